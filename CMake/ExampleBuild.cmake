@@ -232,6 +232,10 @@ FUNCTION(BUILD_WIN32_EXAMPLE EXAMPLE_NAME EXAMPLE_SOURCE_FILES EXAMPLE_HEADER_FI
 	BUILD_APP_GENERIC("${EXAMPLE_NAME}" "${EXAMPLE_SOURCE_FILES}" "${EXAMPLE_HEADER_FILES}" "${EXAMPLE_INSTALL_FILES}" "${EXAMPLE_INSTALL_DIRS}" TRUE "example/${EXAMPLE_NAME}" "" "" "" IRRIMGUI_INSTALL_EXAMPLE_SOURCE)
 ENDFUNCTION()
 
+FUNCTION(BUILD_BENCHMARK BENCHMARK_NAME BENCHMARK_SOURCE_FILES BENCHMARK_HEADER_FILES BENCHMARK_INSTALL_FILES BENCHMARK_INSTALL_DIRS)
+	BUILD_APP_GENERIC("${BENCHMARK_NAME}" "${BENCHMARK_SOURCE_FILES}" "${BENCHMARK_HEADER_FILES}" "${BENCHMARK_INSTALL_FILES}" "${BENCHMARK_INSTALL_DIRS}" FALSE "benchmarks/${BENCHMARK_NAME}" "" "" "" IRRIMGUI_INSTALL_EXAMPLE_SOURCE)
+ENDFUNCTION()
+
 FUNCTION(BUILD_TOOL TOOL_NAME TOOL_SOURCE_FILES TOOL_HEADER_FILES TOOL_INSTALL_FILES TOOL_INSTALL_DIRS)
 	BUILD_APP_GENERIC("${TOOL_NAME}" "${TOOL_SOURCE_FILES}" "${TOOL_HEADER_FILES}" "${TOOL_INSTALL_FILES}" "${TOOL_INSTALL_DIRS}" FALSE "tools/${TOOL_NAME}" "" "" "" IRRIMGUI_INSTALL_EXAMPLE_SOURCE)
 ENDFUNCTION()
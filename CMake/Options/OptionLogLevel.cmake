@@ -0,0 +1,33 @@
+#
+# The MIT License (MIT)
+#
+# Copyright (c) 2015 Andr Netzeband
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+SET (IRRIMGUI_LOG_LEVEL "DEFAULT" CACHE STRING "Removes the log messages below this level at compile time: DEFAULT (NOTE for debug builds, otherwise ERROR), NOTE, WARNING, ERROR or NONE.")
+SET_PROPERTY(CACHE IRRIMGUI_LOG_LEVEL PROPERTY STRINGS DEFAULT NOTE WARNING ERROR NONE)
+
+if (NOT IRRIMGUI_LOG_LEVEL STREQUAL "DEFAULT")
+	message(STATUS "Remove all log messages below level ${IRRIMGUI_LOG_LEVEL}...")
+	ADD_DEFINITIONS(	
+	-DDEBUG_LEVEL=DEBUG_LEVEL_${IRRIMGUI_LOG_LEVEL}
+	)
+endif ()
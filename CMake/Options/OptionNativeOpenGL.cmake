@@ -22,10 +22,10 @@
 # SOFTWARE.
 #
 
-SET (IRRIMGUI_NATIVE_OPENGL OFF CACHE BOOL "Enables the native OpenGL Driver for IMGUI (ATTENTION: This is just a fallback solution!).")
+SET (IRRIMGUI_NATIVE_OPENGL OFF CACHE BOOL "Enables the native OpenGL Driver for IMGUI, that is used when the OpenGL context does not support OpenGL 3.3 (ATTENTION: This is just a fallback solution!).")
 
 if (IRRIMGUI_NATIVE_OPENGL)
-	message(WARNING "Use native OpenGL render driver (Fallback solution, do not use it for productive work!)...")
+	message(WARNING "Add native OpenGL render driver for old OpenGL contexts (Fallback solution, do not use it for productive work!)...")
 	ADD_DEFINITIONS(	
 	-D_IRRIMGUI_NATIVE_OPENGL_
 	)
@@ -52,9 +52,12 @@ message(STATUS " -> Options set:")
 message(STATUS "    * Build static lib:             ${IRRIMGUI_STATIC_LIBRARY}")
 message(STATUS "    * Install media files:          ${IRRIMGUI_INSTALL_MEDIA_FILES}")
 message(STATUS "    * Build examples:               ${IRRIMGUI_BUILD_EXAMPLES}")
+message(STATUS "    * Build benchmarks:             ${IRRIMGUI_BUILD_BENCHMARKS}")
 message(STATUS "    * Direct Irrlicht Includes:     ${IRRIMGUI_IRRLICHT_DIRECT_INCLUDES}")
 message(STATUS "    * Use native OpenGL function:   ${IRRIMGUI_NATIVE_OPENGL}")
 message(STATUS "    * Fast OpenGL texture creation: ${IRRIMGUI_FAST_OPENGL_TEXTURE_CREATION}")
+message(STATUS "    * Memory instrumentation:       ${IRRIMGUI_MEMORY_INSTRUMENTATION}")
+message(STATUS "    * Log level:                    ${IRRIMGUI_LOG_LEVEL}")
 message(STATUS " ")
 message(STATUS " -> Compiler settings:")
 message(STATUS "    * GCC like compiler:            ${GCC_LIKE_COMPILER}")
@@ -35,9 +35,18 @@ SET (IRRIMGUI_PUBLIC_HEADER_FILES
 	includes/IrrIMGUI/UnitTest/MockHelper.h
 	includes/IrrIMGUI/UnitTest/UnitTest.h
 	includes/IrrIMGUI/CCharFifo.h
+	includes/IrrIMGUI/CIMGUIEventPlayer.h
 	includes/IrrIMGUI/CIMGUIEventReceiver.h
+	includes/IrrIMGUI/CIMGUIEventRecorder.h
+	includes/IrrIMGUI/CIMGUIDrawDataReader.h
+	includes/IrrIMGUI/CIMGUIDrawDataWriter.h
 	includes/IrrIMGUI/CIMGUIEventStorage.h
+	includes/IrrIMGUI/CIMGUIFrameProfiler.h
+	includes/IrrIMGUI/CIMGUIFrameTimer.h
+	includes/IrrIMGUI/CIntrusiveReferenceCounter.h
 	includes/IrrIMGUI/IGUITexture.h
+	includes/IrrIMGUI/IIMGUIClock.h
+	includes/IrrIMGUI/IIMGUIFrameScheduler.h
 	includes/IrrIMGUI/IIMGUIHandle.h
 	includes/IrrIMGUI/IMGUIHelper.h
 	includes/IrrIMGUI/IncludeIMGUI.h
@@ -47,29 +56,68 @@ SET (IRRIMGUI_PUBLIC_HEADER_FILES
 	includes/IrrIMGUI/IrrIMGUIConfig.h
 	includes/IrrIMGUI/IrrIMGUIConstants.h
 	includes/IrrIMGUI/IrrIMGUIDebug.h
+	includes/IrrIMGUI/IrrIMGUITrace.h
 	includes/IrrIMGUI/SIMGUISettings.h
 	includes/IrrIMGUI/imgui_irrlicht.h
 )
 
 SET (IRRIMGUI_PRIVATE_HEADER_FILES
+	source/private/CAllocationTracker.h
+	source/private/CAtomicFileWriter.h
+	source/private/CAsyncLogWriter.h
+	source/private/CDynamicGlyphCache.h
+	source/private/CFontAtlasCache.h
+	source/private/CFontDataStore.h
+	source/private/CFrameAllocator.h
+	source/private/CGPUFrameTimer.h
 	source/private/CGUITexture.h
+	source/private/CGUITextureTable.h
+	source/private/CIMGUIBackendRegistry.h
+	source/private/CProgramBinaryCache.h
+	source/private/CTraceWriter.h
+	source/private/CWorkStealingPool.h
 	source/private/IrrIMGUIDebug_priv.h
+	source/private/IrrIMGUIDrawData_priv.h
 	source/private/IrrIMGUIInject_priv.h
+	source/private/IrrIMGUITrace_priv.h
+	source/CIMGUIFrameScheduler.h
 	source/CIMGUIHandle.h
 	source/CIrrlichtIMGUIDriver.h
 	source/COpenGLIMGUIDriver.h
+	source/CNullIMGUIDriver.h
 	source/IIMGUIDriver.h
 )
 
 SET (IRRIMGUI_SOURCE_FILES
+	source/CAllocationTracker.cpp
+	source/CAsyncLogWriter.cpp
+	source/CAtomicFileWriter.cpp
 	source/CBasicMemoryLeakDetection.cpp
 	source/CChannelBuffer.cpp
 	source/CCharFifo.cpp
+	source/CDynamicGlyphCache.cpp
+	source/CFontAtlasCache.cpp
+	source/CFontDataStore.cpp
+	source/CFrameAllocator.cpp
+	source/CGPUFrameTimer.cpp
 	source/CGUITexture.cpp
+	source/CGUITextureTable.cpp
+	source/CIMGUIBackendRegistry.cpp
+	source/CIMGUIDrawDataReader.cpp
+	source/CIMGUIDrawDataWriter.cpp
+	source/CIMGUIEventPlayer.cpp
 	source/CIMGUIEventReceiver.cpp
+	source/CIMGUIEventRecorder.cpp
+	source/CIMGUIFrameProfiler.cpp
+	source/CIMGUIFrameScheduler.cpp
+	source/CIMGUIFrameTimer.cpp
 	source/CIMGUIHandle.cpp
 	source/CIrrlichtIMGUIDriver.cpp
 	source/COpenGLIMGUIDriver.cpp
+	source/CNullIMGUIDriver.cpp
+	source/CProgramBinaryCache.cpp
+	source/CTraceWriter.cpp
+	source/CWorkStealingPool.cpp
 	source/IIMGUIDriver.cpp
 	source/IMGUIHelper.cpp
 	source/IReferenceCounter.cpp
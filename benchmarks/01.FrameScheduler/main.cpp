@@ -0,0 +1,177 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark measures how the frame building of many independent GUI panels scales with the number of threads.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// draws the synthetic content of a single panel
+static void drawPanel(int const PanelNumber, int const NumberOfWidgets)
+{
+  static float Values[64] = { 0.0f };
+
+  ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiSetCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(400.0f, 600.0f), ImGuiSetCond_FirstUseEver);
+  ImGui::Begin("Panel", NULL, ImGuiWindowFlags_ShowBorders);
+  ImGui::Text("Panel %d", PanelNumber);
+
+  for (int i = 0; i < NumberOfWidgets; i++)
+  {
+    ImGui::PushID(i);
+    switch (i % 4)
+    {
+      case 0: ImGui::Text("Value %d: %.3f", i, static_cast<float>(i) * 0.5f); break;
+      case 1: ImGui::Button("Button");                                      break;
+      case 2: ImGui::ProgressBar(static_cast<float>(i % 100) / 100.0f);     break;
+      case 3: ImGui::PlotLines("Plot", Values, 64);                         break;
+    }
+    ImGui::PopID();
+  }
+
+  ImGui::End();
+  return;
+}
+
+// measures the frame building time for a number of threads
+static double measureFrameTime(std::vector<IrrIMGUI::IIMGUIHandle *> const &rGUIs, unsigned int const NumberOfThreads, int const NumberOfWidgets, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+
+  IIMGUIFrameScheduler * const pScheduler = createIMGUIFrameScheduler(NumberOfThreads);
+
+  for (size_t i = 0; i < rGUIs.size(); i++)
+  {
+    int const PanelNumber = static_cast<int>(i);
+    pScheduler->addGUI(rGUIs[i], [PanelNumber, NumberOfWidgets](IIMGUIHandle * pGUI) { drawPanel(PanelNumber, NumberOfWidgets); });
+  }
+
+  // warm up: windows and draw lists are created during the first frames
+  for (int i = 0; i < 5; i++)
+  {
+    pScheduler->buildFrames();
+  }
+
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NumberOfFrames; i++)
+  {
+    pScheduler->buildFrames();
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  pScheduler->drop();
+
+  return std::chrono::duration<double, std::milli>(End - Start).count() / static_cast<double>(NumberOfFrames);
+}
+
+// runs the benchmark
+void runBenchmark(int const NumberOfPanels, int const NumberOfWidgets, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+  using namespace irr;
+
+  // the null driver is enough, the frame building does not use the graphic API
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  std::vector<IIMGUIHandle *> GUIs;
+  for (int i = 0; i < NumberOfPanels; i++)
+  {
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+    ImGui::GetIO().IniFilename = NULL;
+    GUIs.push_back(pGUI);
+  }
+
+  std::cout << "Frame building of " << NumberOfPanels << " panels with " << NumberOfWidgets << " widgets each (" << NumberOfFrames << " frames, "
+            << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+  std::cout << " Threads | ms/frame | Speedup | Efficiency" << std::endl;
+
+  double BaseTime = 0.0;
+  unsigned int const ThreadCounts[] = {1, 2, 4, 8, 16};
+  for (unsigned int const NumberOfThreads : ThreadCounts)
+  {
+    double const FrameTime = measureFrameTime(GUIs, NumberOfThreads, NumberOfWidgets, NumberOfFrames);
+    if (NumberOfThreads == 1)
+    {
+      BaseTime = FrameTime;
+    }
+
+    double const Speedup = BaseTime / FrameTime;
+    std::cout << std::fixed << std::setprecision(3)
+              << " " << std::setw(7) << NumberOfThreads
+              << " | " << std::setw(8) << FrameTime
+              << " | " << std::setw(7) << Speedup
+              << " | " << std::setw(9) << std::setprecision(1) << (100.0 * Speedup / NumberOfThreads) << "%" << std::endl;
+  }
+
+  for (IIMGUIHandle * const pGUI : GUIs)
+  {
+    pGUI->drop();
+  }
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [panels] [widgets per panel] [frames]
+ */
+int main(int argc, char * argv[])
+{
+  int const NumberOfPanels  = (argc > 1) ? std::atoi(argv[1]) : 64;
+  int const NumberOfWidgets = (argc > 2) ? std::atoi(argv[2]) : 200;
+  int const NumberOfFrames  = (argc > 3) ? std::atoi(argv[3]) : 100;
+
+  try
+  {
+    runBenchmark(NumberOfPanels, NumberOfWidgets, NumberOfFrames);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,388 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark renders synthetic GUI workloads headless and reports the frame time, allocations and draw statistics.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IrrIMGUI/Tools/CBasicMemoryLeakDetection.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// the result of a single workload
+struct SResult
+{
+  std::string  mName;
+  double       mMillisecondsPerFrame;
+  IrrIMGUI::SIMGUIFrameProfile mProfile;
+  double       mHeapAllocationsPerFrame;  // all allocations of the process, only measured with memory instrumentation
+  size_t       mHeapPeakBytes;
+};
+
+// N windows with M mixed widgets each
+static void drawWindows(std::vector<IrrIMGUI::IGUITexture *> const &rTextures)
+{
+  static float Value    = 0.5f;
+  static bool  IsActive = true;
+  int const NumberOfWindows = 32;
+  int const NumberOfWidgets = 40;
+
+  for (int Window = 0; Window < NumberOfWindows; Window++)
+  {
+    char Name[32];
+    std::snprintf(Name, sizeof(Name), "Window %d", Window);
+
+    ImGui::SetNextWindowPos(ImVec2(static_cast<float>((Window % 8) * 125), static_cast<float>((Window / 8) * 200)), ImGuiSetCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(125.0f, 200.0f), ImGuiSetCond_Always);
+    ImGui::Begin(Name, NULL, ImGuiWindowFlags_ShowBorders);
+
+    for (int i = 0; i < NumberOfWidgets; i++)
+    {
+      ImGui::PushID(i);
+      switch (i % 5)
+      {
+        case 0: ImGui::Text("Value %d: %.3f", i, Value);    break;
+        case 1: ImGui::Button("Button");                    break;
+        case 2: ImGui::SliderFloat("Slider", &Value, 0.0f, 1.0f); break;
+        case 3: ImGui::Checkbox("Active", &IsActive);       break;
+        case 4: ImGui::ProgressBar(Value);                  break;
+      }
+      ImGui::PopID();
+    }
+
+    ImGui::End();
+  }
+
+  return;
+}
+
+// a single window with a long text log
+static void drawTextLog(std::vector<IrrIMGUI::IGUITexture *> const &rTextures)
+{
+  int const NumberOfLines = 2000;
+
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiSetCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(1024.0f, 800.0f), ImGuiSetCond_Always);
+  ImGui::Begin("Log", NULL, ImGuiWindowFlags_ShowBorders);
+
+  for (int i = 0; i < NumberOfLines; i++)
+  {
+    ImGui::Text("[%05d] Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor (value=%d)", i, i * 7);
+  }
+
+  ImGui::End();
+  return;
+}
+
+// a grid of images with alternating textures
+static void drawImageGrid(std::vector<IrrIMGUI::IGUITexture *> const &rTextures)
+{
+  int const Columns = 32;
+  int const Rows    = 24;
+
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiSetCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(1024.0f, 800.0f), ImGuiSetCond_Always);
+  ImGui::Begin("Images", NULL, ImGuiWindowFlags_ShowBorders);
+
+  for (int Row = 0; Row < Rows; Row++)
+  {
+    for (int Column = 0; Column < Columns; Column++)
+    {
+      if (Column > 0)
+      {
+        ImGui::SameLine();
+      }
+      ImGui::Image(*rTextures[(Row + Column) % rTextures.size()], ImVec2(24.0f, 24.0f));
+    }
+  }
+
+  ImGui::End();
+  return;
+}
+
+// line and histogram plots with many values
+static void drawPlots(std::vector<IrrIMGUI::IGUITexture *> const &rTextures)
+{
+  int const NumberOfPlots  = 16;
+  int const NumberOfValues = 256;
+  static std::vector<float> Values;
+
+  if (Values.empty())
+  {
+    for (int i = 0; i < NumberOfValues; i++)
+    {
+      Values.push_back(static_cast<float>((i * 37) % 101) / 100.0f);
+    }
+  }
+
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiSetCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(1024.0f, 800.0f), ImGuiSetCond_Always);
+  ImGui::Begin("Plots", NULL, ImGuiWindowFlags_ShowBorders);
+
+  for (int i = 0; i < NumberOfPlots; i++)
+  {
+    ImGui::PushID(i);
+    if (i % 2 == 0)
+    {
+      ImGui::PlotLines("Lines", Values.data(), NumberOfValues, 0, NULL, 0.0f, 1.0f, ImVec2(0.0f, 40.0f));
+    }
+    else
+    {
+      ImGui::PlotHistogram("Histogram", Values.data(), NumberOfValues, 0, NULL, 0.0f, 1.0f, ImVec2(0.0f, 40.0f));
+    }
+    ImGui::PopID();
+  }
+
+  ImGui::End();
+  return;
+}
+
+// draws a tree node and all its children opened
+static void drawTreeNode(int const Depth, int const Branches)
+{
+  for (int i = 0; i < Branches; i++)
+  {
+    ImGui::SetNextTreeNodeOpen(true, ImGuiSetCond_Always);
+    if (ImGui::TreeNode(reinterpret_cast<void *>(static_cast<intptr_t>(i)), "Node %d (depth %d)", i, Depth))
+    {
+      if (Depth > 0)
+      {
+        drawTreeNode(Depth - 1, Branches);
+      }
+      else
+      {
+        ImGui::BulletText("Leaf");
+      }
+      ImGui::TreePop();
+    }
+  }
+
+  return;
+}
+
+// a deep tree with all nodes opened
+static void drawDeepTree(std::vector<IrrIMGUI::IGUITexture *> const &rTextures)
+{
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiSetCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(1024.0f, 800.0f), ImGuiSetCond_Always);
+  ImGui::Begin("Tree", NULL, ImGuiWindowFlags_ShowBorders);
+  drawTreeNode(6, 3);
+  ImGui::End();
+  return;
+}
+
+// measures a single workload
+static SResult measureWorkload(irr::IrrlichtDevice * const pDevice, char const * const pName, void (*pDrawFunction)(std::vector<IrrIMGUI::IGUITexture *> const &), int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+  using namespace irr;
+
+  SIMGUISettings Settings;
+  Settings.mIsProfilerEnabled   = true;
+  Settings.mProfilerHistorySize = static_cast<unsigned int>(NumberOfFrames);
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  FASSERT(pGUI);
+  ImGui::GetIO().IniFilename = NULL;
+
+  std::vector<IGUITexture *> Textures;
+  for (int i = 0; i < 4; i++)
+  {
+    video::IImage * const pImage = pDevice->getVideoDriver()->createImage(video::ECF_A8R8G8B8, core::dimension2d<u32>(64, 64));
+    FASSERT(pImage);
+    Textures.push_back(pGUI->createTexture(pImage));
+    pImage->drop();
+  }
+
+  // warm up: windows, draw lists and tree states are created during the first frames
+  for (int i = 0; i < 5; i++)
+  {
+    pGUI->startGUI();
+    pDrawFunction(Textures);
+    pGUI->drawAll();
+  }
+  pGUI->getProfiler()->clear();
+
+  IrrIMGUI::Tools::CBasicMemoryLeakDetection HeapMeasurement;
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NumberOfFrames; i++)
+  {
+    pGUI->startGUI();
+    pDrawFunction(Textures);
+    pGUI->drawAll();
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+  size_t const HeapAllocations = HeapMeasurement.getNumberOfAllocations();
+  size_t const HeapPeakBytes   = HeapMeasurement.getPeakBytes();
+  HeapMeasurement.compareMemoryState();
+
+  SResult Result;
+  Result.mName                 = pName;
+  Result.mMillisecondsPerFrame = std::chrono::duration<double, std::milli>(End - Start).count() / static_cast<double>(NumberOfFrames);
+  Result.mProfile              = pGUI->getProfiler()->getAverage();
+  Result.mHeapAllocationsPerFrame = static_cast<double>(HeapAllocations) / static_cast<double>(NumberOfFrames);
+  Result.mHeapPeakBytes           = HeapPeakBytes;
+
+  for (IGUITexture * const pTexture : Textures)
+  {
+    pGUI->deleteTexture(pTexture);
+  }
+  pGUI->drop();
+
+  return Result;
+}
+
+// writes the results as JSON file
+static void writeJSON(char const * const pFileName, std::vector<SResult> const &rResults, int const NumberOfFrames)
+{
+  std::ofstream File(pFileName);
+  FASSERT(File.is_open());
+
+  File << std::fixed << std::setprecision(4);
+  File << "{\n";
+  File << "  \"benchmark\": \"02.Workloads\",\n";
+  File << "  \"frames\": " << NumberOfFrames << ",\n";
+  File << "  \"results\": [\n";
+
+  for (size_t i = 0; i < rResults.size(); i++)
+  {
+    SResult const &rResult = rResults[i];
+    File << "    {"
+         << "\"name\": \"" << rResult.mName << "\", "
+         << "\"msPerFrame\": " << rResult.mMillisecondsPerFrame << ", "
+         << "\"allocationsPerFrame\": " << rResult.mProfile.mAllocations << ", "
+         << "\"allocatedBytesPerFrame\": " << rResult.mProfile.mAllocatedBytes << ", "
+         << "\"peakBytes\": " << rResult.mProfile.mPeakBytes << ", ";
+
+    if (IrrIMGUI::Tools::CBasicMemoryLeakDetection::isInstrumented())
+    {
+      File << "\"heapAllocationsPerFrame\": " << rResult.mHeapAllocationsPerFrame << ", "
+           << "\"heapPeakBytes\": " << rResult.mHeapPeakBytes << ", ";
+    }
+
+    File << "\"verticesPerFrame\": " << rResult.mProfile.mVertices << ", "
+         << "\"indicesPerFrame\": " << rResult.mProfile.mIndices << ", "
+         << "\"drawCallsPerFrame\": " << rResult.mProfile.mDrawCalls << ", "
+         << "\"textureBindsPerFrame\": " << rResult.mProfile.mTextureBinds
+         << "}" << ((i + 1 < rResults.size()) ? "," : "") << "\n";
+  }
+
+  File << "  ]\n";
+  File << "}\n";
+  return;
+}
+
+// runs the benchmark
+void runBenchmark(int const NumberOfFrames, char const * const pJSONFileName)
+{
+  using namespace irr;
+
+  // the null driver measures the GUI code and the draw data without a graphic API
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  std::vector<SResult> Results;
+  Results.push_back(measureWorkload(pDevice, "Windows",   drawWindows,   NumberOfFrames));
+  Results.push_back(measureWorkload(pDevice, "TextLog",   drawTextLog,   NumberOfFrames));
+  Results.push_back(measureWorkload(pDevice, "ImageGrid", drawImageGrid, NumberOfFrames));
+  Results.push_back(measureWorkload(pDevice, "Plots",     drawPlots,     NumberOfFrames));
+  Results.push_back(measureWorkload(pDevice, "DeepTree",  drawDeepTree,  NumberOfFrames));
+
+  pDevice->drop();
+
+  std::cout << "Headless GUI workloads (" << NumberOfFrames << " frames each)" << std::endl;
+  std::cout << " Workload  | ms/frame | allocs/frame | vertices | indices | draw calls | texture binds" << std::endl;
+  for (SResult const &rResult : Results)
+  {
+    std::cout << std::fixed << std::setprecision(3)
+              << " " << std::left << std::setw(9) << rResult.mName << std::right
+              << " | " << std::setw(8) << rResult.mMillisecondsPerFrame
+              << " | " << std::setw(12) << rResult.mProfile.mAllocations
+              << " | " << std::setw(8) << rResult.mProfile.mVertices
+              << " | " << std::setw(7) << rResult.mProfile.mIndices
+              << " | " << std::setw(10) << rResult.mProfile.mDrawCalls
+              << " | " << std::setw(13) << rResult.mProfile.mTextureBinds << std::endl;
+  }
+
+  if (IrrIMGUI::Tools::CBasicMemoryLeakDetection::isInstrumented())
+  {
+    std::cout << std::endl << " Workload  | heap allocs/frame | heap peak [bytes]" << std::endl;
+    for (SResult const &rResult : Results)
+    {
+      std::cout << " " << std::left << std::setw(9) << rResult.mName << std::right
+                << " | " << std::setw(17) << rResult.mHeapAllocationsPerFrame
+                << " | " << std::setw(17) << rResult.mHeapPeakBytes << std::endl;
+    }
+  }
+
+  if (pJSONFileName)
+  {
+    writeJSON(pJSONFileName, Results, NumberOfFrames);
+    std::cout << "Results written to " << pJSONFileName << std::endl;
+  }
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [frames] [JSON output file]
+ */
+int main(int argc, char * argv[])
+{
+  int          const NumberOfFrames = (argc > 1) ? std::atoi(argv[1]) : 200;
+  char const * const pJSONFileName  = (argc > 2) ? argv[2] : NULL;
+
+  try
+  {
+    FASSERT(NumberOfFrames > 0);
+    runBenchmark(NumberOfFrames, pJSONFileName);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
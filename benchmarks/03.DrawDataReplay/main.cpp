@@ -0,0 +1,172 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This tool replays captured draw data at maximum speed to measure the render function of a backend.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// the file, that is captured when no capture file is passed
+static char const * const DefaultCaptureFile = "DrawDataReplay.imdd";
+
+// captures a synthetic session with the IMGUI test window
+static void captureSession(irr::IrrlichtDevice * const pDevice, char const * const pFileName, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+
+  CIMGUIDrawDataWriter Writer;
+  FASSERT(Writer.open(pFileName));
+
+  SIMGUISettings Settings;
+  Settings.mpDrawDataWriter = &Writer;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = NULL;
+
+  for (int i = 0; i < NumberOfFrames; i++)
+  {
+    pGUI->startGUI();
+    ImGui::SetNextWindowPos(ImVec2(static_cast<float>(i % 200), 20.0f));
+    ImGui::ShowTestWindow();
+    ImGui::ShowMetricsWindow();
+    pGUI->drawAll();
+  }
+
+  pGUI->drop();
+
+  std::cout << "Captured " << Writer.getNumberOfFrames() << " frames (" << Writer.getNumberOfBytes() << " bytes) into " << pFileName << std::endl;
+  return;
+}
+
+// replays a capture file several times
+void runReplay(irr::video::E_DRIVER_TYPE const DriverType, char const * pFileName, int const NumberOfRepeats)
+{
+  using namespace IrrIMGUI;
+  using namespace irr;
+
+  IrrlichtDevice * const pDevice = createDevice(DriverType, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+  video::IVideoDriver * const pDriver = pDevice->getVideoDriver();
+
+  if (pFileName == NULL)
+  {
+    pFileName = DefaultCaptureFile;
+    captureSession(pDevice, pFileName, 300);
+  }
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  ImGuiIO &rGUIIO = ImGui::GetIO();
+  rGUIIO.IniFilename = NULL;
+
+  {
+    CIMGUIDrawDataReader Reader;
+    FASSERT(Reader.open(pFileName));
+    Reader.setTextures(rGUIIO.Fonts->TexID, NULL);
+
+    unsigned long long NumberOfFrames   = 0;
+    unsigned long long NumberOfVertices = 0;
+    std::chrono::steady_clock::duration RenderTime(0);
+
+    for (int Repeat = 0; Repeat < NumberOfRepeats; Repeat++)
+    {
+      FASSERT(Reader.rewind());
+
+      while (ImDrawData * const pDrawData = Reader.readFrame())
+      {
+        rGUIIO.DisplaySize = Reader.getDisplaySize();
+
+        pDriver->beginScene(true, true, video::SColor(255, 100, 101, 140));
+
+        // only the render function of the backend is measured, not the reading of the file
+        std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+        if (pDrawData->CmdListsCount > 0)
+        {
+          rGUIIO.RenderDrawListsFn(pDrawData);
+        }
+        RenderTime += std::chrono::steady_clock::now() - Start;
+
+        pDriver->endScene();
+
+        NumberOfFrames++;
+        NumberOfVertices += static_cast<unsigned long long>(pDrawData->TotalVtxCount);
+      }
+    }
+
+    FASSERT(NumberOfFrames > 0);
+
+    double const Milliseconds = std::chrono::duration<double, std::milli>(RenderTime).count();
+    std::cout << std::fixed << std::setprecision(4)
+              << "Replayed " << NumberOfFrames << " frames of " << pFileName << ((DriverType == video::EDT_OPENGL) ? " with OpenGL" : " with the null driver") << std::endl
+              << "  render ms/frame: " << (Milliseconds / static_cast<double>(NumberOfFrames)) << std::endl
+              << "  vertices/frame:  " << (NumberOfVertices / NumberOfFrames) << std::endl;
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: replay [capture file] [repeats] [opengl]
+ * @details When no capture file is passed, a synthetic session is captured first.
+ */
+int main(int argc, char * argv[])
+{
+  char const * const pFileName       = ((argc > 1) && (std::string(argv[1]) != "-")) ? argv[1] : NULL;
+  int          const NumberOfRepeats = (argc > 2) ? std::atoi(argv[2]) : 10;
+  bool         const IsOpenGL        = (argc > 3) && (std::string(argv[3]) == "opengl");
+
+  try
+  {
+    FASSERT(NumberOfRepeats > 0);
+    runReplay(IsOpenGL ? irr::video::EDT_OPENGL : irr::video::EDT_NULL, pFileName, NumberOfRepeats);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
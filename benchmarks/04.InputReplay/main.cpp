@@ -0,0 +1,236 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark replays recorded input with a fixed-step clock and measures the GUI building from NewFrame to Render.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// the file, that is recorded when no recording file is passed
+static char const * const DefaultRecordingFile = "InputReplay.input";
+
+// the state of the widgets, every replay starts with the same state
+struct SGUIState
+{
+  SGUIState(void)
+  {
+    for (int i = 0; i < NumberOfWidgets; i++)
+    {
+      mIsChecked[i] = false;
+      mValues[i]    = 0.5f;
+    }
+  }
+
+  enum Constants {
+    NumberOfWidgets = 120,
+  };
+
+  bool  mIsChecked[NumberOfWidgets];
+  float mValues[NumberOfWidgets];
+};
+
+// the widget code, that is measured
+static void drawGUI(SGUIState &rState)
+{
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f), ImGuiSetCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(1024.0f, 800.0f), ImGuiSetCond_Always);
+  ImGui::Begin("Input Replay", NULL, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse);
+  ImGui::Columns(4);
+
+  for (int i = 0; i < SGUIState::NumberOfWidgets; i++)
+  {
+    ImGui::PushID(i);
+    ImGui::Checkbox("Enabled", &rState.mIsChecked[i]);
+    ImGui::SliderFloat("Value", &rState.mValues[i], 0.0f, 1.0f);
+    if (ImGui::Button("Reset"))
+    {
+      rState.mValues[i] = 0.5f;
+    }
+    ImGui::NextColumn();
+    ImGui::PopID();
+  }
+
+  ImGui::Columns(1);
+  ImGui::End();
+  return;
+}
+
+// records a synthetic session: the mouse moves over the widgets and clicks on them
+static void recordSession(char const * const pFileName, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+
+  CIMGUIEventRecorder Recorder;
+  FASSERT(Recorder.open(pFileName));
+
+  CIMGUIEventReceiver EventReceiver;
+  EventReceiver.setRecorder(&Recorder);
+
+  irr::SEvent Event;
+  Event.EventType               = irr::EET_MOUSE_INPUT_EVENT;
+  Event.MouseInput.Wheel        = 0.0f;
+  Event.MouseInput.Shift        = false;
+  Event.MouseInput.Control      = false;
+  Event.MouseInput.ButtonStates = 0;
+
+  for (int i = 0; i < NumberOfFrames; i++)
+  {
+    Event.MouseInput.Event = irr::EMIE_MOUSE_MOVED;
+    Event.MouseInput.X     = 20 + (i * 7) % 1000;
+    Event.MouseInput.Y     = 40 + (i * 13) % 740;
+    EventReceiver.OnEvent(Event);
+
+    if (i % 20 == 10)
+    {
+      Event.MouseInput.Event = irr::EMIE_LMOUSE_PRESSED_DOWN;
+      EventReceiver.OnEvent(Event);
+    }
+    else if (i % 20 == 12)
+    {
+      Event.MouseInput.Event = irr::EMIE_LMOUSE_LEFT_UP;
+      EventReceiver.OnEvent(Event);
+    }
+
+    // without a GUI, the frame counter of the storage is advanced directly
+    EventReceiver.mFrameNumber++;
+  }
+
+  std::cout << "Recorded " << Recorder.getNumberOfEvents() << " events of " << NumberOfFrames << " frames into " << pFileName << std::endl;
+  return;
+}
+
+// replays the recording once and returns the average CPU time from NewFrame to Render in milliseconds
+static double replaySession(irr::IrrlichtDevice * const pDevice, IrrIMGUI::CIMGUIEventPlayer &rPlayer)
+{
+  using namespace IrrIMGUI;
+
+  CIMGUIFixedStepClock Clock(16666667);
+  SIMGUISettings Settings;
+  Settings.mpFrameClock         = &Clock;
+  Settings.mIsProfilerEnabled   = true;
+  Settings.mProfilerHistorySize = rPlayer.getNumberOfFrames();
+
+  // every replay starts with a new GUI and widget state
+  SGUIState State;
+  CIMGUIEventReceiver EventReceiver;
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, &EventReceiver, &Settings);
+  ImGui::GetIO().IniFilename = NULL;
+
+  rPlayer.rewind();
+  while (rPlayer.getFrameNumber() < rPlayer.getNumberOfFrames())
+  {
+    rPlayer.playFrame(EventReceiver);
+    pGUI->startGUI();
+    drawGUI(State);
+    pGUI->drawAll();
+  }
+
+  SIMGUIFrameProfile const Average = pGUI->getProfiler()->getAverage();
+  pGUI->drop();
+
+  irr::u64 const Nanoseconds = Average.mStartGUINanoseconds + Average.mWidgetNanoseconds + Average.mRenderNanoseconds;
+  return static_cast<double>(Nanoseconds) / 1e6;
+}
+
+// runs the benchmark
+void runBenchmark(char const * pFileName, int const NumberOfRepeats)
+{
+  using namespace IrrIMGUI;
+  using namespace irr;
+
+  if (pFileName == NULL)
+  {
+    pFileName = DefaultRecordingFile;
+    recordSession(pFileName, 600);
+  }
+
+  CIMGUIEventPlayer Player;
+  FASSERT(Player.open(pFileName));
+  FASSERT(Player.getNumberOfFrames() > 0);
+
+  // the null driver is enough, only the GUI building is measured
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  std::cout << "Replay of " << Player.getNumberOfEvents() << " events in " << Player.getNumberOfFrames() << " frames from " << pFileName << std::endl;
+  std::cout << " Repeat | NewFrame to Render [ms/frame]" << std::endl;
+
+  double Best = 0.0;
+  for (int i = 0; i < NumberOfRepeats; i++)
+  {
+    double const Milliseconds = replaySession(pDevice, Player);
+    if ((i == 0) || (Milliseconds < Best))
+    {
+      Best = Milliseconds;
+    }
+
+    std::cout << std::fixed << std::setprecision(4) << " " << std::setw(6) << (i + 1) << " | " << Milliseconds << std::endl;
+  }
+  std::cout << "   Best | " << Best << std::endl;
+
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [recording file] [repeats]
+ * @details When no recording file is passed (or "-"), a synthetic session is recorded first.
+ */
+int main(int argc, char * argv[])
+{
+  char const * const pFileName       = ((argc > 1) && (std::string(argv[1]) != "-")) ? argv[1] : NULL;
+  int          const NumberOfRepeats = (argc > 2) ? std::atoi(argv[2]) : 5;
+
+  try
+  {
+    FASSERT(NumberOfRepeats > 0);
+    runBenchmark(pFileName, NumberOfRepeats);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark compares the allocator calls and the frame time of GUI workloads with and without the frame allocator.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// a log, that is formatted into a temporary text buffer in every frame
+static void drawTextBuffer(void)
+{
+  ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+  ImGui::SetNextWindowSize(ImVec2(400.0f, 600.0f));
+  ImGui::Begin("Text Buffer");
+
+  ImGuiTextBuffer Buffer;
+  for (int Line = 0; Line < 500; Line++)
+  {
+    Buffer.append("[%04d] value = %f\n", Line, static_cast<float>(Line) * 0.5f);
+  }
+  ImGui::TextUnformatted(Buffer.begin(), Buffer.end());
+
+  ImGui::End();
+  return;
+}
+
+// custom drawing with temporary point vectors
+static void drawTemporaryVectors(void)
+{
+  ImGui::SetNextWindowPos(ImVec2(420.0f, 10.0f));
+  ImGui::SetNextWindowSize(ImVec2(400.0f, 400.0f));
+  ImGui::Begin("Temporary Vectors");
+
+  ImDrawList * const pDrawList = ImGui::GetWindowDrawList();
+  ImVec2 const Origin = ImGui::GetCursorScreenPos();
+
+  for (int Curve = 0; Curve < 50; Curve++)
+  {
+    ImVector<ImVec2> Points;
+    for (int Point = 0; Point < 64; Point++)
+    {
+      Points.push_back(ImVec2(Origin.x + static_cast<float>(Point) * 5.0f, Origin.y + static_cast<float>((Point * Curve) % 300)));
+    }
+    pDrawList->AddPolyline(Points.Data, Points.Size, 0xFFFFFFFF, false, 1.0f, true);
+  }
+
+  ImGui::End();
+  return;
+}
+
+// the demo window, that hardly allocates in a steady state
+static void drawTestWindow(void)
+{
+  ImGui::SetNextWindowPos(ImVec2(10.0f, 620.0f), ImGuiSetCond_FirstUseEver);
+  ImGui::ShowTestWindow();
+  return;
+}
+
+// the result of a workload
+struct SResult
+{
+  double                       mMillisecondsPerFrame;
+  IrrIMGUI::SIMGUIFrameProfile mProfile;
+};
+
+// measures a workload with or without frame allocator
+static SResult measureWorkload(irr::IrrlichtDevice * const pDevice, void (*pDrawFunction)(void), bool const IsFrameAllocatorEnabled, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+
+  SIMGUISettings Settings;
+  Settings.mIsProfilerEnabled       = true;
+  Settings.mProfilerHistorySize     = static_cast<unsigned int>(NumberOfFrames);
+  Settings.mIsFrameAllocatorEnabled = IsFrameAllocatorEnabled;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  FASSERT(pGUI);
+  ImGui::GetIO().IniFilename = NULL;
+
+  // warm up: windows and draw lists are created and the pools are filled during the first frames
+  for (int i = 0; i < 5; i++)
+  {
+    pGUI->startGUI();
+    pDrawFunction();
+    pGUI->drawAll();
+  }
+  pGUI->getProfiler()->clear();
+
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NumberOfFrames; i++)
+  {
+    pGUI->startGUI();
+    pDrawFunction();
+    pGUI->drawAll();
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  SResult Result;
+  Result.mMillisecondsPerFrame = std::chrono::duration<double, std::milli>(End - Start).count() / static_cast<double>(NumberOfFrames);
+  Result.mProfile              = pGUI->getProfiler()->getAverage();
+
+  pGUI->drop();
+  return Result;
+}
+
+// measures a workload in both modes and prints the results
+static void compareWorkload(irr::IrrlichtDevice * const pDevice, char const * const pName, void (*pDrawFunction)(void), int const NumberOfFrames)
+{
+  char const * const pModes[] = {"malloc", "frame"};
+
+  for (int Mode = 0; Mode < 2; Mode++)
+  {
+    SResult const Result = measureWorkload(pDevice, pDrawFunction, Mode == 1, NumberOfFrames);
+
+    std::cout << std::fixed << std::setprecision(3)
+              << " " << std::left << std::setw(11) << pName << " | " << std::setw(6) << pModes[Mode] << std::right
+              << " | " << std::setw(8) << Result.mMillisecondsPerFrame
+              << " | " << std::setw(12) << Result.mProfile.mAllocations
+              << " | " << std::setw(13) << Result.mProfile.mSystemAllocations
+              << " | " << std::setw(10) << Result.mProfile.mPeakBytes << std::endl;
+  }
+
+  return;
+}
+
+// runs the benchmark
+void runBenchmark(int const NumberOfFrames)
+{
+  using namespace irr;
+
+  // the null driver is enough, only the allocations of the GUI building are measured
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  std::cout << "IMGUI allocations with and without frame allocator (" << NumberOfFrames << " frames each)" << std::endl;
+  std::cout << " Workload    | Mode   | ms/frame | allocs/frame | malloc/frame | peak bytes" << std::endl;
+
+  compareWorkload(pDevice, "TextBuffer",  drawTextBuffer,       NumberOfFrames);
+  compareWorkload(pDevice, "TempVectors", drawTemporaryVectors, NumberOfFrames);
+  compareWorkload(pDevice, "TestWindow",  drawTestWindow,       NumberOfFrames);
+
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [frames]
+ */
+int main(int argc, char * argv[])
+{
+  int const NumberOfFrames = (argc > 1) ? std::atoi(argv[1]) : 500;
+
+  try
+  {
+    FASSERT(NumberOfFrames > 0);
+    runBenchmark(NumberOfFrames);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark measures the throughput of grab() and drop() from several threads for the virtual and the inline reference counter.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IrrIMGUI/IReferenceCounter.h>
+#include <IrrIMGUI/CIntrusiveReferenceCounter.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// an object with the inline reference counter
+class CInlineCounted : public IrrIMGUI::CIntrusiveReferenceCounter<CInlineCounted>
+{
+};
+
+// grabs and drops the object in a loop, every thread starts with the other threads
+template <typename TObject>
+static void grabAndDrop(TObject * const pObject, int const NumberOfPairs, std::atomic<int> * const pStartSignal)
+{
+  while (pStartSignal->load() == 0)
+  {
+    std::this_thread::yield();
+  }
+
+  for (int i = 0; i < NumberOfPairs; i++)
+  {
+    pObject->grab();
+    pObject->drop();
+  }
+  return;
+}
+
+// runs the grab and drop loop on several threads and returns the million grab/drop pairs per second of all threads
+template <typename TObject>
+static double measure(std::vector<TObject *> const &rObjects, int const NumberOfThreads, int const NumberOfPairs)
+{
+  std::atomic<int> StartSignal(0);
+  std::vector<std::thread> Threads;
+
+  for (int i = 0; i < NumberOfThreads; i++)
+  {
+    Threads.push_back(std::thread(grabAndDrop<TObject>, rObjects[i % rObjects.size()], NumberOfPairs, &StartSignal));
+  }
+
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  StartSignal = 1;
+  for (std::thread &rThread : Threads)
+  {
+    rThread.join();
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  for (TObject * const pObject : rObjects)
+  {
+    FASSERT(pObject->getReferenceCount() == 1);
+  }
+
+  double const Seconds = std::chrono::duration<double>(End - Start).count();
+  return static_cast<double>(NumberOfThreads) * static_cast<double>(NumberOfPairs) / Seconds / 1e6;
+}
+
+// measures one kind of reference counter with a shared object and with one object per thread
+template <typename TObject>
+static void runCounter(char const * const pName, int const MaxThreads, int const NumberOfPairs)
+{
+  std::vector<TObject *> SharedObject(1, new TObject);
+  std::vector<TObject *> OwnObjects;
+  for (int i = 0; i < MaxThreads; i++)
+  {
+    OwnObjects.push_back(new TObject);
+  }
+
+  for (int Threads = 1; Threads <= MaxThreads; Threads *= 2)
+  {
+    double const Shared = measure(SharedObject, Threads, NumberOfPairs);
+    double const Own    = measure(OwnObjects,   Threads, NumberOfPairs);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << " " << std::left << std::setw(17) << pName << std::right
+              << " | " << std::setw(7) << Threads
+              << " | " << std::setw(24) << Shared
+              << " | " << std::setw(22) << Own << std::endl;
+  }
+
+  SharedObject[0]->drop();
+  for (TObject * const pObject : OwnObjects)
+  {
+    pObject->drop();
+  }
+  return;
+}
+
+// runs the benchmark
+void runBenchmark(int const MaxThreads, int const NumberOfPairs)
+{
+  using namespace IrrIMGUI;
+
+  std::cout << "Grab and drop pairs (" << NumberOfPairs << " per thread)" << std::endl;
+  std::cout << " Counter           | Threads | shared object [Mpairs/s] | own objects [Mpairs/s]" << std::endl;
+
+  runCounter<IReferenceCounter>("IReferenceCounter", MaxThreads, NumberOfPairs);
+  runCounter<CInlineCounted>("Intrusive inline", MaxThreads, NumberOfPairs);
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [max threads] [pairs per thread]
+ */
+int main(int argc, char * argv[])
+{
+  int const HardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+  int const MaxThreads      = (argc > 1) ? std::atoi(argv[1]) : ((HardwareThreads > 0) ? HardwareThreads : 4);
+  int const NumberOfPairs   = (argc > 2) ? std::atoi(argv[2]) : 2000000;
+
+  try
+  {
+    FASSERT(MaxThreads > 0);
+    FASSERT(NumberOfPairs > 0);
+    runBenchmark(MaxThreads, NumberOfPairs);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
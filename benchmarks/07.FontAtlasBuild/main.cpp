@@ -0,0 +1,167 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark measures how long compileFonts() needs to build a font atlas with several fonts on a different number of threads.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// adds the fonts of the benchmark: a CJK font with its huge glyph ranges or, without one, all fonts of the media directory
+static void addFonts(IrrIMGUI::IIMGUIHandle * const pGUI, char const * const pCJKFileName)
+{
+  if (pCJKFileName)
+  {
+    FASSERT(pGUI->addFontFromFileTTF(pCJKFileName, 16.0f, nullptr, pGUI->getGlyphRangesChinese()));
+    FASSERT(pGUI->addFontFromFileTTF(pCJKFileName, 20.0f, nullptr, pGUI->getGlyphRangesJapanese()));
+    FASSERT(pGUI->addFontFromFileTTF(pCJKFileName, 24.0f, nullptr, pGUI->getGlyphRangesChinese()));
+    FASSERT(pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 16.0f, nullptr, pGUI->getGlyphRangesCyrillic()));
+    return;
+  }
+
+  char const * const pFileNames[] =
+  {
+    "../../media/Cousine-Regular.ttf",
+    "../../media/DroidSans.ttf",
+    "../../media/Karla-Regular.ttf",
+    "../../media/MerriweatherSans-Regular.ttf",
+    "../../media/azoft-sans.ttf",
+  };
+
+  ImFontConfig OversampledConfig;
+  OversampledConfig.OversampleH = 3;
+  OversampledConfig.OversampleV = 2;
+
+  for (char const * const pFileName : pFileNames)
+  {
+    FASSERT(pGUI->addFontFromFileTTF(pFileName, 14.0f, &OversampledConfig, pGUI->getGlyphRangesCyrillic()));
+    FASSERT(pGUI->addFontFromFileTTF(pFileName, 24.0f, &OversampledConfig, pGUI->getGlyphRangesCyrillic()));
+    FASSERT(pGUI->addFontFromFileTTF(pFileName, 48.0f, nullptr,            pGUI->getGlyphRangesCyrillic()));
+  }
+
+  return;
+}
+
+// measures the average time of compileFonts() with a given number of font threads
+static double measureBuild(irr::IrrlichtDevice * const pDevice, char const * const pCJKFileName, unsigned int const NumberOfThreads, int const NumberOfBuilds)
+{
+  using namespace IrrIMGUI;
+
+  SIMGUISettings Settings;
+  Settings.mNumberOfFontThreads = NumberOfThreads;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  FASSERT(pGUI);
+  ImGui::GetIO().IniFilename = NULL;
+
+  addFonts(pGUI, pCJKFileName);
+
+  // every call rasterizes all glyphs again, since the atlas is not cached on disk
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NumberOfBuilds; i++)
+  {
+    pGUI->compileFonts();
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  pGUI->drop();
+
+  return std::chrono::duration<double, std::milli>(End - Start).count() / static_cast<double>(NumberOfBuilds);
+}
+
+// runs the benchmark
+void runBenchmark(char const * const pCJKFileName, int const NumberOfBuilds)
+{
+  using namespace irr;
+
+  // the null driver is enough, only the building of the atlas is measured
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  std::cout << "Font atlas build with " << (pCJKFileName ? pCJKFileName : "the media fonts") << " (" << NumberOfBuilds << " builds each, "
+            << std::thread::hardware_concurrency() << " CPU cores)" << std::endl;
+  std::cout << " Threads | ms/build | speedup" << std::endl;
+
+  unsigned int const ThreadSettings[] = {1, 2, 4, 8, 0};
+  double SerialMilliseconds = 0.0;
+
+  for (unsigned int const NumberOfThreads : ThreadSettings)
+  {
+    double const Milliseconds = measureBuild(pDevice, pCJKFileName, NumberOfThreads, NumberOfBuilds);
+    if (NumberOfThreads == 1)
+    {
+      SerialMilliseconds = Milliseconds;
+    }
+
+    std::cout << std::fixed << std::setprecision(3)
+              << " " << std::setw(7) << (NumberOfThreads == 0 ? std::string("all") : std::to_string(NumberOfThreads))
+              << " | " << std::setw(8) << Milliseconds
+              << " | " << std::setw(6) << std::setprecision(2) << (SerialMilliseconds / Milliseconds) << "x" << std::endl;
+  }
+
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [builds] [CJK TTF file]
+ */
+int main(int argc, char * argv[])
+{
+  int          const NumberOfBuilds = (argc > 1) ? std::atoi(argv[1]) : 5;
+  char const * const pCJKFileName   = (argc > 2) ? argv[2] : nullptr;
+
+  try
+  {
+    FASSERT(NumberOfBuilds > 0);
+    runBenchmark(pCJKFileName, NumberOfBuilds);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark compares a bitmap font atlas, that contains a font for every displayed size, with a distance field atlas,
+ *        that contains the font only once and scales it. It measures the size of the atlases and the text fill rate.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// the sizes in pixels, in which the text is displayed
+static float const DisplaySizes[] = {12.0f, 16.0f, 24.0f, 32.0f, 48.0f};
+static int   const NumberOfDisplaySizes = static_cast<int>(sizeof(DisplaySizes) / sizeof(DisplaySizes[0]));
+
+// the text of every frame
+static char const * const pTextLines[] =
+{
+  "The quick brown fox jumps over the lazy dog.",
+  "Sphinx of black quartz, judge my vow! 0123456789",
+  "Pack my box with five dozen liquor jugs (+-*/=%&#@).",
+};
+
+/// @brief The measurements of one atlas.
+struct SAtlasResult
+{
+  int                 mWidth;
+  int                 mHeight;
+  double              mFillPixels[NumberOfDisplaySizes];
+  double              mMicrosecondsPerFrame[NumberOfDisplaySizes];
+};
+
+// returns the area of all text triangles of the last frame; glyph quads have different UVs, while other shapes use the white pixel
+static double getTextPixels(void)
+{
+  ImDrawData const * const pDrawData = ImGui::GetDrawData();
+  FASSERT(pDrawData);
+
+  double Pixels = 0.0;
+  for (int ListIndex = 0; ListIndex < pDrawData->CmdListsCount; ListIndex++)
+  {
+    ImDrawList const * const pList = pDrawData->CmdLists[ListIndex];
+    for (int Index = 0; Index + 2 < pList->IdxBuffer.Size; Index += 3)
+    {
+      ImDrawVert const &rA = pList->VtxBuffer[pList->IdxBuffer[Index]];
+      ImDrawVert const &rB = pList->VtxBuffer[pList->IdxBuffer[Index + 1]];
+      ImDrawVert const &rC = pList->VtxBuffer[pList->IdxBuffer[Index + 2]];
+      if ((rA.uv.x == rB.uv.x) && (rA.uv.x == rC.uv.x) && (rA.uv.y == rB.uv.y) && (rA.uv.y == rC.uv.y))
+      {
+        continue;
+      }
+      Pixels += std::fabs((rB.pos.x - rA.pos.x) * (rC.pos.y - rA.pos.y) - (rC.pos.x - rA.pos.x) * (rB.pos.y - rA.pos.y)) * 0.5;
+    }
+  }
+
+  return Pixels;
+}
+
+// draws the text lines with a font and scale
+static void drawText(ImFont * const pFont, float const Scale)
+{
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::SetNextWindowSize(ImVec2(1024.0f, 800.0f));
+  ImGui::Begin("Text", NULL, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize);
+  ImGui::PushFont(pFont);
+  ImGui::SetWindowFontScale(Scale);
+  for (char const * const pLine : pTextLines)
+  {
+    ImGui::TextUnformatted(pLine);
+  }
+  ImGui::SetWindowFontScale(1.0f);
+  ImGui::PopFont();
+  ImGui::End();
+
+  return;
+}
+
+// builds an atlas and draws the text in every display size; a spread of 0 adds a font for every size, otherwise a single font is scaled
+static SAtlasResult measureAtlas(irr::IrrlichtDevice * const pDevice, char const * const pFileName, unsigned int const Spread, float const BaseSize, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+
+  // only the draw lists are measured, thus the null renderer is enough
+  SIMGUISettings Settings;
+  Settings.mBackend       = EIB_NULL;
+  Settings.mFontSDFSpread = Spread;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  FASSERT(pGUI);
+  ImGui::GetIO().IniFilename = NULL;
+
+  std::vector<ImFont *> Fonts;
+  for (float const Size : DisplaySizes)
+  {
+    if (Spread == 0 || Fonts.empty())
+    {
+      Fonts.push_back(pGUI->addFontFromFileTTF(pFileName, Spread == 0 ? Size : BaseSize));
+      FASSERT(Fonts.back());
+    }
+  }
+  pGUI->compileFonts();
+
+  SAtlasResult Result;
+  Result.mWidth  = ImGui::GetIO().Fonts->TexWidth;
+  Result.mHeight = ImGui::GetIO().Fonts->TexHeight;
+
+  for (int SizeIndex = 0; SizeIndex < NumberOfDisplaySizes; SizeIndex++)
+  {
+    ImFont * const pFont = Fonts[Spread == 0 ? SizeIndex : 0];
+    float    const Scale = DisplaySizes[SizeIndex] / pFont->FontSize;
+
+    // warm up: the window and its draw list are created during the first frames
+    for (int i = 0; i < 3; i++)
+    {
+      pGUI->startGUI();
+      drawText(pFont, Scale);
+      pGUI->drawAll();
+    }
+    Result.mFillPixels[SizeIndex] = getTextPixels();
+
+    std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NumberOfFrames; i++)
+    {
+      pGUI->startGUI();
+      drawText(pFont, Scale);
+      pGUI->drawAll();
+    }
+    std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+    Result.mMicrosecondsPerFrame[SizeIndex] = std::chrono::duration<double, std::micro>(End - Start).count() / static_cast<double>(NumberOfFrames);
+  }
+
+  pGUI->drop();
+
+  return Result;
+}
+
+// prints the size of an atlas; the OpenGL 3 renderer uploads the atlas as RGBA texture
+static void printAtlas(std::string const &rName, SAtlasResult const &rResult)
+{
+  std::string const Size = std::to_string(rResult.mWidth) + "x" + std::to_string(rResult.mHeight);
+  std::cout << " " << std::setw(23) << std::left << rName << std::right
+            << " | " << std::setw(9) << Size
+            << " | " << std::setw(11) << (rResult.mWidth * rResult.mHeight)
+            << " | " << std::setw(13) << (rResult.mWidth * rResult.mHeight * 4) << std::endl;
+
+  return;
+}
+
+// runs the benchmark
+void runBenchmark(char const * const pFileName, unsigned int const Spread, float const BaseSize, int const NumberOfFrames)
+{
+  using namespace irr;
+
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  SAtlasResult const Bitmap        = measureAtlas(pDevice, pFileName, 0, BaseSize, NumberOfFrames);
+  SAtlasResult const DistanceField = measureAtlas(pDevice, pFileName, Spread, BaseSize, NumberOfFrames);
+
+  std::cout << "Font atlas of " << pFileName << " (" << NumberOfFrames << " frames per size)" << std::endl;
+  std::cout << " Atlas                   |      size | alpha bytes | texture bytes" << std::endl;
+  printAtlas(std::to_string(NumberOfDisplaySizes) + " bitmap fonts", Bitmap);
+  printAtlas("SDF " + std::to_string(static_cast<int>(BaseSize)) + " px, spread " + std::to_string(Spread), DistanceField);
+  std::cout << std::endl;
+
+  // the quads of distance field glyphs contain the spread, thus more fragments are shaded (by a more expensive fragment shader)
+  std::cout << " Size | bitmap text px | SDF text px | fill ratio | bitmap us/frame | SDF us/frame" << std::endl;
+  for (int SizeIndex = 0; SizeIndex < NumberOfDisplaySizes; SizeIndex++)
+  {
+    std::cout << std::fixed << std::setprecision(0)
+              << " " << std::setw(4) << DisplaySizes[SizeIndex]
+              << " | " << std::setw(14) << Bitmap.mFillPixels[SizeIndex]
+              << " | " << std::setw(11) << DistanceField.mFillPixels[SizeIndex]
+              << " | " << std::setw(9) << std::setprecision(2) << (DistanceField.mFillPixels[SizeIndex] / Bitmap.mFillPixels[SizeIndex]) << "x"
+              << " | " << std::setw(15) << std::setprecision(1) << Bitmap.mMicrosecondsPerFrame[SizeIndex]
+              << " | " << std::setw(12) << DistanceField.mMicrosecondsPerFrame[SizeIndex] << std::endl;
+  }
+
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [frames] [spread] [SDF font size] [TTF file]
+ */
+int main(int argc, char * argv[])
+{
+  int          const NumberOfFrames = (argc > 1) ? std::atoi(argv[1]) : 200;
+  int          const Spread         = (argc > 2) ? std::atoi(argv[2]) : 4;
+  float        const BaseSize       = (argc > 3) ? static_cast<float>(std::atof(argv[3])) : 32.0f;
+  char const * const pFileName      = (argc > 4) ? argv[4] : "../../media/DroidSans.ttf";
+
+  try
+  {
+    FASSERT(NumberOfFrames > 0);
+    FASSERT(Spread > 0);
+    FASSERT(BaseSize > 0.0f);
+    runBenchmark(pFileName, static_cast<unsigned int>(Spread), BaseSize, NumberOfFrames);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark draws a property grid with thousands of static labels and a few changing values with and without
+ *        the text layout cache and reports the frame time and the hit rate of the cache.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// the names of the properties of every object
+static char const * const pPropertyNames[] =
+{
+  "Transform / Position X", "Transform / Position Y", "Transform / Position Z", "Transform / Rotation",
+  "Transform / Uniform Scale", "Rendering / Is Visible", "Rendering / Material Name", "Rendering / Layer Mask",
+};
+static int const NumberOfPropertyNames = static_cast<int>(sizeof(pPropertyNames) / sizeof(pPropertyNames[0]));
+
+/// @brief The measurements with one cache size.
+struct SResult
+{
+  double       mMicrosecondsPerFrame;
+  unsigned int mTextLayoutHits;
+  unsigned int mTextLayoutMisses;
+};
+
+// draws a property grid in several windows; every 16th value changes in every frame
+static void drawPropertyGrid(int const NumberOfRows, int const Frame)
+{
+  int const NumberOfWindows = 4;
+  int const RowsPerWindow   = NumberOfRows / NumberOfWindows;
+
+  for (int Window = 0; Window < NumberOfWindows; Window++)
+  {
+    char Name[32];
+    std::snprintf(Name, sizeof(Name), "Properties %d", Window);
+    ImGui::SetNextWindowPos(ImVec2(static_cast<float>(Window * 256), 0.0f), ImGuiSetCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(256.0f, 800.0f), ImGuiSetCond_Always);
+    ImGui::Begin(Name, NULL, ImGuiWindowFlags_ShowBorders);
+
+    for (int Row = 0; Row < RowsPerWindow; Row++)
+    {
+      int const Property = Window * RowsPerWindow + Row;
+      ImGui::TextUnformatted(pPropertyNames[Property % NumberOfPropertyNames]);
+      ImGui::SameLine(180.0f);
+      if (Property % 16 == 0)
+      {
+        ImGui::Text("%d", Frame + Property);
+      }
+      else
+      {
+        ImGui::Text("%.3f", static_cast<float>(Property) * 0.125f);
+      }
+    }
+
+    ImGui::End();
+  }
+
+  return;
+}
+
+// measures the frame time with a cache size
+static SResult measureCacheSize(irr::IrrlichtDevice * const pDevice, unsigned int const CacheSize, int const NumberOfRows, int const NumberOfFrames)
+{
+  using namespace IrrIMGUI;
+
+  // only the draw lists are measured, thus the null renderer is enough
+  SIMGUISettings Settings;
+  Settings.mBackend             = EIB_NULL;
+  Settings.mIsProfilerEnabled   = true;
+  Settings.mProfilerHistorySize = static_cast<unsigned int>(NumberOfFrames);
+  Settings.mTextLayoutCacheSize = CacheSize;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  FASSERT(pGUI);
+  ImGui::GetIO().IniFilename = NULL;
+
+  // warm up: the windows are placed and the cache is filled during the first frames
+  for (int i = 0; i < 5; i++)
+  {
+    pGUI->startGUI();
+    drawPropertyGrid(NumberOfRows, i);
+    pGUI->drawAll();
+  }
+  pGUI->getProfiler()->clear();
+
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NumberOfFrames; i++)
+  {
+    pGUI->startGUI();
+    drawPropertyGrid(NumberOfRows, i);
+    pGUI->drawAll();
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  SIMGUIFrameProfile const Average = pGUI->getProfiler()->getAverage();
+
+  SResult Result;
+  Result.mMicrosecondsPerFrame = std::chrono::duration<double, std::micro>(End - Start).count() / static_cast<double>(NumberOfFrames);
+  Result.mTextLayoutHits       = Average.mTextLayoutHits;
+  Result.mTextLayoutMisses     = Average.mTextLayoutMisses;
+
+  pGUI->drop();
+
+  return Result;
+}
+
+// runs the benchmark
+void runBenchmark(int const NumberOfRows, int const NumberOfFrames)
+{
+  using namespace irr;
+
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL, core::dimension2d<u32>(1024, 800));
+  FASSERT(pDevice);
+
+  // every row has a label and a value, the cache of the largest run holds all of them
+  unsigned int const CacheSizes[] = {0, 256, static_cast<unsigned int>(NumberOfRows) * 2 + 64};
+
+  std::cout << "Property grid with " << NumberOfRows << " rows (" << NumberOfFrames << " frames each)" << std::endl;
+  std::cout << " Cache size | us/frame | hits/frame | misses/frame | hit rate" << std::endl;
+  for (unsigned int const CacheSize : CacheSizes)
+  {
+    SResult const Result = measureCacheSize(pDevice, CacheSize, NumberOfRows, NumberOfFrames);
+    unsigned int const Lookups = Result.mTextLayoutHits + Result.mTextLayoutMisses;
+
+    std::cout << std::fixed << std::setprecision(1)
+              << " " << std::setw(10) << CacheSize
+              << " | " << std::setw(8) << Result.mMicrosecondsPerFrame
+              << " | " << std::setw(10) << Result.mTextLayoutHits
+              << " | " << std::setw(12) << Result.mTextLayoutMisses
+              << " | " << std::setw(7) << ((Lookups > 0) ? (100.0 * Result.mTextLayoutHits / Lookups) : 0.0) << "%" << std::endl;
+  }
+
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [frames] [rows]
+ */
+int main(int argc, char * argv[])
+{
+  int const NumberOfFrames = (argc > 1) ? std::atoi(argv[1]) : 200;
+  int const NumberOfRows   = (argc > 2) ? std::atoi(argv[2]) : 4000;
+
+  try
+  {
+    FASSERT(NumberOfFrames > 0);
+    FASSERT(NumberOfRows >= 4);
+    runBenchmark(NumberOfRows, NumberOfFrames);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark formats widget values with the common display formats once with vsnprintf() and once with
+ *        the fast path of ImFormatFloat() and ImFormatInt() and reports the time per value.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+// library includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IMGUI/imgui_internal.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+// the display formats of float values, as they are used by sliders, drags and inputs
+static char const * const pFloatFormats[] =
+{
+  "%.3f", "%.0f", "%.1f", "%.2f m/s", "%.0f deg", "%g", "%f",
+};
+static int const NumberOfFloatFormats = static_cast<int>(sizeof(pFloatFormats) / sizeof(pFloatFormats[0]));
+
+/// @brief The measurements of one format.
+struct SResult
+{
+  double mNanosecondsVsnprintf;
+  double mNanosecondsFast;
+};
+
+// formats the values with a format; the sum of the lengths keeps the compiler from removing the calls
+template <typename TValue, typename TFunction>
+static double measureFormat(char const * const pFormat, TValue const * const pValues, int const NumberOfValues, TFunction Format, unsigned int &rLengthSum)
+{
+  char Buffer[64];
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NumberOfValues; i++)
+  {
+    rLengthSum += static_cast<unsigned int>(Format(Buffer, static_cast<int>(sizeof(Buffer)), pFormat, pValues[i]));
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(End - Start).count() / static_cast<double>(NumberOfValues);
+}
+
+static int formatFloatVsnprintf(char * const pBuffer, int const BufferSize, char const * const pFormat, float const Value)
+{
+  return ImFormatString(pBuffer, BufferSize, pFormat, Value);
+}
+
+static int formatIntVsnprintf(char * const pBuffer, int const BufferSize, char const * const pFormat, int const Value)
+{
+  return ImFormatString(pBuffer, BufferSize, pFormat, Value);
+}
+
+// prints one line of the result table
+static void printResult(char const * const pFormat, SResult const &rResult)
+{
+  std::cout << std::fixed << std::setprecision(1)
+            << " " << std::setw(10) << pFormat
+            << " | " << std::setw(14) << rResult.mNanosecondsVsnprintf
+            << " | " << std::setw(9) << rResult.mNanosecondsFast
+            << " | " << std::setw(6) << (rResult.mNanosecondsVsnprintf / rResult.mNanosecondsFast) << "x" << std::endl;
+  return;
+}
+
+// runs the benchmark
+void runBenchmark(int const NumberOfValues)
+{
+  using namespace irr;
+  using namespace IrrIMGUI;
+
+  // the parsed formats are cached in the IMGUI context
+  IrrlichtDevice * const pDevice = createDevice(video::EDT_NULL);
+  FASSERT(pDevice);
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  FASSERT(pGUI);
+  ImGui::GetIO().IniFilename = NULL;
+
+  // values of typical widget ranges
+  float * const pFloatValues = new float[NumberOfValues];
+  int   * const pIntValues   = new int[NumberOfValues];
+  for (int i = 0; i < NumberOfValues; i++)
+  {
+    pFloatValues[i] = static_cast<float>((i * 7919) % 200001 - 100000) * 0.00731f;
+    pIntValues[i]   = (i * 7919) % 200001 - 100000;
+  }
+
+  unsigned int LengthSum = 0;
+  std::cout << "Formatting " << NumberOfValues << " values per format" << std::endl;
+  std::cout << "     Format | vsnprintf ns/v | fast ns/v | speedup" << std::endl;
+
+  for (int i = 0; i < NumberOfFloatFormats; i++)
+  {
+    SResult Result;
+    Result.mNanosecondsVsnprintf = measureFormat(pFloatFormats[i], pFloatValues, NumberOfValues, formatFloatVsnprintf, LengthSum);
+    Result.mNanosecondsFast      = measureFormat(pFloatFormats[i], pFloatValues, NumberOfValues, ImFormatFloat, LengthSum);
+    printResult(pFloatFormats[i], Result);
+  }
+
+  SResult Result;
+  Result.mNanosecondsVsnprintf = measureFormat("%d", pIntValues, NumberOfValues, formatIntVsnprintf, LengthSum);
+  Result.mNanosecondsFast      = measureFormat("%d", pIntValues, NumberOfValues, ImFormatInt, LengthSum);
+  printResult("%d", Result);
+
+  std::cout << "(" << LengthSum << " characters written)" << std::endl;
+
+  delete[] pFloatValues;
+  delete[] pIntValues;
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [values]
+ */
+int main(int argc, char * argv[])
+{
+  int const NumberOfValues = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+  try
+  {
+    FASSERT(NumberOfValues > 0);
+    runBenchmark(NumberOfValues);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
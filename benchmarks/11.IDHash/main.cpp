@@ -0,0 +1,225 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief This benchmark computes the IDs of typical label sets and the hash of a large buffer once with the byte-wise
+ *        table lookup IMGUI used before and once with ImHash() and reports the time per hash. The IDs of both must be equal.
+ */
+
+// standard library includes
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// library includes
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IMGUI/imgui_internal.h>
+
+// helper macros for reacting on unexpected states
+#define _TOSTR(x) #x
+#define TOSTR(x) _TOSTR(x)
+#define FASSERT(expr) if (!(expr)) { throw IrrIMGUI::Debug::ExAssert(__FILE__ "[" TOSTR(__LINE__) "] Assertion failed: \'" TOSTR(expr) "'\n"); }
+
+/// @brief A set of data to hash: zero terminated labels or buffers with known size.
+struct SHashSet
+{
+  char const *                          mpName;
+  std::vector<std::string>              mLabels;
+  std::vector<std::vector<unsigned char>> mBuffers;
+};
+
+// the CRC32 with a byte-wise table lookup, as it was used by IMGUI before
+static ImU32 hashByteWise(void const * const pData, int DataSize, ImU32 Seed)
+{
+  static ImU32 Table[256];
+  if (Table[1] == 0)
+  {
+    for (ImU32 i = 0; i < 256; i++)
+    {
+      ImU32 CRC = i;
+      for (int j = 0; j < 8; j++)
+      {
+        CRC = (CRC >> 1) ^ ((CRC & 1) ? 0xEDB88320 : 0);
+      }
+      Table[i] = CRC;
+    }
+  }
+
+  Seed = ~Seed;
+  ImU32 CRC = Seed;
+  unsigned char const * pCurrent = static_cast<unsigned char const *>(pData);
+  if (DataSize > 0)
+  {
+    while (DataSize--)
+    {
+      CRC = (CRC >> 8) ^ Table[(CRC & 0xFF) ^ *pCurrent++];
+    }
+  }
+  else
+  {
+    while (unsigned char const Char = *pCurrent++)
+    {
+      if ((Char == '#') && (pCurrent[0] == '#') && (pCurrent[1] == '#'))
+      {
+        CRC = Seed;
+      }
+      CRC = (CRC >> 8) ^ Table[(CRC & 0xFF) ^ Char];
+    }
+  }
+  return ~CRC;
+}
+
+// creates the label sets of typical windows
+static std::vector<SHashSet> createHashSets(void)
+{
+  static char const * const pWords[] = { "Position", "Rotation", "Scale", "Color", "Visible", "Material", "Layer", "Speed" };
+  static char const * const pGroups[] = { "Transform", "Rendering", "Physics", "Audio" };
+
+  std::vector<SHashSet> Sets(5);
+  Sets[0].mpName = "short labels";
+  Sets[1].mpName = "hidden labels";
+  Sets[2].mpName = "property paths";
+  Sets[3].mpName = "label###id";
+  Sets[4].mpName = "PushID(int)";
+
+  char Text[128];
+  for (int i = 0; i < 1024; i++)
+  {
+    char const * const pWord  = pWords[i % 8];
+    char const * const pGroup = pGroups[(i / 8) % 4];
+
+    std::snprintf(Text, sizeof(Text), "%s %d", pWord, i % 10);
+    Sets[0].mLabels.push_back(Text);
+    std::snprintf(Text, sizeof(Text), "##%s%d", pWord, i);
+    Sets[1].mLabels.push_back(Text);
+    std::snprintf(Text, sizeof(Text), "%s / %s / %s %d", pGroup, pWord, pWords[(i + 3) % 8], i);
+    Sets[2].mLabels.push_back(Text);
+    std::snprintf(Text, sizeof(Text), "%s: %d items###%sList%d", pWord, i * 3, pGroup, i);
+    Sets[3].mLabels.push_back(Text);
+
+    unsigned char const * const pInt = reinterpret_cast<unsigned char const *>(&i);
+    Sets[4].mBuffers.push_back(std::vector<unsigned char>(pInt, pInt + sizeof(i)));
+  }
+
+  // a font file, that is hashed for the key of the font atlas cache
+  SHashSet FontData;
+  FontData.mpName = "1 MB buffer";
+  FontData.mBuffers.push_back(std::vector<unsigned char>(1024 * 1024));
+  for (size_t i = 0; i < FontData.mBuffers[0].size(); i++)
+  {
+    FontData.mBuffers[0][i] = static_cast<unsigned char>(i * 2654435761u >> 24);
+  }
+  Sets.push_back(FontData);
+
+  return Sets;
+}
+
+/// @brief The signature of ImHash().
+typedef ImU32 (*THashFunction)(void const *, int, ImU32);
+
+// hashes every entry of the set several times and returns the nanoseconds per hash; the IDs are summed up into rIDSum
+static double measureHashSet(SHashSet const &rSet, int const NumberOfRepeats, THashFunction const pHashFunction, ImU32 &rIDSum)
+{
+  size_t const Entries = rSet.mLabels.size() + rSet.mBuffers.size();
+
+  // both functions are called through a pointer, thus the byte-wise function is not inlined into the loop
+  THashFunction volatile pVolatileHashFunction = pHashFunction;
+  THashFunction const Hash = pVolatileHashFunction;
+
+  std::chrono::steady_clock::time_point const Start = std::chrono::steady_clock::now();
+  for (int Repeat = 0; Repeat < NumberOfRepeats; Repeat++)
+  {
+    // the seed is the ID of the window, like for window->GetID()
+    ImU32 const Seed = 0x5BD1E995u + static_cast<ImU32>(Repeat);
+    for (std::string const &rLabel : rSet.mLabels)
+    {
+      rIDSum += Hash(rLabel.c_str(), 0, Seed);
+    }
+    for (std::vector<unsigned char> const &rBuffer : rSet.mBuffers)
+    {
+      rIDSum += Hash(&rBuffer[0], static_cast<int>(rBuffer.size()), Seed);
+    }
+  }
+  std::chrono::steady_clock::time_point const End = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(End - Start).count() / static_cast<double>(Entries * NumberOfRepeats);
+}
+
+// runs the benchmark
+void runBenchmark(int const NumberOfRepeats)
+{
+  std::vector<SHashSet> const Sets = createHashSets();
+
+  std::cout << "Hashing every label set " << NumberOfRepeats << " times" << std::endl;
+  std::cout << "           Set | byte-wise ns/hash | ImHash ns/hash | speedup" << std::endl;
+  for (SHashSet const &rSet : Sets)
+  {
+    // the large buffer is hashed less often
+    int const Repeats = rSet.mBuffers.empty() || (rSet.mBuffers[0].size() < 1024) ? NumberOfRepeats : (NumberOfRepeats / 100 + 1);
+
+    ImU32 ByteWiseSum = 0;
+    ImU32 ImHashSum   = 0;
+    double const ByteWise = measureHashSet(rSet, Repeats, hashByteWise, ByteWiseSum);
+    double const Fast     = measureHashSet(rSet, Repeats, ImHash, ImHashSum);
+
+    // the IDs must not change
+    FASSERT(ByteWiseSum == ImHashSum);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << " " << std::setw(13) << rSet.mpName
+              << " | " << std::setw(17) << ByteWise
+              << " | " << std::setw(14) << Fast
+              << " | " << std::setw(6) << (ByteWise / Fast) << "x" << std::endl;
+  }
+
+  return;
+}
+
+/**
+ * @brief Main function: benchmark [repeats]
+ */
+int main(int argc, char * argv[])
+{
+  int const NumberOfRepeats = (argc > 1) ? std::atoi(argv[1]) : 1000;
+
+  try
+  {
+    FASSERT(NumberOfRepeats > 0);
+    runBenchmark(NumberOfRepeats);
+  }
+  catch(std::exception &rEx)
+  {
+    std::cout << rEx.what() << std::flush;
+    return 1;
+  }
+  return 0;
+}
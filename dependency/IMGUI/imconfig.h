@@ -47,6 +47,38 @@
 //---- Use 32-bit vertex indices (instead of default: 16-bit) to allow meshes with more than 64K vertices
 //#define ImDrawIdx unsigned int
 
+//---- IrrIMGUI: Use a thread local current context pointer, so that independent contexts can be built on different threads at the same time.
+//---- Every thread starts with the default context. Thread local variables cannot be imported from a windows DLL, thus only applications,
+//---- that use IrrIMGUI as DLL, access the pointer over a function. The initial-exec model keeps the access of the shared library inline,
+//---- instead of calling __tls_get_addr for every use of GImGui.
+#ifndef IMGUI_API
+#define IMGUI_API
+#endif
+struct ImGuiContext;
+IMGUI_API ImGuiContext*& ImGuiGetCurrentContextSlot();
+#if defined(__GNUC__) && !defined(_WIN32)
+#define IMGUI_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+#define IMGUI_TLS_MODEL
+#endif
+#if defined(_IRRIMGUI_WINDOWS_) && !defined(_IRRIMGUI_STATIC_LIB_) && !defined(_IRRIMGUI_EXPORTS_)
+#define GImGui (ImGuiGetCurrentContextSlot())
+#else
+extern thread_local ImGuiContext* GImGuiTLS IMGUI_TLS_MODEL;
+#define GImGui GImGuiTLS
+#endif
+
+//---- IrrIMGUI: Glyphs, that are not part of the built font atlas, are looked up in the dynamic glyph cache of IrrIMGUI before the fallback glyph is used.
+//---- The hook is only called for fonts with ImFont::DynamicGlyphs and returns a pointer to an ImFont::Glyph or NULL.
+struct ImFont;
+IMGUI_API const void* ImGuiFindDynamicGlyph(const ImFont* font, unsigned short c);
+#define IMGUI_FIND_DYNAMIC_GLYPH(font, c) ImGuiFindDynamicGlyph(font, c)
+
+//---- IrrIMGUI: The glyphs of the font atlas are rendered in blocks, that are distributed over the threads of IrrIMGUI. The hook calls task(i, user_data)
+//---- for every i in [0, count) and returns when all calls are done. Without this define the blocks are rendered one after another.
+IMGUI_API void ImGuiParallelFor(int count, void (*task)(int index, void* user_data), void* user_data);
+#define IMGUI_PARALLEL_FOR(count, task, user_data) ImGuiParallelFor(count, task, user_data)
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 //---- e.g. create variants of the ImGui::Value() helper for your low-level math types, or your own widgets/helpers.
 /*
@@ -551,6 +551,9 @@
 #include <stdlib.h>     // NULL, malloc, free, qsort, atoi
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <limits.h>     // INT_MIN, INT_MAX
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>   // __crc32b, __crc32w, __crc32d (IrrIMGUI)
+#endif
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
@@ -663,6 +666,11 @@ static ImFontAtlas      GImDefaultFontAtlas;
 #ifndef GImGui
 static ImGuiContext     GImDefaultContext;
 ImGuiContext*           GImGui = &GImDefaultContext;
+#else
+// IrrIMGUI: thread local context pointer, see imconfig.h
+static ImGuiContext     GImDefaultContext;
+thread_local ImGuiContext* GImGuiTLS IMGUI_TLS_MODEL = &GImDefaultContext;
+ImGuiContext*&          ImGuiGetCurrentContextSlot() { return GImGuiTLS; }
 #endif
 
 //-----------------------------------------------------------------------------
@@ -961,23 +969,304 @@ int ImFormatStringV(char* buf, int buf_size, const char* fmt, va_list args)
     return w;
 }
 
-// Pass data_size==0 for zero-terminated strings
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
-ImU32 ImHash(const void* data, int data_size, ImU32 seed)
+// IrrIMGUI: Fast path for the display formats of widget values.
+// Only a single "%d", "%i", "%.Nf" or "%.Ng" (N <= 9) surrounded by text is supported, anything else (width, flags, length modifiers) is passed to vsnprintf().
+// Floats are rounded with integer arithmetic from their exact value (ties to even), thus the text is the same as the one of a correctly rounding vsnprintf().
+static const ImU64 GImPowersOf10[10] = { 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL };
+
+static void ImParseFormatSpec(ImFormatSpec* spec, const char* fmt)
+{
+    spec->Type = 0;
+    spec->PrefixLen = spec->SuffixLen = 0;
+    const int fmt_len = (int)strlen(fmt);
+    if (fmt_len >= IM_ARRAYSIZE(spec->Format))
+    {
+        spec->FormatPtr = NULL;
+        return;
+    }
+    spec->FormatPtr = fmt;
+    memcpy(spec->Format, fmt, fmt_len + 1);
+
+    int literals_len = 0;
+    int prefix_len = -1;
+    char type = 0;
+    int precision = -1;
+    for (const char* p = fmt; *p; )
+    {
+        if (*p != '%')
+        {
+            spec->Literals[literals_len++] = *p++;
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            spec->Literals[literals_len++] = '%';
+            p += 2;
+            continue;
+        }
+        if (prefix_len >= 0)
+            return;
+        p++;
+        if (*p == '.')
+        {
+            p++;
+            precision = 0;
+            while (*p >= '0' && *p <= '9')
+                if ((precision = precision * 10 + (*p++ - '0')) > 9)
+                    return;
+        }
+        type = *p;
+        if (type == 'i')
+            type = 'd';
+        if (type == 'd' && precision >= 0)
+            return;
+        if (type != 'd' && type != 'f' && type != 'g')
+            return;
+        prefix_len = literals_len;
+        p++;
+    }
+    if (prefix_len < 0)
+        return;
+
+    if (precision < 0)
+        precision = 6;
+    if (type == 'g' && precision == 0)
+        precision = 1;
+    spec->Type = type;
+    spec->Precision = precision;
+    spec->PrefixLen = prefix_len;
+    spec->SuffixLen = literals_len - prefix_len;
+}
+
+static const ImFormatSpec* ImGetFormatSpec(const char* fmt, ImFormatSpec* temp_spec)
+{
+    ImGuiContext* g = GImGui;
+    if (g == NULL)
+    {
+        ImParseFormatSpec(temp_spec, fmt);
+        return temp_spec;
+    }
+
+    ImFormatSpec* spec = &g->FormatSpecs[((size_t)fmt >> 3) % IM_ARRAYSIZE(g->FormatSpecs)];
+    if (spec->FormatPtr != fmt || strcmp(spec->Format, fmt) != 0)
+        ImParseFormatSpec(spec, fmt);
+    return spec;
+}
+
+// Writes the decimal digits of v in front of buf_end and returns the first digit
+static char* ImWriteDigitsBackwards(char* buf_end, ImU64 v, int min_digits)
+{
+    char* p = buf_end;
+    do
+    {
+        *--p = (char)('0' + (int)(v % 10));
+        v /= 10;
+        min_digits--;
+    } while (v != 0 || min_digits > 0);
+    return p;
+}
+
+// Rounds the absolute value of a float times 10^precision to an integer. Returns false for values, that do not fit.
+static bool ImRoundFloatToDecimals(ImU32 float_bits, int precision, ImU64* out_value)
+{
+    const int biased_exponent = (int)((float_bits >> 23) & 0xFF);
+    if (biased_exponent >= 127 + 32)
+        return false;                                                   // >= 2^32, infinity or NaN
+    const ImU64 mantissa = (biased_exponent == 0) ? (float_bits & 0x7FFFFF) : ((float_bits & 0x7FFFFF) | 0x800000);
+    const int exponent = (biased_exponent == 0) ? -149 : biased_exponent - 150;
+
+    if (exponent >= 0)
+    {
+        *out_value = (mantissa << exponent) * GImPowersOf10[precision];
+        return true;
+    }
+
+    const ImU64 scaled = mantissa * GImPowersOf10[precision];          // < 2^54
+    const int shift = -exponent;
+    if (shift > 55)
+    {
+        *out_value = 0;                                                 // scaled < half of 2^shift
+        return true;
+    }
+    ImU64 value = scaled >> shift;
+    const ImU64 remainder = scaled & ((1ULL << shift) - 1);
+    const ImU64 half = 1ULL << (shift - 1);
+    if (remainder > half || (remainder == half && (value & 1)))
+        value++;
+    *out_value = value;
+    return true;
+}
+
+static int ImFormatOutput(char* buf, int buf_size, const ImFormatSpec* spec, const char* value_begin, const char* value_end)
+{
+    IM_ASSERT(buf_size > 0);
+    const int value_len = (int)(value_end - value_begin);
+    const int len = spec->PrefixLen + value_len + spec->SuffixLen;
+    if (len < buf_size)
+    {
+        memcpy(buf, spec->Literals, spec->PrefixLen);
+        memcpy(buf + spec->PrefixLen, value_begin, value_len);
+        memcpy(buf + spec->PrefixLen + value_len, spec->Literals + spec->PrefixLen, spec->SuffixLen);
+        buf[len] = 0;
+        return len;
+    }
+
+    // Truncated like ImFormatString()
+    char temp[IM_ARRAYSIZE(spec->Literals) + 32];
+    memcpy(temp, spec->Literals, spec->PrefixLen);
+    memcpy(temp + spec->PrefixLen, value_begin, value_len);
+    memcpy(temp + spec->PrefixLen + value_len, spec->Literals + spec->PrefixLen, spec->SuffixLen);
+    memcpy(buf, temp, buf_size - 1);
+    buf[buf_size - 1] = 0;
+    return buf_size - 1;
+}
+
+int ImFormatFloat(char* buf, int buf_size, const char* fmt, float v)
+{
+    ImFormatSpec temp_spec;
+    const ImFormatSpec* spec = ImGetFormatSpec(fmt, &temp_spec);
+    if (spec->Type != 'f' && spec->Type != 'g')
+        return ImFormatString(buf, buf_size, fmt, v);
+
+    ImU32 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const bool negative = (bits & 0x80000000) != 0;
+    bits &= 0x7FFFFFFF;
+
+    int precision = spec->Precision;
+    ImU64 value = 0;
+    if (spec->Type == 'f')
+    {
+        if (!ImRoundFloatToDecimals(bits, precision, &value))
+            return ImFormatString(buf, buf_size, fmt, v);
+    }
+    else if (bits != 0)
+    {
+        // "%g" uses "%f" with (P - 1 - X) decimals, when the exponent X of the value rounded to P digits is in [-4, P)
+        const int digits = spec->Precision;
+        const double a = (double)(negative ? -v : v);
+        if (a < 1e-5 || a >= 1e9)
+            return ImFormatString(buf, buf_size, fmt, v);
+        static const double powers[14] = { 1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+        int exponent = -5;
+        while (a >= powers[exponent + 5])
+            exponent++;
+
+        // The estimated exponent may be off by one at powers of 10 and when the rounding carries into another digit
+        int tries = 0;
+        for (;;)
+        {
+            precision = digits - 1 - exponent;
+            if (precision < 0 || precision > 9 || ++tries > 3 || !ImRoundFloatToDecimals(bits, precision, &value))
+                return ImFormatString(buf, buf_size, fmt, v);
+            if (value >= GImPowersOf10[digits])
+                exponent++;
+            else if (value < GImPowersOf10[digits - 1])
+                exponent--;
+            else
+                break;
+        }
+        if (exponent < -4)
+            return ImFormatString(buf, buf_size, fmt, v);
+    }
+
+    char temp[32];
+    char* const temp_end = temp + IM_ARRAYSIZE(temp);
+    char* p = temp_end;
+    if (precision > 0)
+    {
+        p = ImWriteDigitsBackwards(p, value % GImPowersOf10[precision], precision);
+        *--p = '.';
+    }
+    p = ImWriteDigitsBackwards(p, value / GImPowersOf10[precision], 1);
+    if (negative)
+        *--p = '-';
+
+    const char* value_end = temp_end;
+    if (spec->Type == 'g' && precision > 0)
+    {
+        // Trailing zeros and a trailing decimal point are removed
+        while (value_end[-1] == '0')
+            value_end--;
+        if (value_end[-1] == '.')
+            value_end--;
+    }
+    return ImFormatOutput(buf, buf_size, spec, p, value_end);
+}
+
+int ImFormatInt(char* buf, int buf_size, const char* fmt, int v)
 {
-    static ImU32 crc32_lut[256] = { 0 };
-    if (!crc32_lut[1])
+    ImFormatSpec temp_spec;
+    const ImFormatSpec* spec = ImGetFormatSpec(fmt, &temp_spec);
+    if (spec->Type != 'd')
+        return ImFormatString(buf, buf_size, fmt, v);
+
+    char temp[16];
+    char* const temp_end = temp + IM_ARRAYSIZE(temp);
+    char* p = ImWriteDigitsBackwards(temp_end, (v < 0) ? (ImU64)(0U - (unsigned int)v) : (ImU64)v, 1);
+    if (v < 0)
+        *--p = '-';
+    return ImFormatOutput(buf, buf_size, spec, p, temp_end);
+}
+
+// IrrIMGUI: CRC32 steps of one, 4 and 8 bytes. The result is the same as the one of the byte-wise table lookup, thus the IDs do not change:
+// - ARMv8 with the CRC extension uses the CRC32 instructions, since they use the same polynomial.
+// - Other CPUs use slicing-by-8, that looks up 8 bytes at once in 8 tables. The CRC32 instruction of SSE 4.2 cannot be used, since it computes CRC32-C.
+#if defined(__ARM_FEATURE_CRC32)
+struct ImCrc32
+{
+    ImU32 Byte(ImU32 crc, unsigned char c) const        { return __crc32b(crc, c); }
+    ImU32 Bytes4(ImU32 crc, const unsigned char* data) const { uint32_t value; memcpy(&value, data, sizeof(value)); return __crc32w(crc, value); }
+    ImU32 Bytes8(ImU32 crc, const unsigned char* data) const { uint64_t value; memcpy(&value, data, sizeof(value)); return __crc32d(crc, value); }
+};
+#else
+struct ImCrc32
+{
+    // The table is built by a thread safe static initialization, since frames of several contexts can be built at the same time
+    struct Tables
     {
-        const ImU32 polynomial = 0xEDB88320;
-        for (ImU32 i = 0; i < 256; i++)
+        ImU32 Values[8][256];
+        Tables()
         {
-            ImU32 crc = i;
-            for (ImU32 j = 0; j < 8; j++)
-                crc = (crc >> 1) ^ (ImU32(-int(crc & 1)) & polynomial);
-            crc32_lut[i] = crc;
+            const ImU32 polynomial = 0xEDB88320;
+            for (ImU32 i = 0; i < 256; i++)
+            {
+                ImU32 crc = i;
+                for (ImU32 j = 0; j < 8; j++)
+                    crc = (crc >> 1) ^ (ImU32(-int(crc & 1)) & polynomial);
+                Values[0][i] = crc;
+            }
+            for (int table = 1; table < 8; table++)
+                for (int i = 0; i < 256; i++)
+                    Values[table][i] = (Values[table - 1][i] >> 8) ^ Values[0][Values[table - 1][i] & 0xFF];
         }
+    };
+    const ImU32 (*Lut)[256];
+
+    ImCrc32()                                           { static const Tables tables; Lut = tables.Values; }
+    ImU32 Byte(ImU32 crc, unsigned char c) const        { return (crc >> 8) ^ Lut[0][(crc & 0xFF) ^ c]; }
+
+    // The values are composed of single bytes, thus it does not depend on the endianness and alignment
+    ImU32 Bytes4(ImU32 crc, const unsigned char* data) const
+    {
+        const ImU32 low = crc ^ ((ImU32)data[0] | ((ImU32)data[1] << 8) | ((ImU32)data[2] << 16) | ((ImU32)data[3] << 24));
+        return Lut[3][low & 0xFF] ^ Lut[2][(low >> 8) & 0xFF] ^ Lut[1][(low >> 16) & 0xFF] ^ Lut[0][low >> 24];
+    }
+
+    ImU32 Bytes8(ImU32 crc, const unsigned char* data) const
+    {
+        const ImU32 low = crc ^ ((ImU32)data[0] | ((ImU32)data[1] << 8) | ((ImU32)data[2] << 16) | ((ImU32)data[3] << 24));
+        const ImU32 high = (ImU32)data[4] | ((ImU32)data[5] << 8) | ((ImU32)data[6] << 16) | ((ImU32)data[7] << 24);
+        return Lut[7][low & 0xFF] ^ Lut[6][(low >> 8) & 0xFF] ^ Lut[5][(low >> 16) & 0xFF] ^ Lut[4][low >> 24] ^
+               Lut[3][high & 0xFF] ^ Lut[2][(high >> 8) & 0xFF] ^ Lut[1][(high >> 16) & 0xFF] ^ Lut[0][high >> 24];
     }
+};
+#endif
 
+// Pass data_size==0 for zero-terminated strings
+ImU32 ImHash(const void* data, int data_size, ImU32 seed)
+{
+    const ImCrc32 crc32;
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* current = (const unsigned char*)data;
@@ -985,21 +1274,46 @@ ImU32 ImHash(const void* data, int data_size, ImU32 seed)
     if (data_size > 0)
     {
         // Known size
+        for (; data_size >= 8; data_size -= 8, current += 8)
+            crc = crc32.Bytes8(crc, current);
+        if (data_size >= 4)
+        {
+            crc = crc32.Bytes4(crc, current);
+            data_size -= 4;
+            current += 4;
+        }
         while (data_size--)
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *current++];
+            crc = crc32.Byte(crc, *current++);
     }
     else
     {
         // Zero-terminated string
-        while (unsigned char c = *current++)
+        // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+        // Because this syntax is rarely used we are optimizing for the common case.
+        // - If we reach ### in the string we discard the hash so far and reset to the seed.
+        // - IrrIMGUI: 8 bytes without '#' are hashed at once, the other bytes one after the other.
+        const unsigned char* const end = current + strlen((const char*)current);
+        const ImU64 ones = 0x0101010101010101ULL;
+        while (end - current >= 8)
+        {
+            ImU64 word;
+            memcpy(&word, current, sizeof(word));
+            word ^= ones * '#';
+            if (((word - ones) & ~word & (ones << 7)) == 0)
+            {
+                crc = crc32.Bytes8(crc, current);
+                current += 8;
+                continue;
+            }
+            if (current[0] == '#' && current[1] == '#' && current[2] == '#')
+                crc = seed;
+            crc = crc32.Byte(crc, *current++);
+        }
+        for (; current < end; current++)
         {
-            // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
-            // Because this syntax is rarely used we are optimizing for the common case.
-            // - If we reach ### in the string we discard the hash so far and reset to the seed.
-            // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller.
-            if (c == '#' && current[0] == '#' && current[1] == '#')
+            if (current[0] == '#' && current[1] == '#' && current[2] == '#')
                 crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+            crc = crc32.Byte(crc, current[0]);
         }
     }
     return ~crc;
@@ -2142,6 +2456,8 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
+    g.TextLayoutHits = g.TextLayoutMisses = 0;
+    ImTextLayoutCacheCollect(); // IrrIMGUI: Removes the texts, that have not been drawn in the last frame
     g.OverlayDrawList.Clear();
     g.OverlayDrawList.PushTextureID(g.IO.Fonts->TexID);
     g.OverlayDrawList.PushClipRectFullScreen();
@@ -2360,6 +2676,7 @@ void ImGui::Shutdown()
     // The fonts atlas can be used prior to calling NewFrame(), so we clear it even if g.Initialized is FALSE (which would happen if we never called NewFrame)
     if (g.IO.Fonts) // Testing for NULL to allow user to NULLify in case of running Shutdown() on multiple contexts. Bit hacky.
         g.IO.Fonts->Clear();
+    ImTextLayoutCacheClear(); // IrrIMGUI
 
     // Cleanup of other data are conditional on actually having used ImGui.
     if (!g.Initialized)
@@ -2703,6 +3020,9 @@ void ImGui::Render()
     if (g.FrameCountEnded != g.FrameCount)
         ImGui::EndFrame();
     g.FrameCountRendered = g.FrameCount;
+    g.IO.MetricsTextLayoutHits = g.TextLayoutHits; // IrrIMGUI
+    g.IO.MetricsTextLayoutMisses = g.TextLayoutMisses;
+    g.IO.MetricsTextLayoutEntries = g.TextLayouts.Size;
 
     // Skip render altogether if alpha is 0.0
     // Note that vertex buffers have been created and are wasted, so it is best practice that you don't create windows in the first place, or consistently respond to Begin() returning false.
@@ -3029,7 +3349,36 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+
+    // IrrIMGUI: The size of a text, that has been measured in the last frame, is taken from the text layout cache.
+    // Short texts are measured faster than they are found in the cache.
+    ImTextLayout* layout = NULL;
+    if (g.IO.TextLayoutCacheSize > 0)
+    {
+        if (!text_display_end)
+            text_display_end = text + strlen(text);
+        if (text_display_end - text >= 16)
+            layout = ImTextLayoutCacheFind(font, font_size, wrap_width, text, text_display_end);
+    }
+
+    ImVec2 text_size;
+    if (layout && layout->HasTextSize)
+    {
+        text_size = layout->TextSize;
+        g.TextLayoutHits++;
+    }
+    else
+    {
+        // IrrIMGUI: A dynamic glyph, that falls back before its advance is known, changes the size later
+        bool fallback = false;
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL, &fallback);
+        if (layout && !(fallback && font->DynamicGlyphs))
+        {
+            layout->TextSize = text_size;
+            layout->HasTextSize = true;
+            g.TextLayoutMisses++;
+        }
+    }
 
     // Cancel out character spacing for the last character of a line (it is baked into glyph->XAdvance field)
     const float font_scale = font_size / font->FontSize;
@@ -5333,6 +5682,19 @@ void ImGui::TextV(const char* fmt, va_list args)
     if (window->SkipItems)
         return;
 
+    // IrrIMGUI: Labels without format specifier and "%s" are drawn without being copied into the temporary buffer
+    if (!strchr(fmt, '%'))
+    {
+        TextUnformatted(fmt);
+        return;
+    }
+    if (fmt[0] == '%' && fmt[1] == 's' && fmt[2] == 0)
+    {
+        const char* text = va_arg(args, const char*);
+        TextUnformatted(text ? text : "(null)");
+        return;
+    }
+
     ImGuiContext& g = *GImGui;
     const char* text_end = g.TempBuffer + ImFormatStringV(g.TempBuffer, IM_ARRAYSIZE(g.TempBuffer), fmt, args);
     TextUnformatted(g.TempBuffer, text_end);
@@ -6304,9 +6666,9 @@ void ImGui::BulletText(const char* fmt, ...)
 static inline void DataTypeFormatString(ImGuiDataType data_type, void* data_ptr, const char* display_format, char* buf, int buf_size)
 {
     if (data_type == ImGuiDataType_Int)
-        ImFormatString(buf, buf_size, display_format, *(int*)data_ptr);
+        ImFormatInt(buf, buf_size, display_format, *(int*)data_ptr);
     else if (data_type == ImGuiDataType_Float)
-        ImFormatString(buf, buf_size, display_format, *(float*)data_ptr);
+        ImFormatFloat(buf, buf_size, display_format, *(float*)data_ptr);
 }
 
 static inline void DataTypeFormatString(ImGuiDataType data_type, void* data_ptr, int decimal_precision, char* buf, int buf_size)
@@ -6314,14 +6676,19 @@ static inline void DataTypeFormatString(ImGuiDataType data_type, void* data_ptr,
     if (data_type == ImGuiDataType_Int)
     {
         if (decimal_precision < 0)
-            ImFormatString(buf, buf_size, "%d", *(int*)data_ptr);
+            ImFormatInt(buf, buf_size, "%d", *(int*)data_ptr);
         else
             ImFormatString(buf, buf_size, "%.*d", decimal_precision, *(int*)data_ptr);
     }
     else if (data_type == ImGuiDataType_Float)
     {
         if (decimal_precision < 0)
-            ImFormatString(buf, buf_size, "%f", *(float*)data_ptr);     // Ideally we'd have a minimum decimal precision of 1 to visually denote that it is a float, while hiding non-significant digits?
+            ImFormatFloat(buf, buf_size, "%f", *(float*)data_ptr);     // Ideally we'd have a minimum decimal precision of 1 to visually denote that it is a float, while hiding non-significant digits?
+        else if (decimal_precision < 10)
+        {
+            static const char* precision_formats[10] = { "%.0f", "%.1f", "%.2f", "%.3f", "%.4f", "%.5f", "%.6f", "%.7f", "%.8f", "%.9f" };   // IrrIMGUI: Formats for ImFormatFloat()
+            ImFormatFloat(buf, buf_size, precision_formats[decimal_precision], *(float*)data_ptr);
+        }
         else
             ImFormatString(buf, buf_size, "%.*f", decimal_precision, *(float*)data_ptr);
     }
@@ -6679,7 +7046,7 @@ bool ImGui::SliderFloat(const char* label, float* v, float v_min, float v_max, c
 
     // Display value using user-provided display format so user can add prefix/suffix/decorations to the value.
     char value_buf[64];
-    const char* value_buf_end = value_buf + ImFormatString(value_buf, IM_ARRAYSIZE(value_buf), display_format, *v);
+    const char* value_buf_end = value_buf + ImFormatFloat(value_buf, IM_ARRAYSIZE(value_buf), display_format, *v);
     RenderTextClipped(frame_bb.Min, frame_bb.Max, value_buf, value_buf_end, NULL, ImVec2(0.5f,0.5f));
 
     if (label_size.x > 0.0f)
@@ -6726,7 +7093,7 @@ bool ImGui::VSliderFloat(const char* label, const ImVec2& size, float* v, float
     // Display value using user-provided display format so user can add prefix/suffix/decorations to the value.
     // For the vertical slider we allow centered text to overlap the frame padding
     char value_buf[64];
-    char* value_buf_end = value_buf + ImFormatString(value_buf, IM_ARRAYSIZE(value_buf), display_format, *v);
+    char* value_buf_end = value_buf + ImFormatFloat(value_buf, IM_ARRAYSIZE(value_buf), display_format, *v);
     RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, value_buf, value_buf_end, NULL, ImVec2(0.5f,0.0f));
     if (label_size.x > 0.0f)
         RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
@@ -6976,7 +7343,7 @@ bool ImGui::DragFloat(const char* label, float* v, float v_speed, float v_min, f
 
     // Display value using user-provided display format so user can add prefix/suffix/decorations to the value.
     char value_buf[64];
-    const char* value_buf_end = value_buf + ImFormatString(value_buf, IM_ARRAYSIZE(value_buf), display_format, *v);
+    const char* value_buf_end = value_buf + ImFormatFloat(value_buf, IM_ARRAYSIZE(value_buf), display_format, *v);
     RenderTextClipped(frame_bb.Min, frame_bb.Max, value_buf, value_buf_end, NULL, ImVec2(0.5f,0.5f));
 
     if (label_size.x > 0.0f)
@@ -7302,7 +7669,7 @@ void ImGui::ProgressBar(float fraction, const ImVec2& size_arg, const char* over
     char overlay_buf[32];
     if (!overlay)
     {
-        ImFormatString(overlay_buf, IM_ARRAYSIZE(overlay_buf), "%.0f%%", fraction*100+0.01f);
+        ImFormatFloat(overlay_buf, IM_ARRAYSIZE(overlay_buf), "%.0f%%", fraction*100+0.01f);
         overlay = overlay_buf;
     }
 
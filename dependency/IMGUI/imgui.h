@@ -788,6 +788,7 @@ struct ImGuiIO
     float         FontGlobalScale;          // = 1.0f               // Global scale all fonts
     bool          FontAllowUserScaling;     // = false              // Allow user scaling text of individual window with CTRL+Wheel.
     ImFont*       FontDefault;              // = NULL               // Font to use on NewFrame(). Use NULL to uses Fonts->Fonts[0].
+    int           TextLayoutCacheSize;      // = 0                  // IrrIMGUI: Maximum number of text layouts (sizes and glyph quads), that are kept for texts drawn again in the next frame. 0 disables the cache.
     ImVec2        DisplayFramebufferScale;  // = (1.0f,1.0f)        // For retina display or other situations where window coordinates are different from framebuffer coordinates. User storage only, presently not used by ImGui.
     ImVec2        DisplayVisibleMin;        // <unset> (0.0f,0.0f)  // If you use DisplaySize as a virtual space larger than your screen, set DisplayVisibleMin/Max to the visible area.
     ImVec2        DisplayVisibleMax;        // <unset> (0.0f,0.0f)  // If the values are the same, we defaults to Min=(0.0f) and Max=DisplaySize
@@ -852,6 +853,9 @@ struct ImGuiIO
     int         MetricsRenderVertices;      // Vertices output during last call to Render()
     int         MetricsRenderIndices;       // Indices output during last call to Render() = number of triangles * 3
     int         MetricsActiveWindows;       // Number of visible root windows (exclude child windows)
+    int         MetricsTextLayoutHits;      // IrrIMGUI: Number of text sizes and text renderings taken from the text layout cache during last frame
+    int         MetricsTextLayoutMisses;    // IrrIMGUI: Number of text sizes and text renderings computed during last frame, while the text layout cache was enabled
+    int         MetricsTextLayoutEntries;   // IrrIMGUI: Number of texts in the text layout cache
     ImVec2      MouseDelta;                 // Mouse delta. Note that this is zero if either current or previous position are negative, so a disappearing/reappearing mouse won't have a huge delta for one frame.
 
     //------------------------------------------------------------------
@@ -1397,6 +1401,7 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1.
+    int                         TexGlyphSDFSpread;  // IrrIMGUI: When > 0, the glyphs are stored as signed distance field, that reaches this many pixels beyond the outline. Defaults to 0 (coverage).
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
 
@@ -1447,6 +1452,8 @@ struct ImFont
     ImFontAtlas*                ContainerAtlas;     //              // What we has been loaded into
     float                       Ascent, Descent;    //              // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;//              // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    unsigned int                LayoutGeneration;   //              // IrrIMGUI: Changes whenever the glyphs are built again, thus cached text layouts of this font become invalid
+    void*                       DynamicGlyphs;      // = NULL       // IrrIMGUI: Cache of the glyphs, that are rasterized on demand (see IMGUI_FIND_DYNAMIC_GLYPH). Fonts without cache never call the hook
 
     // Methods
     IMGUI_API ImFont();
@@ -1460,7 +1467,7 @@ struct ImFont
 
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
-    IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** remaining = NULL) const; // utf8
+    IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** remaining = NULL, bool* out_fallback = NULL) const; // utf8. IrrIMGUI: 'out_fallback' is set to true, when a codepoint outside of the index used the fallback advance
     IMGUI_API const char*       CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const;
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, unsigned short c) const;
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false) const;
@@ -1468,6 +1475,7 @@ struct ImFont
     // Private
     IMGUI_API void              GrowIndex(int new_size);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
+    IMGUI_API void              InvalidateLayouts(); // IrrIMGUI: Changes LayoutGeneration, thus the cached text layouts of this font are computed again
 };
 
 #if defined(__clang__)
@@ -18,6 +18,7 @@
 #include "imgui_internal.h"
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#include <atomic>       // IrrIMGUI: std::atomic, fonts of different atlases are built on different threads
 #if !defined(alloca)
 #ifdef _WIN32
 #include <malloc.h>     // alloca
@@ -680,19 +681,23 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 
 void ImDrawList::PathArcToFast(const ImVec2& centre, float radius, int a_min_of_12, int a_max_of_12)
 {
-    static ImVec2 circle_vtx[12];
-    static bool circle_vtx_builds = false;
-    const int circle_vtx_count = IM_ARRAYSIZE(circle_vtx);
-    if (!circle_vtx_builds)
+    // IrrIMGUI: the vertices are built by a thread safe static initialization, since frames of several contexts can be built at the same time
+    struct ImCircleVertices
     {
-        for (int i = 0; i < circle_vtx_count; i++)
+        ImVec2 Values[12];
+        ImCircleVertices()
         {
-            const float a = ((float)i / (float)circle_vtx_count) * 2*IM_PI;
-            circle_vtx[i].x = cosf(a);
-            circle_vtx[i].y = sinf(a);
+            for (int i = 0; i < IM_ARRAYSIZE(Values); i++)
+            {
+                const float a = ((float)i / (float)IM_ARRAYSIZE(Values)) * 2*IM_PI;
+                Values[i].x = cosf(a);
+                Values[i].y = sinf(a);
+            }
         }
-        circle_vtx_builds = true;
-    }
+    };
+    static const ImCircleVertices circle_vertices;
+    const ImVec2* circle_vtx = circle_vertices.Values;
+    const int circle_vtx_count = IM_ARRAYSIZE(circle_vertices.Values);
 
     if (a_min_of_12 > a_max_of_12) return;
     if (radius == 0.0f)
@@ -1102,6 +1107,7 @@ ImFontAtlas::ImFontAtlas()
     TexPixelsRGBA32 = NULL;
     TexWidth = TexHeight = TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    TexGlyphSDFSpread = 0;
     TexUvWhitePixel = ImVec2(0, 0);
 }
 
@@ -1315,6 +1321,27 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
     return font;
 }
 
+// IrrIMGUI: Decompresses TTF data like AddFontFromMemoryCompressedTTF(), thus a released font can be loaded again from its compressed data.
+void*   ImFontAtlasBuildDecompressTTF(const void* compressed_ttf_data, int compressed_ttf_size, int* out_size)
+{
+    const unsigned int buf_decompressed_size = stb_decompress_length((unsigned char*)compressed_ttf_data);
+    unsigned char* buf_decompressed_data = (unsigned char *)ImGui::MemAlloc(buf_decompressed_size);
+    stb_decompress(buf_decompressed_data, (unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    *out_size = (int)buf_decompressed_size;
+    return buf_decompressed_data;
+}
+
+// IrrIMGUI: Decodes and decompresses TTF data like AddFontFromMemoryCompressedBase85TTF().
+void*   ImFontAtlasBuildDecompressBase85TTF(const char* compressed_ttf_data_base85, int* out_size)
+{
+    int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
+    void* compressed_ttf = ImGui::MemAlloc((size_t)compressed_ttf_size);
+    Decode85((const unsigned char*)compressed_ttf_data_base85, (unsigned char*)compressed_ttf);
+    void* ttf_data = ImFontAtlasBuildDecompressTTF(compressed_ttf, compressed_ttf_size, out_size);
+    ImGui::MemFree(compressed_ttf);
+    return ttf_data;
+}
+
 int ImFontAtlas::CustomRectRegister(unsigned int id, int width, int height)
 {
     IM_ASSERT(width > 0 && width <= 0xFFFF);
@@ -1340,85 +1367,143 @@ bool    ImFontAtlas::Build()
     return ImFontAtlasBuildWithStbTruetype(this);
 }
 
-bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
+// IrrIMGUI: A block of glyphs of a single range, that is rendered by one thread.
+struct ImFontBuildRenderBlock
 {
-    IM_ASSERT(atlas->ConfigData.Size > 0);
+    const stbtt_fontinfo*   FontInfo;
+    stbtt_pack_range        Range;
+    stbrp_rect*             Rects;
+};
 
-    ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
+struct ImFontBuildRenderData
+{
+    const stbtt_pack_context*       PackContext;
+    const ImFontBuildRenderBlock*   Blocks;
+    int                             SDFSpread;
+};
 
-    atlas->TexID = NULL;
-    atlas->TexWidth = atlas->TexHeight = 0;
-    atlas->TexUvWhitePixel = ImVec2(0, 0);
-    atlas->ClearTexData();
+// IrrIMGUI: The number of glyphs of a render block. Huge ranges (like the Chinese one) are split into many blocks.
+static const int FONT_ATLAS_RENDER_BLOCK_SIZE = 256;
+
+static void ImFontAtlasBuildRenderBlock(int block_i, void* user_data)
+{
+    const ImFontBuildRenderData* data = (const ImFontBuildRenderData*)user_data;
+    const ImFontBuildRenderBlock& block = data->Blocks[block_i];
+
+    // stbtt changes the oversampling of the pack context while rendering, thus every block uses its own copy
+    stbtt_pack_context spc = *data->PackContext;
+    stbtt_pack_range range = block.Range;
+    stbtt_PackFontRangesRenderIntoRects(&spc, block.FontInfo, &range, 1, block.Rects);
+
+    // IrrIMGUI: The distance field of a glyph reaches into its padding, which no other glyph touches (see ImFontAtlasBuildGetGlyphPadding())
+    const int spread = data->SDFSpread;
+    if (spread > 0)
+        for (int char_idx = 0; char_idx < range.num_chars; char_idx++)
+        {
+            const stbtt_packedchar& pc = range.chardata_for_range[char_idx];
+            if (pc.x1 > pc.x0 && pc.y1 > pc.y0)
+                ImFontAtlasBuildDistanceField(spc.pixels, spc.stride_in_bytes, pc.x0 - spread, pc.y0 - spread, pc.x1 - pc.x0 + 2 * spread, pc.y1 - pc.y0 + 2 * spread, spread);
+        }
+}
+
+// IrrIMGUI: Returns the padding between the glyphs. The glyphs of a distance field atlas need space for the distance field on every side,
+// which is the padding on their left and top side and the padding of their neighbours on the right and bottom side.
+static int ImFontAtlasBuildGetGlyphPadding(const ImFontAtlas* atlas)
+{
+    if (atlas->TexGlyphSDFSpread > 0)
+        return ImMax(atlas->TexGlyphPadding, atlas->TexGlyphSDFSpread * 2 + 1);
+    return atlas->TexGlyphPadding;
+}
+
+// IrrIMGUI: The temporary data of the fonts, that are built. It is shared by ImFontAtlasBuildWithStbTruetype() and ImFontAtlasBuildAppendWithStbTruetype().
+struct ImFontTempBuildData
+{
+    stbtt_fontinfo      FontInfo;
+    stbrp_rect*         Rects;
+    stbtt_pack_range*   Ranges;
+    int                 RangesCount;
+};
+
+struct ImFontBuildFonts
+{
+    int                 FirstConfig;        // The fonts of ConfigData[FirstConfig] and behind are built
+    ImFontTempBuildData* TmpArray;          // One entry per built config, starting with FirstConfig
+    stbtt_packedchar*   BufPackedChars;
+    stbrp_rect*         BufRects;
+    stbtt_pack_range*   BufRanges;
+    int                 GlyphsCount;
+    int                 RangesCount;
+};
+
+static void ImFontAtlasBuildEndFonts(ImFontBuildFonts* fonts)
+{
+    if (fonts->TmpArray) ImGui::MemFree(fonts->TmpArray);
+    if (fonts->BufPackedChars) ImGui::MemFree(fonts->BufPackedChars);
+    if (fonts->BufRects) ImGui::MemFree(fonts->BufRects);
+    if (fonts->BufRanges) ImGui::MemFree(fonts->BufRanges);
+    memset(fonts, 0, sizeof(*fonts));
+}
+
+static bool ImFontAtlasBuildBeginFonts(ImFontAtlas* atlas, int first_config, ImFontBuildFonts* fonts)
+{
+    memset(fonts, 0, sizeof(*fonts));
+    fonts->FirstConfig = first_config;
 
     // Count glyphs/ranges
-    int total_glyphs_count = 0;
-    int total_ranges_count = 0;
-    for (int input_i = 0; input_i < atlas->ConfigData.Size; input_i++)
+    for (int input_i = first_config; input_i < atlas->ConfigData.Size; input_i++)
     {
         ImFontConfig& cfg = atlas->ConfigData[input_i];
         if (!cfg.GlyphRanges)
             cfg.GlyphRanges = atlas->GetGlyphRangesDefault();
-        for (const ImWchar* in_range = cfg.GlyphRanges; in_range[0] && in_range[1]; in_range += 2, total_ranges_count++)
-            total_glyphs_count += (in_range[1] - in_range[0]) + 1;
+        for (const ImWchar* in_range = cfg.GlyphRanges; in_range[0] && in_range[1]; in_range += 2, fonts->RangesCount++)
+            fonts->GlyphsCount += (in_range[1] - in_range[0]) + 1;
     }
 
-    // We need a width for the skyline algorithm. Using a dumb heuristic here to decide of width. User can override TexDesiredWidth and TexGlyphPadding if they wish.
-    // Width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
-    atlas->TexWidth = (atlas->TexDesiredWidth > 0) ? atlas->TexDesiredWidth : (total_glyphs_count > 4000) ? 4096 : (total_glyphs_count > 2000) ? 2048 : (total_glyphs_count > 1000) ? 1024 : 512;
-    atlas->TexHeight = 0;
-
-    // Start packing
-    const int max_tex_height = 1024*32;
-    stbtt_pack_context spc;
-    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, max_tex_height, 0, atlas->TexGlyphPadding, NULL);
-    stbtt_PackSetOversampling(&spc, 1, 1);
-
-    // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
-    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
-
     // Initialize font information (so we can error without any cleanup)
-    struct ImFontTempBuildData
-    {
-        stbtt_fontinfo      FontInfo;
-        stbrp_rect*         Rects;
-        stbtt_pack_range*   Ranges;
-        int                 RangesCount;
-    };
-    ImFontTempBuildData* tmp_array = (ImFontTempBuildData*)ImGui::MemAlloc((size_t)atlas->ConfigData.Size * sizeof(ImFontTempBuildData));
-    for (int input_i = 0; input_i < atlas->ConfigData.Size; input_i++)
+    const int configs_count = atlas->ConfigData.Size - first_config;
+    fonts->TmpArray = (ImFontTempBuildData*)ImGui::MemAlloc((size_t)configs_count * sizeof(ImFontTempBuildData));
+    for (int input_i = first_config; input_i < atlas->ConfigData.Size; input_i++)
     {
         ImFontConfig& cfg = atlas->ConfigData[input_i];
-        ImFontTempBuildData& tmp = tmp_array[input_i];
+        ImFontTempBuildData& tmp = fonts->TmpArray[input_i - first_config];
         IM_ASSERT(cfg.DstFont && (!cfg.DstFont->IsLoaded() || cfg.DstFont->ContainerAtlas == atlas));
 
         const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo);
         IM_ASSERT(font_offset >= 0);
         if (!stbtt_InitFont(&tmp.FontInfo, (unsigned char*)cfg.FontData, font_offset))
+        {
+            ImFontAtlasBuildEndFonts(fonts);
             return false;
+        }
     }
 
     // Allocate packing character data and flag packed characters buffer as non-packed (x0=y0=x1=y1=0)
-    int buf_packedchars_n = 0, buf_rects_n = 0, buf_ranges_n = 0;
-    stbtt_packedchar* buf_packedchars = (stbtt_packedchar*)ImGui::MemAlloc(total_glyphs_count * sizeof(stbtt_packedchar));
-    stbrp_rect* buf_rects = (stbrp_rect*)ImGui::MemAlloc(total_glyphs_count * sizeof(stbrp_rect));
-    stbtt_pack_range* buf_ranges = (stbtt_pack_range*)ImGui::MemAlloc(total_ranges_count * sizeof(stbtt_pack_range));
-    memset(buf_packedchars, 0, total_glyphs_count * sizeof(stbtt_packedchar));
-    memset(buf_rects, 0, total_glyphs_count * sizeof(stbrp_rect));              // Unnecessary but let's clear this for the sake of sanity.
-    memset(buf_ranges, 0, total_ranges_count * sizeof(stbtt_pack_range));
+    fonts->BufPackedChars = (stbtt_packedchar*)ImGui::MemAlloc(fonts->GlyphsCount * sizeof(stbtt_packedchar));
+    fonts->BufRects = (stbrp_rect*)ImGui::MemAlloc(fonts->GlyphsCount * sizeof(stbrp_rect));
+    fonts->BufRanges = (stbtt_pack_range*)ImGui::MemAlloc(fonts->RangesCount * sizeof(stbtt_pack_range));
+    memset(fonts->BufPackedChars, 0, fonts->GlyphsCount * sizeof(stbtt_packedchar));
+    memset(fonts->BufRects, 0, fonts->GlyphsCount * sizeof(stbrp_rect));              // Unnecessary but let's clear this for the sake of sanity.
+    memset(fonts->BufRanges, 0, fonts->RangesCount * sizeof(stbtt_pack_range));
+    return true;
+}
 
-    // First font pass: pack all glyphs (no rendering at this point, we are working with rectangles in an infinitely tall texture at this point)
-    for (int input_i = 0; input_i < atlas->ConfigData.Size; input_i++)
+// Pack all glyphs (no rendering at this point). Returns the bottom of the packed rectangles.
+static int ImFontAtlasBuildPackFonts(ImFontAtlas* atlas, ImFontBuildFonts* fonts, stbtt_pack_context* spc, bool* out_all_packed)
+{
+    int buf_packedchars_n = 0, buf_rects_n = 0, buf_ranges_n = 0;
+    int bottom = 0;
+    *out_all_packed = true;
+    for (int input_i = fonts->FirstConfig; input_i < atlas->ConfigData.Size; input_i++)
     {
         ImFontConfig& cfg = atlas->ConfigData[input_i];
-        ImFontTempBuildData& tmp = tmp_array[input_i];
+        ImFontTempBuildData& tmp = fonts->TmpArray[input_i - fonts->FirstConfig];
 
         // Setup ranges
         int font_glyphs_count = 0;
         int font_ranges_count = 0;
         for (const ImWchar* in_range = cfg.GlyphRanges; in_range[0] && in_range[1]; in_range += 2, font_ranges_count++)
             font_glyphs_count += (in_range[1] - in_range[0]) + 1;
-        tmp.Ranges = buf_ranges + buf_ranges_n;
+        tmp.Ranges = fonts->BufRanges + buf_ranges_n;
         tmp.RangesCount = font_ranges_count;
         buf_ranges_n += font_ranges_count;
         for (int i = 0; i < font_ranges_count; i++)
@@ -1428,54 +1513,83 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             range.font_size = cfg.SizePixels;
             range.first_unicode_codepoint_in_range = in_range[0];
             range.num_chars = (in_range[1] - in_range[0]) + 1;
-            range.chardata_for_range = buf_packedchars + buf_packedchars_n;
+            range.chardata_for_range = fonts->BufPackedChars + buf_packedchars_n;
             buf_packedchars_n += range.num_chars;
         }
 
         // Pack
-        tmp.Rects = buf_rects + buf_rects_n;
+        tmp.Rects = fonts->BufRects + buf_rects_n;
         buf_rects_n += font_glyphs_count;
-        stbtt_PackSetOversampling(&spc, cfg.OversampleH, cfg.OversampleV);
-        int n = stbtt_PackFontRangesGatherRects(&spc, &tmp.FontInfo, tmp.Ranges, tmp.RangesCount, tmp.Rects);
+        // IrrIMGUI: Distance fields are smooth enough for sub-pixel positions, they are not oversampled
+        if (atlas->TexGlyphSDFSpread > 0)
+            stbtt_PackSetOversampling(spc, 1, 1);
+        else
+            stbtt_PackSetOversampling(spc, cfg.OversampleH, cfg.OversampleV);
+        int n = stbtt_PackFontRangesGatherRects(spc, &tmp.FontInfo, tmp.Ranges, tmp.RangesCount, tmp.Rects);
         IM_ASSERT(n == font_glyphs_count);
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, tmp.Rects, n);
+        stbrp_pack_rects((stbrp_context*)spc->pack_info, tmp.Rects, n);
 
         // Extend texture height
         for (int i = 0; i < n; i++)
             if (tmp.Rects[i].was_packed)
-                atlas->TexHeight = ImMax(atlas->TexHeight, tmp.Rects[i].y + tmp.Rects[i].h);
+                bottom = ImMax(bottom, tmp.Rects[i].y + tmp.Rects[i].h);
+            else
+                *out_all_packed = false;
     }
-    IM_ASSERT(buf_rects_n == total_glyphs_count);
-    IM_ASSERT(buf_packedchars_n == total_glyphs_count);
-    IM_ASSERT(buf_ranges_n == total_ranges_count);
-
-    // Create texture
-    atlas->TexHeight = ImUpperPowerOfTwo(atlas->TexHeight);
-    atlas->TexPixelsAlpha8 = (unsigned char*)ImGui::MemAlloc(atlas->TexWidth * atlas->TexHeight);
-    memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
-    spc.pixels = atlas->TexPixelsAlpha8;
-    spc.height = atlas->TexHeight;
+    IM_ASSERT(buf_rects_n == fonts->GlyphsCount);
+    IM_ASSERT(buf_packedchars_n == fonts->GlyphsCount);
+    IM_ASSERT(buf_ranges_n == fonts->RangesCount);
+    return bottom;
+}
 
-    // Second pass: render font characters
-    for (int input_i = 0; input_i < atlas->ConfigData.Size; input_i++)
+// Render font characters into the pixels of the pack context
+static void ImFontAtlasBuildRenderFonts(ImFontAtlas* atlas, ImFontBuildFonts* fonts, stbtt_pack_context* spc)
+{
+    // IrrIMGUI: The ranges are split into blocks of glyphs, that are rendered in parallel (see IMGUI_PARALLEL_FOR in imconfig.h).
+    // Every glyph is rendered into its own packed rectangle, thus the pixels do not depend on the order of the blocks.
+    ImVector<ImFontBuildRenderBlock> render_blocks;
+    for (int input_i = fonts->FirstConfig; input_i < atlas->ConfigData.Size; input_i++)
     {
-        ImFontConfig& cfg = atlas->ConfigData[input_i];
-        ImFontTempBuildData& tmp = tmp_array[input_i];
-        stbtt_PackSetOversampling(&spc, cfg.OversampleH, cfg.OversampleV);
-        stbtt_PackFontRangesRenderIntoRects(&spc, &tmp.FontInfo, tmp.Ranges, tmp.RangesCount, tmp.Rects);
+        ImFontTempBuildData& tmp = fonts->TmpArray[input_i - fonts->FirstConfig];
+        stbrp_rect* range_rects = tmp.Rects;
+        for (int i = 0; i < tmp.RangesCount; i++)
+        {
+            const stbtt_pack_range& range = tmp.Ranges[i];
+            for (int char_idx = 0; char_idx < range.num_chars; char_idx += FONT_ATLAS_RENDER_BLOCK_SIZE)
+            {
+                ImFontBuildRenderBlock block;
+                block.FontInfo = &tmp.FontInfo;
+                block.Range = range;
+                block.Range.first_unicode_codepoint_in_range += char_idx;
+                block.Range.num_chars = ImMin(range.num_chars - char_idx, FONT_ATLAS_RENDER_BLOCK_SIZE);
+                block.Range.chardata_for_range += char_idx;
+                block.Rects = range_rects + char_idx;
+                render_blocks.push_back(block);
+            }
+            range_rects += range.num_chars;
+        }
         tmp.Rects = NULL;
     }
 
-    // End packing
-    stbtt_PackEnd(&spc);
-    ImGui::MemFree(buf_rects);
-    buf_rects = NULL;
+    ImFontBuildRenderData render_data;
+    render_data.PackContext = spc;
+    render_data.Blocks = render_blocks.Data;
+    render_data.SDFSpread = atlas->TexGlyphSDFSpread;
+#ifdef IMGUI_PARALLEL_FOR
+    IMGUI_PARALLEL_FOR(render_blocks.Size, ImFontAtlasBuildRenderBlock, &render_data);
+#else
+    for (int block_i = 0; block_i < render_blocks.Size; block_i++)
+        ImFontAtlasBuildRenderBlock(block_i, &render_data);
+#endif
+}
 
-    // Third pass: setup ImFont and glyphs for runtime
-    for (int input_i = 0; input_i < atlas->ConfigData.Size; input_i++)
+// Setup ImFont and glyphs for runtime
+static void ImFontAtlasBuildSetupFonts(ImFontAtlas* atlas, ImFontBuildFonts* fonts)
+{
+    for (int input_i = fonts->FirstConfig; input_i < atlas->ConfigData.Size; input_i++)
     {
         ImFontConfig& cfg = atlas->ConfigData[input_i];
-        ImFontTempBuildData& tmp = tmp_array[input_i];
+        ImFontTempBuildData& tmp = fonts->TmpArray[input_i - fonts->FirstConfig];
         ImFont* dst_font = cfg.DstFont; // We can have multiple input fonts writing into a same destination font (when using MergeMode=true)
 
         float font_scale = stbtt_ScaleForPixelHeight(&tmp.FontInfo, cfg.SizePixels);
@@ -1488,6 +1602,10 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         float off_x = cfg.GlyphOffset.x;
         float off_y = cfg.GlyphOffset.y + (float)(int)(dst_font->Ascent + 0.5f);
 
+        // IrrIMGUI: The quads of distance field glyphs contain the distance field around the outline
+        const float spread = (float)atlas->TexGlyphSDFSpread;
+        const ImVec2 uv_spread(spread / atlas->TexWidth, spread / atlas->TexHeight);
+
         dst_font->FallbackGlyph = NULL; // Always clear fallback so FindGlyph can return NULL. It will be set again in BuildLookupTable()
         for (int i = 0; i < tmp.RangesCount; i++)
         {
@@ -1517,6 +1635,11 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                 glyph.V0 = q.t0; 
                 glyph.U1 = q.s1; 
                 glyph.V1 = q.t1;
+                if (spread > 0.0f && pc.x1 > pc.x0 && pc.y1 > pc.y0)
+                {
+                    glyph.X0 -= spread; glyph.Y0 -= spread; glyph.X1 += spread; glyph.Y1 += spread;
+                    glyph.U0 -= uv_spread.x; glyph.V0 -= uv_spread.y; glyph.U1 += uv_spread.x; glyph.V1 += uv_spread.y;
+                }
                 glyph.XAdvance = (pc.xadvance + cfg.GlyphExtraSpacing.x);  // Bake spacing into XAdvance
 
                 if (cfg.PixelSnapH)
@@ -1526,11 +1649,63 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
         cfg.DstFont->BuildLookupTable();
     }
+}
+
+bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->ConfigData.Size > 0);
+
+    ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
+
+    atlas->TexID = NULL;
+    atlas->TexWidth = atlas->TexHeight = 0;
+    atlas->TexUvWhitePixel = ImVec2(0, 0);
+    atlas->ClearTexData();
+
+    ImFontBuildFonts fonts;
+    if (!ImFontAtlasBuildBeginFonts(atlas, 0, &fonts))
+        return false;
+
+    // We need a width for the skyline algorithm. Using a dumb heuristic here to decide of width. User can override TexDesiredWidth and TexGlyphPadding if they wish.
+    // Width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
+    const int total_glyphs_count = fonts.GlyphsCount;
+    atlas->TexWidth = (atlas->TexDesiredWidth > 0) ? atlas->TexDesiredWidth : (total_glyphs_count > 4000) ? 4096 : (total_glyphs_count > 2000) ? 2048 : (total_glyphs_count > 1000) ? 1024 : 512;
+    atlas->TexHeight = 0;
+
+    // Start packing
+    const int max_tex_height = 1024*32;
+    stbtt_pack_context spc;
+    const int glyph_padding = ImFontAtlasBuildGetGlyphPadding(atlas);
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, max_tex_height, 0, glyph_padding, NULL);
+    stbtt_PackSetOversampling(&spc, 1, 1);
+
+    // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
+    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
+
+    // First font pass: pack all glyphs (no rendering at this point, we are working with rectangles in an infinitely tall texture at this point)
+    bool all_packed;
+    atlas->TexHeight = ImMax(atlas->TexHeight, ImFontAtlasBuildPackFonts(atlas, &fonts, &spc, &all_packed));
+    if (atlas->TexGlyphSDFSpread > 0)
+        atlas->TexHeight += glyph_padding; // IrrIMGUI: Space for the distance field below the last row of glyphs
+
+    // Create texture
+    atlas->TexHeight = ImUpperPowerOfTwo(atlas->TexHeight);
+    atlas->TexPixelsAlpha8 = (unsigned char*)ImGui::MemAlloc(atlas->TexWidth * atlas->TexHeight);
+    memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+    spc.pixels = atlas->TexPixelsAlpha8;
+    spc.height = atlas->TexHeight;
+
+    // Second pass: render font characters
+    ImFontAtlasBuildRenderFonts(atlas, &fonts, &spc);
+
+    // End packing
+    stbtt_PackEnd(&spc);
+
+    // Third pass: setup ImFont and glyphs for runtime
+    ImFontAtlasBuildSetupFonts(atlas, &fonts);
 
     // Cleanup temporaries
-    ImGui::MemFree(buf_packedchars);
-    ImGui::MemFree(buf_ranges);
-    ImGui::MemFree(tmp_array);
+    ImFontAtlasBuildEndFonts(&fonts);
 
     // Render into our custom data block
     ImFontAtlasBuildRenderDefaultTexData(atlas);
@@ -1538,6 +1713,153 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     return true;
 }
 
+// IrrIMGUI: Returns the first row of the atlas below all glyphs of the configs before end_config and below all custom rectangles.
+static int ImFontAtlasBuildGetUsedHeight(ImFontAtlas* atlas, int end_config)
+{
+    int used_height = 0;
+    for (int input_i = 0; input_i < end_config; input_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[input_i];
+        if (cfg.MergeMode)
+            continue;
+        for (int glyph_i = 0; glyph_i < cfg.DstFont->Glyphs.Size; glyph_i++)
+            used_height = ImMax(used_height, (int)(cfg.DstFont->Glyphs[glyph_i].V1 * atlas->TexHeight + 0.99f));
+    }
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        used_height = ImMax(used_height, atlas->CustomRects[i].Y + atlas->CustomRects[i].Height);
+    return used_height;
+}
+
+// IrrIMGUI: Builds the fonts of ConfigData[first_config] and behind into the empty rows of a built atlas. The glyphs and the size of the atlas stay
+// as they are, thus a texture of the atlas only needs to be updated by the returned rows. *out_pixels is allocated with ImGui::MemAlloc().
+// Returns false when the glyphs do not fit into the empty rows, in this case the atlas is not changed.
+bool    ImFontAtlasBuildAppendWithStbTruetype(ImFontAtlas* atlas, int first_config, unsigned char** out_pixels, int* out_y, int* out_height)
+{
+    IM_ASSERT(first_config > 0 && first_config < atlas->ConfigData.Size);
+    IM_ASSERT(atlas->TexWidth > 0 && atlas->TexHeight > 0);
+
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        if (!atlas->CustomRects[i].IsPacked())
+            return false;
+
+    // The used height ends with the pixels of the glyphs, the padding below them keeps the appended glyphs out of reach of bilinear filtering
+    const int glyph_padding = ImFontAtlasBuildGetGlyphPadding(atlas);
+    const int free_y = ImMin(ImFontAtlasBuildGetUsedHeight(atlas, first_config) + glyph_padding, atlas->TexHeight);
+    const int free_height = atlas->TexHeight - free_y;
+    if (free_height <= glyph_padding)
+        return false;
+
+    ImFontBuildFonts fonts;
+    if (!ImFontAtlasBuildBeginFonts(atlas, first_config, &fonts))
+        return false;
+
+    // Pack into the empty rows, the rectangles are relative to free_y
+    stbtt_pack_context spc;
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, free_height, 0, glyph_padding, NULL);
+    stbtt_PackSetOversampling(&spc, 1, 1);
+
+    bool all_packed;
+    int height = ImFontAtlasBuildPackFonts(atlas, &fonts, &spc, &all_packed);
+    if (atlas->TexGlyphSDFSpread > 0 && height > 0)
+        height = ImMin(height + glyph_padding, free_height);
+    if (!all_packed || height <= 0)
+    {
+        stbtt_PackEnd(&spc);
+        ImFontAtlasBuildEndFonts(&fonts);
+        return false;
+    }
+
+    unsigned char* pixels = (unsigned char*)ImGui::MemAlloc(atlas->TexWidth * height);
+    memset(pixels, 0, atlas->TexWidth * height);
+    spc.pixels = pixels;
+    spc.height = height;
+    ImFontAtlasBuildRenderFonts(atlas, &fonts, &spc);
+    stbtt_PackEnd(&spc);
+
+    // Move the rendered characters to their place inside the atlas
+    for (int i = 0; i < fonts.GlyphsCount; i++)
+    {
+        stbtt_packedchar& pc = fonts.BufPackedChars[i];
+        if (!pc.x0 && !pc.x1 && !pc.y0 && !pc.y1)
+            continue;
+        pc.y0 = (unsigned short)(pc.y0 + free_y);
+        pc.y1 = (unsigned short)(pc.y1 + free_y);
+    }
+
+    // Adding fonts may have moved the configs of the existing fonts
+    for (int input_i = 0; input_i < first_config; input_i++)
+        if (!atlas->ConfigData[input_i].MergeMode)
+            atlas->ConfigData[input_i].DstFont->ConfigData = &atlas->ConfigData[input_i];
+
+    ImFontAtlasBuildSetupFonts(atlas, &fonts);
+    ImFontAtlasBuildEndFonts(&fonts);
+
+    // Keep the texture data in sync, when it has not been cleared after the upload
+    if (atlas->TexPixelsAlpha8)
+        memcpy(atlas->TexPixelsAlpha8 + free_y * atlas->TexWidth, pixels, atlas->TexWidth * height);
+    if (atlas->TexPixelsRGBA32)
+    {
+        ImGui::MemFree(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = NULL;
+    }
+
+    *out_pixels = pixels;
+    *out_y = free_y;
+    *out_height = height;
+    return true;
+}
+
+// IrrIMGUI: Replaces the coverage of a glyph by its signed distance field. The rectangle (x, y, w, h) contains the glyph and 'spread' empty pixels on
+// every side. The stored value is 128 on the outline and falls to 0 outside or rises to 255 inside the glyph within 'spread' pixels.
+// A partly covered pixel is taken as a pixel, whose center is (0.5 - coverage) pixels outside of the outline.
+void    ImFontAtlasBuildDistanceField(unsigned char* pixels, int stride, int x, int y, int w, int h, int spread)
+{
+    if (w <= 0 || h <= 0 || spread <= 0)
+        return;
+
+    unsigned char* coverage = (unsigned char*)ImGui::MemAlloc((size_t)(w * h));
+    for (int row = 0; row < h; row++)
+        memcpy(coverage + row * w, pixels + (y + row) * stride + x, (size_t)w);
+
+    const float max_dist = (float)spread;
+    for (int py = 0; py < h; py++)
+        for (int px = 0; px < w; px++)
+        {
+            const int c = coverage[py * w + px];
+            float dist;
+            if (c > 0 && c < 255)
+            {
+                dist = 0.5f - c / 255.0f;
+            }
+            else
+            {
+                // Look for the nearest pixel at the other side of the outline
+                const bool inside = (c == 255);
+                float best = max_dist;
+                const int qy0 = ImMax(py - spread, 0), qy1 = ImMin(py + spread, h - 1);
+                const int qx0 = ImMax(px - spread, 0), qx1 = ImMin(px + spread, w - 1);
+                for (int qy = qy0; qy <= qy1; qy++)
+                    for (int qx = qx0; qx <= qx1; qx++)
+                    {
+                        const int cq = coverage[qy * w + qx];
+                        if (inside ? (cq == 255) : (cq == 0))
+                            continue;
+                        const float dx = (float)(qx - px), dy = (float)(qy - py);
+                        const float d2 = dx * dx + dy * dy;
+                        if (d2 >= (best + 0.5f) * (best + 0.5f))
+                            continue;
+                        const float d = sqrtf(d2) + (inside ? (cq / 255.0f - 0.5f) : (0.5f - cq / 255.0f));
+                        if (d < best)
+                            best = d;
+                    }
+                dist = inside ? -best : best;
+            }
+            pixels[(y + py) * stride + x + px] = (unsigned char)(ImSaturate(0.5f - dist / (2.0f * max_dist)) * 255.0f + 0.5f);
+        }
+
+    ImGui::MemFree(coverage);
+}
+
 void ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtlas* atlas)
 {
     // FIXME-WIP: We should register in the constructor (but cannot because our static instances may not have allocator ready by the time they initialize). This needs to be fixed because we can expose CustomRects.
@@ -1565,22 +1887,25 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* pack_context_opaq
 {
     stbrp_context* pack_context = (stbrp_context*)pack_context_opaque;
 
+    // IrrIMGUI: The distance field of a glyph must not reach into a rectangle, thus the rectangles get the padding of the glyphs on their left and top side
+    const int pad = (atlas->TexGlyphSDFSpread > 0) ? ImFontAtlasBuildGetGlyphPadding(atlas) : 0;
+
     ImVector<ImFontAtlas::CustomRect>& user_rects = atlas->CustomRects;
     ImVector<stbrp_rect> pack_rects;
     pack_rects.resize(user_rects.Size);
     memset(pack_rects.Data, 0, sizeof(stbrp_rect) * user_rects.Size);
     for (int i = 0; i < user_rects.Size; i++)
     {
-        pack_rects[i].w = user_rects[i].Width;
-        pack_rects[i].h = user_rects[i].Height;
+        pack_rects[i].w = user_rects[i].Width + pad;
+        pack_rects[i].h = user_rects[i].Height + pad;
     }
     stbrp_pack_rects(pack_context, &pack_rects[0], pack_rects.Size);
     for (int i = 0; i < pack_rects.Size; i++)
         if (pack_rects[i].was_packed)
         {
-            user_rects[i].X = pack_rects[i].x;
-            user_rects[i].Y = pack_rects[i].y;
-            IM_ASSERT(pack_rects[i].w == user_rects[i].Width && pack_rects[i].h == user_rects[i].Height);
+            user_rects[i].X = pack_rects[i].x + pad;
+            user_rects[i].Y = pack_rects[i].y + pad;
+            IM_ASSERT(pack_rects[i].w == user_rects[i].Width + pad && pack_rects[i].h == user_rects[i].Height + pad);
             atlas->TexHeight = ImMax(atlas->TexHeight, pack_rects[i].y + pack_rects[i].h);
         }
 }
@@ -1800,10 +2125,15 @@ void ImFontAtlas::GlyphRangesBuilder::BuildRanges(ImVector<ImWchar>* out_ranges)
 // ImFont
 //-----------------------------------------------------------------------------
 
+// IrrIMGUI: Source of ImFont::LayoutGeneration. It is global, thus a font created at the address of a deleted font gets a new generation.
+// It is atomic, since the atlases of different devices are built on different threads.
+static std::atomic<unsigned int> GImFontLayoutGeneration(0);
+
 ImFont::ImFont()
 {
     Scale = 1.0f;
     FallbackChar = (ImWchar)'?';
+    DynamicGlyphs = NULL;
     Clear();
 }
 
@@ -1834,6 +2164,7 @@ void    ImFont::Clear()
     ContainerAtlas = NULL;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    LayoutGeneration = ++GImFontLayoutGeneration;
 }
 
 void ImFont::BuildLookupTable()
@@ -1873,6 +2204,7 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i < max_codepoint + 1; i++)
         if (IndexXAdvance[i] < 0.0f)
             IndexXAdvance[i] = FallbackXAdvance;
+    LayoutGeneration = ++GImFontLayoutGeneration;
 }
 
 void ImFont::SetFallbackChar(ImWchar c)
@@ -1909,6 +2241,12 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (unsigned short)-1;
     IndexXAdvance[dst] = (src < index_size) ? IndexXAdvance.Data[src] : 1.0f;
+    LayoutGeneration = ++GImFontLayoutGeneration;
+}
+
+void ImFont::InvalidateLayouts()
+{
+    LayoutGeneration = ++GImFontLayoutGeneration;
 }
 
 const ImFont::Glyph* ImFont::FindGlyph(unsigned short c) const
@@ -1919,6 +2257,12 @@ const ImFont::Glyph* ImFont::FindGlyph(unsigned short c) const
         if (i != (unsigned short)-1)
             return &Glyphs.Data[i];
     }
+#ifdef IMGUI_FIND_DYNAMIC_GLYPH
+    // IrrIMGUI: Ask the dynamic glyph cache for glyphs, that are rasterized on demand.
+    if (DynamicGlyphs)
+        if (const Glyph* glyph = (const Glyph*)IMGUI_FIND_DYNAMIC_GLYPH(this, c))
+            return glyph;
+#endif
     return FallbackGlyph;
 }
 
@@ -2021,7 +2365,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
-ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
+ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining, bool* out_fallback) const
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
@@ -2094,6 +2438,8 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         }
 
         const float char_width = ((int)c < IndexXAdvance.Size ? IndexXAdvance[(int)c] : FallbackXAdvance) * scale;
+        if (out_fallback && (int)c >= IndexXAdvance.Size)
+            *out_fallback = true;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -2129,6 +2475,41 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     }
 }
 
+// IrrIMGUI: Copies the cached glyph quads of a text to the draw list. The cached vertices are relative to the text position
+// and are never changed, thus moving texts do not accumulate rounding errors.
+static void ImFontRenderTextLayout(ImDrawList* draw_list, const ImTextLayout* layout, const ImVec2& pos, ImU32 col)
+{
+    const int vtx_count = layout->QuadVertices.Size;
+    if (vtx_count == 0)
+        return;
+
+    draw_list->PrimReserve(vtx_count / 4 * 6, vtx_count);
+
+    const ImDrawVert* vtx_read = layout->QuadVertices.Data;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    for (int i = 0; i < vtx_count; i++)
+    {
+        vtx_write[i].pos.x = vtx_read[i].pos.x + pos.x;
+        vtx_write[i].pos.y = vtx_read[i].pos.y + pos.y;
+        vtx_write[i].uv = vtx_read[i].uv;
+        vtx_write[i].col = col;
+    }
+
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    for (int i = 0; i < vtx_count; i += 4)
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+        idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+        vtx_current_idx += 4;
+        idx_write += 6;
+    }
+
+    draw_list->_VtxWritePtr += vtx_count;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_current_idx;
+}
+
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
     if (!text_end)
@@ -2142,11 +2523,29 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (y > clip_rect.w)
         return;
 
+    // IrrIMGUI: The glyph quads of a text, that has been drawn completely inside the clip rectangle before, are copied from the text layout cache
+    ImTextLayout* layout = ImTextLayoutCacheFind(this, size, wrap_width, text_begin, text_end);
+    if (layout)
+    {
+        const ImVec4& bounds = layout->QuadBounds;
+        if (layout->HasQuads && pos.x + bounds.x >= clip_rect.x && pos.y + bounds.y >= clip_rect.y && pos.x + bounds.z <= clip_rect.z && pos.y + bounds.w <= clip_rect.w)
+        {
+            GImGui->TextLayoutHits++;
+            ImFontRenderTextLayout(draw_list, layout, pos, col);
+            return;
+        }
+        GImGui->TextLayoutMisses++;
+    }
+
     const float scale = size / FontSize;
     const float line_height = FontSize * scale;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
 
+    // IrrIMGUI: The bounds of all glyph quads and lines decide, whether the text is completely inside the clip rectangle
+    bool store_layout = layout && !layout->HasQuads;
+    ImVec4 layout_bounds(pos.x, pos.y, pos.x, pos.y + line_height);
+
     // Skip non-visible lines
     const char* s = text_begin;
     if (!word_wrap_enabled && y + line_height < clip_rect.y)
@@ -2162,6 +2561,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    const ImDrawVert* vtx_begin = vtx_write;
 
     while (s < text_end)
     {
@@ -2180,6 +2580,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 x = pos.x;
                 y += line_height;
                 word_wrap_eol = NULL;
+                layout_bounds.w = ImMax(layout_bounds.w, y + line_height);
 
                 // Wrapping skips upcoming blanks
                 while (s < text_end)
@@ -2210,6 +2611,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             {
                 x = pos.x;
                 y += line_height;
+                layout_bounds.w = ImMax(layout_bounds.w, y + line_height);
 
                 if (y > clip_rect.w)
                     break;
@@ -2223,7 +2625,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
         }
 
         float char_width = 0.0f;
-        if (const Glyph* glyph = FindGlyph((unsigned short)c))
+        const Glyph* glyph = FindGlyph((unsigned short)c);
+
+        // IrrIMGUI: A dynamic glyph, that is not available yet, falls back. It is drawn correctly later, thus the layout is not cached
+        if (store_layout && DynamicGlyphs && glyph == FallbackGlyph && c != FallbackChar)
+            store_layout = false;
+
+        if (glyph)
         {
             char_width = glyph->XAdvance * scale;
 
@@ -2235,6 +2643,16 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 float x2 = x + glyph->X1 * scale;
                 float y1 = y + glyph->Y0 * scale;
                 float y2 = y + glyph->Y1 * scale;
+                if (store_layout)
+                {
+                    // Glyphs of the dynamic glyph cache may move inside the atlas, they are not cached
+                    if (glyph < Glyphs.Data || glyph >= Glyphs.Data + Glyphs.Size)
+                        store_layout = false;
+                    layout_bounds.x = ImMin(layout_bounds.x, x1);
+                    layout_bounds.y = ImMin(layout_bounds.y, y1);
+                    layout_bounds.z = ImMax(layout_bounds.z, x2);
+                    layout_bounds.w = ImMax(layout_bounds.w, y2);
+                }
                 if (x1 <= clip_rect.z && x2 >= clip_rect.x)
                 {
                     // Render a character
@@ -2292,6 +2710,21 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
         x += char_width;
     }
 
+    // IrrIMGUI: Store the glyph quads, when nothing of the text has been clipped
+    if (store_layout && layout_bounds.x >= clip_rect.x && layout_bounds.y >= clip_rect.y && layout_bounds.z <= clip_rect.z && layout_bounds.w <= clip_rect.w)
+    {
+        const int vtx_count = (int)(vtx_write - vtx_begin);
+        layout->QuadVertices.resize(vtx_count);
+        for (int i = 0; i < vtx_count; i++)
+        {
+            layout->QuadVertices[i] = vtx_begin[i];
+            layout->QuadVertices[i].pos.x -= pos.x;
+            layout->QuadVertices[i].pos.y -= pos.y;
+        }
+        layout->QuadBounds = ImVec4(layout_bounds.x - pos.x, layout_bounds.y - pos.y, layout_bounds.z - pos.x, layout_bounds.w - pos.y);
+        layout->HasQuads = true;
+    }
+
     // Give back unused vertices
     draw_list->VtxBuffer.resize((int)(vtx_write - draw_list->VtxBuffer.Data));
     draw_list->IdxBuffer.resize((int)(idx_write - draw_list->IdxBuffer.Data));
@@ -2301,6 +2734,192 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size;
 }
 
+//-----------------------------------------------------------------------------
+// IrrIMGUI: TEXT LAYOUT CACHE
+//-----------------------------------------------------------------------------
+// The sizes and glyph quads of texts are kept for the next frame, thus labels, that do not change, are neither measured
+// nor laid out glyph by glyph again. The cache belongs to the current context, since every context draws its own texts.
+
+static void ImTextLayoutDestroy(ImTextLayout* layout)
+{
+    layout->~ImTextLayout();
+    ImGui::MemFree(layout);
+}
+
+static inline bool ImTextLayoutMatches(const ImTextLayout* layout, const ImFont* font, float size, float wrap_width, const char* text, int text_size)
+{
+    return layout->Font == font && layout->FontGeneration == font->LayoutGeneration && layout->Size == size && layout->WrapWidth == wrap_width &&
+        layout->Text.Size == text_size && memcmp(layout->Text.Data, text, (size_t)text_size) == 0;
+}
+
+// Hashes 4 bytes per step, since the bytes of a text would cost as much as measuring it. Collisions are found by comparing the text.
+static ImU32 ImTextLayoutHash(const char* text, int text_size, ImU32 seed)
+{
+    ImU32 hash = seed ^ (ImU32)text_size;
+    for (; text_size >= 4; text += 4, text_size -= 4)
+    {
+        ImU32 word;
+        memcpy(&word, text, sizeof(word));
+        hash = ((hash ^ word) * 0x9E3779B1u);
+        hash ^= hash >> 15;
+    }
+    for (; text_size > 0; text++, text_size--)
+        hash = (hash ^ (unsigned char)*text) * 0x01000193u;
+    hash ^= hash >> 13;
+    return hash * 0x85EBCA6Bu;
+}
+
+// Returns the bucket of the hash table, that contains the entry with the hash or the empty bucket, where it belongs to.
+static ImTextLayout** ImTextLayoutCacheFindBucket(ImGuiContext& g, ImGuiID hash)
+{
+    const int mask = g.TextLayoutBuckets.Size - 1;
+    for (int i = (int)(hash & mask); ; i = (i + 1) & mask)
+    {
+        ImTextLayout** bucket = &g.TextLayoutBuckets.Data[i];
+        if (*bucket == NULL || (*bucket)->Hash == hash)
+            return bucket;
+    }
+}
+
+// Builds the hash table of all entries with text. It is at least twice as large as the cache, thus it never gets full and the probe sequences stay short.
+static void ImTextLayoutCacheRebuildBuckets(ImGuiContext& g)
+{
+    const int entry_count = ImMax(g.IO.TextLayoutCacheSize, g.TextLayouts.Size);
+    int bucket_count = 16;
+    while (bucket_count < entry_count * 2)
+        bucket_count *= 2;
+    g.TextLayoutBuckets.resize(bucket_count);
+    memset(g.TextLayoutBuckets.Data, 0, (size_t)bucket_count * sizeof(ImTextLayout*));
+    for (int i = 0; i < g.TextLayouts.Size; i++)
+        *ImTextLayoutCacheFindBucket(g, g.TextLayouts[i]->Hash) = g.TextLayouts[i];
+}
+
+// Returns the entry of a text, that contains the results computed for the same text in the last and in the current frame.
+// Returns NULL, when the cache is disabled or when it is full.
+ImTextLayout* ImTextLayoutCacheFind(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_size = (int)(text_end - text_begin);
+    if (g.IO.TextLayoutCacheSize <= 0 || text_size <= 0)
+        return NULL;
+
+    // CalcTextSize() passes -1.0f and RenderText() passes 0.0f for texts without word-wrapping
+    if (wrap_width < 0.0f)
+        wrap_width = 0.0f;
+
+    if (g.TextLayoutLast && ImTextLayoutMatches(g.TextLayoutLast, font, size, wrap_width, text_begin, text_size))
+        return g.TextLayoutLast;
+
+    if (g.TextLayoutBuckets.Size < g.IO.TextLayoutCacheSize * 2)
+        ImTextLayoutCacheRebuildBuckets(g);
+
+    // The font settings are mixed into the seed instead of being hashed
+    ImU32 size_bits, wrap_width_bits;
+    memcpy(&size_bits, &size, sizeof(size_bits));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(wrap_width_bits));
+    const ImU32 seed = (ImU32)(size_t)font * 2654435761u ^ size_bits * 2246822519u ^ wrap_width_bits * 3266489917u;
+    const ImGuiID hash = ImTextLayoutHash(text_begin, text_size, seed);
+
+    ImTextLayout** bucket = ImTextLayoutCacheFindBucket(g, hash);
+    ImTextLayout* layout = *bucket;
+    if (layout)
+    {
+        if (ImTextLayoutMatches(layout, font, size, wrap_width, text_begin, text_size))
+        {
+            layout->LastFrame = g.FrameCount;
+            g.TextLayoutLast = layout;
+            return layout;
+        }
+        // The font has been built again or another text has the same hash: the entry is used for the new text
+    }
+    else
+    {
+        if (!g.TextLayoutsUnused.empty())
+        {
+            layout = g.TextLayoutsUnused.back();
+            g.TextLayoutsUnused.pop_back();
+        }
+        else if (g.TextLayouts.Size < g.IO.TextLayoutCacheSize)
+        {
+            layout = (ImTextLayout*)ImGui::MemAlloc(sizeof(ImTextLayout));
+            IM_PLACEMENT_NEW(layout) ImTextLayout();
+        }
+        else
+        {
+            return NULL;
+        }
+        g.TextLayouts.push_back(layout);
+        *bucket = layout;
+    }
+
+    layout->Font = font;
+    layout->FontGeneration = font->LayoutGeneration;
+    layout->Size = size;
+    layout->WrapWidth = wrap_width;
+    layout->Hash = hash;
+    layout->Text.resize(text_size);
+    memcpy(layout->Text.Data, text_begin, (size_t)text_size);
+    layout->LastFrame = g.FrameCount;
+    layout->HasTextSize = false;
+    layout->HasQuads = false;
+    layout->QuadVertices.resize(0);
+    g.TextLayoutLast = layout;
+    return layout;
+}
+
+// Removes the texts, that have not been drawn in the last frame. Their entries keep their memory for the texts of the next frames.
+void ImTextLayoutCacheCollect()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.IO.TextLayoutCacheSize <= 0)
+    {
+        ImTextLayoutCacheClear();
+        return;
+    }
+
+    g.TextLayoutLast = NULL;
+    int kept = 0;
+    for (int i = 0; i < g.TextLayouts.Size; i++)
+    {
+        ImTextLayout* layout = g.TextLayouts[i];
+        if (layout->LastFrame >= g.FrameCount - 1)
+        {
+            g.TextLayouts[kept++] = layout;
+        }
+        else
+        {
+            layout->Font = NULL;
+            g.TextLayoutsUnused.push_back(layout);
+        }
+    }
+
+    // A smaller cache size frees the unused entries
+    while (!g.TextLayoutsUnused.empty() && kept + g.TextLayoutsUnused.Size > g.IO.TextLayoutCacheSize)
+    {
+        ImTextLayoutDestroy(g.TextLayoutsUnused.back());
+        g.TextLayoutsUnused.pop_back();
+    }
+
+    if (kept != g.TextLayouts.Size)
+    {
+        g.TextLayouts.resize(kept);
+        ImTextLayoutCacheRebuildBuckets(g);
+    }
+}
+
+void ImTextLayoutCacheClear()
+{
+    ImGuiContext& g = *GImGui;
+    for (int i = 0; i < g.TextLayouts.Size; i++)
+        ImTextLayoutDestroy(g.TextLayouts[i]);
+    for (int i = 0; i < g.TextLayoutsUnused.Size; i++)
+        ImTextLayoutDestroy(g.TextLayoutsUnused[i]);
+    g.TextLayouts.clear();
+    g.TextLayoutsUnused.clear();
+    g.TextLayoutBuckets.clear();
+    g.TextLayoutLast = NULL;
+}
+
 //-----------------------------------------------------------------------------
 // DEFAULT FONT DATA
 //-----------------------------------------------------------------------------
@@ -111,6 +111,8 @@ IMGUI_API const ImWchar*ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* bu
 IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end);
 IMGUI_API int           ImFormatString(char* buf, int buf_size, const char* fmt, ...) IM_PRINTFARGS(3);
 IMGUI_API int           ImFormatStringV(char* buf, int buf_size, const char* fmt, va_list args);
+IMGUI_API int           ImFormatFloat(char* buf, int buf_size, const char* fmt, float v);      // IrrIMGUI: Same as ImFormatString(buf, buf_size, fmt, v), but "%.Nf" and "%g" are formatted without vsnprintf()
+IMGUI_API int           ImFormatInt(char* buf, int buf_size, const char* fmt, int v);          // IrrIMGUI: Same as ImFormatString(buf, buf_size, fmt, v), but "%d" is formatted without vsnprintf()
 
 // Helpers: Math
 // We are keeping those not leaking to the user by default, in the case the user has implicit cast operators between ImVec2 and its own types (when IM_VEC2_CLASS_EXTRA is defined)
@@ -390,6 +392,39 @@ struct ImGuiPopupRef
     ImGuiPopupRef(ImGuiID id, ImGuiWindow* parent_window, ImGuiID parent_menu_set, const ImVec2& mouse_pos) { PopupId = id; Window = NULL; ParentWindow = parent_window; ParentMenuSet = parent_menu_set; MousePosOnOpen = mouse_pos; }
 };
 
+// IrrIMGUI: Parsed display format of a single numeric value (see ImFormatFloat() and ImFormatInt())
+struct ImFormatSpec
+{
+    const char*             FormatPtr;          // Format the spec was parsed from, NULL when the format is too long to be cached
+    char                    Format[32];         // Copy of the format, since a buffer may be reused for another format
+    char                    Literals[32];       // Text before and after the value, with "%%" replaced by '%'
+    int                     PrefixLen;
+    int                     SuffixLen;
+    char                    Type;               // 'd', 'f' or 'g', or 0 when the format is passed to vsnprintf()
+    int                     Precision;
+
+    ImFormatSpec()          { FormatPtr = NULL; Format[0] = 0; PrefixLen = SuffixLen = 0; Type = 0; Precision = 0; }
+};
+
+// IrrIMGUI: Cached size and glyph quads of a text, that is drawn again in the next frame (see ImGuiIO::TextLayoutCacheSize)
+struct ImTextLayout
+{
+    const ImFont*           Font;               // NULL for an unused entry
+    unsigned int            FontGeneration;     // == Font->LayoutGeneration when the layout was computed
+    float                   Size;
+    float                   WrapWidth;          // 0.0f without word-wrapping
+    ImGuiID                 Hash;
+    ImVector<char>          Text;
+    int                     LastFrame;
+    bool                    HasTextSize;
+    ImVec2                  TextSize;           // Result of ImFont::CalcTextSizeA() without max_width
+    bool                    HasQuads;
+    ImVec4                  QuadBounds;         // Bounds of all glyph quads and lines relative to the aligned text position
+    ImVector<ImDrawVert>    QuadVertices;       // 4 vertices per glyph, relative to the aligned text position
+
+    ImTextLayout()          { Font = NULL; FontGeneration = 0; Size = WrapWidth = 0.0f; Hash = 0; LastFrame = -1; HasTextSize = HasQuads = false; }
+};
+
 // Main state for ImGui
 struct ImGuiContext
 {
@@ -489,6 +524,17 @@ struct ImGuiContext
     int                     CaptureKeyboardNextFrame;
     char                    TempBuffer[1024*3+1];               // temporary text buffer
 
+    // IrrIMGUI: Text layout cache
+    ImVector<ImTextLayout*> TextLayouts;                        // Entries with text
+    ImVector<ImTextLayout*> TextLayoutsUnused;                  // Allocated entries without text, that are used for new texts
+    ImVector<ImTextLayout*> TextLayoutBuckets;                  // Open addressing hash table of TextLayouts, the size is a power of 2
+    ImTextLayout*           TextLayoutLast;                     // Result of the last lookup, since a text is usually measured and rendered one after the other
+    int                     TextLayoutHits;                     // Counters of the current frame
+    int                     TextLayoutMisses;
+
+    // IrrIMGUI: Direct mapped cache of parsed display formats, indexed by the format pointer
+    ImFormatSpec            FormatSpecs[16];
+
     ImGuiContext()
     {
         Initialized = false;
@@ -559,6 +605,8 @@ struct ImGuiContext
         FramerateSecPerFrameAccum = 0.0f;
         CaptureMouseNextFrame = CaptureKeyboardNextFrame = -1;
         memset(TempBuffer, 0, sizeof(TempBuffer));
+        TextLayoutLast = NULL;
+        TextLayoutHits = TextLayoutMisses = 0;
     }
 };
 
@@ -812,6 +860,15 @@ namespace ImGui
 
 // ImFontAtlas internals
 IMGUI_API bool              ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasBuildAppendWithStbTruetype(ImFontAtlas* atlas, int first_config, unsigned char** out_pixels, int* out_y, int* out_height); // IrrIMGUI
+IMGUI_API void              ImFontAtlasBuildDistanceField(unsigned char* pixels, int stride, int x, int y, int w, int h, int spread); // IrrIMGUI
+IMGUI_API void*             ImFontAtlasBuildDecompressTTF(const void* compressed_ttf_data, int compressed_ttf_size, int* out_size); // IrrIMGUI
+IMGUI_API void*             ImFontAtlasBuildDecompressBase85TTF(const char* compressed_ttf_data_base85, int* out_size); // IrrIMGUI
+
+// IrrIMGUI: Text layout cache of the current context (see ImGuiIO::TextLayoutCacheSize)
+IMGUI_API ImTextLayout*     ImTextLayoutCacheFind(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end);
+IMGUI_API void              ImTextLayoutCacheCollect();
+IMGUI_API void              ImTextLayoutCacheClear();
 IMGUI_API void              ImFontAtlasBuildRegisterDefaultCustomRects(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent); 
 IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* spc);
@@ -0,0 +1,135 @@
+/**
+ * @file   CIMGUIDrawDataReader.h
+ * @author Andre Netzeband
+ * @brief  Contains a reader, that replays the draw data of captured GUI frames.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIDRAWDATAREADER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIDRAWDATAREADER_H_
+
+// library includes
+#include <fstream>
+#include <vector>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIMGUI.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief Reads the draw data of GUI frames, that have been captured by CIMGUIDrawDataWriter.
+   * @details
+   *   Every frame is returned as ImDrawData, that can be passed directly to the render function of a backend
+   *   (for example to "ImGui::GetIO().RenderDrawListsFn" of a handle).
+   *
+   *   The texture handles of the capture are only valid inside the captured process. Use setTextures() to replace them
+   *   with textures of the replaying process.
+   *
+   *   @code
+
+IrrIMGUI::CIMGUIDrawDataReader Reader;
+Reader.open("Session.imdd");
+Reader.setTextures(ImGui::GetIO().Fonts->TexID, nullptr);
+
+while (ImDrawData * const pDrawData = Reader.readFrame())
+{
+  ImGui::GetIO().DisplaySize = Reader.getDisplaySize();
+  ImGui::GetIO().RenderDrawListsFn(pDrawData);
+}
+
+ @endcode
+   *
+   *   @note The draw lists are allocated with the IMGUI memory functions, thus destroy the reader while the same IMGUI context is current.
+   */
+  class IRRIMGUI_DLL_API CIMGUIDrawDataReader
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      CIMGUIDrawDataReader(void);
+
+      /// @brief Destructor. Closes the file.
+      ~CIMGUIDrawDataReader(void);
+
+      /// @brief Copy Constructor does not exist.
+      CIMGUIDrawDataReader(CIMGUIDrawDataReader const &rCopyReader) = delete;
+
+      /// @}
+
+      /// @{
+      /// @name File handling
+
+      /// @brief Opens a capture file. An already opened file is closed before.
+      /// @param pFileName Is the name of the file.
+      /// @return Returns false, when the file cannot be opened or is not a capture file of this IMGUI version.
+      bool open(char const * pFileName);
+
+      /// @brief Closes the capture file.
+      void close(void);
+
+      /// @return Returns true, when a capture file is opened.
+      bool isOpen(void) const;
+
+      /// @brief Restarts the replay with the first frame of the file.
+      /// @return Returns false, when no file is opened.
+      bool rewind(void);
+
+      /// @}
+
+      /// @{
+      /// @name Replay
+
+      /// @brief Replaces the captured texture handles while reading. Call it before reading the first frame.
+      /// @param FontTexture  Is the texture, that replaces the captured font texture. When it is nullptr, the captured handles are not replaced.
+      /// @param OtherTexture Is the texture, that replaces all other captured textures. When it is nullptr, the font texture is used.
+      void setTextures(ImTextureID FontTexture, ImTextureID OtherTexture);
+
+      /// @brief Reads the next frame.
+      /// @return Returns a pointer to the draw data of the frame, that is valid until the next frame is read. At the end of the file or for corrupt data nullptr is returned.
+      ImDrawData * readFrame(void);
+
+      /// @return Returns the display size of the last read frame.
+      ImVec2 getDisplaySize(void) const;
+
+      /// @return Returns the number of frames read since opening or rewinding the file.
+      unsigned int getNumberOfFrames(void) const;
+
+      /// @}
+
+    private:
+      /// @brief Reads the data of a draw list from the file.
+      bool readList(ImDrawList * pList, ImTextureID CapturedFontTexture);
+
+      /// @brief Removes all draw lists.
+      void deleteLists(void);
+
+      /// @brief Returns the number of bytes between the read position and the end of the file.
+      irr::u64 getRemainingBytes(void);
+
+      std::ifstream             mFile;
+      std::streampos            mFirstFramePosition;
+      std::streampos            mEndPosition;
+      std::vector<ImDrawList *> mLists;
+      unsigned int              mNumberOfReadLists;
+      ImDrawData                mDrawData;
+      ImVec2                    mDisplaySize;
+      ImTextureID               mFontTexture;
+      ImTextureID               mOtherTexture;
+      unsigned int              mNumberOfFrames;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIDRAWDATAREADER_H_ */
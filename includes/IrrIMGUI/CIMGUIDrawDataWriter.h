@@ -0,0 +1,102 @@
+/**
+ * @file   CIMGUIDrawDataWriter.h
+ * @author Andre Netzeband
+ * @brief  Contains a writer, that captures the draw data of GUI frames into a file.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIDRAWDATAWRITER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIDRAWDATAWRITER_H_
+
+// library includes
+#include <fstream>
+#include <vector>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIMGUI.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief Captures the draw data (draw lists, vertices, indices, commands and texture handles) of GUI frames into a file.
+   * @details
+   *   The file can be replayed with CIMGUIDrawDataReader to measure a renderer with the draw data of a real session.
+   *   To capture the frames of a handle, set SIMGUISettings::mpDrawDataWriter to an opened writer.
+   *
+   *   A draw list, that is equal to the draw list at the same position in the previous frame, is only stored as a
+   *   small marker. Thus static windows cost nearly nothing and the capture can be used in production builds.
+   *
+   *   @note User callbacks of draw commands cannot be captured, they are stored as empty draw commands.
+   */
+  class IRRIMGUI_DLL_API CIMGUIDrawDataWriter
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      CIMGUIDrawDataWriter(void);
+
+      /// @brief Destructor. Closes the file.
+      ~CIMGUIDrawDataWriter(void);
+
+      /// @brief Copy Constructor does not exist.
+      CIMGUIDrawDataWriter(CIMGUIDrawDataWriter const &rCopyWriter) = delete;
+
+      /// @}
+
+      /// @{
+      /// @name File handling
+
+      /// @brief Opens a new capture file. An already opened file is closed before.
+      /// @param pFileName Is the name of the file.
+      /// @return Returns false, when the file cannot be opened.
+      bool open(char const * pFileName);
+
+      /// @brief Closes the capture file.
+      void close(void);
+
+      /// @return Returns true, when a capture file is opened.
+      bool isOpen(void) const;
+
+      /// @}
+
+      /// @{
+      /// @name Capture
+
+      /// @brief Writes the draw data of a frame into the file.
+      /// @param pDrawData    Is a pointer to the draw data of the frame. When it is nullptr or not valid, an empty frame is written.
+      /// @param rDisplaySize Is the display size of the frame.
+      /// @param FontTexture  Is the texture ID of the font atlas. It is used to map the font texture during the replay.
+      /// @return Returns false, when no file is opened or the frame cannot be written.
+      bool writeFrame(ImDrawData const * pDrawData, ImVec2 const &rDisplaySize, ImTextureID FontTexture);
+
+      /// @return Returns the number of frames written into the current file.
+      unsigned int getNumberOfFrames(void) const;
+
+      /// @return Returns the number of bytes written into the current file.
+      irr::u64 getNumberOfBytes(void) const;
+
+      /// @}
+
+    private:
+      std::ofstream                  mFile;
+      std::vector<std::vector<char>> mPreviousLists;
+      std::vector<char>              mListBuffer;
+      std::vector<char>              mFrameBuffer;
+      unsigned int                   mNumberOfFrames;
+      irr::u64                       mNumberOfBytes;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIDRAWDATAWRITER_H_ */
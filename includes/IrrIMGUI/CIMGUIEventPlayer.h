@@ -0,0 +1,123 @@
+/**
+ * @file   CIMGUIEventPlayer.h
+ * @author Andre Netzeband
+ * @brief  Contains a player, that injects recorded input events into an event receiver.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIEVENTPLAYER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIEVENTPLAYER_H_
+
+// library includes
+#include <vector>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief Replays the input events of a file, that has been recorded with CIMGUIEventRecorder.
+   * @details
+   *   Call playFrame() once before every "startGUI()". It injects the events of this frame into the event receiver of the GUI,
+   *   thus the GUI gets exactly the same input states as during the recording. Together with a CIMGUIFixedStepClock as
+   *   SIMGUISettings::mpFrameClock every replay builds identical frames, which is useful for benchmarks of the widget code.
+   *
+   *   @code
+
+IrrIMGUI::CIMGUIFixedStepClock Clock(16666667);
+IrrIMGUI::SIMGUISettings Settings;
+Settings.mpFrameClock = &Clock;
+
+IrrIMGUI::CIMGUIEventReceiver EventReceiver;
+IrrIMGUI::IIMGUIHandle * const pGUI = IrrIMGUI::createIMGUI(pDevice, &EventReceiver, &Settings);
+
+IrrIMGUI::CIMGUIEventPlayer Player;
+Player.open("Session.input");
+
+while (!Player.isFinished())
+{
+  Player.playFrame(EventReceiver);
+  pGUI->startGUI();
+  drawMyGUI();
+  pGUI->drawAll();
+}
+
+ @endcode
+   */
+  class IRRIMGUI_DLL_API CIMGUIEventPlayer
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      CIMGUIEventPlayer(void);
+
+      /// @brief Destructor.
+      ~CIMGUIEventPlayer(void);
+
+      /// @}
+
+      /// @{
+      /// @name File handling
+
+      /// @brief Reads all events of a recording file into memory. Already read events are removed before.
+      /// @param pFileName Is the name of the file.
+      /// @return Returns false, when the file cannot be opened or is not a recording file.
+      bool open(char const * pFileName);
+
+      /// @brief Removes all events.
+      void close(void);
+
+      /// @brief Restarts the replay with the first frame.
+      void rewind(void);
+
+      /// @}
+
+      /// @{
+      /// @name Replay
+
+      /// @brief Injects all events of the next frame into an event receiver.
+      /// @param rReceiver Is a reference to the event receiver (usually a CIMGUIEventReceiver, that is the event storage of the GUI).
+      /// @return Returns the number of injected events.
+      unsigned int playFrame(irr::IEventReceiver &rReceiver);
+
+      /// @return Returns true, when all events have been injected.
+      bool isFinished(void) const;
+
+      /// @return Returns the number of frames played since opening or rewinding.
+      unsigned int getFrameNumber(void) const;
+
+      /// @return Returns the number of events in the recording.
+      unsigned int getNumberOfEvents(void) const;
+
+      /// @return Returns the number of frames in the recording (the frame of the last event plus 1).
+      unsigned int getNumberOfFrames(void) const;
+
+      /// @}
+
+    private:
+      /// @brief A recorded event.
+      struct SRecordedEvent
+      {
+        unsigned int mFrameNumber;
+        irr::SEvent  mEvent;
+      };
+
+      std::vector<SRecordedEvent> mEvents;
+      size_t                      mNextEvent;
+      unsigned int                mFrameNumber;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIEVENTPLAYER_H_ */
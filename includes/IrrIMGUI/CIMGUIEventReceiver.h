@@ -14,6 +14,7 @@
 
 // module includes
 #include "IrrIMGUIConfig.h"
+#include "CIMGUIEventRecorder.h"
 
 /**
  * @addtogroup IrrIMGUI
@@ -25,6 +26,12 @@ namespace IrrIMGUI
   class CIMGUIEventReceiver : public irr::IEventReceiver, public CIMGUIEventStorage
   {
     public:
+      /// @brief Constructor.
+      CIMGUIEventReceiver(void):
+        mpRecorder(nullptr),
+        mRecordingStartFrame(0)
+      {}
+
       /// @brief This function is called by Irrlicht, when an Event occurs.
       /// @param rEvent is a reference to that event.
       /// @return Returns true, if the event has completely been handled by that Receiver.
@@ -32,12 +39,33 @@ namespace IrrIMGUI
       {
         bool EventCompletelyHandled = false;
 
+        if (mpRecorder)
+        {
+          mpRecorder->recordEvent(rEvent, mFrameNumber - mRecordingStartFrame);
+        }
+
         EventCompletelyHandled = EventCompletelyHandled || checkKeyboardEvents(rEvent);
         EventCompletelyHandled = EventCompletelyHandled || checkMouseEvents(rEvent);
 
         return EventCompletelyHandled;
       }
 
+      /// @brief Sets a recorder, that writes all received mouse and keyboard events into a file.
+      /// @param pRecorder Is a pointer to the recorder or nullptr to stop the recording. The frame numbers of the recording start with 0.
+      /// @note  The receiver does not take the ownership of the recorder, it must live as long as the receiver uses it.
+      void setRecorder(CIMGUIEventRecorder * pRecorder)
+      {
+        mpRecorder           = pRecorder;
+        mRecordingStartFrame = mFrameNumber;
+        return;
+      }
+
+      /// @return Returns a pointer to the recorder or nullptr, when no recorder is set.
+      CIMGUIEventRecorder * getRecorder(void) const
+      {
+        return mpRecorder;
+      }
+
     private:
       /// @brief Checks the events that are mouse related.
       /// @param rEvent is a reference to that event.
@@ -49,6 +77,9 @@ namespace IrrIMGUI
       /// @return Returns true, if the event has completely been handled by that Receiver.
       bool IRRIMGUI_DLL_API checkKeyboardEvents(irr::SEvent const &rEvent);
 
+      CIMGUIEventRecorder * mpRecorder;
+      unsigned int          mRecordingStartFrame;
+
   };
 }
 
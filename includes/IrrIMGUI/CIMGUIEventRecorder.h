@@ -0,0 +1,92 @@
+/**
+ * @file   CIMGUIEventRecorder.h
+ * @author Andre Netzeband
+ * @brief  Contains a recorder, that writes the input events of the GUI into a file.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIEVENTRECORDER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIEVENTRECORDER_H_
+
+// library includes
+#include <fstream>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief Records the mouse and keyboard events of the GUI with frame number and timestamp into a text file.
+   * @details
+   *   Pass the recorder to CIMGUIEventReceiver::setRecorder(), then every mouse and keyboard event, that is received by
+   *   Irrlicht, is written into the file. Replay the file with CIMGUIEventPlayer to build the same GUI frames again.
+   *
+   *   Every line of the file contains a single event:
+   *   @li Mouse:    "<Frame> <Nanoseconds> M <Event> <X> <Y> <Wheel> <Shift> <Control> <ButtonStates>"
+   *   @li Keyboard: "<Frame> <Nanoseconds> K <Key> <Char> <PressedDown> <Shift> <Control>"
+   */
+  class IRRIMGUI_DLL_API CIMGUIEventRecorder
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      CIMGUIEventRecorder(void);
+
+      /// @brief Destructor. Closes the file.
+      ~CIMGUIEventRecorder(void);
+
+      /// @brief Copy Constructor does not exist.
+      CIMGUIEventRecorder(CIMGUIEventRecorder const &rCopyRecorder) = delete;
+
+      /// @}
+
+      /// @{
+      /// @name File handling
+
+      /// @brief Opens a new recording file. An already opened file is closed before.
+      /// @param pFileName Is the name of the file.
+      /// @return Returns false, when the file cannot be opened.
+      bool open(char const * pFileName);
+
+      /// @brief Closes the recording file.
+      void close(void);
+
+      /// @return Returns true, when a recording file is opened.
+      bool isOpen(void) const;
+
+      /// @}
+
+      /// @{
+      /// @name Recording
+
+      /// @brief Writes an event into the file. Events, that are neither mouse nor keyboard events, are ignored.
+      /// @param rEvent      Is a reference to the event.
+      /// @param FrameNumber Is the number of GUI frames since the recording has been started.
+      /// @return Returns true, when the event has been recorded.
+      bool recordEvent(irr::SEvent const &rEvent, unsigned int FrameNumber);
+
+      /// @return Returns the number of recorded events since opening the file.
+      unsigned int getNumberOfEvents(void) const;
+
+      /// @}
+
+    private:
+      std::ofstream mFile;
+      irr::u64      mStartNanoseconds;
+      unsigned int  mNumberOfEvents;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIEVENTRECORDER_H_ */
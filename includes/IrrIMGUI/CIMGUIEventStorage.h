@@ -52,7 +52,8 @@ namespace IrrIMGUI
         mKeyZPressed(false),
         mCtrlPressed(false),
         mShiftPressed(false),
-        mAltPressed(false)
+        mAltPressed(false),
+        mFrameNumber(0)
       {}
 
       ///@{
@@ -102,6 +103,14 @@ namespace IrrIMGUI
 
       /// @}
 
+      /// @{
+      /// @name Frame counter
+
+      /// @brief The number of frames, that have read the input states of this storage so far. It assigns recorded input events to frames.
+      unsigned int mFrameNumber;
+
+      /// @}
+
   };
 }
 
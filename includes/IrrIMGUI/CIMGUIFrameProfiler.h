@@ -0,0 +1,356 @@
+/**
+ * @file   CIMGUIFrameProfiler.h
+ * @author Andre Netzeband
+ * @brief  Contains a profiler that records the CPU and GPU timings of the last GUI frames.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMEPROFILER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMEPROFILER_H_
+
+// library includes
+#include <map>
+#include <string>
+#include <vector>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIMGUI.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /// @brief Stores the timings and the draw statistics of a single GUI frame.
+  struct IRRIMGUI_DLL_API SIMGUIFrameProfile
+  {
+    public:
+      /// @brief Constructor to reset all values to 0.
+      SIMGUIFrameProfile(void):
+        mFrameNumber(0),
+        mStartGUINanoseconds(0),
+        mWidgetNanoseconds(0),
+        mRenderNanoseconds(0),
+        mSubmitNanoseconds(0),
+        mGPUNanoseconds(0),
+        mIsGPUTimeValid(false),
+        mDrawLists(0),
+        mVertices(0),
+        mIndices(0),
+        mDrawCalls(0),
+        mTextureBinds(0),
+        mBufferBytes(0),
+        mAllocations(0),
+        mSystemAllocations(0),
+        mFrees(0),
+        mReallocations(0),
+        mAllocatedBytes(0),
+        mLiveBytes(0),
+        mPeakBytes(0),
+        mTextLayoutHits(0),
+        mTextLayoutMisses(0)
+      {}
+
+      /// @{
+      /// @name Timings
+
+      /// @brief The IMGUI frame number of this frame.
+      int      mFrameNumber;
+
+      /// @brief CPU time of "startGUI()" (input, timing and IMGUI NewFrame) in nanoseconds.
+      irr::u64 mStartGUINanoseconds;
+
+      /// @brief CPU time of the widget code between "startGUI()" and "finishGUI()" or "drawAll()" in nanoseconds.
+      irr::u64 mWidgetNanoseconds;
+
+      /// @brief CPU time of building the draw data (IMGUI Render) in nanoseconds.
+      irr::u64 mRenderNanoseconds;
+
+      /// @brief CPU time of submitting the draw data to the graphic API in nanoseconds.
+      irr::u64 mSubmitNanoseconds;
+
+      /// @brief GPU time of the GUI render pass in nanoseconds. Only valid when mIsGPUTimeValid is true.
+      irr::u64 mGPUNanoseconds;
+
+      /// @brief Is true, when the GPU time of this frame has been measured. The GPU time arrives some frames later.
+      bool     mIsGPUTimeValid;
+
+      /// @}
+
+      /// @{
+      /// @name Draw statistics
+
+      /// @brief The number of draw lists (one per window).
+      unsigned int mDrawLists;
+
+      /// @brief The number of vertices sent to the GPU.
+      unsigned int mVertices;
+
+      /// @brief The number of indices sent to the GPU.
+      unsigned int mIndices;
+
+      /// @brief The number of draw calls (draw commands without user callback).
+      unsigned int mDrawCalls;
+
+      /// @brief The number of texture changes between the draw calls.
+      unsigned int mTextureBinds;
+
+      /// @brief The number of bytes uploaded into vertex and index buffers.
+      unsigned int mBufferBytes;
+
+      /// @}
+
+      /// @{
+      /// @name Memory statistics
+
+      /// @brief The number of IMGUI memory allocations from "startGUI()" until the draw data has been submitted.
+      unsigned int mAllocations;
+
+      /// @brief The number of allocations, that reached the system allocator. Without frame allocator this is equal to mAllocations.
+      unsigned int mSystemAllocations;
+
+      /// @brief The number of IMGUI memory frees in this frame.
+      unsigned int mFrees;
+
+      /// @brief The number of allocations, that replaced a smaller block (growing IMGUI vectors).
+      unsigned int mReallocations;
+
+      /// @brief The number of requested bytes of all allocations in this frame.
+      irr::u64     mAllocatedBytes;
+
+      /// @brief The number of bytes allocated by the IMGUI context at the end of this frame.
+      irr::u64     mLiveBytes;
+
+      /// @brief The highest number of bytes allocated by the IMGUI context during this frame.
+      irr::u64     mPeakBytes;
+
+      /// @}
+
+      /// @{
+      /// @name Text layout cache statistics
+
+      /// @brief The number of text sizes and text renderings, that have been taken from the text layout cache.
+      unsigned int mTextLayoutHits;
+
+      /// @brief The number of text sizes and text renderings, that have been computed while the text layout cache was enabled.
+      unsigned int mTextLayoutMisses;
+
+      /// @}
+
+      /// @return Returns the whole CPU time of this frame in nanoseconds.
+      irr::u64 getCPUNanoseconds(void) const
+      {
+        return mStartGUINanoseconds + mWidgetNanoseconds + mRenderNanoseconds + mSubmitNanoseconds;
+      }
+  };
+
+  /// @brief Stores the sampled allocations of a window.
+  struct IRRIMGUI_DLL_API SIMGUIAllocationSample
+  {
+    public:
+      /// @brief Constructor to reset all values to 0.
+      SIMGUIAllocationSample(void):
+        mSamples(0),
+        mBytes(0)
+      {}
+
+      /// @brief The name of the IMGUI window, that was built while the allocations were sampled.
+      std::string  mLocation;
+
+      /// @brief The number of sampled allocations.
+      unsigned int mSamples;
+
+      /// @brief The number of requested bytes of the sampled allocations.
+      irr::u64     mBytes;
+  };
+
+  /// @brief Stores the time, that was needed to create the graphic objects of the renderer (see IIMGUIHandle::prepare()).
+  struct IRRIMGUI_DLL_API SIMGUIStartupProfile
+  {
+    public:
+      /// @brief Constructor to reset all values.
+      SIMGUIStartupProfile(void):
+        mIsPrepared(false),
+        mIsProgramFromCache(false),
+        mPrepareNanoseconds(0)
+      {}
+
+      /// @brief Is true, when the graphic objects have been created by this handle.
+      bool     mIsPrepared;
+
+      /// @brief Is true for a warm start, where the shader program was loaded from the program cache instead of being compiled.
+      bool     mIsProgramFromCache;
+
+      /// @brief The time to create the shader program, the buffers and the font texture in nanoseconds.
+      irr::u64 mPrepareNanoseconds;
+  };
+
+  /// @brief Stores the number of bytes, that the fonts of a device keep in CPU memory.
+  struct IRRIMGUI_DLL_API SIMGUIFontMemory
+  {
+    public:
+      /// @brief Constructor to reset all values to 0.
+      SIMGUIFontMemory(void):
+        mTTFBytes(0),
+        mReleasedTTFBytes(0),
+        mAtlasPixelBytes(0),
+        mGlyphBytes(0),
+        mDynamicGlyphBytes(0)
+      {}
+
+      /// @brief The TTF data of all fonts, that is in memory.
+      irr::u64 mTTFBytes;
+
+      /// @brief The TTF data, that has been released after the font atlas has been cached (see SIMGUISettings::mFontDataPolicy).
+      ///        It is not part of the total bytes.
+      irr::u64 mReleasedTTFBytes;
+
+      /// @brief The pixels of the font atlas. They are released, when the font texture has been uploaded.
+      irr::u64 mAtlasPixelBytes;
+
+      /// @brief The glyph tables of all fonts.
+      irr::u64 mGlyphBytes;
+
+      /// @brief The pixels and glyph tables of the caches for dynamic glyphs.
+      irr::u64 mDynamicGlyphBytes;
+
+      /// @return Returns the number of bytes, that are in memory.
+      irr::u64 getTotalBytes(void) const
+      {
+        return mTTFBytes + mAtlasPixelBytes + mGlyphBytes + mDynamicGlyphBytes;
+      }
+  };
+
+  /**
+   * @brief Records the profiles of the last N GUI frames in a ring buffer.
+   * @details
+   *   Every GUI handle owns a profiler, that is filled when SIMGUISettings::mIsProfilerEnabled is true.
+   *   Use IIMGUIHandle::getProfiler() to query the recorded frames or to show them in an overlay window.
+   *
+   *   When SIMGUISettings::mAllocationSamplingInterval is not 0, every n-th IMGUI allocation is sampled together with
+   *   the window, that was built at this moment. Windows that still allocate in a steady state show up in the samples.
+   */
+  class IRRIMGUI_DLL_API CIMGUIFrameProfiler
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      /// @param HistorySize Is the number of frames, that are stored in the ring buffer.
+      CIMGUIFrameProfiler(unsigned int HistorySize = 120);
+
+      /// @brief Destructor.
+      ~CIMGUIFrameProfiler(void);
+
+      /// @}
+
+      /// @{
+      /// @name Query recorded frames
+
+      /// @return Returns the number of frames, that can be stored at most.
+      unsigned int getHistorySize(void) const;
+
+      /// @param HistorySize Is the number of frames, that can be stored at most. Changing the size removes all recorded frames.
+      void setHistorySize(unsigned int HistorySize);
+
+      /// @return Returns the number of recorded frames.
+      unsigned int getNumberOfFrames(void) const;
+
+      /// @param Index Is the index of the frame, 0 is the newest frame and "getNumberOfFrames()-1" the oldest one.
+      /// @return Returns a reference to the profile of the frame.
+      SIMGUIFrameProfile const &getFrame(unsigned int Index) const;
+
+      /// @return Returns the average profile of all recorded frames. The GPU time is only averaged over frames with a valid GPU time.
+      SIMGUIFrameProfile getAverage(void) const;
+
+      /// @brief Removes all recorded frames.
+      void clear(void);
+
+      /// @}
+
+      /// @{
+      /// @name Record frames
+
+      /// @brief Adds a frame to the ring buffer. When the buffer is full, the oldest frame is removed.
+      /// @param rProfile Is a reference to the profile of the frame.
+      void addFrame(SIMGUIFrameProfile const &rProfile);
+
+      /// @brief Sets the GPU time of a recorded frame. When the frame is not in the ring buffer anymore, the time is ignored.
+      /// @param FrameNumber Is the IMGUI frame number of the frame.
+      /// @param Nanoseconds Is the GPU time in nanoseconds.
+      void setGPUTime(int FrameNumber, irr::u64 Nanoseconds);
+
+      /// @brief Counts the vertices, indices, draw calls, texture changes and buffer bytes of the draw data.
+      /// @param pDrawData Is a pointer to the draw data to count.
+      /// @param rProfile  Is a reference to the profile, where the numbers are stored.
+      static void countDrawData(ImDrawData const * pDrawData, SIMGUIFrameProfile &rProfile);
+
+      /// @}
+
+      /// @{
+      /// @name Allocation samples
+
+      /// @brief Adds a sampled allocation.
+      /// @param pLocation Is the name of the window, that was built while allocating.
+      /// @param Bytes     Is the number of requested bytes.
+      void addAllocationSample(char const * pLocation, irr::u64 Bytes);
+
+      /// @return Returns the sampled allocations of every window, the window with the most samples is the first one.
+      std::vector<SIMGUIAllocationSample> getAllocationSamples(void) const;
+
+      /// @brief Removes all sampled allocations.
+      void clearAllocationSamples(void);
+
+      /// @}
+
+      /// @{
+      /// @name Startup
+
+      /// @return Returns the time, that was needed to create the graphic objects of the renderer.
+      SIMGUIStartupProfile const &getStartup(void) const;
+
+      /// @param rStartup Is the time, that was needed to create the graphic objects of the renderer.
+      void setStartup(SIMGUIStartupProfile const &rStartup);
+
+      /// @}
+
+      /// @{
+      /// @name Font memory
+
+      /// @return Returns the memory of the fonts at the end of the last recorded frame.
+      SIMGUIFontMemory const &getFontMemory(void) const;
+
+      /// @param rFontMemory Is the memory of the fonts.
+      void setFontMemory(SIMGUIFontMemory const &rFontMemory);
+
+      /// @}
+
+      /// @{
+      /// @name Overlay
+
+      /// @brief Draws an IMGUI window, that shows the average timings and a graph of the frame times.
+      /// @param pIsOpen Is a pointer to a bool, that is set to false when the window is closed. Use nullptr for a window without close button.
+      /// @note  Call this between "startGUI()" and "drawAll()". The overlay shows the recorded frames, not the current one.
+      void drawOverlay(bool * pIsOpen = nullptr) const;
+
+      /// @}
+
+    private:
+      std::vector<SIMGUIFrameProfile> mFrames;
+      unsigned int                    mNextFrame;
+      unsigned int                    mNumberOfFrames;
+      std::map<std::string, SIMGUIAllocationSample> mAllocationSamples;
+      SIMGUIStartupProfile            mStartup;
+      SIMGUIFontMemory                mFontMemory;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMEPROFILER_H_ */
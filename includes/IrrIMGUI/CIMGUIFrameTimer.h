@@ -0,0 +1,96 @@
+/**
+ * @file   CIMGUIFrameTimer.h
+ * @author Andre Netzeband
+ * @brief  Contains a timer that measures the time step between two GUI frames.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMETIMER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMETIMER_H_
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IIMGUIClock.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief A timer that measures the time step between two GUI frames with nanosecond resolution.
+   * @details
+   *   The time step is measured with a monotonic clock. Optionally the time step is smoothed by an exponential moving average,
+   *   which removes the jitter of single frames from animations and the IMGUI frame rate.
+   */
+  class IRRIMGUI_DLL_API CIMGUIFrameTimer
+  {
+    public:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      /// @param pClock Is a pointer to the clock to use. When it is nullptr, the monotonic system clock is used.
+      CIMGUIFrameTimer(IIMGUIClock * pClock = nullptr);
+
+      /// @brief Destructor.
+      ~CIMGUIFrameTimer(void);
+
+      /// @}
+
+      /// @{
+      /// @name Settings
+
+      /// @brief Changes the clock and restarts the time measurement.
+      /// @param pClock Is a pointer to the clock to use. When it is nullptr, the monotonic system clock is used.
+      /// @note  The timer does not take the ownership of the clock.
+      void setClock(IIMGUIClock * pClock);
+
+      /// @param Smoothing Is the weight of the previous time step in the moving average (0.0 disables the smoothing, values near 1.0 smooth strongly).
+      void setSmoothing(float Smoothing);
+
+      /// @return Returns the weight of the previous time step in the moving average.
+      float getSmoothing(void) const;
+
+      /// @}
+
+      /// @{
+      /// @name Time measurement
+
+      /// @brief Restarts the time measurement. The next time step is measured from now on.
+      void reset(void);
+
+      /// @brief Measures the time step since the last update.
+      /// @return Returns the (smoothed) time step in seconds. The value is always greater than 0.
+      float update(void);
+
+      /// @return Returns the (smoothed) time step of the last update in seconds.
+      float getDeltaTime(void) const;
+
+      /// @return Returns the measured time step of the last update in nanoseconds (without smoothing).
+      irr::u64 getRawDeltaNanoseconds(void) const;
+
+      /// @return Returns the current time of the monotonic system clock in nanoseconds.
+      static irr::u64 getSystemNanoseconds(void);
+
+      /// @}
+
+    private:
+      /// @return Returns the current time of the used clock.
+      irr::u64 getNanoseconds(void);
+
+      IIMGUIClock * mpClock;
+      irr::u64      mLastNanoseconds;
+      irr::u64      mRawDeltaNanoseconds;
+      float         mDeltaTime;
+      float         mSmoothing;
+      bool          mIsFirstUpdate;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMETIMER_H_ */
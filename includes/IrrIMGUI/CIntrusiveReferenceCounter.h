@@ -0,0 +1,91 @@
+/**
+ * @file   CIntrusiveReferenceCounter.h
+ * @author Andre Netzeband
+ * @brief  Contains a template class to count references with atomic operations and without virtual methods.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CINTRUSIVEREFERENCECOUNTER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CINTRUSIVEREFERENCECOUNTER_H_
+
+// library includes
+#include <atomic>
+#include "IrrIMGUIConfig.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+
+  /**
+   * @brief A reference counter, that is part of the counted object.
+   * @details The class TDerived, that should be counted, is derived from CIntrusiveReferenceCounter<TDerived>.
+   *          It works like IReferenceCounter: When the object is created, the counter is set to 1, grab() increases the counter and
+   *          drop() decreases it. When the counter reaches 0, the object is deleted as TDerived.
+   *
+   *          The methods are inline and not virtual, thus they can be used in the main-loop for objects, that are created and
+   *          destroyed every frame. The counter is changed with atomic operations, thus the references can be grabbed and dropped by
+   *          several threads at the same time.
+   *
+   *          When the class needs to be mocked, derive it from IReferenceCounter instead, that wraps this counter with virtual methods.
+   *
+   * @tparam TDerived Is the class, that is derived from this counter.
+   */
+  template <typename TDerived>
+  class CIntrusiveReferenceCounter
+  {
+    public:
+      /// @brief Call this method to grab an instance.
+      void grab(void)
+      {
+        mReferences.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+
+      /// @brief Call this method to drop an instance. If you drop the last used instance, the object is destroyed.
+      /// @return Returns true, when the object has been destroyed.
+      bool drop(void)
+      {
+        // all changes of other threads to the object must be visible, before the last thread destroys it
+        if (mReferences.fetch_sub(1, std::memory_order_release) == 1)
+        {
+          std::atomic_thread_fence(std::memory_order_acquire);
+          delete static_cast<TDerived *>(this);
+          return true;
+        }
+
+        return false;
+      }
+
+      /// @return Returns the current reference count.
+      unsigned int getReferenceCount(void) const
+      {
+        return mReferences.load(std::memory_order_relaxed);
+      }
+
+    protected:
+      /// @brief Constructor.
+      CIntrusiveReferenceCounter(void):
+        mReferences(1)
+      {}
+
+      /// @brief Destructor. It is not virtual, the object is always deleted as TDerived.
+      ~CIntrusiveReferenceCounter(void) {}
+
+      /// @brief Copy Constructor does not exist.
+      CIntrusiveReferenceCounter(CIntrusiveReferenceCounter const &rOther) = delete;
+
+    private:
+      /// @brief The reference counter of this object.
+      std::atomic<unsigned int> mReferences;
+  };
+
+}
+
+/**
+ * @}
+ */
+
+#endif // IRRIMGUI_INCLUDE_IRRIMGUI_CINTRUSIVEREFERENCECOUNTER_H_
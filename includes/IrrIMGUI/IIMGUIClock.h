@@ -0,0 +1,88 @@
+/**
+ * @file   IIMGUIClock.h
+ * @author Andre Netzeband
+ * @brief  Contains a interface for a time source of the GUI frame timer.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_IIMGUICLOCK_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_IIMGUICLOCK_H_
+
+// module includes
+#include "IncludeIrrlicht.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief A interface to a monotonic time source, that is used to calculate the time step of every GUI frame.
+   * @details Pass an own clock with SIMGUISettings::mpFrameClock to a handle, when the time steps must be deterministic (for example in unit tests or benchmarks).
+   *          Without a clock, the handle uses the monotonic system clock.
+   */
+  class IIMGUIClock
+  {
+    public:
+      /// @brief Destructor.
+      virtual ~IIMGUIClock(void) {};
+
+      /// @return Returns the current time in nanoseconds. The value must never decrease.
+      virtual irr::u64 getNanoseconds(void) = 0;
+  };
+
+  /**
+   * @brief A clock that is advanced by a fixed step every time it is read. Use it for reproducible frame timings.
+   * @details With a step of 0 the clock only changes by calling setNanoseconds(...) or advance(...).
+   */
+  class CIMGUIFixedStepClock : public IIMGUIClock
+  {
+    public:
+      /// @brief Constructor.
+      /// @param StepNanoseconds Is the time step in nanoseconds, that is added after every read access.
+      CIMGUIFixedStepClock(irr::u64 StepNanoseconds = 0):
+        mNanoseconds(0),
+        mStepNanoseconds(StepNanoseconds)
+      {}
+
+      /// @return Returns the current time in nanoseconds and advances the clock by one step afterwards.
+      virtual irr::u64 getNanoseconds(void)
+      {
+        irr::u64 const Nanoseconds = mNanoseconds;
+        mNanoseconds += mStepNanoseconds;
+        return Nanoseconds;
+      }
+
+      /// @param Nanoseconds Is the new time in nanoseconds.
+      void setNanoseconds(irr::u64 Nanoseconds)
+      {
+        mNanoseconds = Nanoseconds;
+        return;
+      }
+
+      /// @param Nanoseconds Is the time in nanoseconds to add to the current time.
+      void advance(irr::u64 Nanoseconds)
+      {
+        mNanoseconds += Nanoseconds;
+        return;
+      }
+
+      /// @param StepNanoseconds Is the time step in nanoseconds, that is added after every read access.
+      void setStep(irr::u64 StepNanoseconds)
+      {
+        mStepNanoseconds = StepNanoseconds;
+        return;
+      }
+
+    private:
+      irr::u64 mNanoseconds;
+      irr::u64 mStepNanoseconds;
+  };
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_IIMGUICLOCK_H_ */
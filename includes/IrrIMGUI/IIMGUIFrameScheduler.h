@@ -0,0 +1,125 @@
+/**
+ * @file   IIMGUIFrameScheduler.h
+ * @author Andre Netzeband
+ * @brief  Contains a interface for a scheduler, that builds the frames of several IMGUI handles in parallel.
+ * @addtogroup IrrIMGUI
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_IIMGUIFRAMESCHEDULER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_IIMGUIFRAMESCHEDULER_H_
+
+// library includes
+#include <functional>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IReferenceCounter.h"
+#include "IIMGUIHandle.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+namespace IrrIMGUI
+{
+  /**
+   * @brief A interface to a scheduler, that builds the frames of several IMGUI handles on a pool of worker threads.
+   * @details
+   *   Every handle owns an independent IMGUI context, thus the GUI elements of different handles can be built at the same time.
+   *   Register every handle together with a function, that draws its GUI elements. A frame is then processed in two steps:
+   *   @li "buildFrames()" prepares all handles on the calling thread (input, timing and graphic resources), runs the GUI functions
+   *       on the worker threads and waits until the draw data of all handles is ready.
+   *   @li "drawAll()" submits the draw data of all handles to the graphic API. Call it on the render thread.
+   *
+   *   The GUI functions are distributed over the threads by work-stealing, thus handles with many elements do not block the other threads.
+   *
+   *   @code
+
+IrrIMGUI::IIMGUIFrameScheduler * const pScheduler = IrrIMGUI::createIMGUIFrameScheduler();
+pScheduler->addGUI(pPanelGUI, [](IrrIMGUI::IIMGUIHandle * pGUI) { ImGui::Text("Panel"); });
+pScheduler->addGUI(pMainGUI,  [](IrrIMGUI::IIMGUIHandle * pGUI) { ImGui::Text("Main"); });
+
+// irrlicht main loop
+while(pDevice->run())
+{
+  pScheduler->buildFrames();
+
+  pDriver->beginScene(true, true, irr::video::SColor(255,100,101,140));
+  pSceneManager->drawAll();
+  pScheduler->drawAll();
+  pDriver->endScene();
+}
+
+pScheduler->drop();
+
+ @endcode
+   *
+   * @note The GUI functions must only call IMGUI functions of their own context. Do not access the Irrlicht device or other handles inside of them.
+   *       Handles, that are built at the same time, should not write to the same ini file (set ImGuiIO::IniFilename to different files or to NULL).
+   */
+  class IIMGUIFrameScheduler : public IReferenceCounter
+  {
+    public:
+      /// @brief The type of a function that draws the GUI elements of a handle. It receives the handle, whose context is current.
+      typedef std::function<void(IIMGUIHandle * pGUI)> GUIFunction;
+
+      /// @brief Destructor.
+      virtual ~IIMGUIFrameScheduler(void) {};
+
+      /// @{
+      /// @name Handle registration
+
+      /// @brief Registers a handle for the frame building. The scheduler grabs the handle until it is removed.
+      /// @param pGUI     Is a pointer to the handle.
+      /// @param Function Is the function that draws the GUI elements of this handle.
+      virtual void addGUI(IIMGUIHandle * pGUI, GUIFunction Function) = 0;
+
+      /// @brief Removes a handle from the frame building and drops it.
+      /// @param pGUI Is a pointer to the handle.
+      virtual void removeGUI(IIMGUIHandle * pGUI) = 0;
+
+      /// @return Returns the number of registered handles.
+      virtual unsigned int getNumberOfGUIs(void) const = 0;
+
+      /// @}
+
+      /// @{
+      /// @name Frame building
+
+      /// @brief Builds the frames of all registered handles and returns when the draw data of all handles is ready.
+      /// @note  Call this function from the render thread, since the handles are prepared on the calling thread.
+      /// @note  When a GUI function throws an exception, the frames of the other handles are still built. Afterwards the first exception is rethrown.
+      virtual void buildFrames(void) = 0;
+
+      /// @brief Submits the draw data of all registered handles in the order they have been added.
+      /// @note  Call this function from the render thread after "buildFrames()". When every handle needs its own render target,
+      ///        call "IIMGUIHandle::drawAll()" of each handle instead.
+      virtual void drawAll(void) = 0;
+
+      /// @return Returns the number of threads that build the frames (including the calling thread).
+      virtual unsigned int getNumberOfThreads(void) const = 0;
+
+      /// @}
+
+    protected:
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Forbidden Constructor.
+      IIMGUIFrameScheduler(void) {};
+
+      /// @}
+
+  };
+
+  /// @brief Creates a frame scheduler object.
+  /// @param NumberOfThreads Is the number of threads that build the frames (including the calling thread). Pass 0 to use one thread per CPU core.
+  /// @return Returns an IIMGUIFrameScheduler object. Destroy this object with IIMGUIFrameScheduler::drop()
+  IRRIMGUI_DLL_API IIMGUIFrameScheduler * createIMGUIFrameScheduler(unsigned int NumberOfThreads = 0);
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_IIMGUIFRAMESCHEDULER_H_ */
@@ -12,6 +12,7 @@
 #include "IGUITexture.h"
 #include "IReferenceCounter.h"
 #include "SIMGUISettings.h"
+#include "CIMGUIFrameProfiler.h"
 
 /**
  * @addtogroup IrrIMGUI
@@ -37,6 +38,20 @@ namespace IrrIMGUI
       /// @brief Call this function after "startGUI()" and after you draw your GUI elements. It will render all elements to the screen (do not call it before rendering the 3D Scene!).
       virtual void drawAll(void) = 0;
 
+      /// @brief Call this function after you draw your GUI elements, when the frame is not built on the render thread. It builds the draw data
+      ///        of the frame without using the graphic API, "drawAll()" only submits this draw data afterwards.
+      /// @note  Calling "drawAll()" without "finishGUI()" does both steps at once.
+      virtual void finishGUI(void) = 0;
+
+      /// @brief Creates the graphic objects of the renderer (shader program, buffers and font texture), that are otherwise created in the first frame.
+      ///        Call it during a loading screen to avoid a hitch in the first frame. The needed time is stored in the profiler (see CIMGUIFrameProfiler::getStartup()).
+      /// @note  When SIMGUISettings::mpProgramCacheDirectory is set, the shader program is loaded from the cache instead of compiling it.
+      virtual void prepare(void) = 0;
+
+      /// @brief Makes the IMGUI context of this handle the current context of the calling thread.
+      /// @note  "startGUI()" and "drawAll()" do this automatically. Call it, when you interleave the GUI elements of several handles.
+      virtual void makeCurrent(void) = 0;
+
       /// @}
 
       /// @{
@@ -46,11 +61,19 @@ namespace IrrIMGUI
       virtual SIMGUISettings const &getSettings(void) const = 0;
 
       /// @param rSettings is a reference to a Setting structure that should be applied.
-      /// @note  The settings are applied to all GUI handles at the same time, since IMGUI uses internally a single instance.
+      /// @note  The settings are only applied to the IMGUI context of this handle.
       virtual void setSettings(SIMGUISettings const &rSettings) = 0;
 
       /// @}
 
+      /// @{
+      /// @name Profiling
+
+      /// @return Returns a pointer to the profiler of this handle. It records frames only when SIMGUISettings::mIsProfilerEnabled is true.
+      virtual CIMGUIFrameProfiler * getProfiler(void) = 0;
+
+      /// @}
+
       /// @{
       /// @anchor LoadFonts
       /// @name Font operations
@@ -117,7 +140,25 @@ namespace IrrIMGUI
        */
       virtual ImFont * addFontFromMemoryCompressedBase85TTF(char const * pCompressedTTFDataBase85, float FontSizeInPixel, ImFontConfig const * pFontConfig = NULL, const ImWchar * pGlyphRanges = NULL) = 0;
 
+      /**
+       * @brief Adds a font from a TTF file to the IMGUI memory, whose large glyph ranges (like the Chinese one) are rasterized when they are drawn for the first time.
+       * @param pFileName            Is the name of the file to add.
+       * @param FontSizeInPixel      Is the desired font size to use.
+       * @param pDynamicGlyphRanges  Is the Glyph-Range of the glyphs, that are rasterized on demand.
+       * @param NumberOfCachedGlyphs Is the number of dynamic glyphs, that fit into the font texture at the same time.
+       *                             When it is full, the least recently used glyph is replaced.
+       * @param pFontConfig          Is a pointer to the font configuration.
+       * @param pGlyphRanges         Is the Glyph-Range of the glyphs, that are rasterized when the fonts are compiled.
+       * @return Returns a pointer to the font for later usage with PushFont(...) to activate this font.
+       *
+       * @note The dynamic glyphs are rasterized without oversampling.
+       */
+      virtual ImFont * addDynamicFontFromFileTTF(char const * pFileName, float FontSizeInPixel, ImWchar const * pDynamicGlyphRanges, unsigned int NumberOfCachedGlyphs = 1024, ImFontConfig const * pFontConfig = NULL, ImWchar const * pGlyphRanges = NULL) = 0;
+
       /// @brief This function copies all fonts that have been added with "addFont/addDefaultFont" into graphic memory.
+      /// @details When fonts have only been added since the last call, their glyphs are packed into the free space of the font texture
+      ///          and only this region is uploaded. The glyphs of the other fonts do not move. When the new glyphs do not fit,
+      ///          the whole atlas is built again.
       /// @attention Call this function before using the fonts that have been added.
       virtual void compileFonts(void) = 0;
 
@@ -150,12 +191,12 @@ namespace IrrIMGUI
 
       /// @brief Creates a GUI texture object out of an Irrlicht image.
       /// @param pImage Is a pointer to an Irrlicht image object.
-      /// @return Returns an GUI texture object.
+      /// @return Returns an GUI texture object or nullptr, when 1048576 GUI textures (32768 on 32 bit platforms) exist already.
       virtual IGUITexture *createTexture(irr::video::IImage * pImage) = 0;
 
       /// @brief Creates a GUI texture object out of an Irrlicht texture.
       /// @param pTexture Is a pointer to an Irrlicht texture object.
-      /// @return Returns an GUI texture object.
+      /// @return Returns an GUI texture object or nullptr, when 1048576 GUI textures (32768 on 32 bit platforms) exist already.
       virtual IGUITexture *createTexture(irr::video::ITexture * pTexture) = 0;
 
       /// @brief Updates a GUI texture object with an Irrlicht image.
@@ -10,6 +10,7 @@
 
 // module includes
 #include <IrrIMGUI/IrrIMGUIConfig.h>
+#include <IrrIMGUI/CIMGUIFrameTimer.h>
 
 /**
  * @addtogroup IrrIMGUI
@@ -18,10 +19,18 @@
 
 namespace IrrIMGUI
 {
+  /// @brief Updates the values for an IMGUI Frame, like delta time, input events and screen size.
+  /// @param pDevice       Is a pointer to an Irrlicht device.
+  /// @param pEventStorage Is a pointer to the event storage. If this pointer is NULL, no input event update is performed.
+  /// @param pFrameTimer   Is a pointer to the timer that measures the time step of the frame.
+  IRRIMGUI_DLL_API void updateIMGUIFrameValues(irr::IrrlichtDevice * const pDevice,  CIMGUIEventStorage * const pEventStorage, CIMGUIFrameTimer * const pFrameTimer);
+
   /// @brief Updates the values for an IMGUI Frame, like delta time, input events and screen size.
   /// @param pDevice       Is a pointer to an Irrlicht device.
   /// @param pEventStorage Is a pointer to the event storage. If this pointer is NULL, no input event update is performed.
   /// @param pLastTime     Is a pointer to a variable where the time from the last update is stored (in seconds).
+  /// @note  This function measures the time step with the millisecond timer of the Irrlicht device. Use the overload with a CIMGUIFrameTimer for
+  ///        a monotonic time step with nanosecond resolution.
   IRRIMGUI_DLL_API void updateIMGUIFrameValues(irr::IrrlichtDevice * const pDevice,  CIMGUIEventStorage * const pEventStorage, float * const pLastTime);
 }
 
@@ -11,6 +11,7 @@
 // library includes
 #include "IrrIMGUIConfig.h"
 #include "IncludeIrrlicht.h"
+#include "CIntrusiveReferenceCounter.h"
 
 /**
  * @addtogroup IrrIMGUI
@@ -31,8 +32,11 @@ namespace IrrIMGUI
   ///          However this comes with a drawback: Creating and destroying such classes is not as fast as in the Irrlicht library.
   ///          Outside of the main-loop this is not an issue, because spending some nanoseconds more a single time is not bad, when you gain a better testability.
   ///          But when you create and destroy objects every frame, then it could become an issue. Please use in such cases the high performance inline implementation
-  ///          from Irrlicht!
-  class IRRIMGUI_DLL_API IReferenceCounter
+  ///          CIntrusiveReferenceCounter!
+  ///
+  ///          The virtual methods are an adapter to CIntrusiveReferenceCounter, thus the counter is changed with atomic operations and the references
+  ///          can be grabbed and dropped by several threads.
+  class IRRIMGUI_DLL_API IReferenceCounter : public CIntrusiveReferenceCounter<IReferenceCounter>
   {
     public:
       /// @brief Constructor.
@@ -51,8 +55,8 @@ namespace IrrIMGUI
       virtual unsigned int getReferenceCount(void) const;
 
     private:
-      /// @brief The reference counter of this class.
-      unsigned int mReferences;
+      /// @brief The counter, that is wrapped by the virtual methods.
+      typedef CIntrusiveReferenceCounter<IReferenceCounter> TCounter;
   };
 
 }
@@ -11,7 +11,13 @@
 // module includes
 #include "IrrIMGUIConfig.h"
 #include "IIMGUIHandle.h"
+#include "IIMGUIFrameScheduler.h"
 #include "CIMGUIEventReceiver.h"
+#include "CIMGUIEventPlayer.h"
+#include "IIMGUIClock.h"
+#include "IrrIMGUITrace.h"
+#include "CIMGUIDrawDataWriter.h"
+#include "CIMGUIDrawDataReader.h"
 
 /**
  * @defgroup IrrIMGUI IrrIMGUI
@@ -21,6 +27,16 @@
  * @li IrrIMGUI::IIMGUIHandle        to setup, draw and render the GUI. Create an object of this class with IrrIMGUI::createIMGUI
  * @li IrrIMGUI::CIMGUIEventReceiver to capture the irrlicht events and pass them to the IMGUI system.
  *
+ * When several handles are used (for example for GUI panels inside of the 3D scene), IrrIMGUI::IIMGUIFrameScheduler builds their frames in parallel.
+ * Create an object of this class with IrrIMGUI::createIMGUIFrameScheduler
+ *
+ * To analyze the GUI frame timeline offline, record a Chrome trace file with IrrIMGUI::Trace::startTracing and IrrIMGUI::Trace::stopTracing.
+ *
+ * To benchmark a renderer with the draw data of a real session, capture the frames with IrrIMGUI::CIMGUIDrawDataWriter and replay them
+ * with IrrIMGUI::CIMGUIDrawDataReader.
+ *
+ * To build the same GUI frames again, record the input with IrrIMGUI::CIMGUIEventRecorder and replay it with IrrIMGUI::CIMGUIEventPlayer.
+ *
  * If you need an own event receiver, you can simply inherit from IrrIMGUI::CIMGUIEventReceiver. In the OnEevent method you can trigger your own actions according to the events.
  * When no actions fits to the event you received, simply pass it to the OnEvent method from IrrIMGUI::CIMGUIEventReceiver class.
  *
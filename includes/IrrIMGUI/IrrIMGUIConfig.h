@@ -37,6 +37,11 @@
 ///        Disable it, when the Example 6 (RenderWindow) does not work correctly.
 #define _IRRIMGUI_FAST_OPENGL_TEXTURE_HANDLE_
 
+/// @brief If this is defined during compilation, the library replaces malloc and free of the process with counting functions.
+///        Tools::CBasicMemoryLeakDetection can then report the peak memory and the number of allocations.
+/// @note GNU C library only!
+#define _IRRIMGUI_MEMORY_INSTRUMENTATION_
+
 /// @}
 
 /// @{
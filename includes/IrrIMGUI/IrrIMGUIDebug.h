@@ -11,6 +11,8 @@
 // standard library includes
 #include <streambuf>
 #include <ostream>
+#include <atomic>
+#include <mutex>
 
 // module includes
 #include "IrrIMGUIConfig.h"
@@ -29,7 +31,12 @@ namespace IrrIMGUI
 namespace Debug
 {
 
-  /// @brief Is a stream channel buffer, that adds to each new line a defined prefix.
+  /**
+   * @brief Is a stream channel buffer, that adds to each new line a defined prefix.
+   * @details The characters are collected in a small buffer and are written with the prefixes as soon as the stream is
+   *          flushed or the buffer is full. When the asynchronous logging is started (see startAsyncLogging()), the text
+   *          is not written directly, but put into a queue, which is written by a background thread.
+   */
   class IRRIMGUI_DLL_API CChannelBuffer : public std::streambuf
   {
     public:
@@ -52,9 +59,14 @@ namespace Debug
       /// @param pPrefix Is a prefix string that should be added before each new line.
       void setupPrefix(char const * pPrefix);
 
+      /// @brief Writes a complete record. A record is never mixed with records of other threads.
+      /// @param pText  Is a pointer to the text of the record.
+      /// @param Length Is the number of characters of the record.
+      void writeRecord(char const * pText, size_t Length);
+
     private:
       /**
-       * @brief Since this is not a real buffer, this method is called for each character that is written to this stream buffer.
+       * @brief This method is called when the buffer is full.
        * @param Character Is the character that shall be written.
        * @return Returns EOF if the original buffer returns it.
        */
@@ -66,9 +78,16 @@ namespace Debug
        */
       virtual int sync(void);
 
-      /// @brief Prints the prefix.
-      /// @return Returns true when prefix print was successful.
-      bool printPrefix(void);
+      /// @brief Writes the collected characters with the prefixes.
+      /// @return Returns true when the output was successful.
+      bool flushCharacters(void);
+
+      /// @brief Adds the prefixes to a text and writes it to the output buffer or into the queue of the asynchronous logging.
+      /// @return Returns true when the output was successful.
+      bool writeText(char const * pText, size_t Length);
+
+      /// @brief The number of characters, that are collected before they are written.
+      static size_t const CharacterBufferSize = 128;
 
       /// @brief The prefix that should be written at the beginning of each new line.
       char const * mpPrefix;
@@ -77,7 +96,13 @@ namespace Debug
       std::streambuf * mpBuffer;
 
       /// @brief Is true, when the next char should be written to a new line.
-      bool mIsNewLine;
+      std::atomic<bool> mIsNewLine;
+
+      /// @brief Protects the output buffer, when records of several threads are written directly.
+      std::mutex mMutex;
+
+      /// @brief The collected characters.
+      char mCharacters[CharacterBufferSize];
   };
 
 
@@ -95,8 +120,16 @@ namespace Debug
        */
       CChannel(std::ostream &rStream, char const * const pPrefix):
         mBuffer(rStream.rdbuf(), pPrefix),
-        std::ostream(&mBuffer)
-      {}
+        std::ostream(&mBuffer),
+        mMaxRecordsPerSecond(0),
+        mRateSecond(0),
+        mRecordsInSecond(0),
+        mUnreportedRecords(0),
+        mSuppressedRecords(0)
+      {
+        // every output is written immediately, thus the stream can be used like before without flushing
+        setf(std::ios::unitbuf);
+      }
 
       /// @brief Copy Constructor does not exist.
       CChannel(CChannel const &rCopyChannel) = delete;
@@ -115,11 +148,123 @@ namespace Debug
 
       /// @}
 
+      /// @{
+      /// @name Records
+
+      /**
+       * @brief Writes a complete record to the channel. This is thread safe, the LOG macros use this method.
+       * @param pText  Is a pointer to the text of the record.
+       * @param Length Is the number of characters of the record.
+       * @note  When the stream buffer of this channel has been replaced with rdbuf(...), the record is written without prefix to the new buffer.
+       */
+      void writeRecord(char const * pText, size_t Length);
+
+      /// @brief Limits the number of records per second. The records above the limit are suppressed.
+      /// @param MaxRecordsPerSecond Is the highest number of records in one second. 0 disables the limit.
+      void setRateLimit(unsigned int MaxRecordsPerSecond);
+
+      /// @return Returns true, when a new record does not exceed the rate limit. Otherwise the record is counted as suppressed.
+      bool isRecordAllowed(void);
+
+      /// @return Returns the number of records, that have been suppressed by the rate limit.
+      unsigned int getNumberOfSuppressedRecords(void) const { return mSuppressedRecords; }
+
+      /// @}
+
     private:
       /// @brief The buffer object where input data are written to.
       CChannelBuffer mBuffer;
+
+      /// @brief The highest number of records per second or 0.
+      std::atomic<unsigned int> mMaxRecordsPerSecond;
+
+      /// @brief The second, where the records are currently counted.
+      std::atomic<long long> mRateSecond;
+
+      /// @brief The number of records in the current second.
+      std::atomic<unsigned int> mRecordsInSecond;
+
+      /// @brief The number of suppressed records, that have not been reported so far.
+      std::atomic<unsigned int> mUnreportedRecords;
+
+      /// @brief The number of all suppressed records.
+      std::atomic<unsigned int> mSuppressedRecords;
+  };
+
+  /**
+   * @brief A stream to format a single record. Every thread has its own stream, thus the LOG macros do not need a lock for formatting.
+   * @details The text is stored in a fixed buffer. Longer records are written in parts. A record, that is started while the expression
+   *          of another record is evaluated, uses another stream of the thread.
+   */
+  class IRRIMGUI_DLL_API CRecordStream : public std::ostream
+  {
+    public:
+      /// @brief Starts a new record of the calling thread.
+      /// @param rChannel Is the channel, where the record is written to.
+      /// @return Returns a stream of the calling thread, that is not used by an unfinished record.
+      static CRecordStream &start(CChannel &rChannel);
+
+      /// @brief Writes the record to the channel.
+      void finish(void);
+
+      /// @brief Copy Constructor does not exist.
+      CRecordStream(CRecordStream const &rCopyStream) = delete;
+
+    private:
+      /// @brief The buffer, that stores the text of the record.
+      class CRecordBuffer : public std::streambuf
+      {
+        public:
+          /// @brief Constructor.
+          CRecordBuffer(void);
+
+          /// @brief Starts a new record.
+          void start(CChannel &rChannel);
+
+          /// @brief Writes the stored text to the channel.
+          void finish(void);
+
+        private:
+          /// @brief Writes the stored text to the channel, when the buffer is full.
+          virtual int overflow(int Character = EOF);
+
+          /// @brief The number of characters of a record part.
+          static size_t const TextSize = 1024;
+
+          CChannel * mpChannel;
+          char       mText[TextSize];
+      };
+
+      /// @brief Constructor.
+      CRecordStream(void);
+
+      CRecordBuffer mBuffer;
   };
 
+  /// @{
+  /// @name Asynchronous logging
+
+  /**
+   * @brief Starts a background thread, that writes the records of all channels.
+   * @details Afterwards the records are only formatted by the logging thread and put into a lock-free queue. When the queue is full,
+   *          the logging thread waits until the background thread has written some records. The records are written in the order
+   *          they have been put into the queue.
+   * @attention The stream buffers of the channels must not be destroyed while there are records in the queue. Changing a stream
+   *            with CChannel::setupStream(...) waits until the queue is empty.
+   */
+  IRRIMGUI_DLL_API void startAsyncLogging(void);
+
+  /// @brief Writes all records of the queue and stops the background thread. Afterwards all records are written directly.
+  IRRIMGUI_DLL_API void stopAsyncLogging(void);
+
+  /// @brief Waits until all records of the queue have been written.
+  IRRIMGUI_DLL_API void flushAsyncLogging(void);
+
+  /// @return Returns true, when the background thread writes the records.
+  IRRIMGUI_DLL_API bool isAsyncLoggingEnabled(void);
+
+  /// @}
+
   /// @brief Standard Exception used for assertions.
   class ExAssert : public std::exception
   {
@@ -0,0 +1,121 @@
+/**
+ * @file   IrrIMGUITrace.h
+ * @author Andre Netzeband
+ * @brief  Contains functions to record the GUI frame timeline into a Chrome trace file.
+ * @addtogroup IrrIMGUITrace
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_IRRIMGUITRACE_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_IRRIMGUITRACE_H_
+
+// library includes
+#include <atomic>
+
+// module includes
+#include "IrrIMGUIConfig.h"
+#include "IncludeIrrlicht.h"
+
+/**
+ * @defgroup IrrIMGUITrace Trace
+ * @ingroup IrrIMGUI
+ * @brief Contains functions to record a timeline of the GUI frames.
+ * @details
+ *   The trace is written as Chrome "trace_event" JSON file, that can be opened with "chrome://tracing" or with Perfetto.
+ *   The events are collected in memory and written to the file by a background thread. When no trace is running, a trace
+ *   marker only costs a single atomic load.
+ *
+ *   @code
+
+IrrIMGUI::Trace::startTracing("GUITrace.json");
+
+// ... main loop ...
+{
+  IrrIMGUI::Trace::CTraceScope Scope("Game Logic");
+  updateGame();
+}
+
+IrrIMGUI::Trace::stopTracing();
+
+ @endcode
+ * @{
+ */
+
+namespace IrrIMGUI
+{
+/// @brief Contains functions to record a timeline of the GUI frames.
+namespace Trace
+{
+  /// @brief Is true, while a trace is running. Use isTracing() to read it.
+  IRRIMGUI_DLL_API extern std::atomic<bool> IsTraceEnabled;
+
+  /// @brief Starts to record a trace.
+  /// @param pFileName Is the name of the JSON file, where the trace is written to.
+  /// @return Returns false, when a trace is already running or when the file cannot be opened.
+  IRRIMGUI_DLL_API bool startTracing(char const * pFileName);
+
+  /// @brief Stops the running trace. All recorded events are written to the file and the file is closed.
+  IRRIMGUI_DLL_API void stopTracing(void);
+
+  /// @return Returns true, while a trace is running.
+  inline bool isTracing(void)
+  {
+    return IsTraceEnabled.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Adds an event to the running trace. When no trace is running, the event is ignored.
+  /// @param pName             Is the name of the event. It must be a static string, since only the pointer is stored.
+  /// @param pArgumentName     Is the name of an optional argument (a static string as well) or nullptr.
+  /// @param ArgumentValue     Is the value of the optional argument.
+  /// @param StartNanoseconds  Is the start time of the event (see CIMGUIFrameTimer::getSystemNanoseconds()).
+  /// @param EndNanoseconds    Is the end time of the event.
+  IRRIMGUI_DLL_API void addTraceEvent(char const * pName, char const * pArgumentName, long long ArgumentValue, irr::u64 StartNanoseconds, irr::u64 EndNanoseconds);
+
+  /// @return Returns the current time used for trace events in nanoseconds.
+  IRRIMGUI_DLL_API irr::u64 getTraceNanoseconds(void);
+
+  /**
+   * @brief Records the lifetime of this object as event into the running trace.
+   * @details When no trace is running at construction, the object does nothing.
+   */
+  class CTraceScope
+  {
+    public:
+      /// @brief Constructor. Starts the event.
+      /// @param pName         Is the name of the event. It must be a static string, since only the pointer is stored.
+      /// @param pArgumentName Is the name of an optional argument (a static string as well) or nullptr.
+      /// @param ArgumentValue Is the value of the optional argument.
+      CTraceScope(char const * pName, char const * pArgumentName = nullptr, long long ArgumentValue = 0):
+        mpName(pName),
+        mpArgumentName(pArgumentName),
+        mArgumentValue(ArgumentValue),
+        mIsActive(isTracing()),
+        mStartNanoseconds(mIsActive ? getTraceNanoseconds() : 0)
+      {}
+
+      /// @brief Destructor. Ends the event and adds it to the trace.
+      ~CTraceScope(void)
+      {
+        if (mIsActive)
+        {
+          addTraceEvent(mpName, mpArgumentName, mArgumentValue, mStartNanoseconds, getTraceNanoseconds());
+        }
+      }
+
+      /// @brief Copy Constructor does not exist.
+      CTraceScope(CTraceScope const &rCopyScope) = delete;
+
+    private:
+      char const * const mpName;
+      char const * const mpArgumentName;
+      long long const    mArgumentValue;
+      bool const         mIsActive;
+      irr::u64 const     mStartNanoseconds;
+  };
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_IRRIMGUITRACE_H_ */
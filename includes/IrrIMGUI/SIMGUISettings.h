@@ -18,6 +18,37 @@
 
 namespace IrrIMGUI
 {
+  // forward declaration
+  class IIMGUIClock;
+  class CIMGUIDrawDataWriter;
+
+  /// @brief The renderers, that can draw the GUI.
+  enum EIMGUIBackend
+  {
+    /// @brief Chooses the fastest renderer, that is supported by the OpenGL context of the Irrlicht device.
+    EIB_AUTOMATIC,
+
+    /// @brief Draws the GUI with the OpenGL 3.3 shader of the IMGUI binding.
+    EIB_OPENGL3,
+
+    /// @brief Draws the GUI with the fixed function pipeline of OpenGL. Only available when IrrIMGUI is build with IRRIMGUI_NATIVE_OPENGL.
+    EIB_OPENGL2,
+
+    /// @brief Does not draw anything. It is used for Irrlicht devices without OpenGL context.
+    EIB_NULL
+  };
+
+  /// @brief Tells, how long the TTF data of the fonts stays in memory.
+  enum EFontDataPolicy
+  {
+    /// @brief The TTF data stays in memory as long as the font is part of the font atlas.
+    EFDP_KEEP,
+
+    /// @brief The TTF data is released, when the font atlas has been stored in or loaded from the font atlas cache (see SIMGUISettings::mpFontCacheDirectory).
+    ///        When the atlas must be built again, the data is read again from the TTF file or decompressed again from the compressed data.
+    ///        Fonts added from uncompressed memory or with dynamic glyphs keep their TTF data.
+    EFDP_RELEASE_CACHED
+  };
 
   /// @brief Stores the settings of the IMGUI.
   struct IRRIMGUI_DLL_API SIMGUISettings
@@ -27,7 +58,22 @@ namespace IrrIMGUI
       /// @brief Constructor to set the standard settings.
       SIMGUISettings(void):
         mIsGUIMouseCursorEnabled(true),
-        mIsIMGUIMemoryAllocationTrackingEnabled(true)
+        mIsIMGUIMemoryAllocationTrackingEnabled(true),
+        mpFrameClock(nullptr),
+        mFrameTimeSmoothing(0.0f),
+        mIsProfilerEnabled(false),
+        mIsProfilerOverlayEnabled(false),
+        mProfilerHistorySize(120),
+        mpDrawDataWriter(nullptr),
+        mAllocationSamplingInterval(0),
+        mIsFrameAllocatorEnabled(false),
+        mBackend(EIB_AUTOMATIC),
+        mpProgramCacheDirectory(nullptr),
+        mpFontCacheDirectory(nullptr),
+        mNumberOfFontThreads(0),
+        mFontSDFSpread(0),
+        mFontDataPolicy(EFDP_KEEP),
+        mTextLayoutCacheSize(0)
       {}
 
       /// @{
@@ -40,6 +86,75 @@ namespace IrrIMGUI
       ///        there is difference between both, IrrIMGUI will throw an assertion during shutdown.
       bool mIsIMGUIMemoryAllocationTrackingEnabled;
 
+      /// @brief The clock that is used to measure the time step of every frame. When this is nullptr, the monotonic system clock is used (default: nullptr).
+      /// @note  The handle does not take the ownership of the clock, it must live as long as the handle uses it.
+      IIMGUIClock * mpFrameClock;
+
+      /// @brief The weight of the previous time step when the time step of a frame is smoothed (0.0 disables the smoothing, values near 1.0 smooth strongly) (default: 0.0).
+      float mFrameTimeSmoothing;
+
+      /// @brief When this is true, the handle measures the CPU and GPU timings and the draw statistics of every frame (default: false).
+      /// @note  The GPU time is measured with a GL_TIME_ELAPSED query. Frames, that are drawn while the application has an own
+      ///        GL_TIME_ELAPSED query active, are not measured by the handle.
+      bool mIsProfilerEnabled;
+
+      /// @brief When this is true and the profiler is enabled, the handle draws a window with the recorded timings into every frame (default: false).
+      bool mIsProfilerOverlayEnabled;
+
+      /// @brief The number of frames, that are recorded by the profiler (default: 120).
+      unsigned int mProfilerHistorySize;
+
+      /// @brief When this is not nullptr and the writer is opened, the draw data of every frame is captured into the file of the writer (default: nullptr).
+      /// @note  The handle does not take the ownership of the writer, it must live as long as the handle uses it.
+      CIMGUIDrawDataWriter * mpDrawDataWriter;
+
+      /// @brief When this is not 0 and the profiler is enabled, every n-th IMGUI allocation is sampled together with the window, that allocates (default: 0).
+      ///        Use CIMGUIFrameProfiler::getAllocationSamples() to query the samples.
+      unsigned int mAllocationSamplingInterval;
+
+      /// @brief When this is true, the IMGUI allocations between "startGUI()" and "drawAll()" are served by size-class pools and a linear arena
+      ///        of the handle instead of malloc (default: false). The memory of the pools is only given back, when the handle is deleted.
+      bool mIsFrameAllocatorEnabled;
+
+      /// @brief The renderer, that should be used instead of the automatically chosen one (default: EIB_AUTOMATIC). When the OpenGL context
+      ///        does not support the renderer, the automatically chosen one is used.
+      /// @note  All handles of an Irrlicht device share the same renderer, thus only the setting of the first handle of the device is used.
+      EIMGUIBackend mBackend;
+
+      /// @brief When this is not nullptr, the linked shader program of the renderer is stored in this directory and loaded from there
+      ///        on the next start, instead of compiling it again (default: nullptr).
+      /// @note  The handle does not copy the string, it must live as long as the handle uses it.
+      char const * mpProgramCacheDirectory;
+
+      /// @brief When this is not nullptr, the built font atlas is stored in this directory and loaded from there by compileFonts(),
+      ///        when the same fonts with the same settings are compiled again. Thus the glyphs are only rasterized once (default: nullptr).
+      /// @note  The handle does not copy the string, it must live as long as the handle uses it.
+      char const * mpFontCacheDirectory;
+
+      /// @brief The number of threads, that rasterize the glyphs when the font atlas is built (including the calling thread).
+      ///        Pass 0 to use one thread per CPU core and 1 to build the atlas only on the calling thread (default: 0).
+      /// @note  The glyphs are always packed on the calling thread, thus the atlas does not depend on the number of threads.
+      unsigned int mNumberOfFontThreads;
+
+      /// @brief When this is not 0, the font atlas stores the glyphs as signed distance field, that reaches this many pixels beyond their outline.
+      ///        Thus a font added with a single size stays sharp, when it is scaled (for example with ImGui::SetWindowFontScale()).
+      ///        A spread of 4 pixels is enough for most fonts, larger values allow stronger scaling and need more space in the atlas (default: 0).
+      /// @note  The setting is applied, when the fonts are compiled. The OpenGL 3 renderer draws the glyphs with smooth edges, the
+      ///        OpenGL renderer cuts them at their outline. Add the fonts with a larger size (like 32 pixels), since the size of the
+      ///        distance field is the quality of the scaled glyphs.
+      unsigned int mFontSDFSpread;
+
+      /// @brief Tells, if the TTF data of the fonts is released after the font atlas has been cached (default: EFDP_KEEP).
+      /// @note  With EFDP_RELEASE_CACHED the TTF files must stay readable and the data of "addFontFromMemoryCompressedTTF()" and
+      ///        "addFontFromMemoryCompressedBase85TTF()" must stay valid, since it is used to load the font again.
+      EFontDataPolicy mFontDataPolicy;
+
+      /// @brief The maximum number of texts, whose size and glyph quads are kept for the next frame (0 disables the cache) (default: 0).
+      ///        A text drawn again with the same font, size and wrap width is then copied into the draw list instead of being
+      ///        laid out glyph by glyph. A few thousand entries are enough for large property grids.
+      /// @note  Only texts, that are completely inside their clip rectangle, are cached. Texts, that are not drawn for a frame, are removed.
+      unsigned int mTextLayoutCacheSize;
+
       /// @}
 
       bool operator==(SIMGUISettings const &rCompareSettings)
@@ -47,6 +162,21 @@ namespace IrrIMGUI
         bool AreAllSettingsEqual = true;
 
         AreAllSettingsEqual = AreAllSettingsEqual && (mIsGUIMouseCursorEnabled == rCompareSettings.mIsGUIMouseCursorEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mpFrameClock             == rCompareSettings.mpFrameClock);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mFrameTimeSmoothing      == rCompareSettings.mFrameTimeSmoothing);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsProfilerEnabled       == rCompareSettings.mIsProfilerEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsProfilerOverlayEnabled == rCompareSettings.mIsProfilerOverlayEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mProfilerHistorySize     == rCompareSettings.mProfilerHistorySize);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mpDrawDataWriter         == rCompareSettings.mpDrawDataWriter);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mAllocationSamplingInterval == rCompareSettings.mAllocationSamplingInterval);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mIsFrameAllocatorEnabled == rCompareSettings.mIsFrameAllocatorEnabled);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mBackend                 == rCompareSettings.mBackend);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mpProgramCacheDirectory  == rCompareSettings.mpProgramCacheDirectory);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mpFontCacheDirectory     == rCompareSettings.mpFontCacheDirectory);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mNumberOfFontThreads     == rCompareSettings.mNumberOfFontThreads);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mFontSDFSpread           == rCompareSettings.mFontSDFSpread);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mFontDataPolicy          == rCompareSettings.mFontDataPolicy);
+        AreAllSettingsEqual = AreAllSettingsEqual && (mTextLayoutCacheSize     == rCompareSettings.mTextLayoutCacheSize);
 
         return AreAllSettingsEqual;
       }
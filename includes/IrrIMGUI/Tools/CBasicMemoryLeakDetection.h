@@ -8,6 +8,9 @@
 #ifndef LIBS_IRRIMGUI_INCLUDES_IRRIMGUI_TOOLS_CBASICMEMORYLEAKDETECTION_H_
 #define LIBS_IRRIMGUI_INCLUDES_IRRIMGUI_TOOLS_CBASICMEMORYLEAKDETECTION_H_
 
+// library includes
+#include <cstddef>
+
 // module includes
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 
@@ -15,11 +18,15 @@
   #ifdef _DEBUG
     #define _ENABLE_MEMORY_LEAK_DETECTION_
   #endif // _DEBUG
+#elif defined(_IRRIMGUI_MEMORY_INSTRUMENTATION_) && defined(__GLIBC__)
+  #define _ENABLE_MEMORY_LEAK_DETECTION_
 #endif // _IRRIMGUI_COMPILER_MSVC_AT_LEAST_2010_
 
+#ifdef _IRRIMGUI_COMPILER_MSVC_AT_LEAST_2010_
 #ifdef _ENABLE_MEMORY_LEAK_DETECTION_
 #include <crtdbg.h>
 #endif // _ENABLE_MEMORY_LEAK_DETECTION_
+#endif // _IRRIMGUI_COMPILER_MSVC_AT_LEAST_2010_
 
 /**
  * @defgroup IrrIMGUITools Tools
@@ -35,17 +42,22 @@ namespace IrrIMGUI
 namespace Tools
 {
   /**
-   * @brief This is a very basic memory leak detection for Windows Systems.
+   * @brief This is a very basic memory leak detection for Windows and Linux Systems.
    *
    * @details When creating an object of this class, it will store the current state of the memory.
    *   And when this object is destroyed, it will compare the state of the memory with the stored one.
    *   Thus it can detect differences in memory usage.
    *
    *   It will not show you any more information than just the difference of the both memory states.
+   *   The memory state is process wide, thus allocations of other threads are part of the difference.
    *
-   * @attention This class has only a functionality for Windows, compiled with Visual C++. When someone knows how to
-   *            perform the same checks with MingW/GCC without using non-standard libraries, please tell me.
-   *            For non Windows or Visual C++ compilers the class will compile but it will just do nothing.
+   *   With the GNU C library the memory state is only known, when the library is compiled with
+   *   _IRRIMGUI_MEMORY_INSTRUMENTATION_ (CMake option IRRIMGUI_MEMORY_INSTRUMENTATION). Then malloc and free of the
+   *   whole process are replaced by counting functions and getPeakBytes() and getNumberOfAllocations() report the
+   *   peak memory and the number of allocations since the last reset, which is useful for benchmarks.
+   *
+   * @attention This class has only a functionality for Visual C++ (debug builds) and for the GNU C library with memory instrumentation.
+   *            For other compilers the class will compile but it will just do nothing.
    *
    * @code
 
@@ -78,14 +90,34 @@ namespace Tools
       /// @return Returns the number of bytes that are different between both states (should be 0 when no memory leak occurred).
       int compareMemoryState(void);
 
-      /// @brief Resets the memory state to prepare a new detection.
+      /// @brief Resets the memory state to prepare a new detection. The peak memory of other objects of this class is kept.
       void resetMemoryState(void);
 
+      /// @return Returns the highest number of bytes, that have been allocated additionally to the stored memory state at the same time.
+      /// @note   This is only measured with memory instrumentation, otherwise it returns 0.
+      size_t getPeakBytes(void) const;
+
+      /// @return Returns the number of allocations since the memory state has been stored.
+      /// @note   This is only measured with memory instrumentation, otherwise it returns 0.
+      size_t getNumberOfAllocations(void) const;
+
+      /// @return Returns true, when the library has been compiled with memory instrumentation.
+      static bool isInstrumented(void);
+
+      /// @brief Copy Constructor does not exist.
+      CBasicMemoryLeakDetection(CBasicMemoryLeakDetection const &rCopyDetection) = delete;
+
     private:
+#ifdef _IRRIMGUI_COMPILER_MSVC_AT_LEAST_2010_
 #ifdef _ENABLE_MEMORY_LEAK_DETECTION_
       _CrtMemState mMemoryState;
 #endif // _ENABLE_MEMORY_LEAK_DETECTION_
+#endif // _IRRIMGUI_COMPILER_MSVC_AT_LEAST_2010_
+      std::ptrdiff_t mUsedBytes;
+      std::ptrdiff_t mPeakBytes;
+      size_t mAllocations;
       bool mWasMemoryChecked;
+      CBasicMemoryLeakDetection * mpNextDetection;
   };
 
 }
@@ -86,6 +86,24 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return;
     }
 
+    virtual void finishGUI(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::finishGUI");
+      return;
+    }
+
+    virtual void prepare(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::prepare");
+      return;
+    }
+
+    virtual void makeCurrent(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::makeCurrent");
+      return;
+    }
+
     virtual IrrIMGUI::SIMGUISettings const &getSettings(void) const
     {
       MOCK_FUNC("IIMGUIHandleMock::getSettings");
@@ -102,6 +120,13 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return;
     }
 
+    virtual IrrIMGUI::CIMGUIFrameProfiler * getProfiler(void)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::getProfiler");
+
+      return static_cast<IrrIMGUI::CIMGUIFrameProfiler*>(mock().returnPointerValueOrDefault(&mDefaultProfiler));
+    }
+
     virtual ImFont * addFont(ImFontConfig const * pFontConfig)
     {
       MOCK_FUNC("IIMGUIHandleMock::addFont").MOCK_ARG(pFontConfig);
@@ -144,6 +169,13 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
       return static_cast<ImFont*>(mock().returnPointerValueOrDefault(getDummyFont()));
     }
 
+    virtual ImFont * addDynamicFontFromFileTTF(char const * pFileName, float FontSizeInPixel, ImWchar const * pDynamicGlyphRanges, unsigned int NumberOfCachedGlyphs = 1024, ImFontConfig const * pFontConfig = NULL, ImWchar const * pGlyphRanges = NULL)
+    {
+      MOCK_FUNC("IIMGUIHandleMock::addDynamicFontFromFileTTF").MOCK_ARG(pFileName).MOCK_ARG(FontSizeInPixel).MOCK_ARG(pDynamicGlyphRanges).MOCK_ARG(NumberOfCachedGlyphs).MOCK_ARG(pFontConfig).MOCK_ARG(pGlyphRanges);
+
+      return static_cast<ImFont*>(mock().returnPointerValueOrDefault(getDummyFont()));
+    }
+
     virtual void compileFonts(void)
     {
       MOCK_FUNC("IIMGUIHandleMock::compileFonts");
@@ -295,6 +327,9 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
     /// @brief A dummy object for storing default settings.
     IrrIMGUI::SIMGUISettings             mDefaultSettings;
 
+    /// @brief A dummy profiler, that is returned by default.
+    IrrIMGUI::CIMGUIFrameProfiler        mDefaultProfiler;
+
     /// @brief Stores the Irrlicht device pointer.
     irr::IrrlichtDevice          * const mpDevice;
 
@@ -333,7 +368,7 @@ class IIMGUIHandleMock : public IrrIMGUI::IIMGUIHandle
     }
 
     /// @brief Dummy draw method.
-    static void drawGUIList(ImDrawData * pDrawData)
+    static void drawGUIList(ImDrawData *)
     {
       return;
     }
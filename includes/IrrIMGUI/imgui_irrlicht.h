@@ -6,11 +6,32 @@
 // If you are new to ImGui, see examples/README.txt and documentation at the top of imgui.cpp.
 // https://github.com/ocornut/imgui
 
+#pragma once
+
 namespace irr {
 class IrrlichtDevice;
 class SEvent;
 }
 
+// OpenGL objects of the binding. IrrIMGUI keeps one of them per Irrlicht device and stores a pointer to it in ImGuiIO::UserData,
+// thus all contexts of the same device share the objects. When UserData is NULL, a global fallback object is used.
+struct ImGui_ImplIrrlicht_Data
+{
+    unsigned int FontTexture;
+    int          ShaderHandle, VertHandle, FragHandle;
+    int          AttribLocationTex, AttribLocationProjMtx, AttribLocationClipRect;
+    int          AttribLocationPosition, AttribLocationUV, AttribLocationColor;
+    int          AttribLocationDistanceField;
+    unsigned int VboHandle, VaoHandle, ElementsHandle;
+
+    ImGui_ImplIrrlicht_Data() :
+        FontTexture(0), ShaderHandle(0), VertHandle(0), FragHandle(0),
+        AttribLocationTex(0), AttribLocationProjMtx(0), AttribLocationClipRect(0),
+        AttribLocationPosition(0), AttribLocationUV(0), AttribLocationColor(0),
+        AttribLocationDistanceField(0),
+        VboHandle(0), VaoHandle(0), ElementsHandle(0) {}
+};
+
 IMGUI_API bool        ImGui_ImplIrrlicht_Init(irr::IrrlichtDevice *dev);
 IMGUI_API void        ImGui_ImplIrrlicht_Shutdown();
 IMGUI_API void        ImGui_ImplIrrlicht_NewFrame(irr::IrrlichtDevice *dev);
@@ -19,3 +40,11 @@ IMGUI_API bool        ImGui_ImplIrrlicht_ProcessEvent(irr::SEvent event);
 // Use if you want to reset your rendering device without losing ImGui state.
 IMGUI_API void        ImGui_ImplIrrlicht_InvalidateDeviceObjects();
 IMGUI_API bool        ImGui_ImplIrrlicht_CreateDeviceObjects();
+
+// Same as ImGui_ImplIrrlicht_CreateDeviceObjects(), but the linked shader program is loaded from the directory program_cache_dir
+// or stored there after linking (needs OpenGL 4.1 or GL_ARB_get_program_binary). program_cache_dir may be NULL to disable the cache.
+// program_from_cache is set to true, when the program has been loaded from the cache (may be NULL).
+IMGUI_API bool        ImGui_ImplIrrlicht_CreateDeviceObjectsCached(const char *program_cache_dir, bool *program_from_cache);
+
+// Copies a rectangle of alpha values (without padding between the rows) into the font texture of the binding (used for dynamic glyphs).
+IMGUI_API void        ImGui_ImplIrrlicht_UpdateFontsTexture(int x, int y, int width, int height, const unsigned char *alpha_pixels);
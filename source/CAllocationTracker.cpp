@@ -0,0 +1,242 @@
+/**
+ * @file   CAllocationTracker.cpp
+ * @author Andre Netzeband
+ * @brief  Contains the allocator hooks of the IMGUI contexts, that count the allocations of every GUI frame.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstdlib>
+#if defined(_MSC_VER)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+// module includes
+#include "private/CAllocationTracker.h"
+#include <IMGUI/imgui_internal.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions and thread states of the allocation tracking.
+namespace AllocationHelper {
+/// @brief The IMGUI context, whose allocations are counted on this thread.
+static thread_local ImGuiContext *tpContext = nullptr;
+
+/// @brief The tracker, that counts the allocations of tpContext on this thread.
+static thread_local CAllocationTracker *tpTracker = nullptr;
+
+/// @return Returns the tracker of the current IMGUI context or nullptr, when the allocations are not counted.
+static CAllocationTracker *getCurrentTracker(void) {
+    if((tpTracker == nullptr) || (tpContext != ImGui::GetCurrentContext())) {
+        return nullptr;
+    }
+
+    return tpTracker;
+}
+
+/// @return Returns the real size of a block allocated with malloc.
+static size_t getBlockSize(void *const pMemory) {
+#if defined(_MSC_VER)
+    return _msize(pMemory);
+#elif defined(__APPLE__)
+    return malloc_size(pMemory);
+#else
+    return malloc_usable_size(pMemory);
+#endif
+}
+}
+
+CAllocationTracker::CAllocationTracker(void):
+    mAllocations(0),
+    mSystemAllocations(0),
+    mFrees(0),
+    mReallocations(0),
+    mAllocatedBytes(0),
+    mLiveBytes(0),
+    mPeakBytes(0),
+    mLastBlockSize(0),
+    mIsLastOperationAllocation(false),
+    mpProfiler(nullptr),
+    mSamplingInterval(0),
+    mSamplingCounter(0),
+    mpFrameAllocator(nullptr),
+    mIsFrameAllocatorEnabled(false),
+    mIsInFrame(false) {
+    return;
+}
+
+CAllocationTracker::~CAllocationTracker(void) {
+    resetCurrent();
+    return;
+}
+
+void *CAllocationTracker::allocate(size_t const Size) {
+    CAllocationTracker *const pTracker = AllocationHelper::getCurrentTracker();
+
+    if(pTracker && pTracker->mIsFrameAllocatorEnabled && pTracker->mIsInFrame) {
+        size_t BlockSize = 0;
+        bool IsSystemAllocation = false;
+
+        void *const pMemory = pTracker->mpFrameAllocator->allocate(Size, BlockSize, IsSystemAllocation);
+        if(pMemory) {
+            pTracker->countAllocation(Size, BlockSize, IsSystemAllocation);
+            return pMemory;
+        }
+    }
+
+    void *const pMemory = malloc(Size);
+
+    if(pTracker && pMemory) {
+        pTracker->countAllocation(Size, AllocationHelper::getBlockSize(pMemory), true);
+    }
+
+    return pMemory;
+}
+
+void CAllocationTracker::deallocate(void *const pMemory) {
+    if(pMemory == nullptr) {
+        return;
+    }
+
+    CAllocationTracker *const pTracker = AllocationHelper::getCurrentTracker();
+
+    // blocks of a frame allocator are given back to their owner, whatever context is current
+    size_t BlockSize = 0;
+    bool const IsFrameBlock = (pTracker && pTracker->mpFrameAllocator && pTracker->mpFrameAllocator->deallocate(pMemory, BlockSize)) ||
+                              CFrameAllocator::deallocateForeignBlock(pMemory, BlockSize);
+    if(IsFrameBlock) {
+        if(pTracker) {
+            pTracker->countDeallocation(BlockSize);
+        }
+        return;
+    }
+
+    if(pTracker) {
+        pTracker->countDeallocation(AllocationHelper::getBlockSize(pMemory));
+    }
+
+    free(pMemory);
+    return;
+}
+
+void CAllocationTracker::makeCurrent(ImGuiContext *const pContext) {
+    AllocationHelper::tpContext = pContext;
+    AllocationHelper::tpTracker = this;
+    return;
+}
+
+void CAllocationTracker::resetCurrent(void) {
+    if(AllocationHelper::tpTracker == this) {
+        AllocationHelper::tpContext = nullptr;
+        AllocationHelper::tpTracker = nullptr;
+    }
+
+    return;
+}
+
+void CAllocationTracker::startFrame(void) {
+    // the blocks, that other contexts have freed since the last frame, are reused in this frame
+    if(mpFrameAllocator) {
+        mpFrameAllocator->releaseRemoteBlocks();
+    }
+
+    mIsInFrame      = true;
+    mAllocations    = 0;
+    mSystemAllocations = 0;
+    mFrees          = 0;
+    mReallocations  = 0;
+    mAllocatedBytes = 0;
+    mPeakBytes      = mLiveBytes;
+    mIsLastOperationAllocation = false;
+    return;
+}
+
+void CAllocationTracker::endFrame(void) {
+    mIsInFrame = false;
+    return;
+}
+
+void CAllocationTracker::getFrameStatistics(SIMGUIFrameProfile &rProfile) const {
+    rProfile.mAllocations    = mAllocations;
+    rProfile.mSystemAllocations = mSystemAllocations;
+    rProfile.mFrees          = mFrees;
+    rProfile.mReallocations  = mReallocations;
+    rProfile.mAllocatedBytes = mAllocatedBytes;
+    rProfile.mLiveBytes      = mLiveBytes;
+    rProfile.mPeakBytes      = mPeakBytes;
+    return;
+}
+
+void CAllocationTracker::setSampling(CIMGUIFrameProfiler *const pProfiler, unsigned int const Interval) {
+    mpProfiler        = pProfiler;
+    mSamplingInterval = Interval;
+    mSamplingCounter  = 0;
+    return;
+}
+
+void CAllocationTracker::setFrameAllocator(CFrameAllocator *const pFrameAllocator, bool const IsEnabled) {
+    mpFrameAllocator          = pFrameAllocator;
+    mIsFrameAllocatorEnabled  = (pFrameAllocator != nullptr) && IsEnabled;
+    return;
+}
+
+void CAllocationTracker::countAllocation(size_t const Size, size_t const BlockSize, bool const IsSystemAllocation) {
+    mAllocations++;
+    if(IsSystemAllocation) {
+        mSystemAllocations++;
+    }
+    mAllocatedBytes += Size;
+    mLiveBytes      += BlockSize;
+
+    if(mLiveBytes > mPeakBytes) {
+        mPeakBytes = mLiveBytes;
+    }
+
+    mLastBlockSize             = BlockSize;
+    mIsLastOperationAllocation = true;
+
+    if(mpProfiler && (mSamplingInterval > 0)) {
+        mSamplingCounter++;
+        if(mSamplingCounter >= mSamplingInterval) {
+            mSamplingCounter = 0;
+
+            // the window, that is currently built, is the call site seen from the widget code
+            ImGuiWindow const *const pWindow = ImGui::GetCurrentContext()->CurrentWindow;
+            mpProfiler->addAllocationSample(pWindow ? pWindow->Name : "(no window)", Size);
+        }
+    }
+
+    return;
+}
+
+void CAllocationTracker::countDeallocation(size_t const BlockSize) {
+    mFrees++;
+
+    // a growing ImVector frees the smaller buffer directly after allocating the new one
+    if(mIsLastOperationAllocation && (BlockSize < mLastBlockSize)) {
+        mReallocations++;
+    }
+    mIsLastOperationAllocation = false;
+
+    // blocks of shared objects (like the font atlas) can be allocated while another tracker was current
+    mLiveBytes = (BlockSize < mLiveBytes) ? (mLiveBytes - BlockSize) : 0;
+    return;
+}
+
+}
+}
+
+/**
+ * @}
+ */
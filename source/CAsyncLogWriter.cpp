@@ -0,0 +1,274 @@
+/**
+ * @file   CAsyncLogWriter.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a background thread, that writes the records of the debug channels.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstring>
+
+// module includes
+#include "private/CAsyncLogWriter.h"
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+std::atomic<bool> CAsyncLogWriter::IsRunning(false);
+
+CAsyncLogWriter &CAsyncLogWriter::getInstance(void) {
+    static CAsyncLogWriter Writer;
+    return Writer;
+}
+
+CAsyncLogWriter::CAsyncLogWriter(void):
+    mEnqueuePosition(0),
+    mWrittenPosition(0),
+    mDequeuePosition(0),
+    mIsStopRequested(false),
+    mActiveWriters(0),
+    mIsWaiting(false) {
+    for(size_t i = 0; i < NumberOfSlots; i++) {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+
+    return;
+}
+
+CAsyncLogWriter::~CAsyncLogWriter(void) {
+    stop();
+    return;
+}
+
+void CAsyncLogWriter::start(void) {
+    std::lock_guard<std::mutex> ThreadLock(mThreadMutex);
+
+    if(!mThread.joinable()) {
+        mIsStopRequested = false;
+        mThread = std::thread(&CAsyncLogWriter::run, this);
+        IsRunning.store(true, std::memory_order_release);
+    }
+
+    return;
+}
+
+void CAsyncLogWriter::stop(void) {
+    // the destructor, stopAsyncLogging() and flush() may access the thread object at the same time
+    std::lock_guard<std::mutex> ThreadLock(mThreadMutex);
+
+    IsRunning = false;
+
+    // the threads, that have seen the running writer, are still allowed to put their text into the queue
+    while(mActiveWriters.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mIsStopRequested = true;
+    }
+    mCondition.notify_one();
+
+    if(mThread.joinable()) {
+        mThread.join();
+    }
+
+    return;
+}
+
+void CAsyncLogWriter::flush(void) {
+    std::lock_guard<std::mutex> ThreadLock(mThreadMutex);
+    size_t const Position = mEnqueuePosition.load();
+
+    while(mThread.joinable() && (mWrittenPosition.load() < Position)) {
+        wakeUp();
+        std::this_thread::yield();
+    }
+
+    return;
+}
+
+bool CAsyncLogWriter::write(std::streambuf *const pBuffer, char const *pText, size_t Length) {
+    // the order of the counter and the check must not be changed, see stop()
+    mActiveWriters++;
+    if(!IsRunning) {
+        mActiveWriters--;
+        return false;
+    }
+
+    size_t const SlotTextSize = sizeof(mSlots[0].mText);
+
+    while(Length > 0) {
+        size_t const NeededSlots          = (Length + SlotTextSize - 1) / SlotTextSize;
+        size_t const NumberOfSlotsForText = (NeededSlots < MaxSlotsPerText) ? NeededSlots : MaxSlotsPerText;
+        size_t const Position = reserveSlots(NumberOfSlotsForText);
+
+        for(size_t i = 0; i < NumberOfSlotsForText; i++) {
+            SSlot &rSlot = mSlots[(Position + i) & (NumberOfSlots - 1)];
+            size_t const PartLength = (Length < SlotTextSize) ? Length : SlotTextSize;
+
+            rSlot.mpBuffer = pBuffer;
+            rSlot.mLength  = PartLength;
+            std::memcpy(rSlot.mText, pText, PartLength);
+            rSlot.mSequence.store(Position + i + 1, std::memory_order_release);
+
+            pText  += PartLength;
+            Length -= PartLength;
+        }
+    }
+
+    // only the first text after the queue became empty finds the background thread waiting
+    wakeUp();
+
+    mActiveWriters--;
+    return true;
+}
+
+size_t CAsyncLogWriter::reserveSlots(size_t const Number) {
+    size_t Position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+    while(true) {
+        // all slots must have been written by the background thread, otherwise the queue is full
+        bool AreSlotsFree = true;
+        for(size_t i = 0; i < Number; i++) {
+            if(mSlots[(Position + i) & (NumberOfSlots - 1)].mSequence.load(std::memory_order_acquire) != (Position + i)) {
+                AreSlotsFree = false;
+                break;
+            }
+        }
+
+        if(AreSlotsFree) {
+            if(mEnqueuePosition.compare_exchange_weak(Position, Position + Number, std::memory_order_relaxed)) {
+                return Position;
+            }
+        } else {
+            wakeUp();
+            std::this_thread::yield();
+            Position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void CAsyncLogWriter::wakeUp(void) {
+    // the filled slots must be visible before the flag is read, see run()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if(mIsWaiting.load(std::memory_order_relaxed)) {
+        // the lock makes sure, that the background thread either has not checked the queue yet or already waits
+        {
+            std::lock_guard<std::mutex> Lock(mMutex);
+        }
+        mCondition.notify_one();
+    }
+
+    return;
+}
+
+bool CAsyncLogWriter::hasFilledSlot(void) const {
+    return mSlots[mDequeuePosition & (NumberOfSlots - 1)].mSequence.load(std::memory_order_acquire) == (mDequeuePosition + 1);
+}
+
+void CAsyncLogWriter::run(void) {
+    while(true) {
+        if(writeSlots()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> Lock(mMutex);
+
+        // a producer, that filled a slot before the flag was set, is seen by the check below, all later ones see the flag
+        mIsWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if(!hasFilledSlot()) {
+            if(mIsStopRequested && (mDequeuePosition == mEnqueuePosition.load())) {
+                mIsWaiting.store(false, std::memory_order_relaxed);
+                break;
+            }
+
+            mCondition.wait(Lock);
+        }
+
+        mIsWaiting.store(false, std::memory_order_relaxed);
+    }
+
+    return;
+}
+
+bool CAsyncLogWriter::writeSlots(void) {
+    bool WasWritten = false;
+    std::streambuf *pLastBuffer = nullptr;
+
+    while(true) {
+        if(!hasFilledSlot()) {
+            break;
+        }
+
+        SSlot &rSlot = mSlots[mDequeuePosition & (NumberOfSlots - 1)];
+
+        // a buffer is synchronized, when the following text is written to another buffer or when the queue is empty
+        if(pLastBuffer && (pLastBuffer != rSlot.mpBuffer)) {
+            pLastBuffer->pubsync();
+        }
+        pLastBuffer = rSlot.mpBuffer;
+
+        if(rSlot.mpBuffer) {
+            rSlot.mpBuffer->sputn(rSlot.mText, static_cast<std::streamsize>(rSlot.mLength));
+        }
+
+        // the slot can be used again for the position in the next round
+        rSlot.mSequence.store(mDequeuePosition + NumberOfSlots, std::memory_order_release);
+        mDequeuePosition++;
+        WasWritten = true;
+    }
+
+    if(WasWritten) {
+        if(pLastBuffer) {
+            pLastBuffer->pubsync();
+        }
+
+        mWrittenPosition.store(mDequeuePosition);
+    }
+
+    return WasWritten;
+}
+
+}
+
+namespace Debug {
+
+void startAsyncLogging(void) {
+    Private::CAsyncLogWriter::getInstance().start();
+    return;
+}
+
+void stopAsyncLogging(void) {
+    if(Private::CAsyncLogWriter::isRunning()) {
+        Private::CAsyncLogWriter::getInstance().stop();
+    }
+    return;
+}
+
+void flushAsyncLogging(void) {
+    if(Private::CAsyncLogWriter::isRunning()) {
+        Private::CAsyncLogWriter::getInstance().flush();
+    }
+    return;
+}
+
+bool isAsyncLoggingEnabled(void) {
+    return Private::CAsyncLogWriter::isRunning();
+}
+
+}
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,114 @@
+/**
+ * @file   CAtomicFileWriter.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a writer, that replaces a file as a whole.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <IrrIMGUI/IrrIMGUIConfig.h>
+#ifdef _IRRIMGUI_WINDOWS_
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif // _IRRIMGUI_WINDOWS_
+#include <atomic>
+#include <cstdio>
+
+// module includes
+#include "private/CAtomicFileWriter.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions for the atomic file writer.
+namespace AtomicFileHelper {
+/// @brief Counts the temporary files of the process.
+static std::atomic<unsigned int> NumberOfTemporaryFiles(0);
+
+/// @return Returns a name for a temporary file next to the target file, that no other writer uses.
+static std::string getTemporaryFileName(std::string const &rFileName) {
+#ifdef _IRRIMGUI_WINDOWS_
+    unsigned long const ProcessID = static_cast<unsigned long>(GetCurrentProcessId());
+#else
+    unsigned long const ProcessID = static_cast<unsigned long>(getpid());
+#endif // _IRRIMGUI_WINDOWS_
+
+    char Suffix[48];
+    std::snprintf(Suffix, sizeof(Suffix), ".%lu-%u.tmp", ProcessID, NumberOfTemporaryFiles++);
+
+    return rFileName + Suffix;
+}
+
+/// @brief Moves a file over another one, that may exist.
+/// @return Returns false, when the file could not be moved.
+static bool replaceFile(std::string const &rSourceFileName, std::string const &rTargetFileName) {
+#ifdef _IRRIMGUI_WINDOWS_
+    return MoveFileExA(rSourceFileName.c_str(), rTargetFileName.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    // rename replaces an existing file atomically on POSIX systems
+    return std::rename(rSourceFileName.c_str(), rTargetFileName.c_str()) == 0;
+#endif // _IRRIMGUI_WINDOWS_
+}
+}
+
+CAtomicFileWriter::CAtomicFileWriter(std::string const &rFileName):
+    mFileName(rFileName),
+    mTemporaryFileName(AtomicFileHelper::getTemporaryFileName(rFileName)),
+    mIsFinished(false) {
+    mFile.open(mTemporaryFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    return;
+}
+
+CAtomicFileWriter::~CAtomicFileWriter(void) {
+    if(!mIsFinished) {
+        discard();
+    }
+    return;
+}
+
+bool CAtomicFileWriter::isOpen(void) const {
+    return mFile.is_open();
+}
+
+bool CAtomicFileWriter::commit(void) {
+    if(mIsFinished || !mFile.is_open()) {
+        return false;
+    }
+
+    // closing flushes the buffered data, which can fail as well
+    mFile.close();
+    if(!mFile) {
+        discard();
+        return false;
+    }
+
+    mIsFinished = true;
+    if(!AtomicFileHelper::replaceFile(mTemporaryFileName, mFileName)) {
+        std::remove(mTemporaryFileName.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void CAtomicFileWriter::discard(void) {
+    if(mFile.is_open()) {
+        mFile.close();
+    }
+    std::remove(mTemporaryFileName.c_str());
+    mIsFinished = true;
+    return;
+}
+
+}
+}
+
+/**
+ * @}
+ */
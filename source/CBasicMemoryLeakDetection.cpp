@@ -9,10 +9,173 @@
 #include <IrrIMGUI/Tools/CBasicMemoryLeakDetection.h>
 #include "private/IrrIMGUIDebug_priv.h"
 
+#if defined(_IRRIMGUI_MEMORY_INSTRUMENTATION_) && defined(__GLIBC__)
+#define _IRRIMGUI_COUNT_ALLOCATIONS_
+
+// library includes
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cerrno>
+#include <malloc.h>
+#include <unistd.h>
+
+/// @brief The real allocation functions of the GNU C library.
+extern "C" {
+    void *__libc_malloc(size_t Size);
+    void *__libc_calloc(size_t Number, size_t Size);
+    void *__libc_realloc(void *pMemory, size_t Size);
+    void *__libc_memalign(size_t Alignment, size_t Size);
+    void  __libc_free(void *pMemory);
+}
+
+namespace IrrIMGUI {
+namespace Tools {
+
+/// @brief The counters of all allocations of the process.
+namespace InstrumentationHelper {
+/// @brief The number of bytes, that are currently allocated. It is signed, since blocks, that have not been counted (for example
+///        allocated before the instrumentation or directly by the C library), may be freed with free().
+static std::atomic<std::ptrdiff_t> CurrentBytes(0);
+
+/// @brief The highest number of allocated bytes since the last reset of any detection object.
+static std::atomic<std::ptrdiff_t> PeakBytes(0);
+
+/// @brief The number of allocations since the start of the process.
+static std::atomic<size_t> Allocations(0);
+
+/// @brief Protects the list of detection objects and their peak memory.
+static std::mutex DetectionMutex;
+
+/// @brief The first object of the list of all detection objects. The list is linked over the objects, thus it does not allocate memory.
+static CBasicMemoryLeakDetection *pFirstDetection = nullptr;
+
+/// @brief Counts an allocated block.
+static void *countAllocation(void *const pMemory) {
+    if(pMemory) {
+        std::ptrdiff_t const BlockSize = static_cast<std::ptrdiff_t>(malloc_usable_size(pMemory));
+        std::ptrdiff_t const Current   = CurrentBytes.fetch_add(BlockSize) + BlockSize;
+        Allocations++;
+
+        std::ptrdiff_t Peak = PeakBytes.load();
+        while((Current > Peak) && !PeakBytes.compare_exchange_weak(Peak, Current)) {
+        }
+    }
+
+    return pMemory;
+}
+
+/// @brief Counts a block, that is freed.
+static void countDeallocation(void *const pMemory) {
+    if(pMemory) {
+        CurrentBytes -= static_cast<std::ptrdiff_t>(malloc_usable_size(pMemory));
+    }
+
+    return;
+}
+}
+
+}
+}
+
+// the counting functions replace the functions of the C library for the whole process
+extern "C" {
+
+void *malloc(size_t const Size) {
+    return IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_malloc(Size));
+}
+
+void *calloc(size_t const Number, size_t const Size) {
+    return IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_calloc(Number, Size));
+}
+
+void *realloc(void *const pMemory, size_t const Size) {
+    size_t const OldBlockSize = pMemory ? malloc_usable_size(pMemory) : 0;
+    void *const pNewMemory = __libc_realloc(pMemory, Size);
+
+    // when the reallocation fails, the old block is still valid
+    if(pNewMemory || (Size == 0)) {
+        IrrIMGUI::Tools::InstrumentationHelper::CurrentBytes -= static_cast<std::ptrdiff_t>(OldBlockSize);
+        IrrIMGUI::Tools::InstrumentationHelper::countAllocation(pNewMemory);
+    }
+
+    return pNewMemory;
+}
+
+void *reallocarray(void *const pMemory, size_t const Number, size_t const Size) {
+    if((Size != 0) && (Number > (static_cast<size_t>(-1) / Size))) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+
+    return realloc(pMemory, Number * Size);
+}
+
+void *memalign(size_t const Alignment, size_t const Size) {
+    return IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_memalign(Alignment, Size));
+}
+
+void *aligned_alloc(size_t const Alignment, size_t const Size) {
+    return IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_memalign(Alignment, Size));
+}
+
+int posix_memalign(void **const ppMemory, size_t const Alignment, size_t const Size) {
+    if((Alignment < sizeof(void *)) || ((Alignment & (Alignment - 1)) != 0)) {
+        return EINVAL;
+    }
+
+    void *const pMemory = IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_memalign(Alignment, Size));
+    if(pMemory == nullptr) {
+        return ENOMEM;
+    }
+
+    *ppMemory = pMemory;
+    return 0;
+}
+
+void *valloc(size_t const Size) {
+    return IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_memalign(sysconf(_SC_PAGESIZE), Size));
+}
+
+void *pvalloc(size_t const Size) {
+    // the size is rounded up to whole pages, at least one page is allocated
+    size_t const PageSize      = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t const NumberOfPages = (Size == 0) ? 1 : (Size / PageSize) + (((Size % PageSize) != 0) ? 1 : 0);
+    if(NumberOfPages > (static_cast<size_t>(-1) / PageSize)) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+
+    return IrrIMGUI::Tools::InstrumentationHelper::countAllocation(__libc_memalign(PageSize, NumberOfPages * PageSize));
+}
+
+void free(void *const pMemory) {
+    IrrIMGUI::Tools::InstrumentationHelper::countDeallocation(pMemory);
+    __libc_free(pMemory);
+    return;
+}
+
+}
+
+#endif // _IRRIMGUI_MEMORY_INSTRUMENTATION_ && __GLIBC__
+
 namespace IrrIMGUI {
 namespace Tools {
 
-CBasicMemoryLeakDetection::CBasicMemoryLeakDetection(void) {
+CBasicMemoryLeakDetection::CBasicMemoryLeakDetection(void):
+    mUsedBytes(0),
+    mPeakBytes(0),
+    mAllocations(0),
+    mWasMemoryChecked(false),
+    mpNextDetection(nullptr) {
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    {
+        std::lock_guard<std::mutex> Lock(InstrumentationHelper::DetectionMutex);
+        mpNextDetection = InstrumentationHelper::pFirstDetection;
+        InstrumentationHelper::pFirstDetection = this;
+    }
+#endif // _IRRIMGUI_COUNT_ALLOCATIONS_
+
     resetMemoryState();
     return;
 }
@@ -24,13 +187,26 @@ CBasicMemoryLeakDetection::~CBasicMemoryLeakDetection(void) {
             LOG_ERROR("Memory Leak detected: " << MemoryLeak << " Bytes has been allocated but not freed-up!");
         }
     }
+
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    std::lock_guard<std::mutex> Lock(InstrumentationHelper::DetectionMutex);
+    CBasicMemoryLeakDetection **ppDetection = &InstrumentationHelper::pFirstDetection;
+    while(*ppDetection != this) {
+        ppDetection = &(*ppDetection)->mpNextDetection;
+    }
+    *ppDetection = mpNextDetection;
+#endif // _IRRIMGUI_COUNT_ALLOCATIONS_
+
     return;
 }
 
 int CBasicMemoryLeakDetection::compareMemoryState(void) {
     int MemoryLeak = 0;
 
-#ifdef _ENABLE_MEMORY_LEAK_DETECTION_
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    MemoryLeak = static_cast<int>(InstrumentationHelper::CurrentBytes - mUsedBytes);
+
+#elif defined(_ENABLE_MEMORY_LEAK_DETECTION_)
     _CrtMemState CurrentMemoryState;
     _CrtMemState MemoryDifference;
 
@@ -58,15 +234,53 @@ int CBasicMemoryLeakDetection::compareMemoryState(void) {
 }
 
 void CBasicMemoryLeakDetection::resetMemoryState(void) {
-#ifdef _ENABLE_MEMORY_LEAK_DETECTION_
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    std::lock_guard<std::mutex> Lock(InstrumentationHelper::DetectionMutex);
+    mUsedBytes   = InstrumentationHelper::CurrentBytes;
+    mAllocations = InstrumentationHelper::Allocations;
+
+    // the other objects keep the peak, that has been reached until now
+    std::ptrdiff_t const Peak = InstrumentationHelper::PeakBytes.exchange(mUsedBytes);
+    for(CBasicMemoryLeakDetection *pDetection = InstrumentationHelper::pFirstDetection; pDetection; pDetection = pDetection->mpNextDetection) {
+        pDetection->mPeakBytes = std::max(pDetection->mPeakBytes, Peak);
+    }
+    mPeakBytes = mUsedBytes;
+
+#elif defined(_ENABLE_MEMORY_LEAK_DETECTION_)
     _CrtMemCheckpoint(&mMemoryState);
-#endif // _ENABLE_MEMORY_LEAK_DETECTION_
+#endif // _IRRIMGUI_COUNT_ALLOCATIONS_
 
     mWasMemoryChecked = false;
 
     return;
 }
 
+size_t CBasicMemoryLeakDetection::getPeakBytes(void) const {
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    std::lock_guard<std::mutex> Lock(InstrumentationHelper::DetectionMutex);
+    std::ptrdiff_t const PeakBytes = std::max(mPeakBytes, InstrumentationHelper::PeakBytes.load());
+    return (PeakBytes > mUsedBytes) ? static_cast<size_t>(PeakBytes - mUsedBytes) : 0;
+#else
+    return 0;
+#endif // _IRRIMGUI_COUNT_ALLOCATIONS_
+}
+
+size_t CBasicMemoryLeakDetection::getNumberOfAllocations(void) const {
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    return InstrumentationHelper::Allocations - mAllocations;
+#else
+    return 0;
+#endif // _IRRIMGUI_COUNT_ALLOCATIONS_
+}
+
+bool CBasicMemoryLeakDetection::isInstrumented(void) {
+#ifdef _IRRIMGUI_COUNT_ALLOCATIONS_
+    return true;
+#else
+    return false;
+#endif // _IRRIMGUI_COUNT_ALLOCATIONS_
+}
+
 }
 }
 
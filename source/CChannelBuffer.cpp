@@ -7,54 +7,128 @@
 
 // standard library includes
 #include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 
 // module includes
 #include <IrrIMGUI/IrrIMGUIDebug.h>
+#include "private/CAsyncLogWriter.h"
 
 namespace IrrIMGUI {
 namespace Debug {
 
+/// @brief Helper functions for the channels.
+namespace ChannelHelper {
+/// @brief The number of characters, that are prepared at once with the prefixes.
+static size_t const OutputSize = 512;
+
+/// @brief The number of records, that a thread can format at the same time. A LOG macro inside the expression of another LOG macro
+///        starts a nested record. Records nested deeper share the stream of the last level.
+static unsigned int const MaxNestedRecords = 4;
+
+/// @brief The number of records, that the calling thread is formatting.
+static thread_local unsigned int NestedRecords = 0;
+
+/// @brief Collects the text with prefixes before it is written.
+class COutput {
+    public:
+        /// @brief Constructor.
+        COutput(std::streambuf *const pBuffer, bool const IsAsync):
+            mpBuffer(pBuffer),
+            mIsAsync(IsAsync),
+            mLength(0),
+            mIsSuccessful(true) {
+            return;
+        }
+
+        /// @brief Adds text.
+        void add(char const *pText, size_t Length) {
+            while(Length > 0) {
+                size_t const PartLength = ((OutputSize - mLength) < Length) ? (OutputSize - mLength) : Length;
+                std::memcpy(&mText[mLength], pText, PartLength);
+                mLength += PartLength;
+                pText   += PartLength;
+                Length  -= PartLength;
+
+                if(mLength == OutputSize) {
+                    write();
+                }
+            }
+            return;
+        }
+
+        /// @brief Writes the collected text.
+        /// @return Returns true when the output was successful.
+        bool write(void) {
+            if(mLength > 0) {
+                if(!mIsAsync || !Private::CAsyncLogWriter::getInstance().write(mpBuffer, mText, mLength)) {
+                    if(mpBuffer->sputn(mText, static_cast<std::streamsize>(mLength)) != static_cast<std::streamsize>(mLength)) {
+                        mIsSuccessful = false;
+                    }
+                }
+                mLength = 0;
+            }
+            return mIsSuccessful;
+        }
+
+    private:
+        std::streambuf *mpBuffer;
+        bool            mIsAsync;
+        size_t          mLength;
+        bool            mIsSuccessful;
+        char            mText[OutputSize];
+};
+}
+
 CChannelBuffer::CChannelBuffer(std::streambuf *pStreamBuffer, char const *pPrefix):
     mpPrefix(pPrefix),
     mpBuffer(pStreamBuffer),
     mIsNewLine(true) {
+    setp(mCharacters, mCharacters + CharacterBufferSize);
     return;
 }
 
 void CChannelBuffer::setupBuffer(std::streambuf *pStreamBuffer,  bool NextSymbolOnNewLine) {
+    flushCharacters();
+
+    // the queued records still point to the old buffer
+    flushAsyncLogging();
+
     mpBuffer = pStreamBuffer;
     mIsNewLine = NextSymbolOnNewLine;
     return;
 }
 
 void CChannelBuffer::setupPrefix(char const *pPrefix) {
+    flushCharacters();
     mpPrefix = pPrefix;
     return;
 }
 
-int CChannelBuffer::overflow(int const Character) {
-    int ReturnChar      = Character;
+void CChannelBuffer::writeRecord(char const *const pText, size_t const Length) {
+    if(Private::CAsyncLogWriter::isRunning()) {
+        writeText(pText, Length);
+    } else {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        if(writeText(pText, Length) && mpBuffer) {
+            mpBuffer->pubsync();
+        }
+    }
 
-    if(mpBuffer) {
-        bool IsPrintAllowed = true;
+    return;
+}
 
-        if(mIsNewLine) {
-            if(!printPrefix()) {
-                ReturnChar = EOF;
-                IsPrintAllowed = false;
-            }
-            mIsNewLine = false;
-        }
+int CChannelBuffer::overflow(int const Character) {
+    int ReturnChar = Character;
 
-        if(IsPrintAllowed) {
-            if(mpBuffer->sputc(Character) == EOF) {
-                ReturnChar = EOF;
-            }
+    if(!flushCharacters()) {
+        ReturnChar = EOF;
+    }
 
-            if(Character == '\n') {
-                mIsNewLine = true;
-            }
-        }
+    if(Character != EOF) {
+        *pptr() = static_cast<char>(Character);
+        pbump(1);
     }
 
     return ReturnChar;
@@ -63,7 +137,11 @@ int CChannelBuffer::overflow(int const Character) {
 int CChannelBuffer::sync(void) {
     int Return = 0;
 
-    if(mpBuffer) {
+    if(!flushCharacters()) {
+        Return = -1;
+    }
+
+    if(mpBuffer && !Private::CAsyncLogWriter::isRunning()) {
         if(mpBuffer->pubsync() == -1) {
             Return = -1;
         }
@@ -72,17 +150,149 @@ int CChannelBuffer::sync(void) {
     return Return;
 }
 
-bool CChannelBuffer::printPrefix(void) {
-    bool IsPrintAllowed = true;
+bool CChannelBuffer::flushCharacters(void) {
+    size_t const Length = static_cast<size_t>(pptr() - pbase());
+    setp(mCharacters, mCharacters + CharacterBufferSize);
+
+    return writeText(mCharacters, Length);
+}
+
+bool CChannelBuffer::writeText(char const *pText, size_t Length) {
+    if((mpBuffer == nullptr) || (Length == 0)) {
+        return true;
+    }
+
+    bool IsNewLine = mIsNewLine.exchange(pText[Length - 1] == '\n');
+    size_t const PrefixLength = std::strlen(mpPrefix);
+
+    ChannelHelper::COutput Output(mpBuffer, Private::CAsyncLogWriter::isRunning());
 
-    for(int i = 0; mpPrefix[i]; i++) {
-        if(mpBuffer->sputc(mpPrefix[i]) == EOF) {
-            break;
-            IsPrintAllowed = false;
+    while(Length > 0) {
+        if(IsNewLine) {
+            Output.add(mpPrefix, PrefixLength);
         }
+
+        char const *const pLineEnd = static_cast<char const *>(std::memchr(pText, '\n', Length));
+        size_t const LineLength = pLineEnd ? static_cast<size_t>(pLineEnd - pText) + 1 : Length;
+
+        Output.add(pText, LineLength);
+        IsNewLine = (pLineEnd != nullptr);
+
+        pText  += LineLength;
+        Length -= LineLength;
+    }
+
+    return Output.write();
+}
+
+void CChannel::writeRecord(char const *const pText, size_t const Length) {
+    unsigned int const UnreportedRecords = (mUnreportedRecords != 0) ? mUnreportedRecords.exchange(0) : 0;
+
+    // the stream has been redirected, this is done by the unit tests to check the output
+    if(rdbuf() != &mBuffer) {
+        rdbuf()->sputn(pText, static_cast<std::streamsize>(Length));
+        return;
     }
 
-    return IsPrintAllowed;
+    if(UnreportedRecords != 0) {
+        char Text[128];
+        int const TextLength = std::snprintf(Text, sizeof(Text), "%u records have been suppressed by the rate limit.\n", UnreportedRecords);
+        mBuffer.writeRecord(Text, static_cast<size_t>(TextLength));
+    }
+
+    mBuffer.writeRecord(pText, Length);
+    return;
+}
+
+void CChannel::setRateLimit(unsigned int const MaxRecordsPerSecond) {
+    mMaxRecordsPerSecond = MaxRecordsPerSecond;
+    mRecordsInSecond     = 0;
+    return;
+}
+
+bool CChannel::isRecordAllowed(void) {
+    unsigned int const MaxRecordsPerSecond = mMaxRecordsPerSecond.load(std::memory_order_relaxed);
+    if(MaxRecordsPerSecond == 0) {
+        return true;
+    }
+
+    long long const Second = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    long long LastSecond = mRateSecond.load();
+    if((Second != LastSecond) && mRateSecond.compare_exchange_strong(LastSecond, Second)) {
+        mRecordsInSecond = 0;
+    }
+
+    if(++mRecordsInSecond > MaxRecordsPerSecond) {
+        mUnreportedRecords++;
+        mSuppressedRecords++;
+        return false;
+    }
+
+    return true;
+}
+
+CRecordStream::CRecordBuffer::CRecordBuffer(void):
+    mpChannel(nullptr) {
+    return;
+}
+
+void CRecordStream::CRecordBuffer::start(CChannel &rChannel) {
+    mpChannel = &rChannel;
+    setp(mText, mText + TextSize);
+    return;
+}
+
+void CRecordStream::CRecordBuffer::finish(void) {
+    size_t const Length = static_cast<size_t>(pptr() - pbase());
+    if((Length > 0) && mpChannel) {
+        mpChannel->writeRecord(mText, Length);
+    }
+
+    setp(mText, mText + TextSize);
+    return;
+}
+
+int CRecordStream::CRecordBuffer::overflow(int const Character) {
+    finish();
+
+    if(Character != EOF) {
+        *pptr() = static_cast<char>(Character);
+        pbump(1);
+    }
+
+    return Character;
+}
+
+CRecordStream::CRecordStream(void):
+    std::ostream(&mBuffer) {
+    return;
+}
+
+CRecordStream &CRecordStream::start(CChannel &rChannel) {
+    static thread_local CRecordStream Streams[ChannelHelper::MaxNestedRecords];
+    static std::ios DefaultFormat(nullptr);
+
+    // a record, that is started while another record of the thread is formatted, must not reset the stream of the other record
+    unsigned int const Level = ChannelHelper::NestedRecords;
+    CRecordStream &rStream = Streams[(Level < ChannelHelper::MaxNestedRecords) ? Level : (ChannelHelper::MaxNestedRecords - 1)];
+    ChannelHelper::NestedRecords++;
+
+    // every record starts with the default formatting
+    rStream.copyfmt(DefaultFormat);
+    rStream.clear();
+    rStream.mBuffer.start(rChannel);
+
+    return rStream;
+}
+
+void CRecordStream::finish(void) {
+    mBuffer.finish();
+
+    if(ChannelHelper::NestedRecords > 0) {
+        ChannelHelper::NestedRecords--;
+    }
+
+    return;
 }
 
 CChannel NoteOutput(std::cout,    "[Note]    ");
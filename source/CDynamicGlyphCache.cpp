@@ -0,0 +1,404 @@
+/**
+ * @file   CDynamicGlyphCache.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a cache for glyphs, that are rasterized when they are drawn for the first time.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// module includes
+#include "private/CDynamicGlyphCache.h"
+#include <IMGUI/imgui_internal.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+// stb_truetype is compiled as static library inside of imgui_draw.cpp, thus it is compiled here again with the same allocator.
+#define STBTT_malloc(x,u)  ((void)(u), ImGui::MemAlloc(x))
+#define STBTT_free(x,u)    ((void)(u), ImGui::MemFree(x))
+#define STBTT_assert(x)    IM_ASSERT(x)
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <IMGUI/stb_truetype.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions and data for the dynamic glyph cache.
+namespace DynamicGlyphHelper {
+/// @brief The ID of the custom rectangle inside the font atlas, that contains the cells of the cache.
+static unsigned int const RectID = 0x10001;
+
+/// @brief The widest rectangle, that is reserved for the cells, when the atlas has no desired width.
+static unsigned int const MaxRectWidth = 512;
+}
+
+CDynamicGlyphCache::CDynamicGlyphCache(ImFontAtlas &rFontAtlas, ImFontConfig const &rFontConfig, ImWchar const *const pGlyphRanges, unsigned int const NumberOfGlyphs):
+    mpFont(rFontConfig.DstFont),
+    mpFontInfo(new stbtt_fontinfo),
+    mScale(1.0f),
+    mSizePixels(rFontConfig.SizePixels),
+    mGlyphExtraSpacing(rFontConfig.GlyphExtraSpacing),
+    mGlyphOffset(rFontConfig.GlyphOffset),
+    mIsPixelSnapH(rFontConfig.PixelSnapH),
+    mRectIndex(-1),
+    mNumberOfCells(std::max(NumberOfGlyphs, 1u)),
+    mGlyphWidth(0),
+    mGlyphHeight(0),
+    mSpread(0),
+    mCellWidth(0),
+    mCellHeight(0),
+    mColumns(0),
+    mRows(0),
+    mIsBuilt(false),
+    mAtlasX(0),
+    mAtlasY(0),
+    mUVScale(0.0f, 0.0f),
+    mGeneration(1),
+    mDirtyX0(0),
+    mDirtyY0(0),
+    mDirtyX1(0),
+    mDirtyY1(0),
+    mIsFullWarningShown(false) {
+    for(ImWchar const *pRange = pGlyphRanges; pRange && pRange[0] && pRange[1]; pRange += 2) {
+        mGlyphRanges.push_back(pRange[0]);
+        mGlyphRanges.push_back(pRange[1]);
+    }
+
+    unsigned char const *const pFontData = static_cast<unsigned char const *>(rFontConfig.FontData);
+    int const FontOffset = stbtt_GetFontOffsetForIndex(pFontData, rFontConfig.FontNo);
+
+    if((FontOffset < 0) || !stbtt_InitFont(mpFontInfo, pFontData, FontOffset)) {
+        LOG_ERROR("{IrrIMGUI} Cannot read the font for the dynamic glyph cache.\n");
+        return;
+    }
+
+    mScale = stbtt_ScaleForPixelHeight(mpFontInfo, mSizePixels);
+
+    // every cell has the size of the font bounding box, but some fonts contain a few very large glyphs
+    int BoxX0 = 0, BoxY0 = 0, BoxX1 = 0, BoxY1 = 0;
+    stbtt_GetFontBoundingBox(mpFontInfo, &BoxX0, &BoxY0, &BoxX1, &BoxY1);
+    unsigned int const MaxGlyphSize = static_cast<unsigned int>(std::ceil(mSizePixels * 2.0f));
+    mGlyphWidth  = std::min(static_cast<unsigned int>(std::ceil((BoxX1 - BoxX0) * mScale)), MaxGlyphSize);
+    mGlyphHeight = std::min(static_cast<unsigned int>(std::ceil((BoxY1 - BoxY0) * mScale)), MaxGlyphSize);
+
+    setupCells(rFontAtlas);
+
+    // IMGUI finds the cache through the font, thus fonts without cache never lock anything
+    if(mpFont) {
+        mpFont->DynamicGlyphs = this;
+    }
+
+    return;
+}
+
+void CDynamicGlyphCache::setupCells(ImFontAtlas &rFontAtlas) {
+    // the distance field of a glyph needs the spread on every side and the last column and row of a cell stay empty
+    mSpread     = static_cast<unsigned int>(std::max(rFontAtlas.TexGlyphSDFSpread, 0));
+    mCellWidth  = mGlyphWidth  + 2 * mSpread + 1;
+    mCellHeight = mGlyphHeight + 2 * mSpread + 1;
+
+    unsigned int const RectWidth = (rFontAtlas.TexDesiredWidth > 0) ? static_cast<unsigned int>(rFontAtlas.TexDesiredWidth) : DynamicGlyphHelper::MaxRectWidth;
+    mColumns = std::max(1u, std::min(mNumberOfCells, RectWidth / mCellWidth));
+    mRows    = (mNumberOfCells + mColumns - 1) / mColumns;
+
+    if(mRectIndex < 0) {
+        // the default rectangle must be the first one, otherwise IMGUI does not register it
+        ImFontAtlasBuildRegisterDefaultCustomRects(&rFontAtlas);
+        mRectIndex = rFontAtlas.CustomRectRegister(DynamicGlyphHelper::RectID, mColumns * mCellWidth, mRows * mCellHeight);
+    } else if(mRectIndex < rFontAtlas.CustomRects.Size) {
+        rFontAtlas.CustomRects[mRectIndex].Width  = static_cast<unsigned short>(mColumns * mCellWidth);
+        rFontAtlas.CustomRects[mRectIndex].Height = static_cast<unsigned short>(mRows * mCellHeight);
+    }
+
+    return;
+}
+
+void CDynamicGlyphCache::updateCells(ImFontAtlas &rFontAtlas) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    if(mSpread != static_cast<unsigned int>(std::max(rFontAtlas.TexGlyphSDFSpread, 0))) {
+        mIsBuilt = false;
+        setupCells(rFontAtlas);
+    }
+
+    return;
+}
+
+CDynamicGlyphCache::~CDynamicGlyphCache(void) {
+    if(mpFont && (mpFont->DynamicGlyphs == this)) {
+        mpFont->DynamicGlyphs = nullptr;
+    }
+
+    delete mpFontInfo;
+    return;
+}
+
+void CDynamicGlyphCache::build(ImFontAtlas &rFontAtlas) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    mIsBuilt = false;
+
+    if((mRectIndex < 0) || (mRectIndex >= rFontAtlas.CustomRects.Size) || !rFontAtlas.CustomRects[mRectIndex].IsPacked() || !mpFont) {
+        LOG_ERROR("{IrrIMGUI} The dynamic glyphs do not fit into the font atlas.\n");
+        return;
+    }
+
+    ImFontAtlas::CustomRect const &rRect = rFontAtlas.CustomRects[mRectIndex];
+    unsigned int const NumberOfCells = mColumns * mRows;
+
+    mAtlasX  = rRect.X;
+    mAtlasY  = rRect.Y;
+    mUVScale = ImVec2(1.0f / rFontAtlas.TexWidth, 1.0f / rFontAtlas.TexHeight);
+    mPixels.assign(rRect.Width * rRect.Height, 0);
+    mGlyphs.assign(NumberOfCells, ImFont::Glyph());
+    mGenerations.assign(NumberOfCells, 0);
+    mLRUPositions.assign(NumberOfCells, mLRU.end());
+    mLRU.clear();
+    mCells.clear();
+
+    mFreeCells.resize(NumberOfCells);
+    for(unsigned int Cell = 0; Cell < NumberOfCells; Cell++) {
+        mFreeCells[Cell] = NumberOfCells - Cell - 1;
+    }
+
+    mDirtyX0 = rRect.Width;
+    mDirtyY0 = rRect.Height;
+    mDirtyX1 = 0;
+    mDirtyY1 = 0;
+
+    // the advance of every dynamic glyph is stored in the index of the font, thus text sizes are right before a glyph is rasterized
+    int MaxCodepoint = 0;
+    for(size_t Range = 0; Range < mGlyphRanges.size(); Range += 2) {
+        MaxCodepoint = std::max(MaxCodepoint, static_cast<int>(mGlyphRanges[Range + 1]));
+    }
+
+    int const OldIndexSize = mpFont->IndexLookup.Size;
+    mpFont->GrowIndex(MaxCodepoint + 1);
+    for(int Codepoint = OldIndexSize; Codepoint < mpFont->IndexXAdvance.Size; Codepoint++) {
+        mpFont->IndexXAdvance[Codepoint] = mpFont->FallbackXAdvance;
+    }
+
+    for(size_t Range = 0; Range < mGlyphRanges.size(); Range += 2) {
+        for(int Codepoint = mGlyphRanges[Range]; Codepoint <= static_cast<int>(mGlyphRanges[Range + 1]); Codepoint++) {
+            if(mpFont->IndexLookup[Codepoint] != static_cast<unsigned short>(-1)) {
+                continue;
+            }
+
+            int const GlyphIndex = stbtt_FindGlyphIndex(mpFontInfo, Codepoint);
+            if(GlyphIndex == 0) {
+                mpFont->IndexXAdvance[Codepoint] = mpFont->FallbackXAdvance;
+                continue;
+            }
+
+            int Advance = 0, LeftSideBearing = 0;
+            stbtt_GetGlyphHMetrics(mpFontInfo, GlyphIndex, &Advance, &LeftSideBearing);
+            float XAdvance = Advance * mScale + mGlyphExtraSpacing.x;
+            if(mIsPixelSnapH) {
+                XAdvance = static_cast<float>(static_cast<int>(XAdvance + 0.5f));
+            }
+            mpFont->IndexXAdvance[Codepoint] = XAdvance;
+        }
+    }
+
+    // the texts of the font have been measured and drawn with the fallback glyph before
+    mpFont->InvalidateLayouts();
+
+    mIsBuilt = true;
+    return;
+}
+
+void CDynamicGlyphCache::invalidate(void) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    mIsBuilt = false;
+    mCells.clear();
+    mLRU.clear();
+    mFreeCells.clear();
+
+    // the cached text layouts contain quads of the cells
+    mpFont->InvalidateLayouts();
+
+    return;
+}
+
+ImFont::Glyph const *CDynamicGlyphCache::findGlyph(ImWchar const Codepoint) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    if(!mIsBuilt || !isDynamicGlyph(Codepoint)) {
+        return nullptr;
+    }
+
+    auto const CellIterator = mCells.find(Codepoint);
+    if(CellIterator != mCells.end()) {
+        unsigned int const Cell = CellIterator->second;
+        mLRU.splice(mLRU.begin(), mLRU, mLRUPositions[Cell]);
+        mGenerations[Cell] = mGeneration;
+        return &mGlyphs[Cell];
+    }
+
+    int const GlyphIndex = stbtt_FindGlyphIndex(mpFontInfo, Codepoint);
+    if(GlyphIndex == 0) {
+        return nullptr;
+    }
+
+    unsigned int Cell = 0;
+    if(!mFreeCells.empty()) {
+        Cell = mFreeCells.back();
+        mFreeCells.pop_back();
+        mLRUPositions[Cell] = mLRU.insert(mLRU.begin(), Cell);
+    } else {
+        // glyphs used in the current frame of the device can be part of a draw list, that has not been submitted yet
+        Cell = mLRU.back();
+        if(mGenerations[Cell] == mGeneration) {
+            if(!mIsFullWarningShown) {
+                LOG_WARNING("{IrrIMGUI} The dynamic glyph cache is full, increase the number of cached glyphs of the font.\n");
+                mIsFullWarningShown = true;
+            }
+            return nullptr;
+        }
+
+        mCells.erase(mGlyphs[Cell].Codepoint);
+        mLRU.splice(mLRU.begin(), mLRU, mLRUPositions[Cell]);
+    }
+
+    mGenerations[Cell] = mGeneration;
+    mCells[Codepoint]  = Cell;
+    rasterizeGlyph(Cell, Codepoint, GlyphIndex);
+
+    return &mGlyphs[Cell];
+}
+
+void CDynamicGlyphCache::nextFrame(void) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    mGeneration++;
+    mIsFullWarningShown = false;
+
+    return;
+}
+
+bool CDynamicGlyphCache::getUpdate(SUpdate &rUpdate) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    if(!mIsBuilt || (mDirtyX1 <= mDirtyX0) || (mDirtyY1 <= mDirtyY0)) {
+        return false;
+    }
+
+    unsigned int const Pitch = mColumns * mCellWidth;
+
+    rUpdate.mX      = mAtlasX + mDirtyX0;
+    rUpdate.mY      = mAtlasY + mDirtyY0;
+    rUpdate.mWidth  = mDirtyX1 - mDirtyX0;
+    rUpdate.mHeight = mDirtyY1 - mDirtyY0;
+    rUpdate.mPixels.resize(rUpdate.mWidth * rUpdate.mHeight);
+
+    for(unsigned int Y = 0; Y < rUpdate.mHeight; Y++) {
+        std::memcpy(&rUpdate.mPixels[Y * rUpdate.mWidth], &mPixels[(mDirtyY0 + Y) * Pitch + mDirtyX0], rUpdate.mWidth);
+    }
+
+    mDirtyX0 = Pitch;
+    mDirtyY0 = mRows * mCellHeight;
+    mDirtyX1 = 0;
+    mDirtyY1 = 0;
+
+    return true;
+}
+
+unsigned int CDynamicGlyphCache::getNumberOfGlyphs(void) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+    return static_cast<unsigned int>(mCells.size());
+}
+
+unsigned int CDynamicGlyphCache::getMemoryBytes(void) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+    return static_cast<unsigned int>(mPixels.capacity() + mGlyphs.capacity() * sizeof(ImFont::Glyph));
+}
+
+ImFont::Glyph const *CDynamicGlyphCache::findGlyph(ImFont const *const pFont, ImWchar const Codepoint) {
+    CDynamicGlyphCache *const pCache = static_cast<CDynamicGlyphCache *>(pFont->DynamicGlyphs);
+    return pCache ? pCache->findGlyph(Codepoint) : nullptr;
+}
+
+bool CDynamicGlyphCache::isDynamicGlyph(ImWchar const Codepoint) const {
+    for(size_t Range = 0; Range < mGlyphRanges.size(); Range += 2) {
+        if((Codepoint >= mGlyphRanges[Range]) && (Codepoint <= mGlyphRanges[Range + 1])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CDynamicGlyphCache::rasterizeGlyph(unsigned int const Cell, ImWchar const Codepoint, int const GlyphIndex) {
+    unsigned int const Pitch = mColumns * mCellWidth;
+    unsigned int const CellX = (Cell % mColumns) * mCellWidth;
+    unsigned int const CellY = (Cell / mColumns) * mCellHeight;
+    unsigned char *const pCell = &mPixels[CellY * Pitch + CellX];
+
+    for(unsigned int Y = 0; Y < mCellHeight; Y++) {
+        std::memset(&pCell[Y * Pitch], 0, mCellWidth);
+    }
+
+    // the last column and row of a cell stay empty, thus the bilinear filter never reads the neighbour glyph
+    int BoxX0 = 0, BoxY0 = 0, BoxX1 = 0, BoxY1 = 0;
+    stbtt_GetGlyphBitmapBox(mpFontInfo, GlyphIndex, mScale, mScale, &BoxX0, &BoxY0, &BoxX1, &BoxY1);
+    int const Spread = static_cast<int>(mSpread);
+    int const Width  = std::max(0, std::min(BoxX1 - BoxX0, static_cast<int>(mGlyphWidth)));
+    int const Height = std::max(0, std::min(BoxY1 - BoxY0, static_cast<int>(mGlyphHeight)));
+
+    // the quad of a distance field glyph contains the distance field around the outline
+    int const QuadSpread = ((Width > 0) && (Height > 0)) ? Spread : 0;
+
+    if((Width > 0) && (Height > 0)) {
+        stbtt_MakeGlyphBitmap(mpFontInfo, &pCell[Spread * Pitch + Spread], Width, Height, static_cast<int>(Pitch), mScale, mScale, GlyphIndex);
+        ImFontAtlasBuildDistanceField(mPixels.data(), static_cast<int>(Pitch), static_cast<int>(CellX), static_cast<int>(CellY), Width + 2 * Spread, Height + 2 * Spread, Spread);
+    }
+
+    int Advance = 0, LeftSideBearing = 0;
+    stbtt_GetGlyphHMetrics(mpFontInfo, GlyphIndex, &Advance, &LeftSideBearing);
+
+    float const OffsetX = mGlyphOffset.x;
+    float const OffsetY = mGlyphOffset.y + static_cast<float>(static_cast<int>(mpFont->Ascent + 0.5f));
+
+    ImFont::Glyph &rGlyph = mGlyphs[Cell];
+    rGlyph.Codepoint = Codepoint;
+    rGlyph.X0 = BoxX0 - QuadSpread + OffsetX;
+    rGlyph.Y0 = BoxY0 - QuadSpread + OffsetY;
+    rGlyph.X1 = BoxX0 + Width  + QuadSpread + OffsetX;
+    rGlyph.Y1 = BoxY0 + Height + QuadSpread + OffsetY;
+    rGlyph.U0 = (mAtlasX + CellX + Spread - QuadSpread) * mUVScale.x;
+    rGlyph.V0 = (mAtlasY + CellY + Spread - QuadSpread) * mUVScale.y;
+    rGlyph.U1 = (mAtlasX + CellX + Spread + Width  + QuadSpread) * mUVScale.x;
+    rGlyph.V1 = (mAtlasY + CellY + Spread + Height + QuadSpread) * mUVScale.y;
+    rGlyph.XAdvance = Advance * mScale + mGlyphExtraSpacing.x;
+    if(mIsPixelSnapH) {
+        rGlyph.XAdvance = static_cast<float>(static_cast<int>(rGlyph.XAdvance + 0.5f));
+    }
+
+    mDirtyX0 = std::min(mDirtyX0, CellX);
+    mDirtyY0 = std::min(mDirtyY0, CellY);
+    mDirtyX1 = std::max(mDirtyX1, CellX + mCellWidth);
+    mDirtyY1 = std::max(mDirtyY1, CellY + mCellHeight);
+
+    return;
+}
+
+}
+}
+
+/**
+ * @}
+ */
+
+/// @brief Is called by IMGUI for glyphs, that are not part of the font atlas (see IMGUI_FIND_DYNAMIC_GLYPH in imconfig.h).
+void const *ImGuiFindDynamicGlyph(ImFont const *pFont, unsigned short Codepoint) {
+    return IrrIMGUI::Private::CDynamicGlyphCache::findGlyph(pFont, Codepoint);
+}
@@ -0,0 +1,320 @@
+/**
+ * @file   CFontAtlasCache.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a file cache for baked font atlases.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// module includes
+#include "private/CFontAtlasCache.h"
+#include "private/CAtomicFileWriter.h"
+#include "private/CFontDataStore.h"
+#include <IMGUI/imgui_internal.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions for the font atlas cache.
+namespace FontCacheHelper {
+/// @brief The first bytes of a cache file.
+static char const Magic[4] = { 'I', 'I', 'F', 'A' };
+
+/// @brief The version of the file format.
+static uint32_t const Version = 2;
+
+/// @brief The alignment of the pixel data inside the file.
+static uint32_t const PixelAlignment = 16;
+
+/// @brief The largest atlas, that is accepted from a file (the same limit as the packer of IMGUI).
+static uint32_t const MaxAtlasSize = 1024 * 32;
+
+/// @brief The metrics of a font config, that are calculated while building the atlas.
+struct SConfigMetrics {
+    float   mAscent;
+    float   mDescent;
+    int32_t mMetricsTotalSurface;
+    int32_t mNumberOfGlyphs;
+};
+
+/// @brief The position of a custom rectangle inside the atlas.
+struct SRectPosition {
+    uint16_t mX;
+    uint16_t mY;
+};
+
+/// @brief The glyph table of a font config, that is read from a file.
+struct SConfigGlyphs {
+    SConfigMetrics             mMetrics;
+    std::vector<ImFont::Glyph> mGlyphs;
+};
+
+/// @return Returns the glyph ranges of a font config, like they are used to build the atlas.
+static ImWchar const *getGlyphRanges(ImFontAtlas &rFontAtlas, ImFontConfig const &rConfig) {
+    return rConfig.GlyphRanges ? rConfig.GlyphRanges : rFontAtlas.GetGlyphRangesDefault();
+}
+
+/// @return Returns the number of bytes of zero terminated glyph ranges.
+static int getGlyphRangesSize(ImWchar const *pGlyphRanges) {
+    int Size = 0;
+    while(pGlyphRanges[Size] != 0) {
+        Size++;
+    }
+    return Size * sizeof(ImWchar);
+}
+
+/// @return Returns the number of padding bytes in front of the pixel data.
+static uint32_t getPadding(uint64_t const Offset) {
+    return static_cast<uint32_t>((PixelAlignment - (Offset % PixelAlignment)) % PixelAlignment);
+}
+}
+
+CFontAtlasCache::CFontAtlasCache(char const *const pDirectory, ImFontAtlas &rFontAtlas, CFontDataStore const *const pFontDataStore) {
+    using FontCacheHelper::getGlyphRanges;
+    using FontCacheHelper::getGlyphRangesSize;
+
+    char Text[256];
+
+    // the default rectangle is registered while building, thus the rectangles of the key are the same before and after building
+    ImFontAtlasBuildRegisterDefaultCustomRects(&rFontAtlas);
+
+    std::snprintf(Text, sizeof(Text), "IMGUI %s|glyph %u|width %d|padding %d|sdf %d", IMGUI_VERSION, static_cast<unsigned>(sizeof(ImFont::Glyph)), rFontAtlas.TexDesiredWidth, rFontAtlas.TexGlyphPadding, rFontAtlas.TexGlyphSDFSpread);
+    mKey = Text;
+
+    for(ImFontAtlas::CustomRect const &rRect : rFontAtlas.CustomRects) {
+        std::snprintf(Text, sizeof(Text), "|rect %08x:%ux%u", rRect.ID, static_cast<unsigned>(rRect.Width), static_cast<unsigned>(rRect.Height));
+        mKey += Text;
+    }
+
+    for(int i = 0; i < rFontAtlas.ConfigData.Size; i++) {
+        ImFontConfig const &rConfig = rFontAtlas.ConfigData[i];
+        ImWchar const *const pGlyphRanges = getGlyphRanges(rFontAtlas, rConfig);
+        int const GlyphRangesSize = getGlyphRangesSize(pGlyphRanges);
+
+        // the released TTF data is not loaded again only to compute the key
+        ImU32 const FontDataHash = ((rConfig.FontData == nullptr) && pFontDataStore && pFontDataStore->isReleased(i)) ? pFontDataStore->getHash(i) : ImHash(rConfig.FontData, rConfig.FontDataSize);
+
+        std::snprintf(Text, sizeof(Text), "\n%08x:%d|%d|%a|%dx%d|%d|%a,%a|%a,%a|%08x:%d|%d",
+                      FontDataHash, rConfig.FontDataSize, rConfig.FontNo, rConfig.SizePixels,
+                      rConfig.OversampleH, rConfig.OversampleV, rConfig.PixelSnapH ? 1 : 0,
+                      rConfig.GlyphExtraSpacing.x, rConfig.GlyphExtraSpacing.y, rConfig.GlyphOffset.x, rConfig.GlyphOffset.y,
+                      GlyphRangesSize ? ImHash(pGlyphRanges, GlyphRangesSize) : 0, GlyphRangesSize, rConfig.MergeMode ? 1 : 0);
+        mKey += Text;
+    }
+
+    std::snprintf(Text, sizeof(Text), "IrrIMGUIFonts_%08x%08x.bin", ImHash(mKey.data(), static_cast<int>(mKey.size())), static_cast<unsigned>(mKey.size()));
+
+    mFileName = pDirectory;
+    if(!mFileName.empty() && (mFileName.back() != '/') && (mFileName.back() != '\\')) {
+        mFileName += '/';
+    }
+    mFileName += Text;
+
+    return;
+}
+
+CFontAtlasCache::~CFontAtlasCache(void) {
+    return;
+}
+
+bool CFontAtlasCache::load(ImFontAtlas &rFontAtlas) const {
+    using FileHelper::readValue;
+    using FontCacheHelper::SConfigGlyphs;
+    using FontCacheHelper::SRectPosition;
+
+    std::ifstream File(mFileName.c_str(), std::ios::in | std::ios::binary);
+    if(!File.is_open()) {
+        return false;
+    }
+
+    char     Magic[4]        = {0};
+    uint32_t Version         = 0;
+    uint32_t KeySize         = 0;
+    uint32_t Width           = 0;
+    uint32_t Height          = 0;
+    uint32_t NumberOfRects   = 0;
+    uint32_t NumberOfConfigs = 0;
+
+    File.read(Magic, sizeof(Magic));
+    readValue(File, Version);
+    readValue(File, KeySize);
+
+    if(!File || (std::memcmp(Magic, FontCacheHelper::Magic, sizeof(Magic)) != 0) || (Version != FontCacheHelper::Version) || (KeySize != mKey.size())) {
+        LOG_WARNING("{IrrIMGUI} The font cache file \"" << mFileName << "\" does not fit to the fonts, it is replaced.\n");
+        return false;
+    }
+
+    std::string Key(KeySize, '\0');
+    File.read(&Key[0], KeySize);
+    readValue(File, Width);
+    readValue(File, Height);
+    readValue(File, NumberOfRects);
+
+    if(!File || (Key != mKey) || (NumberOfRects != static_cast<uint32_t>(rFontAtlas.CustomRects.Size)) ||
+       (Width == 0) || (Width > FontCacheHelper::MaxAtlasSize) || (Height == 0) || (Height > FontCacheHelper::MaxAtlasSize)) {
+        LOG_WARNING("{IrrIMGUI} The font cache file \"" << mFileName << "\" does not fit to the fonts, it is replaced.\n");
+        return false;
+    }
+
+    std::vector<SRectPosition> Rects(NumberOfRects);
+    File.read(reinterpret_cast<char *>(Rects.data()), Rects.size() * sizeof(SRectPosition));
+    readValue(File, NumberOfConfigs);
+
+    bool AreRectsInside = true;
+    for(SRectPosition const &rRect : Rects) {
+        AreRectsInside = AreRectsInside && (rRect.mX < Width) && (rRect.mY < Height);
+    }
+
+    if(!File || !AreRectsInside || (NumberOfConfigs != static_cast<uint32_t>(rFontAtlas.ConfigData.Size))) {
+        LOG_WARNING("{IrrIMGUI} The font cache file \"" << mFileName << "\" is damaged, it is replaced.\n");
+        return false;
+    }
+
+    // the file is read completely before the atlas is changed, thus a damaged file does not destroy the fonts
+    std::vector<SConfigGlyphs> Configs(NumberOfConfigs);
+    for(SConfigGlyphs &rConfig : Configs) {
+        if(!readValue(File, rConfig.mMetrics) || (rConfig.mMetrics.mNumberOfGlyphs < 0) || (rConfig.mMetrics.mNumberOfGlyphs > 0x10000)) {
+            LOG_WARNING("{IrrIMGUI} The font cache file \"" << mFileName << "\" is damaged, it is replaced.\n");
+            return false;
+        }
+
+        rConfig.mGlyphs.resize(rConfig.mMetrics.mNumberOfGlyphs);
+        File.read(reinterpret_cast<char *>(rConfig.mGlyphs.data()), rConfig.mGlyphs.size() * sizeof(ImFont::Glyph));
+    }
+
+    File.seekg(FontCacheHelper::getPadding(static_cast<uint64_t>(File.tellg())), std::ios::cur);
+
+    size_t const PixelSize = static_cast<size_t>(Width) * Height;
+    unsigned char *const pPixels = static_cast<unsigned char *>(ImGui::MemAlloc(PixelSize));
+    File.read(reinterpret_cast<char *>(pPixels), PixelSize);
+
+    if(!File) {
+        ImGui::MemFree(pPixels);
+        LOG_WARNING("{IrrIMGUI} The font cache file \"" << mFileName << "\" is incomplete, it is replaced.\n");
+        return false;
+    }
+
+    // set the atlas into the state after ImFontAtlas::Build()
+    ImFontAtlasBuildRegisterDefaultCustomRects(&rFontAtlas);
+    rFontAtlas.ClearTexData();
+    rFontAtlas.TexID           = nullptr;
+    rFontAtlas.TexWidth        = static_cast<int>(Width);
+    rFontAtlas.TexHeight       = static_cast<int>(Height);
+    rFontAtlas.TexPixelsAlpha8 = pPixels;
+
+    for(int i = 0; i < rFontAtlas.CustomRects.Size; i++) {
+        rFontAtlas.CustomRects[i].X = Rects[i].mX;
+        rFontAtlas.CustomRects[i].Y = Rects[i].mY;
+    }
+
+    for(int i = 0; i < rFontAtlas.ConfigData.Size; i++) {
+        ImFontConfig &rConfig = rFontAtlas.ConfigData[i];
+        SConfigGlyphs &rStoredConfig = Configs[i];
+
+        if(!rConfig.GlyphRanges) {
+            rConfig.GlyphRanges = rFontAtlas.GetGlyphRangesDefault();
+        }
+
+        ImFontAtlasBuildSetupFont(&rFontAtlas, rConfig.DstFont, &rConfig, rStoredConfig.mMetrics.mAscent, rStoredConfig.mMetrics.mDescent);
+
+        if(!rConfig.MergeMode) {
+            rConfig.DstFont->Glyphs.resize(static_cast<int>(rStoredConfig.mGlyphs.size()));
+            std::memcpy(rConfig.DstFont->Glyphs.Data, rStoredConfig.mGlyphs.data(), rStoredConfig.mGlyphs.size() * sizeof(ImFont::Glyph));
+            rConfig.DstFont->MetricsTotalSurface = rStoredConfig.mMetrics.mMetricsTotalSurface;
+        }
+    }
+
+    for(ImFontConfig const &rConfig : rFontAtlas.ConfigData) {
+        if(!rConfig.MergeMode) {
+            rConfig.DstFont->FallbackGlyph = nullptr;
+            rConfig.DstFont->BuildLookupTable();
+        }
+    }
+
+    // renders the mouse cursors again and sets their texture coordinates inside the current IMGUI context
+    ImFontAtlasBuildRenderDefaultTexData(&rFontAtlas);
+
+    return true;
+}
+
+bool CFontAtlasCache::store(ImFontAtlas const &rFontAtlas) const {
+    using FileHelper::writeValue;
+    using FontCacheHelper::SConfigMetrics;
+
+    if((rFontAtlas.TexPixelsAlpha8 == nullptr) || rFontAtlas.CustomRects.empty()) {
+        return false;
+    }
+
+    for(ImFontAtlas::CustomRect const &rRect : rFontAtlas.CustomRects) {
+        if(!rRect.IsPacked()) {
+            return false;
+        }
+    }
+
+    // other processes never read an incomplete file
+    CAtomicFileWriter Writer(mFileName);
+    if(!Writer.isOpen()) {
+        LOG_WARNING("{IrrIMGUI} Cannot write the font cache file \"" << mFileName << "\".\n");
+        return false;
+    }
+
+    std::ofstream &rFile = Writer.getStream();
+
+    rFile.write(FontCacheHelper::Magic, sizeof(FontCacheHelper::Magic));
+    writeValue(rFile, FontCacheHelper::Version);
+    writeValue(rFile, static_cast<uint32_t>(mKey.size()));
+    rFile.write(mKey.data(), mKey.size());
+    writeValue(rFile, static_cast<uint32_t>(rFontAtlas.TexWidth));
+    writeValue(rFile, static_cast<uint32_t>(rFontAtlas.TexHeight));
+    writeValue(rFile, static_cast<uint32_t>(rFontAtlas.CustomRects.Size));
+    for(ImFontAtlas::CustomRect const &rRect : rFontAtlas.CustomRects) {
+        writeValue(rFile, static_cast<uint16_t>(rRect.X));
+        writeValue(rFile, static_cast<uint16_t>(rRect.Y));
+    }
+    writeValue(rFile, static_cast<uint32_t>(rFontAtlas.ConfigData.Size));
+
+    for(ImFontConfig const &rConfig : rFontAtlas.ConfigData) {
+        ImFont const *const pFont = rConfig.DstFont;
+
+        // the glyphs of merged configs are part of the glyph table of the first config of the font
+        SConfigMetrics Metrics;
+        Metrics.mAscent              = pFont->Ascent;
+        Metrics.mDescent             = pFont->Descent;
+        Metrics.mMetricsTotalSurface = pFont->MetricsTotalSurface;
+        Metrics.mNumberOfGlyphs      = rConfig.MergeMode ? 0 : pFont->Glyphs.Size;
+
+        writeValue(rFile, Metrics);
+        rFile.write(reinterpret_cast<char const *>(pFont->Glyphs.Data), Metrics.mNumberOfGlyphs * sizeof(ImFont::Glyph));
+    }
+
+    uint32_t const Padding = FontCacheHelper::getPadding(static_cast<uint64_t>(rFile.tellp()));
+    char const Zeros[FontCacheHelper::PixelAlignment] = {0};
+    rFile.write(Zeros, Padding);
+    rFile.write(reinterpret_cast<char const *>(rFontAtlas.TexPixelsAlpha8), static_cast<size_t>(rFontAtlas.TexWidth) * rFontAtlas.TexHeight);
+
+    if(!Writer.commit()) {
+        LOG_WARNING("{IrrIMGUI} Cannot write the font cache file \"" << mFileName << "\".\n");
+        return false;
+    }
+
+    return true;
+}
+
+}
+}
+
+/**
+ * @}
+ */
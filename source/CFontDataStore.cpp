@@ -0,0 +1,167 @@
+/**
+ * @file   CFontDataStore.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a store, that releases the TTF data of cached fonts and loads it again on demand.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <algorithm>
+
+// module includes
+#include "private/CFontDataStore.h"
+#include <IMGUI/imgui_internal.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+CFontDataStore::CFontDataStore(void) {
+    return;
+}
+
+CFontDataStore::~CFontDataStore(void) {
+    return;
+}
+
+CFontDataStore::SSource &CFontDataStore::addSource(ImFontAtlas const &rFontAtlas, ESourceType const Type) {
+    FASSERT(rFontAtlas.ConfigData.Size > 0);
+
+    // font configs added without source are filled up with empty sources
+    SSource EmptySource;
+    EmptySource.mType         = EST_NONE;
+    EmptySource.mpData        = nullptr;
+    EmptySource.mSize         = 0;
+    EmptySource.mIsReleased   = false;
+    EmptySource.mReleasedSize = 0;
+    EmptySource.mHash         = 0;
+    mSources.resize(rFontAtlas.ConfigData.Size, EmptySource);
+
+    SSource &rSource = mSources.back();
+    rSource = EmptySource;
+    rSource.mType = Type;
+    return rSource;
+}
+
+void CFontDataStore::addFileSource(ImFontAtlas const &rFontAtlas, char const *const pFileName) {
+    addSource(rFontAtlas, EST_FILE).mFileName = pFileName;
+    return;
+}
+
+void CFontDataStore::addCompressedSource(ImFontAtlas const &rFontAtlas, void const *const pCompressedTTFData, int const CompressedTTFSize) {
+    SSource &rSource = addSource(rFontAtlas, EST_COMPRESSED);
+    rSource.mpData = pCompressedTTFData;
+    rSource.mSize  = CompressedTTFSize;
+    return;
+}
+
+void CFontDataStore::addBase85Source(ImFontAtlas const &rFontAtlas, char const *const pCompressedTTFDataBase85) {
+    addSource(rFontAtlas, EST_BASE85).mpData = pCompressedTTFDataBase85;
+    return;
+}
+
+void CFontDataStore::clear(void) {
+    mSources.clear();
+    return;
+}
+
+unsigned int CFontDataStore::release(ImFontAtlas &rFontAtlas) {
+    unsigned int ReleasedBytes = 0;
+    int const NumberOfSources = std::min(static_cast<int>(mSources.size()), rFontAtlas.ConfigData.Size);
+
+    for(int i = 0; i < NumberOfSources; i++) {
+        SSource &rSource = mSources[i];
+        ImFontConfig &rConfig = rFontAtlas.ConfigData[i];
+
+        if((rSource.mType == EST_NONE) || rSource.mIsReleased || (rConfig.FontData == nullptr) || !rConfig.FontDataOwnedByAtlas) {
+            continue;
+        }
+
+        // the size stays in the config, since it is part of the key of the font atlas cache
+        rSource.mIsReleased   = true;
+        rSource.mReleasedSize = rConfig.FontDataSize;
+        rSource.mHash         = ImHash(rConfig.FontData, rConfig.FontDataSize);
+        ImGui::MemFree(rConfig.FontData);
+        rConfig.FontData = nullptr;
+
+        ReleasedBytes += static_cast<unsigned int>(rSource.mReleasedSize);
+    }
+
+    return ReleasedBytes;
+}
+
+bool CFontDataStore::materialize(ImFontAtlas &rFontAtlas) {
+    bool IsLoaded = true;
+    int const NumberOfSources = std::min(static_cast<int>(mSources.size()), rFontAtlas.ConfigData.Size);
+
+    for(int i = 0; i < NumberOfSources; i++) {
+        SSource &rSource = mSources[i];
+        if(!rSource.mIsReleased) {
+            continue;
+        }
+
+        int Size = 0;
+        void *const pData = loadData(rSource, Size);
+        if(pData == nullptr) {
+            LOG_ERROR("{IrrIMGUI} Could not load the released TTF data of font \"" << rFontAtlas.ConfigData[i].Name << "\" again.\n");
+            IsLoaded = false;
+            continue;
+        }
+
+        ImFontConfig &rConfig = rFontAtlas.ConfigData[i];
+        rConfig.FontData     = pData;
+        rConfig.FontDataSize = Size;
+        rSource.mIsReleased  = false;
+    }
+
+    return IsLoaded;
+}
+
+void *CFontDataStore::loadData(SSource const &rSource, int &rSize) {
+    switch(rSource.mType) {
+        case EST_FILE:
+            return ImFileLoadToMemory(rSource.mFileName.c_str(), "rb", &rSize, 0);
+
+        case EST_COMPRESSED:
+            return ImFontAtlasBuildDecompressTTF(rSource.mpData, rSource.mSize, &rSize);
+
+        case EST_BASE85:
+            return ImFontAtlasBuildDecompressBase85TTF(static_cast<char const *>(rSource.mpData), &rSize);
+
+        default:
+            return nullptr;
+    }
+}
+
+bool CFontDataStore::isReleased(int const ConfigIndex) const {
+    return (ConfigIndex >= 0) && (ConfigIndex < static_cast<int>(mSources.size())) && mSources[ConfigIndex].mIsReleased;
+}
+
+ImU32 CFontDataStore::getHash(int const ConfigIndex) const {
+    FASSERT(isReleased(ConfigIndex));
+    return mSources[ConfigIndex].mHash;
+}
+
+unsigned int CFontDataStore::getReleasedBytes(void) const {
+    unsigned int ReleasedBytes = 0;
+
+    for(SSource const &rSource : mSources) {
+        if(rSource.mIsReleased) {
+            ReleasedBytes += static_cast<unsigned int>(rSource.mReleasedSize);
+        }
+    }
+
+    return ReleasedBytes;
+}
+
+}
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,367 @@
+/**
+ * @file   CFrameAllocator.cpp
+ * @author Andre Netzeband
+ * @brief  Contains an allocator with size-class pools and a linear arena for the allocations of a GUI frame.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <mutex>
+
+// module includes
+#include "private/CFrameAllocator.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions and the global chunk registry of the frame allocators.
+namespace FrameAllocatorHelper {
+/// @brief Maps the start address of every chunk to the chunk.
+typedef std::map<char const *, void *, std::less<char const *> > TChunkMap;
+
+/// @return Returns the registry of all chunks.
+static TChunkMap &getChunks(void) {
+    static TChunkMap Chunks;
+    return Chunks;
+}
+
+/// @return Returns the mutex, that protects the registry.
+static std::mutex &getMutex(void) {
+    static std::mutex Mutex;
+    return Mutex;
+}
+
+/// @brief The number of registered chunks, used to skip the lookup when no frame allocator is used.
+static std::atomic<unsigned int> NumberOfChunks(0);
+
+/// @brief The size of a memory page of the page filter.
+static size_t const PageSize = 4096;
+
+/// @brief The number of counters of the page filter.
+static size_t const PageFilterSize = 4096;
+
+/// @brief Counts the chunks, that cover the memory pages of a hash bucket. When the counter of a page is 0, no block of the page
+///        belongs to a frame allocator, thus ordinary blocks are freed without locking the registry.
+static std::atomic<unsigned int> PageFilter[PageFilterSize];
+
+/// @return Returns the number of the memory page of an address.
+static std::uintptr_t getPage(char const *const pAddress) {
+    return reinterpret_cast<std::uintptr_t>(pAddress) / PageSize;
+}
+
+/// @return Returns the index of the page filter counter of a memory page.
+static size_t getPageFilterIndex(std::uintptr_t const Page) {
+    return static_cast<size_t>((Page ^ (Page / PageFilterSize)) % PageFilterSize);
+}
+
+/// @brief Adds a chunk to the page filter or removes it.
+static void updatePageFilter(char const *const pMemory, size_t const Size, bool const IsAdded) {
+    std::uintptr_t const LastPage = getPage(pMemory + Size - 1);
+    for(std::uintptr_t Page = getPage(pMemory); Page <= LastPage; Page++) {
+        if(IsAdded) {
+            PageFilter[getPageFilterIndex(Page)]++;
+        } else {
+            PageFilter[getPageFilterIndex(Page)]--;
+        }
+    }
+    return;
+}
+
+/// @brief Compares a block address with the start address of a chunk.
+template <typename TChunk>
+static bool isBeforeChunk(char const *const pBlock, TChunk const *const pChunk) {
+    return pBlock < pChunk->mpMemory;
+}
+
+/// @brief Rounds a size up to a multiple of 16 bytes, thus all blocks are aligned like blocks of malloc.
+static size_t alignSize(size_t const Size) {
+    return (Size + 15) & ~static_cast<size_t>(15);
+}
+}
+
+CFrameAllocator::CFrameAllocator(void):
+    mpArenaChunk(nullptr),
+    mReservedBytes(0),
+    mBlocks(0),
+    mpRemoteFreeBlocks(nullptr) {
+    for(unsigned int i = 0; i < NumberOfSizeClasses; i++) {
+        mpFreeLists[i] = nullptr;
+    }
+
+    return;
+}
+
+CFrameAllocator::~CFrameAllocator(void) {
+    releaseRemoteBlocks();
+
+    if(mBlocks != 0) {
+        LOG_ERROR("{IrrIMGUI} There are " << mBlocks << " blocks of the frame allocator that have not been deallocated so far!\n");
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(FrameAllocatorHelper::getMutex());
+        for(SChunk *const pChunk : mChunks) {
+            FrameAllocatorHelper::getChunks().erase(pChunk->mpMemory);
+            FrameAllocatorHelper::updatePageFilter(pChunk->mpMemory, pChunk->mSize, false);
+            FrameAllocatorHelper::NumberOfChunks--;
+        }
+    }
+
+    for(SChunk *const pChunk : mChunks) {
+        free(pChunk->mpMemory);
+        delete pChunk;
+    }
+    mChunks.clear();
+
+    return;
+}
+
+void *CFrameAllocator::allocate(size_t const Size, size_t &rBlockSize, bool &rIsSystemAllocation) {
+    rIsSystemAllocation = false;
+
+    size_t BlockSize = SmallestBlockSize;
+    for(unsigned int SizeClass = 0; SizeClass < NumberOfSizeClasses; SizeClass++) {
+        if(Size <= BlockSize) {
+            void *const pMemory = allocateFromPool(SizeClass, rIsSystemAllocation);
+            rBlockSize = BlockSize;
+            return pMemory;
+        }
+        BlockSize *= 2;
+    }
+
+    if(Size > MaxArenaBlockSize) {
+        return nullptr;
+    }
+
+    rBlockSize = FrameAllocatorHelper::alignSize(Size);
+    return allocateFromArena(rBlockSize, rIsSystemAllocation);
+}
+
+bool CFrameAllocator::deallocate(void *const pMemory, size_t &rBlockSize) {
+    char *const pBlock = static_cast<char *>(pMemory);
+
+    SChunk *const pChunk = findChunk(pBlock);
+    if(pChunk == nullptr) {
+        return false;
+    }
+
+    rBlockSize = getBlockSize(pChunk, pBlock);
+    releaseBlock(pChunk, pBlock);
+    return true;
+}
+
+bool CFrameAllocator::deallocateForeignBlock(void *const pMemory, size_t &rBlockSize) {
+    using namespace FrameAllocatorHelper;
+
+    char *const pBlock = static_cast<char *>(pMemory);
+    if((NumberOfChunks == 0) || (PageFilter[getPageFilterIndex(getPage(pBlock))] == 0)) {
+        return false;
+    }
+
+    SChunk *pChunk = nullptr;
+
+    {
+        std::lock_guard<std::mutex> Lock(getMutex());
+        TChunkMap const &rChunks = getChunks();
+
+        // the chunk with the highest start address below the block
+        TChunkMap::const_iterator Iterator = rChunks.upper_bound(pBlock);
+        if(Iterator == rChunks.begin()) {
+            return false;
+        }
+        --Iterator;
+
+        pChunk = static_cast<SChunk *>(Iterator->second);
+        if(pBlock >= (pChunk->mpMemory + pChunk->mSize)) {
+            return false;
+        }
+    }
+
+    // the size and the owner of a chunk do not change, but the free lists and the arena belong to the thread of the owner
+    rBlockSize = getBlockSize(pChunk, pBlock);
+
+    CFrameAllocator *const pOwner = pChunk->mpOwner;
+    SFreeBlock *const pFreeBlock = reinterpret_cast<SFreeBlock *>(pBlock);
+    pFreeBlock->mpNext = pOwner->mpRemoteFreeBlocks.load();
+    while(!pOwner->mpRemoteFreeBlocks.compare_exchange_weak(pFreeBlock->mpNext, pFreeBlock)) {
+    }
+
+    return true;
+}
+
+void CFrameAllocator::releaseRemoteBlocks(void) {
+    SFreeBlock *pFreeBlock = mpRemoteFreeBlocks.exchange(nullptr);
+
+    while(pFreeBlock) {
+        SFreeBlock *const pNext = pFreeBlock->mpNext;
+        char *const pBlock = reinterpret_cast<char *>(pFreeBlock);
+        releaseBlock(findChunk(pBlock), pBlock);
+        pFreeBlock = pNext;
+    }
+
+    return;
+}
+
+CFrameAllocator::SChunk *CFrameAllocator::findChunk(char const *const pBlock) const {
+    // the chunks are sorted by their address, search the chunk with the highest start address below the block
+    std::vector<SChunk *>::const_iterator Iterator = std::upper_bound(mChunks.begin(), mChunks.end(), pBlock, FrameAllocatorHelper::isBeforeChunk<SChunk>);
+    if(Iterator == mChunks.begin()) {
+        return nullptr;
+    }
+    --Iterator;
+
+    SChunk *const pChunk = *Iterator;
+    if(pBlock >= (pChunk->mpMemory + pChunk->mSize)) {
+        return nullptr;
+    }
+
+    return pChunk;
+}
+
+size_t CFrameAllocator::getBlockSize(SChunk const *const pChunk, char const *const pBlock) {
+    if(pChunk->mSizeClass >= 0) {
+        return SmallestBlockSize << pChunk->mSizeClass;
+    }
+
+    return *reinterpret_cast<size_t const *>(pBlock - ArenaHeaderSize);
+}
+
+void CFrameAllocator::releaseBlock(SChunk *const pChunk, char *const pBlock) {
+    FASSERT(pChunk && (pChunk->mpOwner == this));
+
+    if(pChunk->mSizeClass >= 0) {
+        SFreeBlock *const pFreeBlock = reinterpret_cast<SFreeBlock *>(pBlock);
+        pFreeBlock->mpNext = mpFreeLists[pChunk->mSizeClass];
+        mpFreeLists[pChunk->mSizeClass] = pFreeBlock;
+
+    } else {
+        size_t const BlockSize = getBlockSize(pChunk, pBlock);
+
+        // the whole chunk can be reused, when its last block has been freed
+        pChunk->mBlocks--;
+        if(pChunk->mBlocks == 0) {
+            pChunk->mOffset = 0;
+        } else if((pBlock + BlockSize) == (pChunk->mpMemory + pChunk->mOffset)) {
+            // the newest block of a chunk is given back directly, like temporary vectors in widget code
+            pChunk->mOffset -= ArenaHeaderSize + BlockSize;
+        }
+    }
+
+    mBlocks--;
+    return;
+}
+
+bool CFrameAllocator::isUsed(void) {
+    return FrameAllocatorHelper::NumberOfChunks != 0;
+}
+
+size_t CFrameAllocator::getReservedBytes(void) const {
+    return mReservedBytes;
+}
+
+unsigned int CFrameAllocator::getNumberOfBlocks(void) const {
+    return mBlocks;
+}
+
+void *CFrameAllocator::allocateFromPool(unsigned int const SizeClass, bool &rIsSystemAllocation) {
+    size_t const BlockSize = SmallestBlockSize << SizeClass;
+
+    if(mpFreeLists[SizeClass] == nullptr) {
+        SChunk *const pSlab = createChunk(SlabSize, static_cast<int>(SizeClass));
+        if(pSlab == nullptr) {
+            return nullptr;
+        }
+        rIsSystemAllocation = true;
+
+        // put all blocks of the new slab into the free list, the first block is used first
+        for(size_t Offset = SlabSize; Offset >= BlockSize; Offset -= BlockSize) {
+            SFreeBlock *const pFreeBlock = reinterpret_cast<SFreeBlock *>(pSlab->mpMemory + Offset - BlockSize);
+            pFreeBlock->mpNext = mpFreeLists[SizeClass];
+            mpFreeLists[SizeClass] = pFreeBlock;
+        }
+    }
+
+    SFreeBlock *const pBlock = mpFreeLists[SizeClass];
+    mpFreeLists[SizeClass] = pBlock->mpNext;
+
+    mBlocks++;
+    return pBlock;
+}
+
+void *CFrameAllocator::allocateFromArena(size_t const Size, bool &rIsSystemAllocation) {
+    size_t const Needed = ArenaHeaderSize + Size;
+
+    if((mpArenaChunk == nullptr) || ((mpArenaChunk->mOffset + Needed) > mpArenaChunk->mSize)) {
+        mpArenaChunk = nullptr;
+
+        // reuse a chunk, whose blocks have all been freed
+        for(SChunk *const pChunk : mChunks) {
+            if((pChunk->mSizeClass < 0) && (pChunk->mBlocks == 0) && (pChunk->mSize >= Needed)) {
+                pChunk->mOffset = 0;
+                mpArenaChunk = pChunk;
+                break;
+            }
+        }
+
+        if(mpArenaChunk == nullptr) {
+            mpArenaChunk = createChunk((Needed > ArenaChunkSize) ? Needed : ArenaChunkSize, -1);
+            if(mpArenaChunk == nullptr) {
+                return nullptr;
+            }
+            rIsSystemAllocation = true;
+        }
+    }
+
+    char *const pHeader = mpArenaChunk->mpMemory + mpArenaChunk->mOffset;
+    *reinterpret_cast<size_t *>(pHeader) = Size;
+
+    mpArenaChunk->mOffset += Needed;
+    mpArenaChunk->mBlocks++;
+    mBlocks++;
+
+    return pHeader + ArenaHeaderSize;
+}
+
+CFrameAllocator::SChunk *CFrameAllocator::createChunk(size_t const Size, int const SizeClass) {
+    char *const pMemory = static_cast<char *>(malloc(Size));
+    if(pMemory == nullptr) {
+        return nullptr;
+    }
+
+    SChunk *const pChunk = new SChunk;
+    pChunk->mpMemory   = pMemory;
+    pChunk->mSize      = Size;
+    pChunk->mpOwner    = this;
+    pChunk->mSizeClass = SizeClass;
+    pChunk->mBlocks    = 0;
+    pChunk->mOffset    = 0;
+
+    mChunks.insert(std::upper_bound(mChunks.begin(), mChunks.end(), pMemory, FrameAllocatorHelper::isBeforeChunk<SChunk>), pChunk);
+    mReservedBytes += Size;
+
+    std::lock_guard<std::mutex> Lock(FrameAllocatorHelper::getMutex());
+    FrameAllocatorHelper::getChunks()[pMemory] = pChunk;
+    FrameAllocatorHelper::updatePageFilter(pMemory, Size, true);
+    FrameAllocatorHelper::NumberOfChunks++;
+
+    return pChunk;
+}
+
+}
+}
+
+/**
+ * @}
+ */
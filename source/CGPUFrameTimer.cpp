@@ -0,0 +1,132 @@
+/**
+ * @file   CGPUFrameTimer.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a timer that measures the GPU time of the GUI render pass with OpenGL timer queries.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <GL/gl3w.h>
+
+// module includes
+#include "private/CGPUFrameTimer.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+CGPUFrameTimer::CGPUFrameTimer(void):
+    mFirstPendingQuery(0),
+    mPendingQueries(0),
+    mIsCreated(false),
+    mIsRunning(false) {
+    for(unsigned int i = 0; i < NumberOfQueries; i++) {
+        mQueries[i]      = 0;
+        mFrameNumbers[i] = 0;
+    }
+
+    return;
+}
+
+CGPUFrameTimer::~CGPUFrameTimer(void) {
+    if(mIsCreated) {
+        LOG_WARNING("{IrrIMGUI} The GPU timer queries have not been released before the timer is destroyed.\n");
+    }
+
+    return;
+}
+
+void CGPUFrameTimer::release(void) {
+    FASSERT(!mIsRunning);
+
+    if(mIsCreated) {
+        glDeleteQueries(NumberOfQueries, mQueries);
+        mIsCreated = false;
+    }
+
+    for(unsigned int i = 0; i < NumberOfQueries; i++) {
+        mQueries[i] = 0;
+    }
+    mFirstPendingQuery = 0;
+    mPendingQueries    = 0;
+
+    return;
+}
+
+bool CGPUFrameTimer::begin(int const FrameNumber) {
+    FASSERT(!mIsRunning);
+
+    if(!mIsCreated) {
+        glGenQueries(NumberOfQueries, mQueries);
+        mIsCreated = true;
+    }
+
+    if(mPendingQueries == NumberOfQueries) {
+        return false;
+    }
+
+    // a timer query of the application around the GUI render pass would fail with GL_INVALID_OPERATION
+    GLint ActiveQuery = 0;
+    glGetQueryiv(GL_TIME_ELAPSED, GL_CURRENT_QUERY, &ActiveQuery);
+    if(ActiveQuery != 0) {
+        return false;
+    }
+
+    unsigned int const Query = (mFirstPendingQuery + mPendingQueries) % NumberOfQueries;
+    mFrameNumbers[Query] = FrameNumber;
+    glBeginQuery(GL_TIME_ELAPSED, mQueries[Query]);
+
+    mIsRunning = true;
+    return true;
+}
+
+void CGPUFrameTimer::end(void) {
+    FASSERT(mIsRunning);
+
+    glEndQuery(GL_TIME_ELAPSED);
+    mPendingQueries++;
+    mIsRunning = false;
+
+    return;
+}
+
+bool CGPUFrameTimer::getResult(int &rFrameNumber, irr::u64 &rNanoseconds) {
+    if(mPendingQueries == 0) {
+        return false;
+    }
+
+    GLuint const Query = mQueries[mFirstPendingQuery];
+    GLint IsAvailable = 0;
+    glGetQueryObjectiv(Query, GL_QUERY_RESULT_AVAILABLE, &IsAvailable);
+
+    if(!IsAvailable) {
+        return false;
+    }
+
+    GLuint64 Nanoseconds = 0;
+    glGetQueryObjectui64v(Query, GL_QUERY_RESULT, &Nanoseconds);
+
+    rFrameNumber = mFrameNumbers[mFirstPendingQuery];
+    rNanoseconds = static_cast<irr::u64>(Nanoseconds);
+
+    mFirstPendingQuery = (mFirstPendingQuery + 1) % NumberOfQueries;
+    mPendingQueries--;
+
+    return true;
+}
+
+bool CGPUFrameTimer::isSupported(void) {
+    return (glGenQueries != nullptr) && (glGetQueryiv != nullptr) && (glGetQueryObjectui64v != nullptr);
+}
+
+}
+}
+
+/**
+ * @}
+ */
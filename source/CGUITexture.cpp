@@ -7,6 +7,7 @@
 
 // module includes
 #include "private/CGUITexture.h"
+#include "private/CGUITextureTable.h"
 
 namespace IrrIMGUI {
 namespace Private {
@@ -14,8 +15,14 @@ namespace Private {
 CGUITexture::CGUITexture(void):
     mIsUsingOwnMemory(false),
     mSourceType(ETST_UNKNOWN),
-    mIsValid(true),
-    mGPUTextureID(nullptr) {
+    mHandle(nullptr) {
+    return;
+}
+
+CGUITexture::CGUITexture(ImTextureID const Handle):
+    mIsUsingOwnMemory(false),
+    mSourceType(ETST_UNKNOWN),
+    mHandle(Handle) {
     return;
 }
 
@@ -23,5 +30,25 @@ CGUITexture::~CGUITexture(void) {
     return;
 }
 
+ImTextureID CGUITexture::getTextureID(void) {
+    if(mHandle == nullptr) {
+        return IGUITexture::getTextureID();
+    }
+
+    return mHandle;
+}
+
+bool CGUITexture::isValid(void) const {
+    return (mHandle != nullptr) && (CGUITextureTable::getInstance().getGPUTextureID(mHandle) != nullptr);
+}
+
+ImTextureID CGUITexture::getGPUTextureID(void) const {
+    if(mHandle == nullptr) {
+        return nullptr;
+    }
+
+    return CGUITextureTable::getInstance().getGPUTextureID(mHandle);
+}
+
 }
 }
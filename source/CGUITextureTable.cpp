@@ -0,0 +1,132 @@
+/**
+ * @file   CGUITextureTable.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a table of all GUI textures, that resolves the texture IDs of the draw commands.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <new>
+
+// module includes
+#include "private/CGUITextureTable.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+CGUITextureTable &CGUITextureTable::getInstance(void) {
+    static CGUITextureTable Table;
+    return Table;
+}
+
+CGUITextureTable::~CGUITextureTable(void) {
+    for(std::atomic<SBlock *> &rBlock : mpBlocks) {
+        delete rBlock.load(std::memory_order_relaxed);
+    }
+
+    return;
+}
+
+CGUITexture *CGUITextureTable::createTexture(void) {
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    unsigned int Index = 0;
+
+    if(mFirstFreeIndex != 0) {
+        Index           = mFirstFreeIndex - 1;
+        mFirstFreeIndex = getEntryAt(Index).mNextFreeIndex;
+    } else if(mUsedEntries < MaxTextures) {
+        Index = mUsedEntries;
+
+        if((Index % BlockSize) == 0) {
+            SBlock *const pBlock = new(std::nothrow) SBlock();
+            if(pBlock == nullptr) {
+                LOG_ERROR("{IrrIMGUI} Cannot allocate memory for more GUI textures!\n");
+                return nullptr;
+            }
+
+            mpBlocks[Index / BlockSize].store(pBlock, std::memory_order_release);
+        }
+
+        mUsedEntries++;
+    } else {
+        LOG_ERROR("{IrrIMGUI} Cannot create more than " << MaxTextures << " GUI textures!\n");
+        return nullptr;
+    }
+
+    SEntry &rEntry = getEntryAt(Index);
+
+    rEntry.mGPUTextureID  = nullptr;
+    rEntry.mWidth         = 0;
+    rEntry.mHeight        = 0;
+    rEntry.mColorFormat   = ECF_A8R8G8B8;
+    rEntry.mNextFreeIndex = 0;
+    rEntry.mIsUsed        = true;
+
+    return new(getTextureMemory(Index)) CGUITexture(getHandle(Index, rEntry.mGeneration));
+}
+
+void CGUITextureTable::deleteTexture(CGUITexture *const pTexture) {
+    unsigned int const Index = getIndex(pTexture->getHandle());
+    FASSERT(getTextureMemory(Index) == pTexture);
+
+    pTexture->~CGUITexture();
+
+    std::lock_guard<std::mutex> Lock(mMutex);
+
+    SEntry &rEntry = getEntryAt(Index);
+
+    rEntry.mGPUTextureID = nullptr;
+    rEntry.mIsUsed       = false;
+
+    // all handles, that still point to this entry, are invalid now
+    rEntry.mGeneration++;
+
+    rEntry.mNextFreeIndex = mFirstFreeIndex;
+    mFirstFreeIndex       = Index + 1;
+
+    return;
+}
+
+CGUITexture *CGUITextureTable::getTexture(IGUITexture *const pGUITexture) {
+    if(pGUITexture != nullptr) {
+        ImTextureID const Handle = pGUITexture->getTextureID();
+        unsigned int const Index = getIndex(Handle);
+
+        if(isHandle(Handle) && (Index < MaxTextures) && (getBlock(Index) != nullptr)) {
+            SEntry const &rEntry = getEntryAt(Index);
+            CGUITexture *const pTexture = getTextureMemory(Index);
+
+            if(rEntry.mIsUsed && (getHandle(Index, rEntry.mGeneration) == Handle) && (pTexture == pGUITexture)) {
+                return pTexture;
+            }
+        }
+    }
+
+    LOG_ERROR("{IrrIMGUI} The GUI texture is unknown or has already been deleted!\n");
+    return nullptr;
+}
+
+void CGUITextureTable::setGPUTexture(CGUITexture *const pTexture, ImTextureID const GPUTextureID, unsigned int const Width, unsigned int const Height, EColorFormat const ColorFormat) {
+    SEntry &rEntry = getEntryAt(getIndex(pTexture->getHandle()));
+
+    rEntry.mGPUTextureID = GPUTextureID;
+    rEntry.mWidth        = Width;
+    rEntry.mHeight       = Height;
+    rEntry.mColorFormat  = ColorFormat;
+
+    return;
+}
+
+}
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,185 @@
+/**
+ * @file   CIMGUIBackendRegistry.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a list of all renderers, that chooses the renderer for an Irrlicht device.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstdio>
+#include <cstring>
+#include <GL/gl3w.h>
+
+// module includes
+#include "private/CIMGUIBackendRegistry.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions to check the OpenGL context.
+namespace BackendHelper {
+/// @return Returns true, when the OpenGL 3.3 shader of the binding can be compiled.
+bool isOpenGL3Supported(SBackendCapabilities const &rCapabilities);
+
+/// @return Returns true, when the context has the fixed function pipeline.
+bool isOpenGL2Supported(SBackendCapabilities const &rCapabilities);
+
+/// @return Returns always true, the null renderer does not need a context.
+bool isNullSupported(SBackendCapabilities const &rCapabilities);
+
+/// @param pExtension Is the name of an OpenGL extension.
+/// @return Returns true, when the current context supports the extension. It must be an OpenGL 3.0 context or newer.
+bool hasExtension(char const *pExtension);
+
+/// @param pRenderer Is the renderer string of the OpenGL context.
+/// @return Returns true, when the renderer is a known software rasterizer.
+bool isSoftwareRenderer(char const *pRenderer);
+}
+
+/// @brief All renderers, that are compiled into the library, sorted from the fastest to the slowest one.
+static CIMGUIBackendRegistry::SBackend const Backends[] = {
+    { EIB_OPENGL3, "OpenGL 3 shader",         BackendHelper::isOpenGL3Supported },
+#ifdef _IRRIMGUI_NATIVE_OPENGL_
+    { EIB_OPENGL2, "OpenGL 2 fixed function", BackendHelper::isOpenGL2Supported },
+#endif // _IRRIMGUI_NATIVE_OPENGL_
+    { EIB_NULL,    "Null",                    BackendHelper::isNullSupported }
+};
+
+SBackendCapabilities CIMGUIBackendRegistry::probeCapabilities(irr::IrrlichtDevice *const pDevice) {
+    SBackendCapabilities Capabilities;
+
+    irr::video::E_DRIVER_TYPE const Type = pDevice->getVideoDriver()->getDriverType();
+
+    if(Type == irr::video::EDT_NULL) {
+        Capabilities.mIsHeadless = true;
+        return Capabilities;
+    }
+
+    // the OpenGL functions are only loaded, when the device is an OpenGL device
+    if((Type != irr::video::EDT_OPENGL) || (glGetString == nullptr)) {
+        return Capabilities;
+    }
+
+    char const *const pVersion  = reinterpret_cast<char const *>(glGetString(GL_VERSION));
+    char const *const pRenderer = reinterpret_cast<char const *>(glGetString(GL_RENDERER));
+
+    if((pVersion == nullptr) || (std::sscanf(pVersion, "%d.%d", &Capabilities.mMajorVersion, &Capabilities.mMinorVersion) != 2)) {
+        LOG_ERROR("{IrrIMGUI} Cannot read the version of the OpenGL context!\n");
+        return Capabilities;
+    }
+
+    Capabilities.mHasContext         = true;
+    Capabilities.mIsSoftwareRenderer = BackendHelper::isSoftwareRenderer(pRenderer);
+
+    int const Version = Capabilities.mMajorVersion * 10 + Capabilities.mMinorVersion;
+
+    if(Version >= 32) {
+        GLint ProfileMask = 0;
+        glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &ProfileMask);
+        Capabilities.mHasFixedFunction = (ProfileMask & GL_CONTEXT_COMPATIBILITY_PROFILE_BIT) != 0;
+    } else if(Version == 31) {
+        Capabilities.mHasFixedFunction = BackendHelper::hasExtension("GL_ARB_compatibility");
+    } else {
+        Capabilities.mHasFixedFunction = true;
+    }
+
+    LOG_NOTE("{IrrIMGUI} OpenGL " << pVersion << " (" << (pRenderer ? pRenderer : "unknown renderer") << ")" << (Capabilities.mIsSoftwareRenderer ? " is a software renderer" : "") << ".\n");
+
+    return Capabilities;
+}
+
+CIMGUIBackendRegistry::SBackend const &CIMGUIBackendRegistry::selectBackend(SBackendCapabilities const &rCapabilities, EIMGUIBackend const Requested) {
+    if(Requested != EIB_AUTOMATIC) {
+        SBackend const *const pRequestedBackend = getBackend(Requested);
+
+        if(pRequestedBackend == nullptr) {
+            LOG_WARNING("{IrrIMGUI} The requested renderer " << Requested << " is not compiled into the library, choose another one.\n");
+        } else if(!pRequestedBackend->mpIsSupported(rCapabilities) && !rCapabilities.mIsHeadless) {
+            LOG_WARNING("{IrrIMGUI} The renderer \"" << pRequestedBackend->mpName << "\" is not supported by the OpenGL context, choose another one.\n");
+        } else {
+            // a headless device cannot be checked, the application provides the context for the requested renderer
+            return *pRequestedBackend;
+        }
+    }
+
+    for(SBackend const &rBackend : Backends) {
+        if(rBackend.mpIsSupported(rCapabilities)) {
+            return rBackend;
+        }
+    }
+
+    // the null renderer is always supported
+    FASSERT(false);
+    return Backends[0];
+}
+
+CIMGUIBackendRegistry::SBackend const *CIMGUIBackendRegistry::getBackend(EIMGUIBackend const Backend) {
+    for(SBackend const &rBackend : Backends) {
+        if(rBackend.mBackend == Backend) {
+            return &rBackend;
+        }
+    }
+
+    return nullptr;
+}
+
+namespace BackendHelper {
+bool isOpenGL3Supported(SBackendCapabilities const &rCapabilities) {
+    return rCapabilities.mHasContext && ((rCapabilities.mMajorVersion * 10 + rCapabilities.mMinorVersion) >= 33);
+}
+
+bool isOpenGL2Supported(SBackendCapabilities const &rCapabilities) {
+    return rCapabilities.mHasContext && rCapabilities.mHasFixedFunction;
+}
+
+bool isNullSupported(SBackendCapabilities const &) {
+    return true;
+}
+
+bool hasExtension(char const *const pExtension) {
+    if(glGetStringi == nullptr) {
+        return false;
+    }
+
+    GLint NumberOfExtensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &NumberOfExtensions);
+
+    for(GLint i = 0; i < NumberOfExtensions; i++) {
+        char const *const pName = reinterpret_cast<char const *>(glGetStringi(GL_EXTENSIONS, i));
+        if(pName && (std::strcmp(pName, pExtension) == 0)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool isSoftwareRenderer(char const *const pRenderer) {
+    static char const *const SoftwareRenderers[] = { "llvmpipe", "softpipe", "Software Rasterizer", "SwiftShader", "GDI Generic" };
+
+    if(pRenderer == nullptr) {
+        return false;
+    }
+
+    for(char const *const pSoftwareRenderer : SoftwareRenderers) {
+        if(std::strstr(pRenderer, pSoftwareRenderer) != nullptr) {
+            return true;
+        }
+    }
+
+    return false;
+}
+}
+
+}
+}
+
+/**
+ * @}
+ */
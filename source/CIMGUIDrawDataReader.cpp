@@ -0,0 +1,290 @@
+/**
+ * @file   CIMGUIDrawDataReader.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a reader, that replays the draw data of captured GUI frames.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <cstring>
+#include <climits>
+
+// module includes
+#include <IrrIMGUI/CIMGUIDrawDataReader.h>
+#include "private/IrrIMGUIDrawData_priv.h"
+#include "private/CAtomicFileWriter.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI {
+
+/// @brief Helper functions to deserialize the draw data.
+namespace DrawDataReaderHelper {
+/// @brief Converts a 64 bit integer into a texture handle.
+static ImTextureID toTexture(uint64_t const Integer) {
+    return reinterpret_cast<ImTextureID>(static_cast<uintptr_t>(Integer));
+}
+}
+
+CIMGUIDrawDataReader::CIMGUIDrawDataReader(void):
+    mNumberOfReadLists(0),
+    mDisplaySize(0.0f, 0.0f),
+    mFontTexture(nullptr),
+    mOtherTexture(nullptr),
+    mNumberOfFrames(0) {
+    return;
+}
+
+CIMGUIDrawDataReader::~CIMGUIDrawDataReader(void) {
+    close();
+    return;
+}
+
+bool CIMGUIDrawDataReader::open(char const *const pFileName) {
+    using Private::FileHelper::readValue;
+
+    close();
+
+    mFile.open(pFileName, std::ios::in | std::ios::binary);
+    if(!mFile.is_open()) {
+        LOG_ERROR("{IrrIMGUI} Cannot open the draw data capture file \"" << pFileName << "\"!\n");
+        return false;
+    }
+
+    char     Magic[4]   = {0};
+    uint32_t Version    = 0;
+    uint32_t VertexSize = 0;
+    uint32_t IndexSize  = 0;
+
+    mFile.read(Magic, sizeof(Magic));
+    readValue(mFile, Version);
+    readValue(mFile, VertexSize);
+    readValue(mFile, IndexSize);
+
+    if(!mFile || (std::memcmp(Magic, Private::DrawData::Magic, sizeof(Magic)) != 0) || (Version != Private::DrawData::Version)) {
+        LOG_ERROR("{IrrIMGUI} The file \"" << pFileName << "\" is not a draw data capture file of a supported version!\n");
+        close();
+        return false;
+    }
+
+    if((VertexSize != sizeof(ImDrawVert)) || (IndexSize != sizeof(ImDrawIdx))) {
+        LOG_ERROR("{IrrIMGUI} The draw data capture file \"" << pFileName << "\" has been captured with another vertex or index layout!\n");
+        close();
+        return false;
+    }
+
+    mFirstFramePosition = mFile.tellg();
+    mFile.seekg(0, std::ios::end);
+    mEndPosition = mFile.tellg();
+    mFile.seekg(mFirstFramePosition);
+    mNumberOfReadLists  = 0;
+    mNumberOfFrames     = 0;
+
+    return true;
+}
+
+void CIMGUIDrawDataReader::close(void) {
+    if(mFile.is_open()) {
+        mFile.close();
+    }
+
+    deleteLists();
+    mDrawData = ImDrawData();
+
+    return;
+}
+
+bool CIMGUIDrawDataReader::isOpen(void) const {
+    return mFile.is_open();
+}
+
+bool CIMGUIDrawDataReader::rewind(void) {
+    if(!mFile.is_open()) {
+        return false;
+    }
+
+    mFile.clear();
+    mFile.seekg(mFirstFramePosition);
+    mNumberOfReadLists = 0;
+    mNumberOfFrames    = 0;
+    mDrawData          = ImDrawData();
+
+    return true;
+}
+
+void CIMGUIDrawDataReader::setTextures(ImTextureID const FontTexture, ImTextureID const OtherTexture) {
+    mFontTexture  = FontTexture;
+    mOtherTexture = OtherTexture ? OtherTexture : FontTexture;
+    return;
+}
+
+ImDrawData *CIMGUIDrawDataReader::readFrame(void) {
+    using Private::FileHelper::readValue;
+
+    if(!mFile.is_open()) {
+        return nullptr;
+    }
+
+    uint32_t Marker = 0;
+    if(!readValue(mFile, Marker)) {
+        // end of the file
+        return nullptr;
+    }
+
+    uint32_t NumberOfLists = 0;
+    uint64_t FontTexture   = 0;
+    float    Width         = 0.0f;
+    float    Height        = 0.0f;
+
+    readValue(mFile, NumberOfLists);
+    readValue(mFile, Width);
+    readValue(mFile, Height);
+    readValue(mFile, FontTexture);
+
+    // every list takes at least one byte for its type
+    if(!mFile || (Marker != Private::DrawData::FrameMarker) || (NumberOfLists > INT_MAX) || (NumberOfLists > getRemainingBytes())) {
+        LOG_ERROR("{IrrIMGUI} The draw data capture file is corrupt!\n");
+        mDrawData = ImDrawData();
+        return nullptr;
+    }
+
+    mDrawData               = ImDrawData();
+    mDrawData.CmdListsCount = static_cast<int>(NumberOfLists);
+
+    for(uint32_t i = 0; i < NumberOfLists; i++) {
+        uint8_t Type = 0;
+        readValue(mFile, Type);
+
+        if(Type == Private::DrawData::ListData) {
+            // lists are only created for data, that is really stored in the file
+            if(i >= mLists.size()) {
+                mLists.push_back(new ImDrawList());
+            }
+
+            if(!readList(mLists[i], DrawDataReaderHelper::toTexture(FontTexture))) {
+                LOG_ERROR("{IrrIMGUI} The draw data capture file is corrupt!\n");
+                mNumberOfReadLists = (i < mNumberOfReadLists) ? i : mNumberOfReadLists;
+                mDrawData = ImDrawData();
+                return nullptr;
+            }
+
+            if(i >= mNumberOfReadLists) {
+                mNumberOfReadLists = i + 1;
+            }
+
+        } else if((Type != Private::DrawData::ListRepeat) || (i >= mNumberOfReadLists)) {
+            LOG_ERROR("{IrrIMGUI} The draw data capture file is corrupt!\n");
+            mDrawData = ImDrawData();
+            return nullptr;
+        }
+
+        mDrawData.TotalVtxCount += mLists[i]->VtxBuffer.Size;
+        mDrawData.TotalIdxCount += mLists[i]->IdxBuffer.Size;
+    }
+
+    mDrawData.Valid    = true;
+    mDrawData.CmdLists = mLists.data();
+    mDisplaySize       = ImVec2(Width, Height);
+    mNumberOfFrames++;
+
+    return &mDrawData;
+}
+
+bool CIMGUIDrawDataReader::readList(ImDrawList *const pList, ImTextureID const CapturedFontTexture) {
+    using Private::FileHelper::readValue;
+
+    uint32_t NumberOfVertices = 0;
+    uint32_t NumberOfIndices  = 0;
+    uint32_t NumberOfCommands = 0;
+
+    readValue(mFile, NumberOfVertices);
+    readValue(mFile, NumberOfIndices);
+    readValue(mFile, NumberOfCommands);
+    if(!mFile) {
+        return false;
+    }
+
+    uint64_t const NumberOfBytes = static_cast<uint64_t>(NumberOfVertices) * sizeof(ImDrawVert)
+                                 + static_cast<uint64_t>(NumberOfIndices)  * sizeof(ImDrawIdx)
+                                 + static_cast<uint64_t>(NumberOfCommands) * Private::DrawData::CommandSize;
+
+    if((NumberOfVertices > INT_MAX) || (NumberOfIndices > INT_MAX) || (NumberOfCommands > INT_MAX) || (NumberOfBytes > getRemainingBytes())) {
+        return false;
+    }
+
+    pList->VtxBuffer.resize(static_cast<int>(NumberOfVertices));
+    pList->IdxBuffer.resize(static_cast<int>(NumberOfIndices));
+    pList->CmdBuffer.resize(static_cast<int>(NumberOfCommands));
+
+    mFile.read(reinterpret_cast<char *>(pList->VtxBuffer.Data), NumberOfVertices * sizeof(ImDrawVert));
+    mFile.read(reinterpret_cast<char *>(pList->IdxBuffer.Data), NumberOfIndices * sizeof(ImDrawIdx));
+
+    for(uint32_t i = 0; i < NumberOfIndices; i++) {
+        if(pList->IdxBuffer[static_cast<int>(i)] >= NumberOfVertices) {
+            return false;
+        }
+    }
+
+    uint64_t NumberOfUsedIndices = 0;
+    for(uint32_t i = 0; i < NumberOfCommands; i++) {
+        ImDrawCmd &rCommand = pList->CmdBuffer[static_cast<int>(i)];
+        uint64_t Texture = 0;
+
+        readValue(mFile, rCommand.ElemCount);
+        readValue(mFile, rCommand.ClipRect.x);
+        readValue(mFile, rCommand.ClipRect.y);
+        readValue(mFile, rCommand.ClipRect.z);
+        readValue(mFile, rCommand.ClipRect.w);
+        readValue(mFile, Texture);
+
+        rCommand.TextureId        = DrawDataReaderHelper::toTexture(Texture);
+        rCommand.UserCallback     = nullptr;
+        rCommand.UserCallbackData = nullptr;
+
+        if(mFontTexture) {
+            rCommand.TextureId = (rCommand.TextureId == CapturedFontTexture) ? mFontTexture : mOtherTexture;
+        }
+
+        NumberOfUsedIndices += rCommand.ElemCount;
+    }
+
+    // the renderers walk through the index buffer command by command
+    return static_cast<bool>(mFile) && (NumberOfUsedIndices <= NumberOfIndices);
+}
+
+ImVec2 CIMGUIDrawDataReader::getDisplaySize(void) const {
+    return mDisplaySize;
+}
+
+unsigned int CIMGUIDrawDataReader::getNumberOfFrames(void) const {
+    return mNumberOfFrames;
+}
+
+irr::u64 CIMGUIDrawDataReader::getRemainingBytes(void) {
+    std::streampos const Position = mFile.tellg();
+    if(!mFile || (Position > mEndPosition)) {
+        return 0;
+    }
+
+    return static_cast<irr::u64>(mEndPosition - Position);
+}
+
+void CIMGUIDrawDataReader::deleteLists(void) {
+    for(ImDrawList *const pList : mLists) {
+        delete pList;
+    }
+    mLists.clear();
+    mNumberOfReadLists = 0;
+
+    return;
+}
+
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,175 @@
+/**
+ * @file   CIMGUIDrawDataWriter.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a writer, that captures the draw data of GUI frames into a file.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <cstring>
+
+// module includes
+#include <IrrIMGUI/CIMGUIDrawDataWriter.h>
+#include "private/IrrIMGUIDrawData_priv.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI {
+
+/// @brief Helper functions to serialize the draw data.
+namespace DrawDataWriterHelper {
+/// @brief Appends the bytes of a memory block to a buffer.
+static void appendBytes(std::vector<char> &rBuffer, void const *const pData, size_t const Size) {
+    char const *const pBytes = static_cast<char const *>(pData);
+    rBuffer.insert(rBuffer.end(), pBytes, pBytes + Size);
+    return;
+}
+
+/// @brief Appends the bytes of a value to a buffer.
+template<typename T>
+static void appendValue(std::vector<char> &rBuffer, T const Value) {
+    appendBytes(rBuffer, &Value, sizeof(T));
+    return;
+}
+
+/// @brief Converts a texture handle into a 64 bit integer.
+static uint64_t toInteger(ImTextureID const Texture) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Texture));
+}
+
+/// @brief Serializes a draw list into a buffer.
+static void serializeList(ImDrawList const *const pList, std::vector<char> &rBuffer) {
+    appendValue<uint32_t>(rBuffer, static_cast<uint32_t>(pList->VtxBuffer.Size));
+    appendValue<uint32_t>(rBuffer, static_cast<uint32_t>(pList->IdxBuffer.Size));
+    appendValue<uint32_t>(rBuffer, static_cast<uint32_t>(pList->CmdBuffer.Size));
+    appendBytes(rBuffer, pList->VtxBuffer.Data, pList->VtxBuffer.Size * sizeof(ImDrawVert));
+    appendBytes(rBuffer, pList->IdxBuffer.Data, pList->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+    for(int i = 0; i < pList->CmdBuffer.Size; i++) {
+        ImDrawCmd const &rCommand = pList->CmdBuffer[i];
+
+        // a user callback cannot be replayed, thus it is stored as empty draw command
+        appendValue<uint32_t>(rBuffer, rCommand.UserCallback ? 0 : rCommand.ElemCount);
+        appendValue<float>(rBuffer, rCommand.ClipRect.x);
+        appendValue<float>(rBuffer, rCommand.ClipRect.y);
+        appendValue<float>(rBuffer, rCommand.ClipRect.z);
+        appendValue<float>(rBuffer, rCommand.ClipRect.w);
+        appendValue<uint64_t>(rBuffer, toInteger(rCommand.TextureId));
+    }
+
+    return;
+}
+}
+
+CIMGUIDrawDataWriter::CIMGUIDrawDataWriter(void):
+    mNumberOfFrames(0),
+    mNumberOfBytes(0) {
+    return;
+}
+
+CIMGUIDrawDataWriter::~CIMGUIDrawDataWriter(void) {
+    close();
+    return;
+}
+
+bool CIMGUIDrawDataWriter::open(char const *const pFileName) {
+    using namespace DrawDataWriterHelper;
+
+    close();
+
+    mFile.open(pFileName, std::ios::out | std::ios::trunc | std::ios::binary);
+    if(!mFile.is_open()) {
+        LOG_ERROR("{IrrIMGUI} Cannot open the draw data capture file \"" << pFileName << "\"!\n");
+        return false;
+    }
+
+    mFrameBuffer.clear();
+    appendBytes(mFrameBuffer, Private::DrawData::Magic, sizeof(Private::DrawData::Magic));
+    appendValue<uint32_t>(mFrameBuffer, Private::DrawData::Version);
+    appendValue<uint32_t>(mFrameBuffer, sizeof(ImDrawVert));
+    appendValue<uint32_t>(mFrameBuffer, sizeof(ImDrawIdx));
+    mFile.write(mFrameBuffer.data(), mFrameBuffer.size());
+
+    mNumberOfFrames = 0;
+    mNumberOfBytes  = mFrameBuffer.size();
+
+    return true;
+}
+
+void CIMGUIDrawDataWriter::close(void) {
+    if(mFile.is_open()) {
+        mFile.close();
+    }
+
+    mPreviousLists.clear();
+    return;
+}
+
+bool CIMGUIDrawDataWriter::isOpen(void) const {
+    return mFile.is_open();
+}
+
+bool CIMGUIDrawDataWriter::writeFrame(ImDrawData const *const pDrawData, ImVec2 const &rDisplaySize, ImTextureID const FontTexture) {
+    using namespace DrawDataWriterHelper;
+
+    if(!mFile.is_open()) {
+        return false;
+    }
+
+    int const NumberOfLists = (pDrawData && pDrawData->Valid) ? pDrawData->CmdListsCount : 0;
+
+    mFrameBuffer.clear();
+    appendValue<uint32_t>(mFrameBuffer, Private::DrawData::FrameMarker);
+    appendValue<uint32_t>(mFrameBuffer, static_cast<uint32_t>(NumberOfLists));
+    appendValue<float>(mFrameBuffer, rDisplaySize.x);
+    appendValue<float>(mFrameBuffer, rDisplaySize.y);
+    appendValue<uint64_t>(mFrameBuffer, toInteger(FontTexture));
+
+    if(mPreviousLists.size() < static_cast<size_t>(NumberOfLists)) {
+        mPreviousLists.resize(NumberOfLists);
+    }
+
+    for(int i = 0; i < NumberOfLists; i++) {
+        mListBuffer.clear();
+        serializeList(pDrawData->CmdLists[i], mListBuffer);
+
+        if(mListBuffer == mPreviousLists[i]) {
+            appendValue<uint8_t>(mFrameBuffer, Private::DrawData::ListRepeat);
+
+        } else {
+            appendValue<uint8_t>(mFrameBuffer, Private::DrawData::ListData);
+            appendBytes(mFrameBuffer, mListBuffer.data(), mListBuffer.size());
+            mPreviousLists[i].swap(mListBuffer);
+        }
+    }
+
+    mFile.write(mFrameBuffer.data(), mFrameBuffer.size());
+    if(!mFile) {
+        LOG_ERROR("{IrrIMGUI} Cannot write into the draw data capture file!\n");
+        close();
+        return false;
+    }
+
+    mNumberOfFrames++;
+    mNumberOfBytes += mFrameBuffer.size();
+
+    return true;
+}
+
+unsigned int CIMGUIDrawDataWriter::getNumberOfFrames(void) const {
+    return mNumberOfFrames;
+}
+
+irr::u64 CIMGUIDrawDataWriter::getNumberOfBytes(void) const {
+    return mNumberOfBytes;
+}
+
+}
+
+/**
+ * @}
+ */
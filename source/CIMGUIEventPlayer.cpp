@@ -0,0 +1,159 @@
+/**
+ * @file   CIMGUIEventPlayer.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a player, that injects recorded input events into an event receiver.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// module includes
+#include <IrrIMGUI/CIMGUIEventPlayer.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI {
+
+/// @brief The first line of every recording file.
+static char const *const RecordingHeader = "IrrIMGUI-Input 1";
+
+CIMGUIEventPlayer::CIMGUIEventPlayer(void):
+    mNextEvent(0),
+    mFrameNumber(0) {
+    return;
+}
+
+CIMGUIEventPlayer::~CIMGUIEventPlayer(void) {
+    return;
+}
+
+bool CIMGUIEventPlayer::open(char const *const pFileName) {
+    close();
+
+    std::ifstream File(pFileName);
+    if(!File.is_open()) {
+        LOG_ERROR("{IrrIMGUI} Cannot open the input recording file \"" << pFileName << "\"!\n");
+        return false;
+    }
+
+    std::string Line;
+    if(!std::getline(File, Line) || (Line != RecordingHeader)) {
+        LOG_ERROR("{IrrIMGUI} The file \"" << pFileName << "\" is not an input recording file!\n");
+        return false;
+    }
+
+    unsigned int LineNumber = 1;
+    while(std::getline(File, Line)) {
+        LineNumber++;
+        if(Line.empty()) {
+            continue;
+        }
+
+        std::istringstream LineStream(Line);
+        SRecordedEvent Recorded;
+        irr::u64 Nanoseconds = 0;
+        char Type = 0;
+
+        LineStream >> Recorded.mFrameNumber >> Nanoseconds >> Type;
+
+        if(Type == 'M') {
+            irr::SEvent::SMouseInput &rMouse = Recorded.mEvent.MouseInput;
+            int MouseEvent = 0;
+            bool Shift     = false;
+            bool Control   = false;
+
+            LineStream >> MouseEvent >> rMouse.X >> rMouse.Y >> rMouse.Wheel >> Shift >> Control >> rMouse.ButtonStates;
+            Recorded.mEvent.EventType = irr::EET_MOUSE_INPUT_EVENT;
+            rMouse.Event   = static_cast<irr::EMOUSE_INPUT_EVENT>(MouseEvent);
+            rMouse.Shift   = Shift;
+            rMouse.Control = Control;
+
+        } else if(Type == 'K') {
+            irr::SEvent::SKeyInput &rKey = Recorded.mEvent.KeyInput;
+            int Key                = 0;
+            unsigned long Char     = 0;
+            bool PressedDown       = false;
+            bool Shift             = false;
+            bool Control           = false;
+
+            LineStream >> Key >> Char >> PressedDown >> Shift >> Control;
+            Recorded.mEvent.EventType = irr::EET_KEY_INPUT_EVENT;
+            rKey.Key         = static_cast<irr::EKEY_CODE>(Key);
+            rKey.Char        = static_cast<wchar_t>(Char);
+            rKey.PressedDown = PressedDown;
+            rKey.Shift       = Shift;
+            rKey.Control     = Control;
+
+        } else {
+            LineStream.setstate(std::ios::failbit);
+        }
+
+        if(!LineStream) {
+            LOG_ERROR("{IrrIMGUI} The input recording file \"" << pFileName << "\" is corrupt in line " << LineNumber << "!\n");
+            close();
+            return false;
+        }
+
+        mEvents.push_back(Recorded);
+    }
+
+    return true;
+}
+
+void CIMGUIEventPlayer::close(void) {
+    mEvents.clear();
+    rewind();
+    return;
+}
+
+void CIMGUIEventPlayer::rewind(void) {
+    mNextEvent   = 0;
+    mFrameNumber = 0;
+    return;
+}
+
+unsigned int CIMGUIEventPlayer::playFrame(irr::IEventReceiver &rReceiver) {
+    unsigned int NumberOfEvents = 0;
+
+    while((mNextEvent < mEvents.size()) && (mEvents[mNextEvent].mFrameNumber <= mFrameNumber)) {
+        rReceiver.OnEvent(mEvents[mNextEvent].mEvent);
+        mNextEvent++;
+        NumberOfEvents++;
+    }
+
+    mFrameNumber++;
+    return NumberOfEvents;
+}
+
+bool CIMGUIEventPlayer::isFinished(void) const {
+    return mNextEvent >= mEvents.size();
+}
+
+unsigned int CIMGUIEventPlayer::getFrameNumber(void) const {
+    return mFrameNumber;
+}
+
+unsigned int CIMGUIEventPlayer::getNumberOfEvents(void) const {
+    return static_cast<unsigned int>(mEvents.size());
+}
+
+unsigned int CIMGUIEventPlayer::getNumberOfFrames(void) const {
+    if(mEvents.empty()) {
+        return 0;
+    }
+
+    return mEvents.back().mFrameNumber + 1;
+}
+
+}
+
+/**
+ * @}
+ */
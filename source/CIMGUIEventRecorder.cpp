@@ -0,0 +1,101 @@
+/**
+ * @file   CIMGUIEventRecorder.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a recorder, that writes the input events of the GUI into a file.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <iomanip>
+
+// module includes
+#include <IrrIMGUI/CIMGUIEventRecorder.h>
+#include <IrrIMGUI/CIMGUIFrameTimer.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI {
+
+/// @brief The first line of every recording file.
+static char const *const RecordingHeader = "IrrIMGUI-Input 1";
+
+CIMGUIEventRecorder::CIMGUIEventRecorder(void):
+    mStartNanoseconds(0),
+    mNumberOfEvents(0) {
+    return;
+}
+
+CIMGUIEventRecorder::~CIMGUIEventRecorder(void) {
+    close();
+    return;
+}
+
+bool CIMGUIEventRecorder::open(char const *const pFileName) {
+    close();
+
+    mFile.open(pFileName, std::ios::out | std::ios::trunc);
+    if(!mFile.is_open()) {
+        LOG_ERROR("{IrrIMGUI} Cannot open the input recording file \"" << pFileName << "\"!\n");
+        return false;
+    }
+
+    mFile << RecordingHeader << "\n" << std::setprecision(9);
+
+    mStartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+    mNumberOfEvents   = 0;
+
+    return true;
+}
+
+void CIMGUIEventRecorder::close(void) {
+    if(mFile.is_open()) {
+        mFile.close();
+    }
+
+    return;
+}
+
+bool CIMGUIEventRecorder::isOpen(void) const {
+    return mFile.is_open();
+}
+
+bool CIMGUIEventRecorder::recordEvent(irr::SEvent const &rEvent, unsigned int const FrameNumber) {
+    if(!mFile.is_open()) {
+        return false;
+    }
+
+    irr::u64 const Nanoseconds = CIMGUIFrameTimer::getSystemNanoseconds() - mStartNanoseconds;
+
+    if(rEvent.EventType == irr::EET_MOUSE_INPUT_EVENT) {
+        irr::SEvent::SMouseInput const &rMouse = rEvent.MouseInput;
+        mFile << FrameNumber << " " << Nanoseconds << " M "
+              << static_cast<int>(rMouse.Event) << " " << rMouse.X << " " << rMouse.Y << " " << rMouse.Wheel << " "
+              << rMouse.Shift << " " << rMouse.Control << " " << rMouse.ButtonStates << "\n";
+
+    } else if(rEvent.EventType == irr::EET_KEY_INPUT_EVENT) {
+        irr::SEvent::SKeyInput const &rKey = rEvent.KeyInput;
+        mFile << FrameNumber << " " << Nanoseconds << " K "
+              << static_cast<int>(rKey.Key) << " " << static_cast<unsigned long>(rKey.Char) << " "
+              << rKey.PressedDown << " " << rKey.Shift << " " << rKey.Control << "\n";
+
+    } else {
+        return false;
+    }
+
+    mNumberOfEvents++;
+    return true;
+}
+
+unsigned int CIMGUIEventRecorder::getNumberOfEvents(void) const {
+    return mNumberOfEvents;
+}
+
+}
+
+/**
+ * @}
+ */
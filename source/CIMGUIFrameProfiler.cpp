@@ -0,0 +1,379 @@
+/**
+ * @file   CIMGUIFrameProfiler.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a profiler that records the CPU and GPU timings of the last GUI frames.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <algorithm>
+
+// module includes
+#include <IrrIMGUI/CIMGUIFrameProfiler.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI {
+
+/// @brief Helper functions for the frame profiler.
+namespace ProfilerHelper {
+/// @brief Converts nanoseconds to milliseconds.
+static float toMilliseconds(irr::u64 const Nanoseconds) {
+    return static_cast<float>(static_cast<double>(Nanoseconds) / 1e6);
+}
+
+/// @brief Returns the CPU time of a frame in milliseconds, used for the frame time graph.
+static float getCPUMilliseconds(void *const pData, int const Index) {
+    CIMGUIFrameProfiler const *const pProfiler = static_cast<CIMGUIFrameProfiler const *>(pData);
+
+    // the graph shows the oldest frame on the left side
+    unsigned int const FrameIndex = pProfiler->getNumberOfFrames() - 1 - static_cast<unsigned int>(Index);
+    return toMilliseconds(pProfiler->getFrame(FrameIndex).getCPUNanoseconds());
+}
+
+/// @brief Sorts the allocation samples descending by the number of samples.
+static bool hasMoreSamples(SIMGUIAllocationSample const &rFirst, SIMGUIAllocationSample const &rSecond) {
+    return rFirst.mSamples > rSecond.mSamples;
+}
+
+/// @brief The number of windows, that are shown in the allocation samples of the overlay.
+static unsigned int const OverlayAllocationSamples = 5;
+}
+
+CIMGUIFrameProfiler::CIMGUIFrameProfiler(unsigned int const HistorySize):
+    mNextFrame(0),
+    mNumberOfFrames(0) {
+    setHistorySize(HistorySize);
+    return;
+}
+
+CIMGUIFrameProfiler::~CIMGUIFrameProfiler(void) {
+    return;
+}
+
+unsigned int CIMGUIFrameProfiler::getHistorySize(void) const {
+    return static_cast<unsigned int>(mFrames.size());
+}
+
+void CIMGUIFrameProfiler::setHistorySize(unsigned int const HistorySize) {
+    ASSERT(HistorySize > 0);
+
+    mFrames.assign(HistorySize, SIMGUIFrameProfile());
+    clear();
+    return;
+}
+
+unsigned int CIMGUIFrameProfiler::getNumberOfFrames(void) const {
+    return mNumberOfFrames;
+}
+
+SIMGUIFrameProfile const &CIMGUIFrameProfiler::getFrame(unsigned int const Index) const {
+    FASSERT(Index < mNumberOfFrames);
+
+    unsigned int const HistorySize = getHistorySize();
+    return mFrames[(mNextFrame + HistorySize - 1 - Index) % HistorySize];
+}
+
+SIMGUIFrameProfile CIMGUIFrameProfiler::getAverage(void) const {
+    SIMGUIFrameProfile Average;
+
+    if(mNumberOfFrames == 0) {
+        return Average;
+    }
+
+    irr::u64     StartGUINanoseconds = 0;
+    irr::u64     WidgetNanoseconds   = 0;
+    irr::u64     RenderNanoseconds   = 0;
+    irr::u64     SubmitNanoseconds   = 0;
+    irr::u64     GPUNanoseconds      = 0;
+    unsigned int GPUFrames           = 0;
+    irr::u64     DrawLists           = 0;
+    irr::u64     Vertices            = 0;
+    irr::u64     Indices             = 0;
+    irr::u64     DrawCalls           = 0;
+    irr::u64     TextureBinds        = 0;
+    irr::u64     BufferBytes         = 0;
+    irr::u64     Allocations         = 0;
+    irr::u64     SystemAllocations   = 0;
+    irr::u64     Frees               = 0;
+    irr::u64     Reallocations       = 0;
+    irr::u64     AllocatedBytes      = 0;
+    irr::u64     LiveBytes           = 0;
+    irr::u64     PeakBytes           = 0;
+    irr::u64     TextLayoutHits      = 0;
+    irr::u64     TextLayoutMisses    = 0;
+
+    for(unsigned int i = 0; i < mNumberOfFrames; i++) {
+        SIMGUIFrameProfile const &rFrame = getFrame(i);
+
+        StartGUINanoseconds += rFrame.mStartGUINanoseconds;
+        WidgetNanoseconds   += rFrame.mWidgetNanoseconds;
+        RenderNanoseconds   += rFrame.mRenderNanoseconds;
+        SubmitNanoseconds   += rFrame.mSubmitNanoseconds;
+        DrawLists           += rFrame.mDrawLists;
+        Vertices            += rFrame.mVertices;
+        Indices             += rFrame.mIndices;
+        DrawCalls           += rFrame.mDrawCalls;
+        TextureBinds        += rFrame.mTextureBinds;
+        BufferBytes         += rFrame.mBufferBytes;
+        Allocations         += rFrame.mAllocations;
+        SystemAllocations   += rFrame.mSystemAllocations;
+        Frees               += rFrame.mFrees;
+        Reallocations       += rFrame.mReallocations;
+        AllocatedBytes      += rFrame.mAllocatedBytes;
+        LiveBytes           += rFrame.mLiveBytes;
+        PeakBytes            = std::max(PeakBytes, rFrame.mPeakBytes);
+        TextLayoutHits      += rFrame.mTextLayoutHits;
+        TextLayoutMisses    += rFrame.mTextLayoutMisses;
+
+        if(rFrame.mIsGPUTimeValid) {
+            GPUNanoseconds += rFrame.mGPUNanoseconds;
+            GPUFrames++;
+        }
+    }
+
+    Average.mFrameNumber         = getFrame(0).mFrameNumber;
+    Average.mStartGUINanoseconds = StartGUINanoseconds / mNumberOfFrames;
+    Average.mWidgetNanoseconds   = WidgetNanoseconds   / mNumberOfFrames;
+    Average.mRenderNanoseconds   = RenderNanoseconds   / mNumberOfFrames;
+    Average.mSubmitNanoseconds   = SubmitNanoseconds   / mNumberOfFrames;
+    Average.mDrawLists           = static_cast<unsigned int>(DrawLists    / mNumberOfFrames);
+    Average.mVertices            = static_cast<unsigned int>(Vertices     / mNumberOfFrames);
+    Average.mIndices             = static_cast<unsigned int>(Indices      / mNumberOfFrames);
+    Average.mDrawCalls           = static_cast<unsigned int>(DrawCalls    / mNumberOfFrames);
+    Average.mTextureBinds        = static_cast<unsigned int>(TextureBinds / mNumberOfFrames);
+    Average.mBufferBytes         = static_cast<unsigned int>(BufferBytes  / mNumberOfFrames);
+    Average.mAllocations         = static_cast<unsigned int>(Allocations   / mNumberOfFrames);
+    Average.mSystemAllocations   = static_cast<unsigned int>(SystemAllocations / mNumberOfFrames);
+    Average.mFrees               = static_cast<unsigned int>(Frees         / mNumberOfFrames);
+    Average.mReallocations       = static_cast<unsigned int>(Reallocations / mNumberOfFrames);
+    Average.mAllocatedBytes      = AllocatedBytes / mNumberOfFrames;
+    Average.mLiveBytes           = LiveBytes      / mNumberOfFrames;
+    Average.mPeakBytes           = PeakBytes;
+    Average.mTextLayoutHits      = static_cast<unsigned int>(TextLayoutHits   / mNumberOfFrames);
+    Average.mTextLayoutMisses    = static_cast<unsigned int>(TextLayoutMisses / mNumberOfFrames);
+
+    if(GPUFrames > 0) {
+        Average.mGPUNanoseconds = GPUNanoseconds / GPUFrames;
+        Average.mIsGPUTimeValid = true;
+    }
+
+    return Average;
+}
+
+void CIMGUIFrameProfiler::clear(void) {
+    mNextFrame      = 0;
+    mNumberOfFrames = 0;
+    return;
+}
+
+void CIMGUIFrameProfiler::addFrame(SIMGUIFrameProfile const &rProfile) {
+    unsigned int const HistorySize = getHistorySize();
+
+    mFrames[mNextFrame] = rProfile;
+    mNextFrame = (mNextFrame + 1) % HistorySize;
+
+    if(mNumberOfFrames < HistorySize) {
+        mNumberOfFrames++;
+    }
+
+    return;
+}
+
+void CIMGUIFrameProfiler::setGPUTime(int const FrameNumber, irr::u64 const Nanoseconds) {
+    // the GPU time arrives some frames later, thus search from the newest to the oldest frame
+    for(unsigned int i = 0; i < mNumberOfFrames; i++) {
+        unsigned int const HistorySize = getHistorySize();
+        SIMGUIFrameProfile &rFrame = mFrames[(mNextFrame + HistorySize - 1 - i) % HistorySize];
+
+        if(rFrame.mFrameNumber == FrameNumber) {
+            rFrame.mGPUNanoseconds = Nanoseconds;
+            rFrame.mIsGPUTimeValid = true;
+            break;
+        }
+    }
+
+    return;
+}
+
+void CIMGUIFrameProfiler::countDrawData(ImDrawData const *const pDrawData, SIMGUIFrameProfile &rProfile) {
+    rProfile.mDrawLists    = 0;
+    rProfile.mVertices     = 0;
+    rProfile.mIndices      = 0;
+    rProfile.mDrawCalls    = 0;
+    rProfile.mTextureBinds = 0;
+    rProfile.mBufferBytes  = 0;
+
+    if((pDrawData == nullptr) || !pDrawData->Valid) {
+        return;
+    }
+
+    rProfile.mDrawLists = static_cast<unsigned int>(pDrawData->CmdListsCount);
+    rProfile.mVertices  = static_cast<unsigned int>(pDrawData->TotalVtxCount);
+    rProfile.mIndices   = static_cast<unsigned int>(pDrawData->TotalIdxCount);
+
+    ImTextureID LastTexture = nullptr;
+    bool IsTextureBound = false;
+
+    for(int ListIndex = 0; ListIndex < pDrawData->CmdListsCount; ListIndex++) {
+        ImDrawList const *const pList = pDrawData->CmdLists[ListIndex];
+
+        rProfile.mBufferBytes += static_cast<unsigned int>(pList->VtxBuffer.Size * sizeof(ImDrawVert));
+        rProfile.mBufferBytes += static_cast<unsigned int>(pList->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+        for(int CommandIndex = 0; CommandIndex < pList->CmdBuffer.Size; CommandIndex++) {
+            ImDrawCmd const &rCommand = pList->CmdBuffer[CommandIndex];
+
+            if(rCommand.UserCallback) {
+                // a callback can change the bound texture
+                IsTextureBound = false;
+
+            } else {
+                rProfile.mDrawCalls++;
+
+                if(!IsTextureBound || (rCommand.TextureId != LastTexture)) {
+                    rProfile.mTextureBinds++;
+                    LastTexture    = rCommand.TextureId;
+                    IsTextureBound = true;
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+void CIMGUIFrameProfiler::addAllocationSample(char const *const pLocation, irr::u64 const Bytes) {
+    SIMGUIAllocationSample &rSample = mAllocationSamples[pLocation];
+
+    if(rSample.mSamples == 0) {
+        rSample.mLocation = pLocation;
+    }
+    rSample.mSamples++;
+    rSample.mBytes += Bytes;
+    return;
+}
+
+std::vector<SIMGUIAllocationSample> CIMGUIFrameProfiler::getAllocationSamples(void) const {
+    std::vector<SIMGUIAllocationSample> Samples;
+    Samples.reserve(mAllocationSamples.size());
+
+    for(std::map<std::string, SIMGUIAllocationSample>::const_iterator Iterator = mAllocationSamples.begin(); Iterator != mAllocationSamples.end(); ++Iterator) {
+        Samples.push_back(Iterator->second);
+    }
+
+    std::stable_sort(Samples.begin(), Samples.end(), ProfilerHelper::hasMoreSamples);
+    return Samples;
+}
+
+void CIMGUIFrameProfiler::clearAllocationSamples(void) {
+    mAllocationSamples.clear();
+    return;
+}
+
+SIMGUIStartupProfile const &CIMGUIFrameProfiler::getStartup(void) const {
+    return mStartup;
+}
+
+void CIMGUIFrameProfiler::setStartup(SIMGUIStartupProfile const &rStartup) {
+    mStartup = rStartup;
+    return;
+}
+
+SIMGUIFontMemory const &CIMGUIFrameProfiler::getFontMemory(void) const {
+    return mFontMemory;
+}
+
+void CIMGUIFrameProfiler::setFontMemory(SIMGUIFontMemory const &rFontMemory) {
+    mFontMemory = rFontMemory;
+    return;
+}
+
+void CIMGUIFrameProfiler::drawOverlay(bool *const pIsOpen) const {
+    using ProfilerHelper::toMilliseconds;
+
+    if(!ImGui::Begin("GUI Profiler", pIsOpen, ImGuiWindowFlags_AlwaysAutoResize)) {
+        ImGui::End();
+        return;
+    }
+
+    SIMGUIFrameProfile const Average = getAverage();
+
+    ImGui::Text("Average of %u frames:", mNumberOfFrames);
+    ImGui::Separator();
+    ImGui::Text("CPU startGUI: %7.3f ms", toMilliseconds(Average.mStartGUINanoseconds));
+    ImGui::Text("CPU widgets:  %7.3f ms", toMilliseconds(Average.mWidgetNanoseconds));
+    ImGui::Text("CPU render:   %7.3f ms", toMilliseconds(Average.mRenderNanoseconds));
+    ImGui::Text("CPU submit:   %7.3f ms", toMilliseconds(Average.mSubmitNanoseconds));
+    ImGui::Text("CPU total:    %7.3f ms", toMilliseconds(Average.getCPUNanoseconds()));
+
+    if(Average.mIsGPUTimeValid) {
+        ImGui::Text("GPU pass:     %7.3f ms", toMilliseconds(Average.mGPUNanoseconds));
+    } else {
+        ImGui::Text("GPU pass:     n/a");
+    }
+
+    ImGui::Separator();
+    ImGui::Text("Draw lists:    %u", Average.mDrawLists);
+    ImGui::Text("Draw calls:    %u", Average.mDrawCalls);
+    ImGui::Text("Texture binds: %u", Average.mTextureBinds);
+    ImGui::Text("Vertices:      %u", Average.mVertices);
+    ImGui::Text("Indices:       %u", Average.mIndices);
+    ImGui::Text("Buffer bytes:  %u", Average.mBufferBytes);
+
+    ImGui::Separator();
+    ImGui::Text("Allocations:   %u (%u reallocations)", Average.mAllocations, Average.mReallocations);
+    ImGui::Text("System allocs: %u", Average.mSystemAllocations);
+    ImGui::Text("Frees:         %u", Average.mFrees);
+    ImGui::Text("Alloc. bytes:  %llu", static_cast<unsigned long long>(Average.mAllocatedBytes));
+    ImGui::Text("Live bytes:    %llu (peak %llu)", static_cast<unsigned long long>(Average.mLiveBytes), static_cast<unsigned long long>(Average.mPeakBytes));
+
+    unsigned int const TextLayouts = Average.mTextLayoutHits + Average.mTextLayoutMisses;
+    if(TextLayouts > 0) {
+        ImGui::Separator();
+        ImGui::Text("Text layouts:  %u hits, %u misses (%.1f%% hits)", Average.mTextLayoutHits, Average.mTextLayoutMisses, 100.0 * Average.mTextLayoutHits / TextLayouts);
+    }
+
+    if(mFontMemory.getTotalBytes() > 0) {
+        ImGui::Separator();
+        ImGui::Text("Font bytes:    %llu", static_cast<unsigned long long>(mFontMemory.getTotalBytes()));
+        ImGui::Text("  TTF:         %llu (released %llu)", static_cast<unsigned long long>(mFontMemory.mTTFBytes), static_cast<unsigned long long>(mFontMemory.mReleasedTTFBytes));
+        ImGui::Text("  Pixels:      %llu", static_cast<unsigned long long>(mFontMemory.mAtlasPixelBytes));
+        ImGui::Text("  Glyphs:      %llu", static_cast<unsigned long long>(mFontMemory.mGlyphBytes));
+        ImGui::Text("  Dynamic:     %llu", static_cast<unsigned long long>(mFontMemory.mDynamicGlyphBytes));
+    }
+
+    if(mStartup.mIsPrepared) {
+        ImGui::Separator();
+        ImGui::Text("Startup:       %7.3f ms (%s)", toMilliseconds(mStartup.mPrepareNanoseconds), mStartup.mIsProgramFromCache ? "warm" : "cold");
+    }
+
+    if(!mAllocationSamples.empty()) {
+        std::vector<SIMGUIAllocationSample> const Samples = getAllocationSamples();
+        size_t const NumberOfSamples = std::min<size_t>(Samples.size(), ProfilerHelper::OverlayAllocationSamples);
+
+        ImGui::Separator();
+        ImGui::Text("Sampled allocations:");
+        for(size_t i = 0; i < NumberOfSamples; i++) {
+            ImGui::BulletText("%s: %u (%llu bytes)", Samples[i].mLocation.c_str(), Samples[i].mSamples, static_cast<unsigned long long>(Samples[i].mBytes));
+        }
+    }
+
+    if(mNumberOfFrames > 0) {
+        ImGui::Separator();
+        ImGui::PlotLines("CPU [ms]", ProfilerHelper::getCPUMilliseconds, const_cast<CIMGUIFrameProfiler *>(this), static_cast<int>(mNumberOfFrames), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+    }
+
+    ImGui::End();
+    return;
+}
+
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,116 @@
+/**
+ * @file   CIMGUIFrameScheduler.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a scheduler, that builds the frames of several IMGUI handles in parallel.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <algorithm>
+
+// module includes
+#include "CIMGUIFrameScheduler.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUITrace_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+CIMGUIFrameScheduler::CIMGUIFrameScheduler(unsigned int const NumberOfThreads):
+    mPool(NumberOfThreads) {
+    return;
+}
+
+CIMGUIFrameScheduler::~CIMGUIFrameScheduler(void) {
+    for(SEntry &rEntry : mEntries) {
+        rEntry.mpGUI->drop();
+    }
+
+    return;
+}
+
+void CIMGUIFrameScheduler::addGUI(IIMGUIHandle *const pGUI, GUIFunction const Function) {
+    FASSERT(pGUI);
+
+    pGUI->grab();
+
+    SEntry Entry;
+    Entry.mpGUI     = pGUI;
+    Entry.mFunction = Function;
+    mEntries.push_back(Entry);
+
+    return;
+}
+
+void CIMGUIFrameScheduler::removeGUI(IIMGUIHandle *const pGUI) {
+    std::vector<SEntry>::iterator const Iterator = std::find_if(mEntries.begin(), mEntries.end(), [pGUI](SEntry const & rEntry) {
+        return rEntry.mpGUI == pGUI;
+    });
+
+    if(Iterator == mEntries.end()) {
+        LOG_ERROR("{IrrIMGUI} Try to remove an unknown handle from the frame scheduler!\n");
+
+    } else {
+        mEntries.erase(Iterator);
+        pGUI->drop();
+    }
+
+    return;
+}
+
+unsigned int CIMGUIFrameScheduler::getNumberOfGUIs(void) const {
+    return static_cast<unsigned int>(mEntries.size());
+}
+
+void CIMGUIFrameScheduler::buildFrames(void) {
+    // input, timing and graphic resources are handled on the calling thread
+    for(SEntry &rEntry : mEntries) {
+        rEntry.mpGUI->startGUI();
+    }
+
+    mTasks.clear();
+    for(SEntry &rEntry : mEntries) {
+        SEntry *const pEntry = &rEntry;
+        mTasks.push_back([pEntry] {
+            TRACE_SCOPE("buildFrame");
+            pEntry->mpGUI->makeCurrent();
+            if(pEntry->mFunction) {
+                pEntry->mFunction(pEntry->mpGUI);
+            }
+            pEntry->mpGUI->finishGUI();
+        });
+    }
+
+    mPool.run(mTasks);
+
+    return;
+}
+
+void CIMGUIFrameScheduler::drawAll(void) {
+    for(SEntry &rEntry : mEntries) {
+        rEntry.mpGUI->drawAll();
+    }
+
+    return;
+}
+
+unsigned int CIMGUIFrameScheduler::getNumberOfThreads(void) const {
+    return mPool.getNumberOfThreads();
+}
+
+}
+
+IIMGUIFrameScheduler *createIMGUIFrameScheduler(unsigned int const NumberOfThreads) {
+    return new Private::CIMGUIFrameScheduler(NumberOfThreads);
+}
+
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,91 @@
+/**
+ * @file   CIMGUIFrameScheduler.h
+ * @author Andre Netzeband
+ * @brief  Contains a scheduler, that builds the frames of several IMGUI handles in parallel.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMESCHEDULER_H_
+#define IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMESCHEDULER_H_
+
+// library includes
+#include <vector>
+
+// module includes
+#include <IrrIMGUI/IIMGUIFrameScheduler.h>
+#include "private/CWorkStealingPool.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief The implementation of the frame scheduler (see IrrIMGUI::IIMGUIFrameScheduler).
+class CIMGUIFrameScheduler : public IIMGUIFrameScheduler {
+public:
+
+    /// @{
+    /// @name Constructor and Destructor
+
+    /// @brief Constructor.
+    /// @param NumberOfThreads Is the number of threads that build the frames (including the calling thread). Pass 0 to use one thread per CPU core.
+    CIMGUIFrameScheduler(unsigned int NumberOfThreads);
+
+    /// @brief Destructor. Drops all registered handles.
+    virtual ~CIMGUIFrameScheduler(void);
+
+    /// @}
+
+    /// @{
+    /// @name Handle registration
+
+    /// @brief Registers a handle for the frame building. The scheduler grabs the handle until it is removed.
+    /// @param pGUI     Is a pointer to the handle.
+    /// @param Function Is the function that draws the GUI elements of this handle.
+    virtual void addGUI(IIMGUIHandle *pGUI, GUIFunction Function);
+
+    /// @brief Removes a handle from the frame building and drops it.
+    /// @param pGUI Is a pointer to the handle.
+    virtual void removeGUI(IIMGUIHandle *pGUI);
+
+    /// @return Returns the number of registered handles.
+    virtual unsigned int getNumberOfGUIs(void) const;
+
+    /// @}
+
+    /// @{
+    /// @name Frame building
+
+    /// @brief Builds the frames of all registered handles and returns when the draw data of all handles is ready.
+    virtual void buildFrames(void);
+
+    /// @brief Submits the draw data of all registered handles in the order they have been added.
+    virtual void drawAll(void);
+
+    /// @return Returns the number of threads that build the frames (including the calling thread).
+    virtual unsigned int getNumberOfThreads(void) const;
+
+    /// @}
+
+private:
+    /// @brief A registered handle together with its GUI function.
+    struct SEntry {
+        IIMGUIHandle *mpGUI;
+        GUIFunction   mFunction;
+    };
+
+    std::vector<SEntry>                     mEntries;
+    std::vector<CWorkStealingPool::Task>    mTasks;
+    CWorkStealingPool                       mPool;
+};
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_INCLUDE_IRRIMGUI_CIMGUIFRAMESCHEDULER_H_ */
@@ -0,0 +1,108 @@
+/**
+ * @file   CIMGUIFrameTimer.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a timer that measures the time step between two GUI frames.
+ * @addtogroup IrrIMGUI
+ */
+
+// library includes
+#include <chrono>
+
+// module includes
+#include <IrrIMGUI/CIMGUIFrameTimer.h>
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUI
+ * @{
+ */
+
+namespace IrrIMGUI {
+
+/// @brief The smallest time step, that is passed to IMGUI (IMGUI needs a time step greater than 0).
+static irr::u64 const MinimumDeltaNanoseconds = 1;
+
+CIMGUIFrameTimer::CIMGUIFrameTimer(IIMGUIClock *const pClock):
+    mpClock(pClock),
+    mLastNanoseconds(0),
+    mRawDeltaNanoseconds(MinimumDeltaNanoseconds),
+    mDeltaTime(static_cast<float>(MinimumDeltaNanoseconds) / 1e9f),
+    mSmoothing(0.0f),
+    mIsFirstUpdate(true) {
+    reset();
+    return;
+}
+
+CIMGUIFrameTimer::~CIMGUIFrameTimer(void) {
+    return;
+}
+
+void CIMGUIFrameTimer::setClock(IIMGUIClock *const pClock) {
+    mpClock = pClock;
+    reset();
+    return;
+}
+
+void CIMGUIFrameTimer::setSmoothing(float const Smoothing) {
+    ASSERT((Smoothing >= 0.0f) && (Smoothing < 1.0f));
+    mSmoothing = Smoothing;
+    return;
+}
+
+float CIMGUIFrameTimer::getSmoothing(void) const {
+    return mSmoothing;
+}
+
+void CIMGUIFrameTimer::reset(void) {
+    mLastNanoseconds = getNanoseconds();
+    mIsFirstUpdate   = true;
+    return;
+}
+
+float CIMGUIFrameTimer::update(void) {
+    irr::u64 const CurrentNanoseconds = getNanoseconds();
+
+    mRawDeltaNanoseconds = (CurrentNanoseconds > mLastNanoseconds) ? (CurrentNanoseconds - mLastNanoseconds) : 0;
+    if(mRawDeltaNanoseconds < MinimumDeltaNanoseconds) {
+        mRawDeltaNanoseconds = MinimumDeltaNanoseconds;
+    }
+    mLastNanoseconds = CurrentNanoseconds;
+
+    double const RawDeltaTime = static_cast<double>(mRawDeltaNanoseconds) / 1e9;
+
+    if(mIsFirstUpdate || (mSmoothing == 0.0f)) {
+        mDeltaTime = static_cast<float>(RawDeltaTime);
+    } else {
+        mDeltaTime = static_cast<float>(mSmoothing * static_cast<double>(mDeltaTime) + (1.0 - mSmoothing) * RawDeltaTime);
+    }
+    mIsFirstUpdate = false;
+
+    return mDeltaTime;
+}
+
+float CIMGUIFrameTimer::getDeltaTime(void) const {
+    return mDeltaTime;
+}
+
+irr::u64 CIMGUIFrameTimer::getRawDeltaNanoseconds(void) const {
+    return mRawDeltaNanoseconds;
+}
+
+irr::u64 CIMGUIFrameTimer::getSystemNanoseconds(void) {
+    std::chrono::steady_clock::duration const Time = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<irr::u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Time).count());
+}
+
+irr::u64 CIMGUIFrameTimer::getNanoseconds(void) {
+    if(mpClock) {
+        return mpClock->getNanoseconds();
+    }
+
+    return getSystemNanoseconds();
+}
+
+}
+
+/**
+ * @}
+ */
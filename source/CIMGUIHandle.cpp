@@ -11,6 +11,7 @@
 #include "IIMGUIDriver.h"
 #include <IrrIMGUI/IMGUIHelper.h>
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUITrace_priv.h"
 #include "IrrIMGUI/imgui_irrlicht.h"
 #include <GL/gl3w.h>
 /**
@@ -20,7 +21,7 @@
 
 namespace IrrIMGUI {
 namespace Private {
-unsigned int CIMGUIHandle::mHandleInstances = 0;
+ImGuiContext *const CIMGUIHandle::mpDefaultContext = ImGui::GetCurrentContext();
 
 CIMGUIHandle::CIMGUIHandle(irr::IrrlichtDevice *const pDevice, CIMGUIEventStorage *const pEventStorage, SIMGUISettings const &rSettings):
     CIMGUIHandle(pDevice, pEventStorage, &rSettings) {
@@ -28,110 +29,378 @@ CIMGUIHandle::CIMGUIHandle(irr::IrrlichtDevice *const pDevice, CIMGUIEventStorag
 }
 
 CIMGUIHandle::CIMGUIHandle(irr::IrrlichtDevice *const pDevice, CIMGUIEventStorage *const pEventStorage, SIMGUISettings const *const pSettings) {
-    mpGUIDriver = IIMGUIDriver::getInstance(pDevice);
-    mLastTime    = static_cast<float>(pDevice->getTimer()->getTime()) / 1000.0f;
-    mpEventStorage = pEventStorage;
-    mHandleInstances++;
+    // the allocator hooks count the allocations of every frame for the profiler
+    mpContext = ImGui::CreateContext(CAllocationTracker::allocate, CAllocationTracker::deallocate);
+    makeCurrent();
+
+    mpGUIDriver             = IIMGUIDriver::getInstance(pDevice, pSettings ? pSettings->mBackend : EIB_AUTOMATIC);
+    mpEventStorage          = pEventStorage;
+    mIsFrameFinished        = false;
+    mIsFrameOpen            = false;
+    mWidgetStartNanoseconds = 0;
+
+    // GPU timer queries are only possible with a real OpenGL context
+    irr::video::E_DRIVER_TYPE const DriverType = pDevice->getVideoDriver()->getDriverType();
+    mIsGPUTimingAvailable = (DriverType == irr::video::EDT_OPENGL) && (mpGUIDriver->getBackend() != EIB_NULL) && CGPUFrameTimer::isSupported();
 
     if(pSettings) {
-        mpGUIDriver->setSettings(*pSettings);
+        mSettings = *pSettings;
     }
+    mpGUIDriver->applySettings(mSettings);
+    mFrameTimer.setClock(mSettings.mpFrameClock);
+    mFrameTimer.setSmoothing(mSettings.mFrameTimeSmoothing);
+    mProfiler.setHistorySize(mSettings.mProfilerHistorySize);
+    updateAllocationSettings();
 
     return;
 }
 
 CIMGUIHandle::~CIMGUIHandle(void) {
-    irr::IrrlichtDevice *const pIrrDevice = mpGUIDriver->getIrrDevice();
+    makeCurrent();
 
-    if(mHandleInstances == 0) {
-        LOG_ERROR("The number of CIMGUIHandle instances is out of sync (" << mHandleInstances << " instances)!");
-    } else {
-        mHandleInstances--;
+    // the font atlas is owned by the driver, thus it must not be cleared by the shutdown
+    ImGui::GetIO().Fonts = nullptr;
+    ImGui::Shutdown();
+
+    // a frame, that has never been submitted, must not keep the dynamic glyphs of the other handles forever
+    if(mIsFrameOpen) {
+        mpGUIDriver->endFrame();
+        mIsFrameOpen = false;
+    }
+
+    // the driver keeps the device and its OpenGL context alive
+    if(mIsGPUTimingAvailable) {
+        mGPUTimer.release();
+    }
 
-        if(mHandleInstances == 0) {
-            IIMGUIDriver::deleteInstance();
+    int Allocations = ImGui::GetIO().MetricsAllocs;
+    IIMGUIDriver::deleteInstance(mpGUIDriver, Allocations);
+    mpGUIDriver = nullptr;
+
+    if(Allocations != 0) {
+        if(mSettings.mIsIMGUIMemoryAllocationTrackingEnabled) {
+            LOG_ERROR("{IrrIMGUI} There are " << std::dec << Allocations << " allocated memory blocks that have not been deallocated so far!" << std::endl);
         }
     }
 
+    ImGui::DestroyContext(mpContext);
+    mpContext = nullptr;
+    mAllocationTracker.resetCurrent();
+
+    ImGui::SetCurrentContext(mpDefaultContext);
+
+    return;
+}
+
+void CIMGUIHandle::makeCurrent(void) {
+    ImGui::SetCurrentContext(mpContext);
+    mAllocationTracker.makeCurrent(mpContext);
+    return;
+}
+
+void CIMGUIHandle::updateAllocationSettings(void) {
+    if(mSettings.mIsProfilerEnabled) {
+        mAllocationTracker.setSampling(&mProfiler, mSettings.mAllocationSamplingInterval);
+    } else {
+        mAllocationTracker.setSampling(nullptr, 0);
+    }
+
+    mAllocationTracker.setFrameAllocator(&mFrameAllocator, mSettings.mIsFrameAllocatorEnabled);
     return;
 }
 
 void CIMGUIHandle::drawAll(void) {
-    glViewport(0, 0, (int)ImGui::GetIO().DisplaySize.x, (int)ImGui::GetIO().DisplaySize.y);
+    makeCurrent();
 
-    ImGui::Render();
+    // the null renderer is also used for devices without OpenGL context
+    if(mpGUIDriver->getBackend() != EIB_NULL) {
+        glViewport(0, 0, (int)ImGui::GetIO().DisplaySize.x, (int)ImGui::GetIO().DisplaySize.y);
+    }
+
+    if(!mIsFrameFinished) {
+        buildDrawData();
+    }
+    mIsFrameFinished = false;
+
+    submitDrawData();
+
+    return;
+}
+
+void CIMGUIHandle::finishGUI(void) {
+    makeCurrent();
+
+    buildDrawData();
+
+    mIsFrameFinished = true;
+    return;
+}
+
+void CIMGUIHandle::prepare(void) {
+    makeCurrent();
+    prepareRenderer();
+    return;
+}
+
+void CIMGUIHandle::prepareRenderer(void) {
+    if(mpGUIDriver->isPrepared()) {
+        return;
+    }
+
+    TRACE_SCOPE("prepare");
+    irr::u64 const StartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+
+    SIMGUIStartupProfile Startup;
+    Startup.mIsPrepared         = true;
+    Startup.mIsProgramFromCache = mpGUIDriver->prepare(mSettings);
+    Startup.mPrepareNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds() - StartNanoseconds;
+    mProfiler.setStartup(Startup);
+
+    LOG_NOTE("{IrrIMGUI} Prepared the renderer in " << std::dec << (Startup.mPrepareNanoseconds / 1000) << " us (" << (Startup.mIsProgramFromCache ? "warm" : "cold") << " start).\n");
     return;
 }
 
 void CIMGUIHandle::startGUI(void) {
+    TRACE_SCOPE("startGUI");
+    irr::u64 const StartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+
+    makeCurrent();
 
-    updateIMGUIFrameValues(mpGUIDriver->getIrrDevice(), mpEventStorage, &mLastTime);
-    ImGui_ImplIrrlicht_NewFrame(mpGUIDriver->getIrrDevice());
-    
-    // start new GUI frame
-  //  ImGui::NewFrame();
+    // the font atlas must not be built inside the frame allocator
+    prepareRenderer();
+    mAllocationTracker.startFrame();
+
+    mIsFrameFinished = false;
+    if(!mIsFrameOpen) {
+        mpGUIDriver->beginFrame();
+        mIsFrameOpen = true;
+    }
+    updateIMGUIFrameValues(mpGUIDriver->getIrrDevice(), mpEventStorage, &mFrameTimer);
+
+    {
+        TRACE_SCOPE("NewFrame");
+        ImGui_ImplIrrlicht_NewFrame(mpGUIDriver->getIrrDevice());
+    }
+
+    if(mSettings.mIsProfilerEnabled) {
+        mWidgetStartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+
+        mCurrentProfile = SIMGUIFrameProfile();
+        mCurrentProfile.mFrameNumber         = ImGui::GetFrameCount();
+        mCurrentProfile.mStartGUINanoseconds = mWidgetStartNanoseconds - StartNanoseconds;
+    }
 
     return;
 }
 
+void CIMGUIHandle::buildDrawData(void) {
+    TRACE_SCOPE("Render");
+    bool const IsProfilerEnabled = mSettings.mIsProfilerEnabled;
+    irr::u64 RenderStartNanoseconds = 0;
+
+    if(IsProfilerEnabled) {
+        RenderStartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+        mCurrentProfile.mWidgetNanoseconds = RenderStartNanoseconds - mWidgetStartNanoseconds;
+
+        if(mSettings.mIsProfilerOverlayEnabled) {
+            mProfiler.drawOverlay();
+        }
+    }
+
+    // build the draw data without calling the render function
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+    void (*const pRenderFunction)(ImDrawData *) = rGUIIO.RenderDrawListsFn;
+    rGUIIO.RenderDrawListsFn = nullptr;
+    ImGui::Render();
+    rGUIIO.RenderDrawListsFn = pRenderFunction;
+
+    if(IsProfilerEnabled) {
+        mCurrentProfile.mRenderNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds() - RenderStartNanoseconds;
+        CIMGUIFrameProfiler::countDrawData(ImGui::GetDrawData(), mCurrentProfile);
+        mCurrentProfile.mTextLayoutHits   = static_cast<unsigned int>(rGUIIO.MetricsTextLayoutHits);
+        mCurrentProfile.mTextLayoutMisses = static_cast<unsigned int>(rGUIIO.MetricsTextLayoutMisses);
+    }
+
+    if(mSettings.mpDrawDataWriter && mSettings.mpDrawDataWriter->isOpen()) {
+        TRACE_SCOPE("Capture");
+        mSettings.mpDrawDataWriter->writeFrame(ImGui::GetDrawData(), rGUIIO.DisplaySize, rGUIIO.Fonts->TexID);
+    }
+
+    return;
+}
+
+void CIMGUIHandle::submitDrawData(void) {
+    TRACE_SCOPE("Submit");
+    bool const IsProfilerEnabled = mSettings.mIsProfilerEnabled;
+    bool IsGPUTimerRunning = false;
+    irr::u64 SubmitStartNanoseconds = 0;
+
+    if(IsProfilerEnabled) {
+        SubmitStartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+
+        if(mIsGPUTimingAvailable) {
+            IsGPUTimerRunning = mGPUTimer.begin(mCurrentProfile.mFrameNumber);
+        }
+    }
+
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+    ImDrawData *const pDrawData = ImGui::GetDrawData();
+
+    // the glyphs, that have been rasterized while building the frame, must be in the font texture before they are drawn
+    mpGUIDriver->updateDynamicFonts();
+
+    if(rGUIIO.RenderDrawListsFn && pDrawData && (pDrawData->CmdListsCount > 0)) {
+        rGUIIO.RenderDrawListsFn(pDrawData);
+    }
+
+    // the dynamic glyphs of this frame can be replaced, when the frames of all handles of the device have been submitted
+    if(!mIsFrameOpen) {
+        mpGUIDriver->beginFrame();
+    }
+    mIsFrameOpen = false;
+    mpGUIDriver->endFrame();
+
+    if(IsProfilerEnabled) {
+        if(IsGPUTimerRunning) {
+            mGPUTimer.end();
+        }
+
+        mCurrentProfile.mSubmitNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds() - SubmitStartNanoseconds;
+        mAllocationTracker.getFrameStatistics(mCurrentProfile);
+        mProfiler.addFrame(mCurrentProfile);
+
+        SIMGUIFontMemory FontMemory;
+        mpGUIDriver->getFontMemory(FontMemory);
+        mProfiler.setFontMemory(FontMemory);
+
+        // the GPU results of older frames arrive with a delay of some frames
+        int FrameNumber = 0;
+        irr::u64 GPUNanoseconds = 0;
+        while(mGPUTimer.getResult(FrameNumber, GPUNanoseconds)) {
+            mProfiler.setGPUTime(FrameNumber, GPUNanoseconds);
+        }
+    }
+
+    mAllocationTracker.endFrame();
+    return;
+}
+
 SIMGUISettings const &CIMGUIHandle::getSettings(void) const {
-    return mpGUIDriver->getSettings();
+    return mSettings;
 }
 
 void CIMGUIHandle::setSettings(SIMGUISettings const &rSettings) {
-    mpGUIDriver->setSettings(rSettings);
+    makeCurrent();
+
+    if(mSettings.mpFrameClock != rSettings.mpFrameClock) {
+        mFrameTimer.setClock(rSettings.mpFrameClock);
+    }
+    mFrameTimer.setSmoothing(rSettings.mFrameTimeSmoothing);
+
+    if(mSettings.mProfilerHistorySize != rSettings.mProfilerHistorySize) {
+        mProfiler.setHistorySize(rSettings.mProfilerHistorySize);
+    } else if(mSettings.mIsProfilerEnabled != rSettings.mIsProfilerEnabled) {
+        mProfiler.clear();
+    }
+
+    mSettings = rSettings;
+    mpGUIDriver->applySettings(mSettings);
+    updateAllocationSettings();
+    return;
+}
+
+CIMGUIFrameProfiler *CIMGUIHandle::getProfiler(void) {
+    return &mProfiler;
 }
 
 ImFont *CIMGUIHandle::addFont(ImFontConfig const *const pFontConfig) {
-    return ImGui::GetIO().Fonts->AddFont(pFontConfig);
+    return mpGUIDriver->getFontAtlas()->AddFont(pFontConfig);
 }
 
 ImFont *CIMGUIHandle::addDefaultFont(ImFontConfig const *const pFontConfig) {
-    return ImGui::GetIO().Fonts->AddFontDefault(pFontConfig);
+    return mpGUIDriver->getFontAtlas()->AddFontDefault(pFontConfig);
 }
 
 ImFont *CIMGUIHandle::addFontFromFileTTF(char const *const pFileName, float const FontSizeInPixel, ImFontConfig const *const pFontConfig, ImWchar const *const pGlyphRanges) {
-    return ImGui::GetIO().Fonts->AddFontFromFileTTF(pFileName, FontSizeInPixel, pFontConfig, pGlyphRanges);
+    ImFontAtlas *const pFontAtlas = mpGUIDriver->getFontAtlas();
+    ImFont *const pFont = pFontAtlas->AddFontFromFileTTF(pFileName, FontSizeInPixel, pFontConfig, pGlyphRanges);
+
+    if(pFont != nullptr) {
+        mpGUIDriver->getFontDataStore()->addFileSource(*pFontAtlas, pFileName);
+    }
+
+    return pFont;
 }
 
 ImFont *CIMGUIHandle::addFontFromMemoryTTF(void *const pTTFData, int const TTFSize, float const FontSizeInPixel, ImFontConfig const *const pFontConfig, ImWchar const *const pGlyphRanges) {
-    return ImGui::GetIO().Fonts->AddFontFromMemoryTTF(pTTFData, TTFSize, FontSizeInPixel, pFontConfig, pGlyphRanges);
+    return mpGUIDriver->getFontAtlas()->AddFontFromMemoryTTF(pTTFData, TTFSize, FontSizeInPixel, pFontConfig, pGlyphRanges);
 }
 
 ImFont *CIMGUIHandle::addFontFromMemoryCompressedTTF(void const *const pCompressedTTFData, int const CompressedTTFSize, float const FontSizeInPixel, ImFontConfig const *const pFontConfig, ImWchar const *const pGlyphRanges) {
-    return ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF(pCompressedTTFData, CompressedTTFSize, FontSizeInPixel, pFontConfig, pGlyphRanges);
+    ImFontAtlas *const pFontAtlas = mpGUIDriver->getFontAtlas();
+    ImFont *const pFont = pFontAtlas->AddFontFromMemoryCompressedTTF(pCompressedTTFData, CompressedTTFSize, FontSizeInPixel, pFontConfig, pGlyphRanges);
+
+    if(pFont != nullptr) {
+        mpGUIDriver->getFontDataStore()->addCompressedSource(*pFontAtlas, pCompressedTTFData, CompressedTTFSize);
+    }
+
+    return pFont;
 }
 
 ImFont *CIMGUIHandle::addFontFromMemoryCompressedBase85TTF(char const *const pCompressedTTFDataBase85, float const FontSizeInPixel, ImFontConfig const *const pFontConfig, const ImWchar *const pGlyphRanges) {
-    return ImGui::GetIO().Fonts->AddFontFromMemoryCompressedBase85TTF(pCompressedTTFDataBase85, FontSizeInPixel, pFontConfig, pGlyphRanges);
+    ImFontAtlas *const pFontAtlas = mpGUIDriver->getFontAtlas();
+    ImFont *const pFont = pFontAtlas->AddFontFromMemoryCompressedBase85TTF(pCompressedTTFDataBase85, FontSizeInPixel, pFontConfig, pGlyphRanges);
+
+    if(pFont != nullptr) {
+        mpGUIDriver->getFontDataStore()->addBase85Source(*pFontAtlas, pCompressedTTFDataBase85);
+    }
+
+    return pFont;
+}
+
+ImFont *CIMGUIHandle::addDynamicFontFromFileTTF(char const *const pFileName, float const FontSizeInPixel, ImWchar const *const pDynamicGlyphRanges, unsigned int const NumberOfCachedGlyphs, ImFontConfig const *const pFontConfig, ImWchar const *const pGlyphRanges) {
+    ImFontAtlas *const pFontAtlas = mpGUIDriver->getFontAtlas();
+    ImFont *const pFont = pFontAtlas->AddFontFromFileTTF(pFileName, FontSizeInPixel, pFontConfig, pGlyphRanges);
+
+    if(pFont != nullptr) {
+        mpGUIDriver->addDynamicFont(pFontAtlas->ConfigData.back(), pDynamicGlyphRanges, NumberOfCachedGlyphs);
+    }
+
+    return pFont;
 }
 
 void CIMGUIHandle::compileFonts(void) {
-    mpGUIDriver->compileFonts();
+    makeCurrent();
+
+    mpGUIDriver->compileFonts(mSettings);
     return;
 }
 
 void CIMGUIHandle::resetFonts(void) {
-    ImGui::GetIO().Fonts->Clear();
+    makeCurrent();
+
+    mpGUIDriver->deleteDynamicFonts();
+    mpGUIDriver->getFontDataStore()->clear();
+    mpGUIDriver->getFontAtlas()->Clear();
     addDefaultFont();
-    mpGUIDriver->compileFonts();
+    mpGUIDriver->compileFonts(mSettings);
     return;
 }
 
 ImWchar const *CIMGUIHandle::getGlyphRangesDefault(void) {
-    return ImGui::GetIO().Fonts->GetGlyphRangesDefault();
+    return mpGUIDriver->getFontAtlas()->GetGlyphRangesDefault();
 }
 
 ImWchar const *CIMGUIHandle::getGlyphRangesJapanese(void) {
-    return ImGui::GetIO().Fonts->GetGlyphRangesJapanese();
+    return mpGUIDriver->getFontAtlas()->GetGlyphRangesJapanese();
 }
 
 ImWchar const *CIMGUIHandle::getGlyphRangesChinese(void) {
-    return ImGui::GetIO().Fonts->GetGlyphRangesChinese();
+    return mpGUIDriver->getFontAtlas()->GetGlyphRangesChinese();
 }
 
 ImWchar const *CIMGUIHandle::getGlyphRangesCyrillic(void) {
-    return ImGui::GetIO().Fonts->GetGlyphRangesCyrillic();
+    return mpGUIDriver->getFontAtlas()->GetGlyphRangesCyrillic();
 }
 
 IGUITexture *CIMGUIHandle::createTexture(irr::video::IImage *pImage) {
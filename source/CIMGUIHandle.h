@@ -18,6 +18,11 @@
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 #include <IrrIMGUI/IGUITexture.h>
 #include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/CIMGUIFrameTimer.h>
+#include <IrrIMGUI/CIMGUIFrameProfiler.h>
+#include "private/CGPUFrameTimer.h"
+#include "private/CAllocationTracker.h"
+#include "private/CFrameAllocator.h"
 
 /**
  * @addtogroup IrrIMGUIPrivate
@@ -31,11 +36,14 @@ class IIMGUIDriver;
 /**
  * @brief Use an object of this class to setup the IMGUI for Irrlicht and to render the content.
  * @details
- *   Create an object of this handle in your project, when you need the IMGUI. You can create multiple object, but all
- *   of them will just use a single instance of the GUI (this is an IMGUI limitation). You can setup and use the same GUI
- *   from all instances of this handle.
+ *   Create an object of this handle in your project, when you need the IMGUI. You can create multiple objects, every
+ *   object owns an independent IMGUI context (windows, settings, input and timing). All handles of the same Irrlicht
+ *   device share the font atlas and the graphic resources. Handles of different devices are fully independent.
  *
- *   If the last instance is destroyed, the IMGUI system will be shutdown.
+ *   The context of a handle is made current by "startGUI()", "drawAll()" and "makeCurrent()". The current context is
+ *   stored per thread, thus different handles can build their GUI on different threads at the same time.
+ *
+ *   If the last instance of a device is destroyed, the font atlas and graphic resources of this device are released.
  *
  *   To create an instance of this handle you need to pass an Irrlicht device object to the constructor.
  *   The Event-Storage pointer can be an "nullptr" or NULL, if you don't need mouse or keyboard input for your GUI.
@@ -79,7 +87,7 @@ public:
 
     /**
      * @brief Use this constructor when you want special settings.
-     * @note  When you use multiple instances of this handle class, the settings will be applied to all instances at the same time.
+     * @note  The context of the new handle is the current context after construction.
      *
      * @param pDevice       Is a pointer to the Irrlicht Device.
      * @param pEventStorage Is a pointer to the Event Storage that is used to transfer Mouse and Key input informations to the IMGUI. If you pass NULL or nullptr, no input informations are passed to the GUI.
@@ -89,7 +97,7 @@ public:
 
     /**
      * @brief Use this constructor when you want special settings.
-     * @note  When you use multiple instances of this handle class, the settings will be applied to all instances at the same time.
+     * @note  The context of the new handle is the current context after construction.
      *
      * @param pDevice       Is a pointer to the Irrlicht Device.
      * @param pEventStorage Is a pointer to the Event Storage that is used to transfer Mouse and Key input informations to the IMGUI. If you pass NULL or nullptr, no input informations are passed to the GUI.
@@ -111,6 +119,16 @@ public:
     /// @brief Call this function after "startGUI()" and after you draw your GUI elements. It will render all elements to the screen (do not call it before rendering the 3D Scene!).
     virtual void drawAll(void);
 
+    /// @brief Call this function after you draw your GUI elements, when the frame is not built on the render thread. It builds the draw data
+    ///        of the frame without using the graphic API, "drawAll()" only submits this draw data afterwards.
+    virtual void finishGUI(void);
+
+    /// @brief Creates the graphic objects of the renderer, that are otherwise created in the first frame.
+    virtual void prepare(void);
+
+    /// @brief Makes the IMGUI context of this handle the current context of the calling thread.
+    virtual void makeCurrent(void);
+
     /// @}
 
     /// @{
@@ -120,11 +138,19 @@ public:
     virtual SIMGUISettings const &getSettings(void) const;
 
     /// @param rSettings is a reference to a Setting structure that should be applied.
-    /// @note  The settings are applied to all GUI handles at the same time, since IMGUI uses internally a single instance.
+    /// @note  The settings are only applied to the IMGUI context of this handle.
     virtual void setSettings(SIMGUISettings const &rSettings);
 
     /// @}
 
+    /// @{
+    /// @name Profiling
+
+    /// @return Returns a pointer to the profiler of this handle. It records frames only when SIMGUISettings::mIsProfilerEnabled is true.
+    virtual CIMGUIFrameProfiler *getProfiler(void);
+
+    /// @}
+
     /// @{
     /// @name Font operations
 
@@ -190,6 +216,18 @@ public:
      */
     virtual ImFont *addFontFromMemoryCompressedBase85TTF(char const *pCompressedTTFDataBase85, float FontSizeInPixel, ImFontConfig const *pFontConfig = NULL, const ImWchar *pGlyphRanges = NULL);
 
+    /**
+     * @brief Adds a font from a TTF file to the IMGUI memory, whose large glyph ranges (like the Chinese one) are rasterized when they are drawn for the first time.
+     * @param pFileName            Is the name of the file to add.
+     * @param FontSizeInPixel      Is the desired font size to use.
+     * @param pDynamicGlyphRanges  Is the Glyph-Range of the glyphs, that are rasterized on demand.
+     * @param NumberOfCachedGlyphs Is the number of dynamic glyphs, that fit into the font texture at the same time.
+     * @param pFontConfig          Is a pointer to the font configuration.
+     * @param pGlyphRanges         Is the Glyph-Range of the glyphs, that are rasterized when the fonts are compiled.
+     * @return Returns a pointer to the font for later usage with PushFont(...) to activate this font.
+     */
+    virtual ImFont *addDynamicFontFromFileTTF(char const *pFileName, float FontSizeInPixel, ImWchar const *pDynamicGlyphRanges, unsigned int NumberOfCachedGlyphs = 1024, ImFontConfig const *pFontConfig = NULL, ImWchar const *pGlyphRanges = NULL);
+
     /// @brief This function copies all fonts that have been added with "addFont/addDefaultFont" into graphic memory.
     /// @attention Call this function before using the fonts that have been added.
     virtual void compileFonts(void);
@@ -261,10 +299,35 @@ private:
     /// @brief Update Keyboard input information.
     void updateKeyboard(void);
 
+    /// @brief Builds the draw data of the current frame without using the graphic API.
+    void buildDrawData(void);
+
+    /// @brief Submits the draw data of the current frame to the graphic API.
+    void submitDrawData(void);
+
+    /// @brief Passes the allocation sampling and frame allocator settings to the allocation tracker.
+    void updateAllocationSettings(void);
+
+    /// @brief Creates the graphic objects of the renderer and stores the needed time in the profiler, when they do not exist yet.
+    void prepareRenderer(void);
+
     Private::IIMGUIDriver *mpGUIDriver;
-    float                mLastTime;
-    CIMGUIEventStorage     *mpEventStorage;
-    static unsigned int         mHandleInstances;
+    ImGuiContext          *mpContext;
+    SIMGUISettings         mSettings;
+    CIMGUIFrameTimer       mFrameTimer;
+    CIMGUIEventStorage    *mpEventStorage;
+    bool                   mIsFrameFinished;
+    bool                   mIsFrameOpen;
+    CIMGUIFrameProfiler    mProfiler;
+    SIMGUIFrameProfile     mCurrentProfile;
+    irr::u64               mWidgetStartNanoseconds;
+    CGPUFrameTimer         mGPUTimer;
+    bool                   mIsGPUTimingAvailable;
+    CFrameAllocator        mFrameAllocator;
+    CAllocationTracker     mAllocationTracker;
+
+    /// @brief The context, that is current when no handle context is used.
+    static ImGuiContext   *const mpDefaultContext;
 
 };
 
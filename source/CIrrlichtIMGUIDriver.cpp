@@ -16,7 +16,9 @@
 // module includes
 #include "CIrrlichtIMGUIDriver.h"
 #include "private/CGUITexture.h"
+#include "private/CGUITextureTable.h"
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUITrace_priv.h"
 #include "IrrIMGUI/imgui_irrlicht.h"
 
 /**
@@ -74,6 +76,31 @@ ImTextureID copyTextureIDFromRawData(irr::video::IVideoDriver *pIrrDriver, EColo
 /// @return Returns ITexture object as IMGUI Texture ID.
 ImTextureID copyTextureIDFromImage(irr::video::IVideoDriver *pIrrDriver, irr::video::IImage *pImage);
 
+/// @brief Creates the GPU memory of a GUI texture from raw data.
+/// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
+/// @param pGUITexture Is a pointer to the GUI texture, whose memory has already been deleted.
+/// @param ColorFormat Is the format of the Color of every Pixel.
+/// @param pPixelData  Is a pointer to the pixel array.
+/// @param Width       Is the number of Pixels in X direction.
+/// @param Height      Is the number of Pixels in Y direction.
+void setTextureFromRawData(irr::video::IVideoDriver *pIrrDriver, CGUITexture *pGUITexture, EColorFormat ColorFormat, unsigned char *pPixelData, unsigned int Width, unsigned int Height);
+
+/// @brief Creates the GPU memory of a GUI texture from an Irrlicht image.
+/// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
+/// @param pGUITexture Is a pointer to the GUI texture, whose memory has already been deleted.
+/// @param pImage      Is a pointer to an Irrlicht IImage object.
+void setTextureFromImage(irr::video::IVideoDriver *pIrrDriver, CGUITexture *pGUITexture, irr::video::IImage *pImage);
+
+/// @brief Uses an Irrlicht texture as GPU memory of a GUI texture.
+/// @param pGUITexture Is a pointer to the GUI texture, whose memory has already been deleted.
+/// @param pTexture    Is a pointer to an Irrlicht ITexture object.
+void setTextureFromTexture(CGUITexture *pGUITexture, irr::video::ITexture *pTexture);
+
+/// @brief Creates the GPU memory of a GUI texture from the currently loaded fonts and uses it as font texture.
+/// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
+/// @param pGUITexture Is a pointer to the GUI texture, whose memory has already been deleted.
+void setTextureFromGUIFont(irr::video::IVideoDriver *pIrrDriver, CGUITexture *pGUITexture);
+
 /// @brief Deleted the memory from this texture ID.
 /// @param pIrrDriver  Is a pointer to the Irrlicht driver object.
 /// @param pGUITexture is a pointer to the texture object.
@@ -89,7 +116,6 @@ irr::core::vector3df CIrrlichtIMGUIDriver::mOffset(0.0f, 0.0f, 0.0f);
 
 CIrrlichtIMGUIDriver::CIrrlichtIMGUIDriver(irr::IrrlichtDevice *const pDevice):
     IIMGUIDriver(pDevice) {
-    setupFunctionPointer();
 
     irr::video::IVideoDriver *pDriver = pDevice->getVideoDriver();
     irr::video::E_DRIVER_TYPE Type = pDriver->getDriverType();
@@ -121,9 +147,8 @@ CIrrlichtIMGUIDriver::~CIrrlichtIMGUIDriver(void) {
 }
 
 void CIrrlichtIMGUIDriver::setupFunctionPointer(void) {
-    ImGuiIO &rGUIIO  = ImGui::GetIO();
-
-    rGUIIO.RenderDrawListsFn = CIrrlichtIMGUIDriver::drawGUIList;
+    // the GUI is drawn by the OpenGL 3 shader of the binding
+    ImGui_ImplIrrlicht_Init(getIrrDevice());
     return;
 }
 
@@ -188,6 +213,8 @@ void CIrrlichtIMGUIDriver::drawGUIList(ImDrawData *pDrawData) {
     glUniform1i(g_AttribLocationTex, 0);
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
     glBindVertexArray(g_VaoHandle);
+
+    CGUITextureTable const &rTextureTable = CGUITextureTable::getInstance();
     
     for(int n = 0; n < pDrawData->CmdListsCount; n++) {
         const ImDrawList *cmd_list = pDrawData->CmdLists[n];
@@ -204,16 +231,24 @@ void CIrrlichtIMGUIDriver::drawGUIList(ImDrawData *pDrawData) {
             if(pcmd->UserCallback) {
                 pcmd->UserCallback(cmd_list, pcmd);
             } else {
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
-                //                glScissor((int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
-                float clipRect[4];
-                clipRect[0] = (int)pcmd->ClipRect.x;
-                clipRect[1] = (int)(fb_height - pcmd->ClipRect.w);
-                clipRect[2] = (int)(pcmd->ClipRect.z - pcmd->ClipRect.x);
-                clipRect[3] = (int)(pcmd->ClipRect.w - pcmd->ClipRect.y);
-                glUniform4f(g_AttribLocationClipRect, clipRect[0], clipRect[1], clipRect[2], clipRect[3]);
-                
-                glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
+                // GUI textures use handles of the texture table, other texture IDs are OpenGL texture names
+                bool const IsHandle = CGUITextureTable::isHandle(pcmd->TextureId);
+                ImTextureID const TextureID = IsHandle ? rTextureTable.getGPUTextureID(pcmd->TextureId) : pcmd->TextureId;
+
+                if(IsHandle && (TextureID == nullptr)) {
+                    LOG_ERROR("{IrrIMGUI} The texture " << std::hex << pcmd->TextureId << " of a draw command has already been deleted!\n");
+                } else {
+                    glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)TextureID);
+                    //                glScissor((int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
+                    float clipRect[4];
+                    clipRect[0] = (int)pcmd->ClipRect.x;
+                    clipRect[1] = (int)(fb_height - pcmd->ClipRect.w);
+                    clipRect[2] = (int)(pcmd->ClipRect.z - pcmd->ClipRect.x);
+                    clipRect[3] = (int)(pcmd->ClipRect.w - pcmd->ClipRect.y);
+                    glUniform4f(g_AttribLocationClipRect, clipRect[0], clipRect[1], clipRect[2], clipRect[3]);
+
+                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
+                }
             }
             idx_buffer_offset += pcmd->ElemCount;
         }
@@ -263,65 +298,64 @@ void CIrrlichtIMGUIDriver::drawCommandList(ImDrawList *pCommandList) {
 }
 
 IGUITexture *CIrrlichtIMGUIDriver::createTexture(EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
-    mTextureInstances++;
-    CGUITexture *const pGUITexture = new CGUITexture();
+    CGUITexture *const pGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    pGUITexture->mIsUsingOwnMemory = true;
-    pGUITexture->mSourceType       = ETST_RAWDATA;
-    pGUITexture->mSource.RawDataID = pPixelData;
-    pGUITexture->mIsValid          = true;
-    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromRawData(getIrrDevice()->getVideoDriver(), ColorFormat, pPixelData, Width, Height);
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    mTextureInstances++;
+    IrrlichtHelper::setTextureFromRawData(getIrrDevice()->getVideoDriver(), pGUITexture, ColorFormat, pPixelData, Width, Height);
 
     return pGUITexture;
 }
 
 IGUITexture *CIrrlichtIMGUIDriver::createTexture(irr::video::IImage *const pImage) {
-    mTextureInstances++;
-    CGUITexture *const pGUITexture = new CGUITexture();
+    CGUITexture *const pGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    pGUITexture->mIsUsingOwnMemory = true;
-    pGUITexture->mSourceType       = ETST_IMAGE;
-    pGUITexture->mSource.ImageID   = pImage;
-    pGUITexture->mIsValid          = true;
-    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromImage(getIrrDevice()->getVideoDriver(), pImage);
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    mTextureInstances++;
+    IrrlichtHelper::setTextureFromImage(getIrrDevice()->getVideoDriver(), pGUITexture, pImage);
 
     return pGUITexture;
 }
 
 IGUITexture *CIrrlichtIMGUIDriver::createTexture(irr::video::ITexture *pTexture) {
-    mTextureInstances++;
-    CGUITexture *const pGUITexture = new CGUITexture();
+    CGUITexture *const pGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    pGUITexture->mIsUsingOwnMemory = false;
-    pGUITexture->mSourceType       = ETST_TEXTURE;
-    pGUITexture->mSource.TextureID = pTexture;
-    pGUITexture->mIsValid          = true;
-    pGUITexture->mGPUTextureID     = static_cast<ImTextureID>(static_cast<void *const>(pTexture));
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    mTextureInstances++;
+    IrrlichtHelper::setTextureFromTexture(pGUITexture, pTexture);
 
     return pGUITexture;
 }
 
 IGUITexture *CIrrlichtIMGUIDriver::createFontTexture(void) {
-    mTextureInstances++;
-    CGUITexture *const pGUITexture = new CGUITexture();
+    CGUITexture *const pGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    pGUITexture->mIsUsingOwnMemory = true;
-    pGUITexture->mSourceType       = ETST_GUIFONT;
-    pGUITexture->mSource.GUIFontID = IrrlichtHelper::IMGUI_FONT_ID;
-    pGUITexture->mIsValid          = true;
-    pGUITexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromGUIFont(getIrrDevice()->getVideoDriver());
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
 
-    void *const pFontTexture = reinterpret_cast<void *>(pGUITexture);
-    ImGui::GetIO().Fonts->TexID = pFontTexture;
+    mTextureInstances++;
+    IrrlichtHelper::setTextureFromGUIFont(getIrrDevice()->getVideoDriver(), pGUITexture);
 
     return pGUITexture;
 }
 
 void CIrrlichtIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
-    CGUITexture *const pRealTexture = dynamic_cast<CGUITexture *const>(pGUITexture);
+    CGUITexture *const pRealTexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
     bool IsRecreationNecessary = false;
 
-    FASSERT(pRealTexture->mIsValid);
+    if(pRealTexture == nullptr) {
+        return;
+    }
 
     if(pRealTexture->mIsUsingOwnMemory) {
         IsRecreationNecessary = true;
@@ -333,22 +367,19 @@ void CIrrlichtIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, EColorF
 
     if(IsRecreationNecessary) {
         IrrlichtHelper::deleteTextureID(getIrrDevice()->getVideoDriver(), pRealTexture);
-
-        pRealTexture->mIsUsingOwnMemory = true;
-        pRealTexture->mSourceType       = ETST_RAWDATA;
-        pRealTexture->mSource.RawDataID = pPixelData;
-        pRealTexture->mIsValid          = true;
-        pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromRawData(getIrrDevice()->getVideoDriver(), ColorFormat, pPixelData, Width, Height);
+        IrrlichtHelper::setTextureFromRawData(getIrrDevice()->getVideoDriver(), pRealTexture, ColorFormat, pPixelData, Width, Height);
     }
 
     return;
 }
 
 void CIrrlichtIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, irr::video::IImage *const pImage) {
-    CGUITexture *const pRealTexture = dynamic_cast<CGUITexture *const>(pGUITexture);
+    CGUITexture *const pRealTexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
     bool IsRecreationNecessary = false;
 
-    FASSERT(pRealTexture->mIsValid);
+    if(pRealTexture == nullptr) {
+        return;
+    }
 
     if(pRealTexture->mIsUsingOwnMemory) {
         IsRecreationNecessary = true;
@@ -360,22 +391,19 @@ void CIrrlichtIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, irr::vi
 
     if(IsRecreationNecessary) {
         IrrlichtHelper::deleteTextureID(getIrrDevice()->getVideoDriver(), pRealTexture);
-
-        pRealTexture->mIsUsingOwnMemory = true;
-        pRealTexture->mSourceType       = ETST_IMAGE;
-        pRealTexture->mSource.ImageID   = pImage;
-        pRealTexture->mIsValid          = true;
-        pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromImage(getIrrDevice()->getVideoDriver(), pImage);
+        IrrlichtHelper::setTextureFromImage(getIrrDevice()->getVideoDriver(), pRealTexture, pImage);
     }
 
     return;
 }
 
 void CIrrlichtIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, irr::video::ITexture *const pTexture) {
-    CGUITexture *const pRealTexture = dynamic_cast<CGUITexture *const>(pGUITexture);
+    CGUITexture *const pRealTexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
     bool IsRecreationNecessary = false;
 
-    FASSERT(pRealTexture->mIsValid);
+    if(pRealTexture == nullptr) {
+        return;
+    }
 
     if(pRealTexture->mIsUsingOwnMemory) {
         IsRecreationNecessary = true;
@@ -387,22 +415,19 @@ void CIrrlichtIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, irr::vi
 
     if(IsRecreationNecessary) {
         IrrlichtHelper::deleteTextureID(getIrrDevice()->getVideoDriver(), pRealTexture);
-
-        pRealTexture->mIsUsingOwnMemory = false;
-        pRealTexture->mSourceType       = ETST_TEXTURE;
-        pRealTexture->mSource.TextureID = pTexture;
-        pRealTexture->mIsValid          = true;
-        pRealTexture->mGPUTextureID     = static_cast<ImTextureID>(static_cast<void *const>(pTexture));
+        IrrlichtHelper::setTextureFromTexture(pRealTexture, pTexture);
     }
 
     return;
 }
 
 void CIrrlichtIMGUIDriver::updateFontTexture(IGUITexture *const pGUITexture) {
-    CGUITexture *const pRealTexture = dynamic_cast<CGUITexture *const>(pGUITexture);
+    CGUITexture *const pRealTexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
     bool IsRecreationNecessary = false;
 
-    FASSERT(pRealTexture->mIsValid);
+    if(pRealTexture == nullptr) {
+        return;
+    }
 
     if(pRealTexture->mIsUsingOwnMemory) {
         IsRecreationNecessary = true;
@@ -414,27 +439,56 @@ void CIrrlichtIMGUIDriver::updateFontTexture(IGUITexture *const pGUITexture) {
 
     if(IsRecreationNecessary) {
         IrrlichtHelper::deleteTextureID(getIrrDevice()->getVideoDriver(), pRealTexture);
+        IrrlichtHelper::setTextureFromGUIFont(getIrrDevice()->getVideoDriver(), pRealTexture);
+    }
+
+    return;
+}
+
+void CIrrlichtIMGUIDriver::updateFontTextureRegion(IGUITexture *const pGUITexture, unsigned int const X, unsigned int const Y, unsigned int const Width, unsigned int const Height, unsigned char const *const pPixelData) {
+    CGUITexture *const pRealTexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
+
+    if(pRealTexture == nullptr) {
+        return;
+    }
+
+    irr::video::ITexture *const pTexture = static_cast<irr::video::ITexture *>(pRealTexture->getGPUTextureID());
+    if(pTexture == nullptr) {
+        return;
+    }
+
+    // Irrlicht has no sub-image upload, it uploads the whole texture when it is unlocked
+    unsigned char *const pTextureData = static_cast<unsigned char *>(pTexture->lock());
+    if(pTextureData == nullptr) {
+        return;
+    }
 
-        pRealTexture->mIsUsingOwnMemory = true;
-        pRealTexture->mSourceType       = ETST_GUIFONT;
-        pRealTexture->mSource.GUIFontID = IrrlichtHelper::IMGUI_FONT_ID;
-        pRealTexture->mIsValid          = true;
-        pRealTexture->mGPUTextureID     = IrrlichtHelper::copyTextureIDFromGUIFont(getIrrDevice()->getVideoDriver());
+    unsigned int const Pitch = pTexture->getPitch();
 
-        void *const pFontTexture = reinterpret_cast<void *>(pGUITexture);
-        ImGui::GetIO().Fonts->TexID = pFontTexture;
+    for(unsigned int Row = 0; Row < Height; Row++) {
+        unsigned int *const pTextureRow = reinterpret_cast<unsigned int *>(&pTextureData[(Y + Row) * Pitch]) + X;
+        for(unsigned int Column = 0; Column < Width; Column++) {
+            // set only Alpha
+            irr::video::SColor const Color(pPixelData[Row * Width + Column], 255, 255, 255);
+            Color.getData(&pTextureRow[Column], irr::video::ECF_A8R8G8B8);
+        }
     }
 
+    pTexture->unlock();
+
     return;
 }
 
 void CIrrlichtIMGUIDriver::deleteTexture(IGUITexture *const pGUITexture) {
-    CGUITexture *const pRealTexture = dynamic_cast<CGUITexture *const>(pGUITexture);
+    CGUITextureTable &rTextureTable = CGUITextureTable::getInstance();
+    CGUITexture *const pRealTexture = rTextureTable.getTexture(pGUITexture);
 
-    FASSERT(pRealTexture->mIsValid);
+    if(pRealTexture == nullptr) {
+        return;
+    }
 
     IrrlichtHelper::deleteTextureID(getIrrDevice()->getVideoDriver(), pRealTexture);
-    delete pRealTexture;
+    rTextureTable.deleteTexture(pRealTexture);
 
     mTextureInstances--;
     return;
@@ -444,6 +498,53 @@ void CIrrlichtIMGUIDriver::deleteTexture(IGUITexture *const pGUITexture) {
 namespace IrrlichtHelper {
 
 
+void setTextureFromRawData(irr::video::IVideoDriver *const pIrrDriver, CGUITexture *const pGUITexture, EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
+    pGUITexture->mIsUsingOwnMemory = true;
+    pGUITexture->mSourceType       = ETST_RAWDATA;
+    pGUITexture->mSource.RawDataID = pPixelData;
+
+    ImTextureID const GPUTextureID = copyTextureIDFromRawData(pIrrDriver, ColorFormat, pPixelData, Width, Height);
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, Width, Height, ECF_A8R8G8B8);
+
+    return;
+}
+
+void setTextureFromImage(irr::video::IVideoDriver *const pIrrDriver, CGUITexture *const pGUITexture, irr::video::IImage *const pImage) {
+    pGUITexture->mIsUsingOwnMemory = true;
+    pGUITexture->mSourceType       = ETST_IMAGE;
+    pGUITexture->mSource.ImageID   = pImage;
+
+    ImTextureID const GPUTextureID = copyTextureIDFromImage(pIrrDriver, pImage);
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, pImage->getDimension().Width, pImage->getDimension().Height, ECF_A8R8G8B8);
+
+    return;
+}
+
+void setTextureFromTexture(CGUITexture *const pGUITexture, irr::video::ITexture *const pTexture) {
+    pGUITexture->mIsUsingOwnMemory = false;
+    pGUITexture->mSourceType       = ETST_TEXTURE;
+    pGUITexture->mSource.TextureID = pTexture;
+
+    ImTextureID const GPUTextureID = static_cast<ImTextureID>(static_cast<void *const>(pTexture));
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, pTexture->getSize().Width, pTexture->getSize().Height, ECF_A8R8G8B8);
+
+    return;
+}
+
+void setTextureFromGUIFont(irr::video::IVideoDriver *const pIrrDriver, CGUITexture *const pGUITexture) {
+    pGUITexture->mIsUsingOwnMemory = true;
+    pGUITexture->mSourceType       = ETST_GUIFONT;
+    pGUITexture->mSource.GUIFontID = IMGUI_FONT_ID;
+
+    ImFontAtlas *const pFonts = ImGui::GetIO().Fonts;
+    ImTextureID const GPUTextureID = copyTextureIDFromGUIFont(pIrrDriver);
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, pFonts->TexWidth, pFonts->TexHeight, ECF_A8R8G8B8);
+
+    pFonts->TexID = pGUITexture->getTextureID();
+
+    return;
+}
+
 irr::video::SColor getColorFromImGuiColor(unsigned int const ImGuiColor) {
     ImColor const Color(ImGuiColor);
 
@@ -456,6 +557,7 @@ irr::video::SColor getColorFromImGuiColor(unsigned int const ImGuiColor) {
 }
 
 ImTextureID copyTextureIDFromRawData(irr::video::IVideoDriver *const pIrrDriver, EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
+    TRACE_SCOPE_ARG("TextureUpload", "pixels", Width * Height);
 
     unsigned int *pImageData = nullptr;
     bool IsTempMemoryUsed = false;
@@ -540,6 +642,8 @@ ImTextureID copyTextureIDFromGUIFont(irr::video::IVideoDriver *const pIrrDriver)
 }
 
 ImTextureID copyTextureIDFromImage(irr::video::IVideoDriver *const pIrrDriver, irr::video::IImage *const pImage) {
+    TRACE_SCOPE_ARG("TextureUpload", "pixels", pImage->getDimension().Width * pImage->getDimension().Height);
+
     // do not generate mipmaps for font textures
     pIrrDriver->setTextureCreationFlag(irr::video::ETCF_CREATE_MIP_MAPS, false);
 
@@ -558,16 +662,16 @@ ImTextureID copyTextureIDFromImage(irr::video::IVideoDriver *const pIrrDriver, i
 
 void deleteTextureID(irr::video::IVideoDriver *const pIrrDriver, CGUITexture *const pGUITexture) {
     if(pGUITexture->mIsUsingOwnMemory) {
-        LOG_NOTE("{IrrIMGUI-Irr} Delete ITexture memory. Handle: " << std::hex << pGUITexture->mGPUTextureID << "\n");
-        irr::video::ITexture *const pIrrlichtTexture = reinterpret_cast<irr::video::ITexture *const>(pGUITexture->mGPUTextureID);
+        ImTextureID const GPUTextureID = pGUITexture->getGPUTextureID();
+        LOG_NOTE("{IrrIMGUI-Irr} Delete ITexture memory. Handle: " << std::hex << GPUTextureID << "\n");
+        irr::video::ITexture *const pIrrlichtTexture = reinterpret_cast<irr::video::ITexture *const>(GPUTextureID);
 
         pIrrDriver->removeTexture(pIrrlichtTexture);
 
         pGUITexture->mIsUsingOwnMemory = false;
-        pGUITexture->mGPUTextureID = nullptr;
     }
 
-    pGUITexture->mIsValid = false;
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, nullptr, 0, 0, ECF_A8R8G8B8);
     pGUITexture->mSourceType = ETST_UNKNOWN;
 
     return;
@@ -0,0 +1,219 @@
+/**
+ * @file       CNullIMGUIDriver.cpp
+ * @author     Andre Netzeband
+ * @brief      Contains a driver that does not render the GUI.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// module includes
+#include "CNullIMGUIDriver.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "private/CGUITexture.h"
+#include "private/CGUITextureTable.h"
+
+namespace IrrIMGUI {
+namespace Private {
+namespace Driver {
+
+/// @brief Helper functions for the null driver.
+namespace NullHelper {
+/// @brief The GPU texture ID of all textures. The textures have no GPU memory, but a valid texture needs an ID.
+static ImTextureID const DummyTextureID = reinterpret_cast<ImTextureID>(0x1);
+
+/// @brief Creates a GUI texture object inside the texture table.
+/// @param SourceType  Is the type of the source of the texture.
+/// @param Width       Is the number of Pixels in X direction.
+/// @param Height      Is the number of Pixels in Y direction.
+/// @param ColorFormat Is the format of the texture.
+/// @return Returns a pointer to the texture or nullptr, when the table is full.
+CGUITexture *createTexture(TextureSourceType SourceType, unsigned int Width, unsigned int Height, EColorFormat ColorFormat);
+
+/// @brief Builds the currently loaded fonts and uses a GUI texture as font texture.
+/// @param pGUITexture Is a pointer to the GUI texture.
+void setTextureFromGUIFont(CGUITexture *pGUITexture);
+}
+
+CNullIMGUIDriver::CNullIMGUIDriver(irr::IrrlichtDevice *const pDevice):
+    IIMGUIDriver(pDevice) {
+    LOG_NOTE("{IrrIMGUI-Null} Start null GUI renderer, the GUI is not drawn.\n");
+    return;
+}
+
+CNullIMGUIDriver::~CNullIMGUIDriver(void) {
+    return;
+}
+
+void CNullIMGUIDriver::setupFunctionPointer(void) {
+    ImGuiIO &rGUIIO  = ImGui::GetIO();
+
+    rGUIIO.RenderDrawListsFn = CNullIMGUIDriver::drawGUIList;
+    return;
+}
+
+void CNullIMGUIDriver::drawGUIList(ImDrawData *const) {
+    return;
+}
+
+IGUITexture *CNullIMGUIDriver::createTexture(EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
+    CGUITexture *const pGUITexture = NullHelper::createTexture(ETST_RAWDATA, Width, Height, (ColorFormat == ECF_A8) ? ECF_A8 : ECF_R8G8B8A8);
+
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    pGUITexture->mSource.RawDataID = pPixelData;
+    mTextureInstances++;
+
+    return pGUITexture;
+}
+
+IGUITexture *CNullIMGUIDriver::createTexture(irr::video::IImage *const pImage) {
+    CGUITexture *const pGUITexture = NullHelper::createTexture(ETST_IMAGE, pImage->getDimension().Width, pImage->getDimension().Height, ECF_R8G8B8A8);
+
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    pGUITexture->mSource.ImageID = pImage;
+    mTextureInstances++;
+
+    return pGUITexture;
+}
+
+IGUITexture *CNullIMGUIDriver::createTexture(irr::video::ITexture *const pTexture) {
+    CGUITexture *const pGUITexture = NullHelper::createTexture(ETST_TEXTURE, pTexture->getSize().Width, pTexture->getSize().Height, ECF_R8G8B8A8);
+
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    pGUITexture->mSource.TextureID = pTexture;
+    mTextureInstances++;
+
+    return pGUITexture;
+}
+
+IGUITexture *CNullIMGUIDriver::createFontTexture(void) {
+    CGUITexture *const pGUITexture = NullHelper::createTexture(ETST_GUIFONT, 0, 0, ECF_A8);
+
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    mTextureInstances++;
+    NullHelper::setTextureFromGUIFont(pGUITexture);
+
+    return pGUITexture;
+}
+
+void CNullIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
+
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
+
+    pRealGUITexture->mSourceType       = ETST_RAWDATA;
+    pRealGUITexture->mSource.RawDataID = pPixelData;
+    CGUITextureTable::getInstance().setGPUTexture(pRealGUITexture, NullHelper::DummyTextureID, Width, Height, (ColorFormat == ECF_A8) ? ECF_A8 : ECF_R8G8B8A8);
+
+    return;
+}
+
+void CNullIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, irr::video::IImage *const pImage) {
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
+
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
+
+    pRealGUITexture->mSourceType     = ETST_IMAGE;
+    pRealGUITexture->mSource.ImageID = pImage;
+    CGUITextureTable::getInstance().setGPUTexture(pRealGUITexture, NullHelper::DummyTextureID, pImage->getDimension().Width, pImage->getDimension().Height, ECF_R8G8B8A8);
+
+    return;
+}
+
+void CNullIMGUIDriver::updateTexture(IGUITexture *const pGUITexture, irr::video::ITexture *const pTexture) {
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
+
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
+
+    pRealGUITexture->mSourceType       = ETST_TEXTURE;
+    pRealGUITexture->mSource.TextureID = pTexture;
+    CGUITextureTable::getInstance().setGPUTexture(pRealGUITexture, NullHelper::DummyTextureID, pTexture->getSize().Width, pTexture->getSize().Height, ECF_R8G8B8A8);
+
+    return;
+}
+
+void CNullIMGUIDriver::updateFontTexture(IGUITexture *const pGUITexture) {
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
+
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
+
+    NullHelper::setTextureFromGUIFont(pRealGUITexture);
+
+    return;
+}
+
+void CNullIMGUIDriver::updateFontTextureRegion(IGUITexture *const, unsigned int const, unsigned int const, unsigned int const, unsigned int const, unsigned char const *const) {
+    // the NULL driver has no texture memory
+    return;
+}
+
+void CNullIMGUIDriver::deleteTexture(IGUITexture *const pGUITexture) {
+    CGUITextureTable &rTextureTable = CGUITextureTable::getInstance();
+    CGUITexture *const pRealGUITexture = rTextureTable.getTexture(pGUITexture);
+
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
+
+    rTextureTable.deleteTexture(pRealGUITexture);
+    mTextureInstances--;
+    return;
+}
+
+namespace NullHelper {
+CGUITexture *createTexture(TextureSourceType const SourceType, unsigned int const Width, unsigned int const Height, EColorFormat const ColorFormat) {
+    CGUITextureTable &rTextureTable = CGUITextureTable::getInstance();
+    CGUITexture *const pGUITexture = rTextureTable.createTexture();
+
+    if(pGUITexture == nullptr) {
+        return nullptr;
+    }
+
+    pGUITexture->mIsUsingOwnMemory = false;
+    pGUITexture->mSourceType       = SourceType;
+    pGUITexture->mSource.RawDataID = nullptr;
+    rTextureTable.setGPUTexture(pGUITexture, DummyTextureID, Width, Height, ColorFormat);
+
+    return pGUITexture;
+}
+
+void setTextureFromGUIFont(CGUITexture *const pGUITexture) {
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+
+    // the fonts must be build, even when they are not drawn
+    unsigned char *pPixelData;
+    int Width, Height;
+    rGUIIO.Fonts->GetTexDataAsAlpha8(&pPixelData, &Width, &Height);
+    rGUIIO.Fonts->ClearTexData();
+
+    pGUITexture->mSourceType       = ETST_GUIFONT;
+    pGUITexture->mSource.GUIFontID = 0;
+
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, DummyTextureID, Width, Height, ECF_A8);
+    rGUIIO.Fonts->TexID = pGUITexture->getTextureID();
+
+    return;
+}
+}
+
+}
+}
+}
@@ -18,7 +18,9 @@
 // module includes
 #include "COpenGLIMGUIDriver.h"
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/IrrIMGUITrace_priv.h"
 #include "private/CGUITexture.h"
+#include "private/CGUITextureTable.h"
 
 namespace IrrIMGUI {
 namespace Private {
@@ -30,6 +32,32 @@ namespace OpenGLHelper {
 /// @param pGUITexture Is a CGUITexture object where the GPU memory should be deleted from.
 void deleteTextureFromMemory(CGUITexture *pGUITexture);
 
+/// @brief Creates the GPU memory of a GUI texture from raw data.
+/// @param pDevice     Is a pointer to the Irrlicht device.
+/// @param pGUITexture Is a pointer to the GUI texture, whose GPU memory has already been deleted.
+/// @param ColorFormat Is the used Color Format inside the raw data.
+/// @param pPixelData  Is a pointer to the image array.
+/// @param Width       Is the number of X pixels.
+/// @param Height      Is the number of Y pixels.
+void setTextureFromRawData(irr::IrrlichtDevice *pDevice, CGUITexture *pGUITexture, EColorFormat ColorFormat, unsigned char *pPixelData, unsigned int Width, unsigned int Height);
+
+/// @brief Sets the GPU memory of a GUI texture to the memory of an ITexture object or to a copy of it.
+/// @param pDevice     Is a pointer to the Irrlicht device.
+/// @param pGUITexture Is a pointer to the GUI texture, whose GPU memory has already been deleted.
+/// @param pTexture    Is a pointer to a ITexture object.
+void setTextureFromIrrlichtTexture(irr::IrrlichtDevice *pDevice, CGUITexture *pGUITexture, irr::video::ITexture *pTexture);
+
+/// @brief Creates the GPU memory of a GUI texture from an IImage object.
+/// @param pDevice     Is a pointer to the Irrlicht device.
+/// @param pGUITexture Is a pointer to the GUI texture, whose GPU memory has already been deleted.
+/// @param pImage      Is a pointer to a IImage object.
+void setTextureFromIrrlichtImage(irr::IrrlichtDevice *pDevice, CGUITexture *pGUITexture, irr::video::IImage *pImage);
+
+/// @brief Creates the GPU memory of a GUI texture from the current loaded GUI Fonts and uses it as font texture.
+/// @param pDevice     Is a pointer to the Irrlicht device.
+/// @param pGUITexture Is a pointer to the GUI texture, whose GPU memory has already been deleted.
+void setTextureFromGUIFont(irr::IrrlichtDevice *pDevice, CGUITexture *pGUITexture);
+
 /// @brief Copies the current loaded GUI Fonts into the GPU memory.
 /// @return Returns a GPU memory ID.
 ImTextureID copyTextureIDFromGUIFont(void);
@@ -99,7 +127,6 @@ private:
 
 COpenGLIMGUIDriver::COpenGLIMGUIDriver(irr::IrrlichtDevice *const pDevice):
     IIMGUIDriver(pDevice) {
-    setupFunctionPointer();
     LOG_WARNING("{IrrIMGUI-GL} Start native OpenGL GUI renderer. This renderer is just a test and fall-back solution and it is not officially supported.\n");
     return;
 }
@@ -135,6 +162,7 @@ void COpenGLIMGUIDriver::drawCommandList(ImDrawList *const pCommandList) {
     ImDrawVert *const pVertexBuffer = &(pCommandList->VtxBuffer.front());
     ImDrawIdx   *const pIndexBuffer  = &(pCommandList->IdxBuffer.front());
     int FirstIndexElement = 0;
+    CGUITextureTable const &rTextureTable = CGUITextureTable::getInstance();
 
     glVertexPointer(2, GL_FLOAT,         sizeof(ImDrawVert), (void *)(((unsigned char *)pVertexBuffer) + OFFSETOF(ImDrawVert, pos)));
     glTexCoordPointer(2, GL_FLOAT,         sizeof(ImDrawVert), (void *)(((unsigned char *)pVertexBuffer) + OFFSETOF(ImDrawVert, uv)));
@@ -147,10 +175,25 @@ void COpenGLIMGUIDriver::drawCommandList(ImDrawList *const pCommandList) {
         if(pCommand->UserCallback) {
             pCommand->UserCallback(pCommandList, pCommand);
         } else {
-            CGUITexture *const pGUITexture = reinterpret_cast<CGUITexture *>(pCommand->TextureId);
-            glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pGUITexture->mGPUTextureID);
-            glScissor((int)pCommand->ClipRect.x, (int)(FrameBufferHeight - pCommand->ClipRect.w), (int)(pCommand->ClipRect.z - pCommand->ClipRect.x), (int)(pCommand->ClipRect.w - pCommand->ClipRect.y));
-            glDrawElements(GL_TRIANGLES, (GLsizei)pCommand->ElemCount, GL_UNSIGNED_SHORT, &(pIndexBuffer[FirstIndexElement]));
+            // GUI textures use handles of the texture table, other texture IDs are OpenGL texture names
+            bool const IsHandle = CGUITextureTable::isHandle(pCommand->TextureId);
+            ImTextureID const GPUTextureID = IsHandle ? rTextureTable.getGPUTextureID(pCommand->TextureId) : pCommand->TextureId;
+
+            if(IsHandle && (GPUTextureID == nullptr)) {
+                LOG_ERROR("{IrrIMGUI-GL} The texture " << std::hex << pCommand->TextureId << " of a draw command has already been deleted!\n");
+            } else {
+                // without shader the glyphs of a distance field font atlas are cut at their outline (hard edges, but sharp at every scale)
+                if((rGUIIO.Fonts->TexGlyphSDFSpread > 0) && (pCommand->TextureId == rGUIIO.Fonts->TexID)) {
+                    glEnable(GL_ALPHA_TEST);
+                    glAlphaFunc(GL_GEQUAL, 0.5f);
+                } else {
+                    glDisable(GL_ALPHA_TEST);
+                }
+
+                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)GPUTextureID);
+                glScissor((int)pCommand->ClipRect.x, (int)(FrameBufferHeight - pCommand->ClipRect.w), (int)(pCommand->ClipRect.z - pCommand->ClipRect.x), (int)(pCommand->ClipRect.w - pCommand->ClipRect.y));
+                glDrawElements(GL_TRIANGLES, (GLsizei)pCommand->ElemCount, GL_UNSIGNED_SHORT, &(pIndexBuffer[FirstIndexElement]));
+            }
         }
 
         FirstIndexElement += pCommand->ElemCount;
@@ -201,104 +244,63 @@ void COpenGLIMGUIDriver::drawGUIList(ImDrawData *const pDrawData) {
 
 
 IGUITexture *COpenGLIMGUIDriver::createTexture(EColorFormat ColorFormat, unsigned char *pPixelData, unsigned int Width, unsigned int Height) {
-    mTextureInstances++;
-    CGUITexture *const pRealGUITexture = new CGUITexture();
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    pRealGUITexture->mIsUsingOwnMemory = true;
-    pRealGUITexture->mSourceType       = ETST_RAWDATA;
-    pRealGUITexture->mSource.RawDataID = pPixelData;
-    pRealGUITexture->mIsValid          = true;
-
-    if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-        pRealGUITexture->mGPUTextureID = OpenGLHelper::createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height);
-    } else {
-        pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
+    if(pRealGUITexture == nullptr) {
+        return nullptr;
     }
 
+    mTextureInstances++;
+    OpenGLHelper::setTextureFromRawData(this->getIrrDevice(), pRealGUITexture, ColorFormat, pPixelData, Width, Height);
+
     return pRealGUITexture;
 }
 
 IGUITexture *COpenGLIMGUIDriver::createTexture(irr::video::ITexture *pTexture) {
-    mTextureInstances++;
-    CGUITexture *const pRealGUITexture = new CGUITexture();
-
-#ifdef _IRRIMGUI_FAST_OPENGL_TEXTURE_HANDLE_
-    pRealGUITexture->mIsUsingOwnMemory = false;
-    pRealGUITexture->mSourceType       = ETST_TEXTURE;
-    pRealGUITexture->mSource.TextureID = pTexture;
-    pRealGUITexture->mIsValid          = true;
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-        pRealGUITexture->mGPUTextureID = OpenGLHelper::getTextureIDFromIrrlichtTexture(pTexture);
-    } else {
-        pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
+    if(pRealGUITexture == nullptr) {
+        return nullptr;
     }
-#else
-    pRealGUITexture->mIsUsingOwnMemory = true;
-    pRealGUITexture->mSourceType       = ETST_TEXTURE;
-    pRealGUITexture->mSource.TextureID = pTexture;
-    pRealGUITexture->mIsValid          = true;
 
-    if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-        pRealGUITexture->mGPUTextureID = OpenGLHelper::copyTextureIDFromIrrlichtTexture(pTexture);
-    } else {
-        pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
-    }
-#endif
+    mTextureInstances++;
+    OpenGLHelper::setTextureFromIrrlichtTexture(this->getIrrDevice(), pRealGUITexture, pTexture);
+
     return pRealGUITexture;
 }
 
 IGUITexture *COpenGLIMGUIDriver::createTexture(irr::video::IImage *pImage) {
-    mTextureInstances++;
-    CGUITexture *const pGUITexture = new CGUITexture();
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().createTexture();
 
-    pGUITexture->mIsUsingOwnMemory = true;
-    pGUITexture->mSourceType       = ETST_IMAGE;
-    pGUITexture->mSource.ImageID   = pImage;
-    pGUITexture->mIsValid          = true;
-
-    if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-        pGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromIrrlichtImage(pImage);
-    } else {
-        pGUITexture->mGPUTextureID = (ImTextureID)0x1;
+    if(pRealGUITexture == nullptr) {
+        return nullptr;
     }
 
-    return pGUITexture;
-}
-
-IGUITexture *COpenGLIMGUIDriver::createFontTexture(void) {
     mTextureInstances++;
-    CGUITexture *const pGUITexture = new CGUITexture();
-
-    pGUITexture->mIsUsingOwnMemory = true;
-    pGUITexture->mSourceType       = ETST_GUIFONT;
-    pGUITexture->mSource.GUIFontID = 0;
-    pGUITexture->mIsValid          = true;
+    OpenGLHelper::setTextureFromIrrlichtImage(this->getIrrDevice(), pRealGUITexture, pImage);
 
-    if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-        pGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromGUIFont();
-    } else {
-        ImGuiIO &rGUIIO  = ImGui::GetIO();
+    return pRealGUITexture;
+}
 
-        unsigned char *pPixelData;
-        int Width, Height;
-        rGUIIO.Fonts->GetTexDataAsAlpha8(&pPixelData, &Width, &Height);
-        rGUIIO.Fonts->ClearTexData();
+IGUITexture *COpenGLIMGUIDriver::createFontTexture(void) {
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().createTexture();
 
-        pGUITexture->mGPUTextureID = (ImTextureID)0x1;
+    if(pRealGUITexture == nullptr) {
+        return nullptr;
     }
 
+    mTextureInstances++;
+    OpenGLHelper::setTextureFromGUIFont(this->getIrrDevice(), pRealGUITexture);
 
-    void *const pFontTexture = reinterpret_cast<void *>(pGUITexture);
-    ImGui::GetIO().Fonts->TexID = pFontTexture;
-
-    return pGUITexture;
+    return pRealGUITexture;
 }
 
 void COpenGLIMGUIDriver::updateTexture(IGUITexture *pGUITexture, EColorFormat ColorFormat, unsigned char *pPixelData, unsigned int Width, unsigned int Height) {
-    CGUITexture *const pRealGUITexture = dynamic_cast<CGUITexture *>(pGUITexture);
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
 
-    FASSERT(pRealGUITexture->mIsValid);
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
 
     bool IsRecreateNecessary = false;
 
@@ -315,25 +317,18 @@ void COpenGLIMGUIDriver::updateTexture(IGUITexture *pGUITexture, EColorFormat Co
             OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
         }
 
-        pRealGUITexture->mIsUsingOwnMemory = true;
-        pRealGUITexture->mSourceType       = ETST_RAWDATA;
-        pRealGUITexture->mSource.RawDataID = pPixelData;
-        pRealGUITexture->mIsValid          = true;
-
-        if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-            pRealGUITexture->mGPUTextureID     = OpenGLHelper::createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height);
-        } else {
-            pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
-        }
+        OpenGLHelper::setTextureFromRawData(this->getIrrDevice(), pRealGUITexture, ColorFormat, pPixelData, Width, Height);
     }
 
     return;
 }
 
 void COpenGLIMGUIDriver::updateTexture(IGUITexture *pGUITexture, irr::video::ITexture *pTexture) {
-    CGUITexture *const pRealGUITexture = dynamic_cast<CGUITexture *>(pGUITexture);
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
 
-    FASSERT(pRealGUITexture->mIsValid);
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
 
     bool IsRecreateNecessary = false;
 
@@ -350,38 +345,18 @@ void COpenGLIMGUIDriver::updateTexture(IGUITexture *pGUITexture, irr::video::ITe
             OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
         }
 
-#ifdef _IRRIMGUI_FAST_OPENGL_TEXTURE_HANDLE_
-        pRealGUITexture->mIsUsingOwnMemory = false;
-        pRealGUITexture->mSourceType       = ETST_TEXTURE;
-        pRealGUITexture->mSource.TextureID = pTexture;
-        pRealGUITexture->mIsValid          = true;
-
-        if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-            pRealGUITexture->mGPUTextureID = OpenGLHelper::getTextureIDFromIrrlichtTexture(pTexture);
-        } else {
-            pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
-        }
-#else
-        pRealGUITexture->mIsUsingOwnMemory = true;
-        pRealGUITexture->mSourceType       = ETST_TEXTURE;
-        pRealGUITexture->mSource.TextureID = pTexture;
-        pRealGUITexture->mIsValid          = true;
-
-        if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-            pRealGUITexture->mGPUTextureID = OpenGLHelper::copyTextureIDFromIrrlichtTexture(pTexture);
-        } else {
-            pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
-        }
-#endif
+        OpenGLHelper::setTextureFromIrrlichtTexture(this->getIrrDevice(), pRealGUITexture, pTexture);
     }
 
     return;
 }
 
 void COpenGLIMGUIDriver::updateTexture(IGUITexture *pGUITexture, irr::video::IImage *pImage) {
-    CGUITexture *const pRealGUITexture = dynamic_cast<CGUITexture *>(pGUITexture);
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
 
-    FASSERT(pRealGUITexture->mIsValid);
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
 
     bool IsRecreateNecessary = false;
 
@@ -398,67 +373,141 @@ void COpenGLIMGUIDriver::updateTexture(IGUITexture *pGUITexture, irr::video::IIm
             OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
         }
 
-        pRealGUITexture->mIsUsingOwnMemory = true;
-        pRealGUITexture->mSourceType       = ETST_IMAGE;
-        pRealGUITexture->mSource.ImageID   = pImage;
-        pRealGUITexture->mIsValid          = true;
-
-        if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-            pRealGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromIrrlichtImage(pImage);
-        } else {
-            pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
-        }
+        OpenGLHelper::setTextureFromIrrlichtImage(this->getIrrDevice(), pRealGUITexture, pImage);
     }
 
     return;
 }
 
 void COpenGLIMGUIDriver::updateFontTexture(IGUITexture *const pGUITexture) {
-    CGUITexture *const pRealGUITexture = dynamic_cast<CGUITexture *>(pGUITexture);
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
 
-    FASSERT(pRealGUITexture->mIsValid);
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
 
     OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
+    OpenGLHelper::setTextureFromGUIFont(this->getIrrDevice(), pRealGUITexture);
 
-    pRealGUITexture->mIsUsingOwnMemory = true;
-    pRealGUITexture->mSourceType       = ETST_GUIFONT;
-    pRealGUITexture->mSource.GUIFontID = 0;
-    pRealGUITexture->mIsValid          = true;
-
-    if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
-        pRealGUITexture->mGPUTextureID     = OpenGLHelper::copyTextureIDFromGUIFont();
-    } else {
-        ImGuiIO &rGUIIO  = ImGui::GetIO();
+    return;
+}
 
-        unsigned char *pPixelData;
-        int Width, Height;
-        rGUIIO.Fonts->GetTexDataAsAlpha8(&pPixelData, &Width, &Height);
-        rGUIIO.Fonts->ClearTexData();
+void COpenGLIMGUIDriver::updateFontTextureRegion(IGUITexture *const pGUITexture, unsigned int const X, unsigned int const Y, unsigned int const Width, unsigned int const Height, unsigned char const *const pPixelData) {
+    CGUITexture *const pRealGUITexture = CGUITextureTable::getInstance().getTexture(pGUITexture);
 
-        pRealGUITexture->mGPUTextureID = (ImTextureID)0x1;
+    if((pRealGUITexture == nullptr) || (this->getIrrDevice()->getVideoDriver()->getDriverType() == irr::video::EDT_NULL)) {
+        return;
     }
 
-    void *const pFontTexture = reinterpret_cast<void *>(pGUITexture);
-    ImGui::GetIO().Fonts->TexID = pFontTexture;
+    TRACE_SCOPE_ARG("TextureUpload", "pixels", Width * Height);
+
+    OpenGLHelper::COpenGLState OpenGLState;
+
+    GLint OldUnpackAlignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &OldUnpackAlignment);
+
+    GLuint const TextureID = static_cast<GLuint>(reinterpret_cast<intptr_t>(pRealGUITexture->getGPUTextureID()));
+    glBindTexture(GL_TEXTURE_2D, TextureID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, X, Y, Width, Height, GL_ALPHA, GL_UNSIGNED_BYTE, pPixelData);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, OldUnpackAlignment);
 
     return;
 }
 
 void COpenGLIMGUIDriver::deleteTexture(IGUITexture *pGUITexture) {
-    CGUITexture *const pRealGUITexture = dynamic_cast<CGUITexture *>(pGUITexture);
+    CGUITextureTable &rTextureTable = CGUITextureTable::getInstance();
+    CGUITexture *const pRealGUITexture = rTextureTable.getTexture(pGUITexture);
 
-    FASSERT(pRealGUITexture->mIsValid);
+    if(pRealGUITexture == nullptr) {
+        return;
+    }
 
     if(this->getIrrDevice()->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
         OpenGLHelper::deleteTextureFromMemory(pRealGUITexture);
     }
 
-    delete(pRealGUITexture);
+    rTextureTable.deleteTexture(pRealGUITexture);
     mTextureInstances--;
     return;
 }
 
 namespace OpenGLHelper {
+void setTextureFromRawData(irr::IrrlichtDevice *const pDevice, CGUITexture *const pGUITexture, EColorFormat const ColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
+    pGUITexture->mIsUsingOwnMemory = true;
+    pGUITexture->mSourceType       = ETST_RAWDATA;
+    pGUITexture->mSource.RawDataID = pPixelData;
+
+    ImTextureID GPUTextureID = (ImTextureID)0x1;
+    if(pDevice->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
+        GPUTextureID = createTextureIDFromRawData(ColorFormat, pPixelData, Width, Height);
+    }
+
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, Width, Height, (ColorFormat == ECF_A8) ? ECF_A8 : ECF_R8G8B8A8);
+    return;
+}
+
+void setTextureFromIrrlichtTexture(irr::IrrlichtDevice *const pDevice, CGUITexture *const pGUITexture, irr::video::ITexture *const pTexture) {
+    pGUITexture->mSourceType       = ETST_TEXTURE;
+    pGUITexture->mSource.TextureID = pTexture;
+
+    ImTextureID GPUTextureID = (ImTextureID)0x1;
+
+#ifdef _IRRIMGUI_FAST_OPENGL_TEXTURE_HANDLE_
+    pGUITexture->mIsUsingOwnMemory = false;
+
+    if(pDevice->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
+        GPUTextureID = getTextureIDFromIrrlichtTexture(pTexture);
+    }
+#else
+    pGUITexture->mIsUsingOwnMemory = true;
+
+    if(pDevice->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
+        GPUTextureID = copyTextureIDFromIrrlichtTexture(pTexture);
+    }
+#endif
+
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, pTexture->getSize().Width, pTexture->getSize().Height, ECF_R8G8B8A8);
+    return;
+}
+
+void setTextureFromIrrlichtImage(irr::IrrlichtDevice *const pDevice, CGUITexture *const pGUITexture, irr::video::IImage *const pImage) {
+    pGUITexture->mIsUsingOwnMemory = true;
+    pGUITexture->mSourceType       = ETST_IMAGE;
+    pGUITexture->mSource.ImageID   = pImage;
+
+    ImTextureID GPUTextureID = (ImTextureID)0x1;
+    if(pDevice->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
+        GPUTextureID = copyTextureIDFromIrrlichtImage(pImage);
+    }
+
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, pImage->getDimension().Width, pImage->getDimension().Height, ECF_R8G8B8A8);
+    return;
+}
+
+void setTextureFromGUIFont(irr::IrrlichtDevice *const pDevice, CGUITexture *const pGUITexture) {
+    pGUITexture->mIsUsingOwnMemory = true;
+    pGUITexture->mSourceType       = ETST_GUIFONT;
+    pGUITexture->mSource.GUIFontID = 0;
+
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+    ImTextureID GPUTextureID = (ImTextureID)0x1;
+
+    if(pDevice->getVideoDriver()->getDriverType() != irr::video::EDT_NULL) {
+        GPUTextureID = copyTextureIDFromGUIFont();
+    } else {
+        unsigned char *pPixelData;
+        int Width, Height;
+        rGUIIO.Fonts->GetTexDataAsAlpha8(&pPixelData, &Width, &Height);
+        rGUIIO.Fonts->ClearTexData();
+    }
+
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, GPUTextureID, rGUIIO.Fonts->TexWidth, rGUIIO.Fonts->TexHeight, ECF_A8);
+    rGUIIO.Fonts->TexID = pGUITexture->getTextureID();
+
+    return;
+}
+
 void copyARGBImageToRGBA(unsigned int *const pSource, unsigned int *const pDestination, unsigned int const Width, unsigned int const Height) {
     for(unsigned int X = 0; X < Width; X++) {
         for(unsigned int Y = 0; Y < Height; Y++) {
@@ -473,6 +522,8 @@ void copyARGBImageToRGBA(unsigned int *const pSource, unsigned int *const pDesti
 }
 
 ImTextureID createTextureInMemory(GLint OpenGLColorFormat, unsigned char *const pPixelData, unsigned int const Width, unsigned int const Height) {
+    TRACE_SCOPE_ARG("TextureUpload", "pixels", Width * Height);
+
     // Store current Texture handle
     GLint OldTextureID;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &OldTextureID);
@@ -641,11 +692,12 @@ ImTextureID copyTextureIDFromGUIFont(void) {
 
 void deleteTextureFromMemory(CGUITexture *pGUITexture) {
     if(pGUITexture->mIsUsingOwnMemory) {
-        LOG_NOTE("{IrrIMGUI-GL} Delete GPU memory. Handle: " << std::hex << pGUITexture->mGPUTextureID << "\n");
-        GLuint TextureID = static_cast<GLuint>(reinterpret_cast<intptr_t>(pGUITexture->mGPUTextureID));
+        ImTextureID const GPUTextureID = pGUITexture->getGPUTextureID();
+        LOG_NOTE("{IrrIMGUI-GL} Delete GPU memory. Handle: " << std::hex << GPUTextureID << "\n");
+        GLuint TextureID = static_cast<GLuint>(reinterpret_cast<intptr_t>(GPUTextureID));
         glDeleteTextures(1, &TextureID);
     }
-    pGUITexture->mIsValid = false;
+    CGUITextureTable::getInstance().setGPUTexture(pGUITexture, nullptr, 0, 0, ECF_A8R8G8B8);
     return;
 }
 
@@ -49,7 +49,7 @@ private:
     /// @name Methods used for setup.
 
     /// @brief Setups the IMGUI function pointer.
-    void setupFunctionPointer(void);
+    virtual void setupFunctionPointer(void);
 
     /// @}
 
@@ -113,6 +113,15 @@ private:
     /// @param pGUITexture Is a pointer to the GUI texture object.
     virtual void updateFontTexture(IGUITexture *pGUITexture);
 
+    /// @brief Updates a rectangle of the font texture with the pixels of the font atlas (used for dynamic glyphs).
+    /// @param pGUITexture Is a pointer to the GUI texture object of the fonts.
+    /// @param X           Is the X position of the rectangle.
+    /// @param Y           Is the Y position of the rectangle.
+    /// @param Width       Is the number of Pixels in X direction.
+    /// @param Height      Is the number of Pixels in Y direction.
+    /// @param pPixelData  Is a pointer to the alpha values of the rectangle without any padding between the rows.
+    virtual void updateFontTextureRegion(IGUITexture *pGUITexture, unsigned int X, unsigned int Y, unsigned int Width, unsigned int Height, unsigned char const *pPixelData);
+
     /**
      * @brief Deletes an texture from graphic memory.
      * @param pGUITexture Is a pointer to the texture to delete. Do not use it afterwards!
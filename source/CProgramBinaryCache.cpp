@@ -0,0 +1,148 @@
+/**
+ * @file   CProgramBinaryCache.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a file cache for linked OpenGL shader programs.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// module includes
+#include "private/CProgramBinaryCache.h"
+#include "private/CAtomicFileWriter.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief Helper functions for the program binary cache.
+namespace ProgramCacheHelper {
+/// @brief The first bytes of a cache file.
+static char const Magic[4] = { 'I', 'I', 'P', 'B' };
+
+/// @brief The version of the file format.
+static uint32_t const Version = 1;
+
+/// @brief The largest program binary, that is accepted from a file.
+static uint32_t const MaxBinarySize = 64 * 1024 * 1024;
+
+/// @return Returns the 64 bit FNV-1a hash of a string.
+static uint64_t getHash(std::string const &rText) {
+    uint64_t Hash = 0xCBF29CE484222325ULL;
+
+    for(char const Character : rText) {
+        Hash ^= static_cast<unsigned char>(Character);
+        Hash *= 0x100000001B3ULL;
+    }
+
+    return Hash;
+}
+}
+
+CProgramBinaryCache::CProgramBinaryCache(char const *const pDirectory, std::string const &rKey):
+    mKey(rKey) {
+    char HashText[17];
+    std::snprintf(HashText, sizeof(HashText), "%016llx", static_cast<unsigned long long>(ProgramCacheHelper::getHash(rKey)));
+
+    mFileName = pDirectory;
+    if(!mFileName.empty() && (mFileName.back() != '/') && (mFileName.back() != '\\')) {
+        mFileName += '/';
+    }
+    mFileName += "IrrIMGUIProgram_";
+    mFileName += HashText;
+    mFileName += ".bin";
+
+    return;
+}
+
+CProgramBinaryCache::~CProgramBinaryCache(void) {
+    return;
+}
+
+bool CProgramBinaryCache::load(unsigned int &rFormat, std::vector<char> &rBinary) const {
+    using FileHelper::readValue;
+
+    std::ifstream File(mFileName.c_str(), std::ios::in | std::ios::binary);
+    if(!File.is_open()) {
+        return false;
+    }
+
+    char     Magic[4]   = {0};
+    uint32_t Version    = 0;
+    uint32_t KeySize    = 0;
+    uint32_t Format     = 0;
+    uint32_t BinarySize = 0;
+
+    File.read(Magic, sizeof(Magic));
+    readValue(File, Version);
+    readValue(File, KeySize);
+
+    if(!File || (std::memcmp(Magic, ProgramCacheHelper::Magic, sizeof(Magic)) != 0) || (Version != ProgramCacheHelper::Version) || (KeySize != mKey.size())) {
+        LOG_WARNING("{IrrIMGUI} The program cache file \"" << mFileName << "\" does not fit to the program, it is replaced.\n");
+        return false;
+    }
+
+    std::string Key(KeySize, '\0');
+    File.read(&Key[0], KeySize);
+    readValue(File, Format);
+    readValue(File, BinarySize);
+
+    if(!File || (Key != mKey) || (BinarySize == 0) || (BinarySize > ProgramCacheHelper::MaxBinarySize)) {
+        LOG_WARNING("{IrrIMGUI} The program cache file \"" << mFileName << "\" does not fit to the program, it is replaced.\n");
+        return false;
+    }
+
+    rBinary.resize(BinarySize);
+    File.read(rBinary.data(), BinarySize);
+
+    if(!File) {
+        LOG_WARNING("{IrrIMGUI} The program cache file \"" << mFileName << "\" is incomplete, it is replaced.\n");
+        return false;
+    }
+
+    rFormat = Format;
+    return true;
+}
+
+bool CProgramBinaryCache::store(unsigned int const Format, void const *const pBinary, size_t const Size) const {
+    using FileHelper::writeValue;
+
+    // other processes never read an incomplete file
+    CAtomicFileWriter Writer(mFileName);
+    if(!Writer.isOpen()) {
+        LOG_WARNING("{IrrIMGUI} Cannot write the program cache file \"" << mFileName << "\".\n");
+        return false;
+    }
+
+    std::ofstream &rFile = Writer.getStream();
+    rFile.write(ProgramCacheHelper::Magic, sizeof(ProgramCacheHelper::Magic));
+    writeValue(rFile, ProgramCacheHelper::Version);
+    writeValue(rFile, static_cast<uint32_t>(mKey.size()));
+    rFile.write(mKey.data(), mKey.size());
+    writeValue(rFile, static_cast<uint32_t>(Format));
+    writeValue(rFile, static_cast<uint32_t>(Size));
+    rFile.write(static_cast<char const *>(pBinary), Size);
+
+    if(!Writer.commit()) {
+        LOG_WARNING("{IrrIMGUI} Cannot write the program cache file \"" << mFileName << "\".\n");
+        return false;
+    }
+
+    return true;
+}
+
+}
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,248 @@
+/**
+ * @file   CTraceWriter.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a writer, that streams trace events into a Chrome trace file.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// library includes
+#include <chrono>
+#include <iomanip>
+
+// module includes
+#include <IrrIMGUI/IrrIMGUITrace.h>
+#include <IrrIMGUI/CIMGUIFrameTimer.h>
+#include "private/CTraceWriter.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/// @brief The time between two writes of the background thread.
+static std::chrono::milliseconds const WriteInterval(100);
+
+/// @brief When more events are pending, the background thread is woken up before the interval ends.
+static size_t const MaxPendingEvents = 4096;
+
+CTraceWriter::CTraceWriter(void):
+    mStartNanoseconds(0),
+    mIsRunning(false),
+    mIsStopRequested(false),
+    mIsFirstEvent(true) {
+    return;
+}
+
+CTraceWriter::~CTraceWriter(void) {
+    stop();
+    return;
+}
+
+bool CTraceWriter::start(char const *const pFileName) {
+    std::lock_guard<std::mutex> ControlLock(mControlMutex);
+
+    if(mIsRunning) {
+        LOG_ERROR("{IrrIMGUI} Cannot start a trace, since another trace is already running!\n");
+        return false;
+    }
+
+    mFile.open(pFileName, std::ios::out | std::ios::trunc);
+    if(!mFile.is_open()) {
+        LOG_ERROR("{IrrIMGUI} Cannot open the trace file \"" << pFileName << "\"!\n");
+        return false;
+    }
+
+    mFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mPendingEvents.clear();
+        mStartNanoseconds = CIMGUIFrameTimer::getSystemNanoseconds();
+        mIsFirstEvent     = true;
+        mIsStopRequested  = false;
+        mIsRunning        = true;
+    }
+
+    mThread = std::thread(&CTraceWriter::writerLoop, this);
+    Trace::IsTraceEnabled.store(true);
+
+    return true;
+}
+
+void CTraceWriter::stop(void) {
+    std::lock_guard<std::mutex> ControlLock(mControlMutex);
+
+    if(!mIsRunning) {
+        return;
+    }
+
+    Trace::IsTraceEnabled.store(false);
+
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mIsStopRequested = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+
+    mFile << "\n]}\n";
+    mFile.close();
+
+    // release the memory of the event lists, the next trace might be far away
+    std::vector<STraceEvent>().swap(mPendingEvents);
+    std::vector<STraceEvent>().swap(mWrittenEvents);
+
+    return;
+}
+
+void CTraceWriter::addEvent(STraceEvent const &rEvent) {
+    bool IsWakeUpNecessary = false;
+
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+
+        // events of scopes, that have been started before the trace has been stopped
+        if(!mIsRunning || mIsStopRequested) {
+            return;
+        }
+
+        mPendingEvents.push_back(rEvent);
+        IsWakeUpNecessary = (mPendingEvents.size() == MaxPendingEvents);
+    }
+
+    if(IsWakeUpNecessary) {
+        mCondition.notify_all();
+    }
+
+    return;
+}
+
+void CTraceWriter::writerLoop(void) {
+    bool IsStopped = false;
+
+    while(!IsStopped) {
+        {
+            std::unique_lock<std::mutex> Lock(mMutex);
+            mCondition.wait_for(Lock, WriteInterval, [this] { return mIsStopRequested || (mPendingEvents.size() >= MaxPendingEvents); });
+
+            mWrittenEvents.swap(mPendingEvents);
+            IsStopped = mIsStopRequested;
+            if(IsStopped) {
+                mIsRunning = false;
+            }
+        }
+
+        writeEvents(mWrittenEvents);
+        mWrittenEvents.clear();
+    }
+
+    mFile.flush();
+    return;
+}
+
+void CTraceWriter::writeEvents(std::vector<STraceEvent> const &rEvents) {
+    for(STraceEvent const &rEvent : rEvents) {
+        mFile << (mIsFirstEvent ? "\n" : ",\n");
+        mIsFirstEvent = false;
+
+        // events can start shortly before the trace has been started
+        irr::u64 const Start = (rEvent.mStartNanoseconds > mStartNanoseconds) ? (rEvent.mStartNanoseconds - mStartNanoseconds) : 0;
+        irr::u64 const Duration = (rEvent.mEndNanoseconds > rEvent.mStartNanoseconds) ? (rEvent.mEndNanoseconds - rEvent.mStartNanoseconds) : 0;
+
+        mFile << "{\"name\":";
+        writeString(rEvent.mpName);
+        mFile << ",\"cat\":\"IrrIMGUI\",\"ph\":\"X\",\"pid\":1,\"tid\":" << rEvent.mThreadID << ",\"ts\":";
+        writeMicroseconds(Start);
+        mFile << ",\"dur\":";
+        writeMicroseconds(Duration);
+
+        if(rEvent.mpArgumentName) {
+            mFile << ",\"args\":{";
+            writeString(rEvent.mpArgumentName);
+            mFile << ":" << rEvent.mArgumentValue << "}";
+        }
+
+        mFile << "}";
+    }
+
+    return;
+}
+
+void CTraceWriter::writeString(char const *const pString) {
+    mFile << '"';
+
+    for(char const *pCharacter = pString; *pCharacter; pCharacter++) {
+        char const Character = *pCharacter;
+
+        if((Character == '"') || (Character == '\\')) {
+            mFile << '\\' << Character;
+        } else if(static_cast<unsigned char>(Character) < 0x20) {
+            mFile << ' ';
+        } else {
+            mFile << Character;
+        }
+    }
+
+    mFile << '"';
+    return;
+}
+
+void CTraceWriter::writeMicroseconds(irr::u64 const Nanoseconds) {
+    mFile << (Nanoseconds / 1000) << '.' << std::setw(3) << std::setfill('0') << (Nanoseconds % 1000) << std::setfill(' ');
+    return;
+}
+
+/// @return Returns the writer, that is used by the trace functions.
+static CTraceWriter &getTraceWriter(void) {
+    static CTraceWriter Writer;
+    return Writer;
+}
+
+}
+
+namespace Trace {
+
+std::atomic<bool> IsTraceEnabled(false);
+
+/// @brief The next free thread ID for the trace.
+static std::atomic<unsigned int> NextThreadID(1);
+
+bool startTracing(char const *const pFileName) {
+    FASSERT(pFileName);
+    return Private::getTraceWriter().start(pFileName);
+}
+
+void stopTracing(void) {
+    Private::getTraceWriter().stop();
+    return;
+}
+
+void addTraceEvent(char const *const pName, char const *const pArgumentName, long long const ArgumentValue, irr::u64 const StartNanoseconds, irr::u64 const EndNanoseconds) {
+    static thread_local unsigned int const ThreadID = NextThreadID++;
+
+    Private::STraceEvent Event;
+    Event.mpName            = pName;
+    Event.mpArgumentName    = pArgumentName;
+    Event.mArgumentValue    = ArgumentValue;
+    Event.mStartNanoseconds = StartNanoseconds;
+    Event.mEndNanoseconds   = EndNanoseconds;
+    Event.mThreadID         = ThreadID;
+
+    Private::getTraceWriter().addEvent(Event);
+    return;
+}
+
+irr::u64 getTraceNanoseconds(void) {
+    return CIMGUIFrameTimer::getSystemNanoseconds();
+}
+
+}
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,173 @@
+/**
+ * @file   CWorkStealingPool.cpp
+ * @author Andre Netzeband
+ * @brief  Contains a thread pool that distributes tasks by work-stealing.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+// module includes
+#include "private/CWorkStealingPool.h"
+#include "private/IrrIMGUIDebug_priv.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+CWorkStealingPool::CWorkStealingPool(unsigned int NumberOfThreads):
+    mGeneration(0),
+    mIsStopped(false),
+    mOpenTasks(0) {
+    if(NumberOfThreads == 0) {
+        NumberOfThreads = std::thread::hardware_concurrency();
+    }
+
+    if(NumberOfThreads == 0) {
+        NumberOfThreads = 1;
+    }
+
+    for(unsigned int i = 0; i < NumberOfThreads; i++) {
+        mQueues.push_back(std::unique_ptr<SQueue>(new SQueue()));
+    }
+
+    // queue 0 belongs to the calling thread
+    for(unsigned int i = 1; i < NumberOfThreads; i++) {
+        mThreads.push_back(std::thread(&CWorkStealingPool::workerLoop, this, i));
+    }
+
+    return;
+}
+
+CWorkStealingPool::~CWorkStealingPool(void) {
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mIsStopped = true;
+    }
+    mStartCondition.notify_all();
+
+    for(std::thread &rThread : mThreads) {
+        rThread.join();
+    }
+
+    return;
+}
+
+unsigned int CWorkStealingPool::getNumberOfThreads(void) const {
+    return static_cast<unsigned int>(mQueues.size());
+}
+
+void CWorkStealingPool::run(std::vector<Task> const &rTasks) {
+    if(rTasks.empty()) {
+        return;
+    }
+
+    mOpenTasks = static_cast<unsigned int>(rTasks.size());
+
+    for(size_t i = 0; i < rTasks.size(); i++) {
+        SQueue &rQueue = *mQueues[i % mQueues.size()];
+        std::lock_guard<std::mutex> Lock(rQueue.mMutex);
+        rQueue.mTasks.push_back(&rTasks[i]);
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(mMutex);
+        mGeneration++;
+    }
+    mStartCondition.notify_all();
+
+    executeTasks(0);
+
+    std::unique_lock<std::mutex> Lock(mMutex);
+    mFinishCondition.wait(Lock, [this] { return mOpenTasks == 0; });
+
+    if(mException) {
+        std::exception_ptr const Exception = mException;
+        mException = nullptr;
+        std::rethrow_exception(Exception);
+    }
+
+    return;
+}
+
+void CWorkStealingPool::workerLoop(unsigned int const QueueIndex) {
+    unsigned int LastGeneration = 0;
+
+    while(true) {
+        {
+            std::unique_lock<std::mutex> Lock(mMutex);
+            mStartCondition.wait(Lock, [this, LastGeneration] { return mIsStopped || (mGeneration != LastGeneration); });
+
+            if(mIsStopped) {
+                break;
+            }
+
+            LastGeneration = mGeneration;
+        }
+
+        executeTasks(QueueIndex);
+    }
+
+    return;
+}
+
+void CWorkStealingPool::executeTasks(unsigned int const QueueIndex) {
+    while(Task const *const pTask = getTask(QueueIndex)) {
+        // an exception must not stop the thread, otherwise the task is never marked as done
+        try {
+            (*pTask)();
+        } catch(...) {
+            std::lock_guard<std::mutex> Lock(mMutex);
+            if(!mException) {
+                mException = std::current_exception();
+            }
+        }
+
+        if(--mOpenTasks == 0) {
+            std::lock_guard<std::mutex> Lock(mMutex);
+            mFinishCondition.notify_all();
+        }
+    }
+
+    return;
+}
+
+CWorkStealingPool::Task const *CWorkStealingPool::getTask(unsigned int const QueueIndex) {
+    unsigned int const NumberOfQueues = static_cast<unsigned int>(mQueues.size());
+    FASSERT(QueueIndex < NumberOfQueues);
+
+    // take the newest task from the own queue
+    {
+        SQueue &rQueue = *mQueues[QueueIndex];
+        std::lock_guard<std::mutex> Lock(rQueue.mMutex);
+
+        if(!rQueue.mTasks.empty()) {
+            Task const *const pTask = rQueue.mTasks.back();
+            rQueue.mTasks.pop_back();
+            return pTask;
+        }
+    }
+
+    // steal the oldest task from another queue
+    for(unsigned int i = 1; i < NumberOfQueues; i++) {
+        SQueue &rQueue = *mQueues[(QueueIndex + i) % NumberOfQueues];
+        std::lock_guard<std::mutex> Lock(rQueue.mMutex);
+
+        if(!rQueue.mTasks.empty()) {
+            Task const *const pTask = rQueue.mTasks.front();
+            rQueue.mTasks.pop_front();
+            return pTask;
+        }
+    }
+
+    return nullptr;
+}
+
+}
+}
+
+/**
+ * @}
+ */
@@ -7,14 +7,26 @@
 
 // library includes
 #include <iostream>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+#include <thread>
 
 // module includes
 #include <IrrIMGUI/IrrIMGUI.h>
 #include "IIMGUIDriver.h"
 #include "COpenGLIMGUIDriver.h"
 #include "CIrrlichtIMGUIDriver.h"
+#include "CNullIMGUIDriver.h"
+#include "private/CIMGUIBackendRegistry.h"
+#include "private/CDynamicGlyphCache.h"
+#include "private/CFontAtlasCache.h"
 #include "private/IrrIMGUIDebug_priv.h"
+#include "private/CGUITextureTable.h"
+#include "private/CWorkStealingPool.h"
+#include <IMGUI/imgui_internal.h>
 #include <IrrIMGUI/IrrIMGUIConstants.h>
+#include <IrrIMGUI/imgui_irrlicht.h>
 
 /**
  * @addtogroup IrrIMGUIPrivate
@@ -24,27 +36,51 @@
 namespace IrrIMGUI {
 namespace Private {
 
-IIMGUIDriver         *IIMGUIDriver::mpInstance = nullptr;
-unsigned int              IIMGUIDriver::mInstances = 0;
-irr::IrrlichtDevice *IIMGUIDriver::mpDevice   = nullptr;
-SIMGUISettings        IIMGUIDriver::mSettings;
-IGUITexture          *IIMGUIDriver::mpFontTexture = nullptr;
-unsigned int              IIMGUIDriver::mTextureInstances = 0;
+/// @brief Stores all driver instances (one per Irrlicht device).
+static std::vector<IIMGUIDriver *> DriverInstances;
 
-IIMGUIDriver::IIMGUIDriver(irr::IrrlichtDevice *const pDevice) {
-    LOG_NOTE("{IrrIMGUI} Create Singleton Instance of IIMGUIDriver.\n");
-    mInstances++;
-    mTextureInstances = 0;
+/// @brief Protects the list of driver instances, since GUI handles can be created and destroyed on different threads.
+static std::mutex DriverInstancesMutex;
+
+/// @brief Helper functions for building the font atlas with several threads.
+namespace FontThreadHelper {
+/// @brief The number of threads, that rasterize the glyphs of a font atlas built on this thread (see ImGuiParallelFor).
+static thread_local unsigned int NumberOfFontThreads = 1;
+
+/// @brief Sets the number of font threads of this thread for its lifetime.
+class CFontThreadScope {
+public:
+    /// @brief Constructor.
+    /// @param NumberOfThreads Is the number of threads (0 means one thread per CPU core).
+    CFontThreadScope(unsigned int const NumberOfThreads):
+        mPreviousNumberOfThreads(NumberOfFontThreads) {
+        NumberOfFontThreads = NumberOfThreads;
+    }
+
+    /// @brief Destructor. Restores the previous number of threads.
+    ~CFontThreadScope(void) {
+        NumberOfFontThreads = mPreviousNumberOfThreads;
+    }
+
+private:
+    unsigned int const mPreviousNumberOfThreads;
+};
+}
 
-    FASSERT(mInstances == 1);
+IIMGUIDriver::IIMGUIDriver(irr::IrrlichtDevice *const pDevice) {
+    LOG_NOTE("{IrrIMGUI} Create Instance of IIMGUIDriver.\n");
+    mInstances               = 0;
+    mTextureInstances        = 0;
+    mTakenOverAllocations    = 0;
+    mpFontTexture            = nullptr;
+    mBackend                 = EIB_NULL;
+    mIsPrepared              = false;
+    mNumberOfCompiledConfigs = 0;
+    mOpenFrames              = 0;
 
     pDevice->grab();
     mpDevice = pDevice;
 
-    setupMouseControl();
-    setupKeyControl();
-    updateSettings();
-
     return;
 }
 
@@ -57,67 +93,111 @@ IIMGUIDriver::~IIMGUIDriver(void) {
         LOG_ERROR("The Font Texture has not been deleted!\n");
     }
 
-    ImGui::GetIO().Fonts->Clear();
-    ImGui::Shutdown();
+    // the OpenGL objects of the binding can only be found over a context that uses this driver
+    if(ImGui::GetIO().UserData == &mRenderData) {
+        ImGui_ImplIrrlicht_InvalidateDeviceObjects();
+    }
+
+    deleteDynamicFonts();
+    mFontAtlas.Clear();
 
     mpDevice->drop();
     return;
 }
 
-IIMGUIDriver *IIMGUIDriver::getInstance(irr::IrrlichtDevice *const pDevice) {
+IIMGUIDriver *IIMGUIDriver::getInstance(irr::IrrlichtDevice *const pDevice, EIMGUIBackend const Backend) {
+    std::lock_guard<std::mutex> Lock(DriverInstancesMutex);
+
+    IIMGUIDriver *pInstance = nullptr;
+
+    for(IIMGUIDriver *const pDriver : DriverInstances) {
+        if(pDriver->mpDevice == pDevice) {
+            pInstance = pDriver;
+            break;
+        }
+    }
+
+    if(pInstance == nullptr) {
+        SBackendCapabilities const Capabilities = CIMGUIBackendRegistry::probeCapabilities(pDevice);
+        CIMGUIBackendRegistry::SBackend const &rBackend = CIMGUIBackendRegistry::selectBackend(Capabilities, Backend);
+
+        switch(rBackend.mBackend) {
+            case EIB_OPENGL3:
+                pInstance = new Driver::CIrrlichtIMGUIDriver(pDevice);
+                break;
 
-    if(mpInstance == nullptr) {
 #ifdef _IRRIMGUI_NATIVE_OPENGL_
-        irr::video::IVideoDriver *pDriver = pDevice->getVideoDriver();
-        irr::video::E_DRIVER_TYPE Type = pDriver->getDriverType();
-
-        switch(Type) {
-            case irr::video::EDT_NULL: // for unit testing
-            case irr::video::EDT_OPENGL:
-                mpInstance = new Driver::COpenGLIMGUIDriver(pDevice);
-                mpFontTexture = mpInstance->createFontTexture();
+            case EIB_OPENGL2:
+                pInstance = new Driver::COpenGLIMGUIDriver(pDevice);
+                break;
+#endif // _IRRIMGUI_NATIVE_OPENGL_
+
+            case EIB_NULL:
+                if(!Capabilities.mHasContext && !Capabilities.mIsHeadless) {
+                    LOG_WARNING("{IrrIMGUI} The Irrlicht device has no OpenGL context, the GUI is not drawn!\n");
+                }
+                pInstance = new Driver::CNullIMGUIDriver(pDevice);
                 break;
 
             default:
-                LOG_ERROR("Unknown driver type" << Type << "\n");
+                LOG_ERROR("{IrrIMGUI} Unknown renderer " << rBackend.mBackend << "!\n");
                 FASSERT(false);
                 break;
         }
-#else
 
-        mpInstance = new Driver::CIrrlichtIMGUIDriver(pDevice);
-        mpFontTexture = mpInstance->createFontTexture();
+        LOG_NOTE("{IrrIMGUI} Use renderer \"" << rBackend.mpName << "\".\n");
+
+        ASSERT(pInstance != nullptr);
 
-#endif
+        pInstance->mBackend = rBackend.mBackend;
+        pInstance->setupContext();
+        pInstance->mpFontTexture = pInstance->createFontTexture();
+        DriverInstances.push_back(pInstance);
+
+    } else {
+        pInstance->setupContext();
 
     }
 
-    ASSERT(mpInstance != nullptr);
+    pInstance->mInstances++;
 
-    return mpInstance;
+    return pInstance;
 }
 
-bool IIMGUIDriver::deleteInstance(void) {
+bool IIMGUIDriver::deleteInstance(IIMGUIDriver *const pDriver, int &rAllocations) {
+    std::lock_guard<std::mutex> Lock(DriverInstancesMutex);
+
     bool WasDeleted = false;
 
-    if(mpInstance != nullptr) {
-        LOG_NOTE("{IrrIMGUI} Delete Singleton Instance of IIMGUIDriver.\n");
+    std::vector<IIMGUIDriver *>::iterator const Iterator = std::find(DriverInstances.begin(), DriverInstances.end(), pDriver);
 
-        // delete font texture
-        mpInstance->deleteTexture(mpFontTexture);
-        mpFontTexture = nullptr;
+    if(Iterator == DriverInstances.end()) {
+        LOG_ERROR("{IrrIMGUI} Try to delete an unknown instance of IIMGUIDriver!\n");
 
-        // delete instance
-        delete(mpInstance);
-        mpInstance = nullptr;
-        mInstances = 0;
+    } else {
+        FASSERT(pDriver->mInstances > 0);
+        pDriver->mInstances--;
 
-        WasDeleted = true;
+        if(pDriver->mInstances == 0) {
+            LOG_NOTE("{IrrIMGUI} Delete Instance of IIMGUIDriver.\n");
 
-        if(ImGui::GetIO().MetricsAllocs != 0) {
-            if(mSettings.mIsIMGUIMemoryAllocationTrackingEnabled) {
-                LOG_ERROR("{IrrIMGUI} There are " << std::dec << ImGui::GetIO().MetricsAllocs << " allocated memory blocks that have not been deallocated so far!" << std::endl);
-            }
+            DriverInstances.erase(Iterator);
+
+            // delete font texture
+            pDriver->deleteTexture(pDriver->mpFontTexture);
+            pDriver->mpFontTexture = nullptr;
+
+            int const TakenOverAllocations = pDriver->mTakenOverAllocations;
+
+            // delete instance
+            delete(pDriver);
+
+            rAllocations = ImGui::GetIO().MetricsAllocs + TakenOverAllocations;
+            WasDeleted   = true;
+
+        } else {
+            pDriver->mTakenOverAllocations += rAllocations;
+            rAllocations = 0;
         }
     }
 
@@ -129,26 +209,72 @@ irr::IrrlichtDevice *IIMGUIDriver::getIrrDevice(void) {
     return mpDevice;
 }
 
-SIMGUISettings const &IIMGUIDriver::getSettings(void) {
-    return mSettings;
+ImFontAtlas *IIMGUIDriver::getFontAtlas(void) {
+    return &mFontAtlas;
+}
+
+CFontDataStore *IIMGUIDriver::getFontDataStore(void) {
+    return &mFontDataStore;
 }
 
-void IIMGUIDriver::setSettings(SIMGUISettings const &rSettings) {
-    mSettings = rSettings;
-    updateSettings();
+EIMGUIBackend IIMGUIDriver::getBackend(void) const {
+    return mBackend;
+}
+
+void IIMGUIDriver::setupContext(void) {
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+
+    rGUIIO.Fonts    = &mFontAtlas;
+    rGUIIO.UserData = &mRenderData;
+
+    setupFunctionPointer();
+    setupMouseControl();
+    setupKeyControl();
 
     return;
 }
 
-void IIMGUIDriver::updateSettings(void) {
+bool IIMGUIDriver::isPrepared(void) const {
+    return mIsPrepared;
+}
+
+bool IIMGUIDriver::prepare(SIMGUISettings const &rSettings) {
+    FontThreadHelper::CFontThreadScope const FontThreads(rSettings.mNumberOfFontThreads);
+    char const *pProgramCacheDirectory = rSettings.mpProgramCacheDirectory;
+    bool IsProgramFromCache = false;
+
+    if(!isPrepared()) {
+        // the NULL device has no context, whose programs could be cached
+        if(mpDevice->getVideoDriver()->getDriverType() == irr::video::EDT_NULL) {
+            pProgramCacheDirectory = nullptr;
+        }
+
+        if((mBackend == EIB_OPENGL3) && (mRenderData.FontTexture == 0)) {
+            // the shader renderer uploads the font atlas again
+            invalidateDynamicFonts();
+            setFontSDFSpread(rSettings.mFontSDFSpread);
+            buildFontAtlas(rSettings.mpFontCacheDirectory, rSettings.mFontDataPolicy);
+            ImGui_ImplIrrlicht_CreateDeviceObjectsCached(pProgramCacheDirectory, &IsProgramFromCache);
+            mNumberOfCompiledConfigs = mFontAtlas.ConfigData.Size;
+            buildDynamicFonts();
+        }
+
+        mIsPrepared = true;
+    }
+
+    return IsProgramFromCache;
+}
+
+void IIMGUIDriver::applySettings(SIMGUISettings const &rSettings) {
     ImGuiIO &rGUIIO = ImGui::GetIO();
-    if(mSettings.mIsGUIMouseCursorEnabled) {
+    if(rSettings.mIsGUIMouseCursorEnabled) {
         rGUIIO.MouseDrawCursor = true;
         mpDevice->getCursorControl()->setVisible(false);
     } else {
         rGUIIO.MouseDrawCursor = false;
         mpDevice->getCursorControl()->setVisible(true);
     }
+    rGUIIO.TextLayoutCacheSize = static_cast<int>(rSettings.mTextLayoutCacheSize);
 
     return;
 }
@@ -194,29 +320,326 @@ void IIMGUIDriver::setupKeyControl(void) {
     rGUIIO.KeyMap[ImGuiKey_Z]          = irr::KEY_KEY_Z;
 }
 
-void IIMGUIDriver::compileFonts(void) {
+void IIMGUIDriver::buildFontAtlas(char const *const pFontCacheDirectory, EFontDataPolicy const FontDataPolicy) {
+    if(mFontAtlas.TexPixelsAlpha8 != nullptr) {
+        return;
+    }
+
+    // without fonts the default font is added while building the atlas, thus it is not cached
+    if((pFontCacheDirectory == nullptr) || mFontAtlas.ConfigData.empty()) {
+        // the texture upload builds the atlas
+        mFontDataStore.materialize(mFontAtlas);
+        return;
+    }
+
+    CFontAtlasCache const FontCache(pFontCacheDirectory, mFontAtlas, &mFontDataStore);
+
+    if(FontCache.load(mFontAtlas)) {
+        LOG_NOTE("{IrrIMGUI} Loaded the font atlas from \"" << FontCache.getFileName() << "\".\n");
+    } else {
+        mFontDataStore.materialize(mFontAtlas);
+
+        // the TTF data is only released, when the atlas can be loaded again
+        if(!mFontAtlas.Build() || !FontCache.store(mFontAtlas)) {
+            return;
+        }
+    }
+
+    if(FontDataPolicy == EFDP_RELEASE_CACHED) {
+        unsigned int const ReleasedBytes = mFontDataStore.release(mFontAtlas);
+        if(ReleasedBytes > 0) {
+            LOG_NOTE("{IrrIMGUI} Released " << ReleasedBytes << " bytes of TTF data of the cached font atlas.\n");
+        }
+    }
+
+    return;
+}
+
+void IIMGUIDriver::compileFonts(SIMGUISettings const &rSettings) {
     FASSERT(mpFontTexture != nullptr);
 
-    updateFontTexture(mpFontTexture);
+    // the atlas is either built here or by the texture upload
+    FontThreadHelper::CFontThreadScope const FontThreads(rSettings.mNumberOfFontThreads);
+
+    invalidateDynamicFonts();
+    setFontSDFSpread(rSettings.mFontSDFSpread);
+
+    if(!appendFonts()) {
+        // pixels of an older atlas must not be used for the added fonts
+        mFontAtlas.ClearTexData();
+        buildFontAtlas(rSettings.mpFontCacheDirectory, rSettings.mFontDataPolicy);
+        updateFontTexture(mpFontTexture);
+    }
+
+    mNumberOfCompiledConfigs = mFontAtlas.ConfigData.Size;
+    buildDynamicFonts();
+
+    return;
+}
+
+void IIMGUIDriver::setFontSDFSpread(unsigned int const Spread) {
+    if(mFontAtlas.TexGlyphSDFSpread == static_cast<int>(Spread)) {
+        return;
+    }
+
+    // the glyphs of the compiled fonts have another padding and quad size, thus nothing can be appended
+    mFontAtlas.TexGlyphSDFSpread = static_cast<int>(Spread);
+    mFontAtlas.ClearTexData();
+    mNumberOfCompiledConfigs = 0;
+
+    for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+        pCache->updateCells(mFontAtlas);
+    }
 
     return;
 }
 
-/// @brief An helper class, that deletes the CIMGUIDriver instance when the program is closed and no other source has deleted it.
+bool IIMGUIDriver::appendFonts(void) {
+    if((mNumberOfCompiledConfigs == 0) || (mFontAtlas.ConfigData.Size <= mNumberOfCompiledConfigs)) {
+        return false;
+    }
+
+    // the shader renderer builds the whole atlas again, when it is prepared
+    if((mBackend == EIB_OPENGL3) && (mRenderData.FontTexture == 0)) {
+        return false;
+    }
+
+    // the compiled fonts are unloaded, when the atlas has been cleared in between
+    for(int i = 0; i < mNumberOfCompiledConfigs; i++) {
+        if(!mFontAtlas.ConfigData[i].DstFont->IsLoaded()) {
+            return false;
+        }
+    }
+
+    unsigned char *pPixels = nullptr;
+    int Y      = 0;
+    int Height = 0;
+    if(!ImFontAtlasBuildAppendWithStbTruetype(&mFontAtlas, mNumberOfCompiledConfigs, &pPixels, &Y, &Height)) {
+        LOG_NOTE("{IrrIMGUI} The added fonts do not fit into the font texture, the whole font atlas is built again.\n");
+        return false;
+    }
+
+    updateFontTextureRegion(mpFontTexture, 0, Y, mFontAtlas.TexWidth, Height, pPixels);
+
+    // the shader renderer has its own copy of the font atlas
+    if((mBackend == EIB_OPENGL3) && (mRenderData.FontTexture != 0)) {
+        ImGui_ImplIrrlicht_UpdateFontsTexture(0, Y, mFontAtlas.TexWidth, Height, pPixels);
+    }
+
+    ImGui::MemFree(pPixels);
+
+    LOG_NOTE("{IrrIMGUI} Appended " << (mFontAtlas.ConfigData.Size - mNumberOfCompiledConfigs) << " fonts to the font texture (rows " << Y << " to " << (Y + Height - 1) << ").\n");
+    return true;
+}
+
+void IIMGUIDriver::addDynamicFont(ImFontConfig const &rFontConfig, ImWchar const *const pGlyphRanges, unsigned int const NumberOfGlyphs) {
+    for(CDynamicGlyphCache const *const pCache : mDynamicFonts) {
+        if(pCache->getFont() == rFontConfig.DstFont) {
+            LOG_WARNING("{IrrIMGUI} The font has already dynamic glyphs, only the first glyph ranges are used.\n");
+            return;
+        }
+    }
+
+    mDynamicFonts.push_back(new CDynamicGlyphCache(mFontAtlas, rFontConfig, pGlyphRanges, NumberOfGlyphs));
+    return;
+}
+
+void IIMGUIDriver::deleteDynamicFonts(void) {
+    for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+        delete pCache;
+    }
+    mDynamicFonts.clear();
+
+    return;
+}
+
+void IIMGUIDriver::updateDynamicFonts(void) {
+    CDynamicGlyphCache::SUpdate Update;
+
+    for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+        if(!pCache->getUpdate(Update)) {
+            continue;
+        }
+
+        updateFontTextureRegion(mpFontTexture, Update.mX, Update.mY, Update.mWidth, Update.mHeight, Update.mPixels.data());
+
+        // the shader renderer has its own copy of the font atlas
+        if((mBackend == EIB_OPENGL3) && (mRenderData.FontTexture != 0)) {
+            ImGui_ImplIrrlicht_UpdateFontsTexture(Update.mX, Update.mY, Update.mWidth, Update.mHeight, Update.mPixels.data());
+        }
+    }
+
+    return;
+}
+
+void IIMGUIDriver::beginFrame(void) {
+    std::lock_guard<std::mutex> Lock(mFrameMutex);
+    mOpenFrames++;
+    return;
+}
+
+void IIMGUIDriver::endFrame(void) {
+    std::lock_guard<std::mutex> Lock(mFrameMutex);
+    FASSERT(mOpenFrames > 0);
+    mOpenFrames--;
+
+    // the glyphs of a frame, that another handle has built but not yet submitted, must stay in their cells
+    if(mOpenFrames == 0) {
+        for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+            pCache->nextFrame();
+        }
+    }
+
+    return;
+}
+
+void IIMGUIDriver::getFontMemory(SIMGUIFontMemory &rFontMemory) {
+    rFontMemory = SIMGUIFontMemory();
+
+    for(ImFontConfig const &rConfig : mFontAtlas.ConfigData) {
+        if(rConfig.FontData != nullptr) {
+            rFontMemory.mTTFBytes += static_cast<irr::u64>(rConfig.FontDataSize);
+        }
+    }
+    rFontMemory.mReleasedTTFBytes = mFontDataStore.getReleasedBytes();
+
+    irr::u64 const NumberOfPixels = static_cast<irr::u64>(mFontAtlas.TexWidth) * static_cast<irr::u64>(mFontAtlas.TexHeight);
+    if(mFontAtlas.TexPixelsAlpha8 != nullptr) {
+        rFontMemory.mAtlasPixelBytes += NumberOfPixels;
+    }
+    if(mFontAtlas.TexPixelsRGBA32 != nullptr) {
+        rFontMemory.mAtlasPixelBytes += NumberOfPixels * 4;
+    }
+
+    for(ImFont const *const pFont : mFontAtlas.Fonts) {
+        rFontMemory.mGlyphBytes += pFont->Glyphs.Capacity        * sizeof(ImFont::Glyph);
+        rFontMemory.mGlyphBytes += pFont->IndexXAdvance.Capacity * sizeof(float);
+        rFontMemory.mGlyphBytes += pFont->IndexLookup.Capacity   * sizeof(unsigned short);
+    }
+
+    for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+        rFontMemory.mDynamicGlyphBytes += pCache->getMemoryBytes();
+    }
+
+    return;
+}
+
+void IIMGUIDriver::buildDynamicFonts(void) {
+    for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+        pCache->build(mFontAtlas);
+    }
+
+    return;
+}
+
+void IIMGUIDriver::invalidateDynamicFonts(void) {
+    for(CDynamicGlyphCache *const pCache : mDynamicFonts) {
+        pCache->invalidate();
+    }
+
+    return;
+}
+
+/// @brief An helper class, that deletes all IIMGUIDriver instances when the program is closed and no other source has deleted them.
 class CIMGUIDriverDeleteHelper {
 public:
-    /// @brief Destructor tries to delete the Instance of CIMGUIDriver. If an instance was deleted, it shows a warning.
+    /// @brief Constructor creates the texture table, thus the table is destroyed after this helper.
+    CIMGUIDriverDeleteHelper(void) {
+        CGUITextureTable::getInstance();
+    }
+
+    /// @brief Destructor tries to delete all Instances of IIMGUIDriver. If an instance was deleted, it shows a warning.
     ~CIMGUIDriverDeleteHelper(void) {
-        if(IrrIMGUI::Private::IIMGUIDriver::deleteInstance()) {
-            LOG_WARNING("Forced deletion of Singleton Instance of IIMGUIDriver!\n");
+        while(!DriverInstances.empty()) {
+            IIMGUIDriver *const pDriver = DriverInstances.back();
+            int Allocations = 0;
+            while(!IrrIMGUI::Private::IIMGUIDriver::deleteInstance(pDriver, Allocations))
+                ;
+            LOG_WARNING("Forced deletion of Instance of IIMGUIDriver!\n");
         }
     }
 };
 
-// @brief Ensures that a driver is deleted at the end of program.
+// @brief Ensures that all drivers are deleted at the end of program.
 static CIMGUIDriverDeleteHelper IMGUIDriverDeleteHelper;
 
+/// @brief The IMGUI context of a font worker thread. It is created by the first task of the thread and destroyed, when the thread ends.
+class CFontWorkerContext {
+public:
+    /// @brief Constructor.
+    CFontWorkerContext(void):
+        mpContext(nullptr) {
+    }
+
+    /// @brief Destructor destroys the context. It must be the current context, since its members are freed with its allocator.
+    ~CFontWorkerContext(void) {
+        if(mpContext) {
+            ImGui::SetCurrentContext(mpContext);
+            ImGui::DestroyContext(mpContext);
+        }
+    }
+
+    /// @param pAllocate Is the allocation function for a new context.
+    /// @param pFree     Is the free function for a new context.
+    /// @return Returns the context of this thread.
+    ImGuiContext *get(void *(*const pAllocate)(size_t), void (*const pFree)(void *)) {
+        if(!mpContext) {
+            mpContext = ImGui::CreateContext(pAllocate, pFree);
+        }
+        return mpContext;
+    }
+
+private:
+    ImGuiContext *mpContext;
+};
+
+}
 }
+
+void ImGuiParallelFor(int const Count, void (*const pTask)(int Index, void *pUserData), void *const pUserData) {
+    using namespace IrrIMGUI::Private;
+
+    unsigned int NumberOfThreads = FontThreadHelper::NumberOfFontThreads;
+    if(NumberOfThreads == 0) {
+        NumberOfThreads = std::thread::hardware_concurrency();
+    }
+    NumberOfThreads = std::min(NumberOfThreads, static_cast<unsigned int>(std::max(Count, 0)));
+
+    if(NumberOfThreads <= 1) {
+        for(int i = 0; i < Count; i++) {
+            pTask(i, pUserData);
+        }
+        return;
+    }
+
+    // the allocation counter of an IMGUI context is not thread safe, thus every worker thread uses its own context with the same allocator
+    ImGuiIO const &rGUIIO = ImGui::GetIO();
+    void *(*const pAllocate)(size_t) = rGUIIO.MemAllocFn;
+    void (*const pFree)(void *)      = rGUIIO.MemFreeFn;
+    std::thread::id const CallerID   = std::this_thread::get_id();
+
+    std::vector<CWorkStealingPool::Task> Tasks;
+    Tasks.reserve(Count);
+    for(int i = 0; i < Count; i++) {
+        Tasks.push_back([=] {
+            if(std::this_thread::get_id() == CallerID) {
+                pTask(i, pUserData);
+                return;
+            }
+
+            static thread_local CFontWorkerContext WorkerContext;
+            ImGuiContext *const pPreviousContext = ImGui::GetCurrentContext();
+            ImGui::SetCurrentContext(WorkerContext.get(pAllocate, pFree));
+            pTask(i, pUserData);
+            ImGui::SetCurrentContext(pPreviousContext);
+        });
+    }
+
+    // the atlas is built rarely, thus the threads and their contexts only live while it is built
+    CWorkStealingPool Pool(NumberOfThreads);
+    Pool.run(Tasks);
+
+    return;
 }
 
 
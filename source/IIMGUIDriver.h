@@ -16,13 +16,19 @@
  */
 
 // library includes
+#include <mutex>
+#include <vector>
 #include <IrrIMGUI/IrrIMGUIConfig.h>
 #include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/imgui_irrlicht.h>
+#include "private/CFontDataStore.h"
 
 namespace IrrIMGUI {
 /// @brief Private definitions for the IMGUI Irrlicht binding. Do not use them outside, the interface may change a lot of times!
 namespace Private {
 
+class CDynamicGlyphCache;
+
 /// @brief The supported color formats for picture transformation and texture creating.
 enum EColorFormat {
     /// @brief 32bit word with Alpha at the MSB and Blue at the LSB.
@@ -34,7 +40,8 @@ enum EColorFormat {
 };
 
 /// @brief Interface for an IMGUI Driver to setup the IMGUI render system.
-/// @note  This is a singleton class, since IMGUI is a single instance system.
+/// @note  There is one driver instance per Irrlicht device. All GUI handles (and thus IMGUI contexts) that render
+///        to the same device share this instance, its font atlas and its graphic resources.
 class IIMGUIDriver {
 public:
     /// @{
@@ -48,14 +55,23 @@ public:
     /// @{
     /// @name Instance handling
 
-    /// @brief This method returns an instance of the driver. If no driver yet exists, it will create a new driver by it's own choice. Otherwise it will simply return the instance of the existing driver.
+    /// @brief This method returns the driver instance for an Irrlicht device. If no driver yet exists for this device, it will create a new driver
+    ///        for the fastest renderer, that is supported by the OpenGL context of the device (see CIMGUIBackendRegistry).
+    ///        Otherwise it will simply return the existing instance of this device.
     /// @param pDevice is a pointer to the Irrlicht Device to use.
+    /// @param Backend is the renderer, that should be used instead of the automatically chosen one, when a new driver is created.
     /// @return Returns a pointer to the instance.
-    static IIMGUIDriver *getInstance(irr::IrrlichtDevice *pDevice);
-
-    /// @brief Tells the driver, that it is not needed anymore. It decided by it's own if it will delete the single instance or exist further. When the instance was deleted.
-    /// @return Returns true, if the instance was destroyed by this calls. If there was not instance, or if the instance has not been destroyed, it will return false.
-    static bool deleteInstance(void);
+    /// @note  The driver is attached to the current IMGUI context (see setupContext()).
+    static IIMGUIDriver *getInstance(irr::IrrlichtDevice *pDevice, EIMGUIBackend Backend);
+
+    /// @brief Tells the driver, that it is not needed anymore by one of its users. When the last user releases the driver, the instance is deleted.
+    /// @param pDriver      is a pointer to the driver instance to release.
+    /// @param rAllocations is the number of memory blocks, that are still allocated in the current context.
+    ///                     The font atlas and the render data are shared between all contexts of a device, thus they can be allocated in one context and released in another one.
+    ///                     As long as the driver is still used, it takes over this number and sets it to 0. When the last user releases the driver,
+    ///                     the numbers of all released contexts are added, so that the sum tells if there are memory blocks left.
+    /// @return Returns true, if the instance was destroyed by this calls. If the instance has not been destroyed, it will return false.
+    static bool deleteInstance(IIMGUIDriver *pDriver, int &rAllocations);
 
     /// @}
 
@@ -63,21 +79,69 @@ public:
     /// @name Miscellaneous methods
 
     /// @return Returns a pointer to the irrlicht device.
-    static irr::IrrlichtDevice *getIrrDevice(void);
+    irr::IrrlichtDevice *getIrrDevice(void);
+
+    /// @return Returns a pointer to the font atlas, that is shared by all contexts of this device.
+    ImFontAtlas *getFontAtlas(void);
+
+    /// @return Returns a pointer to the store, that knows the sources of the TTF data of the font atlas.
+    CFontDataStore *getFontDataStore(void);
+
+    /// @return Returns the renderer of this driver.
+    EIMGUIBackend getBackend(void) const;
 
-    /// @return Returns a constant reference to the settings that are currently used.
-    static SIMGUISettings const &getSettings(void);
+    /// @brief Setups the current IMGUI context to render with this driver (font atlas, key map, mouse values and render function).
+    void setupContext(void);
 
-    /// @param rSettings is a reference of the new settings to apply. The settings will applied to the global IMGUI object.
-    static void setSettings(SIMGUISettings const &rSettings);
+    /// @return Returns true, when the graphic objects of the renderer have been created.
+    bool isPrepared(void) const;
+
+    /// @brief Creates the graphic objects of the renderer. Only the OpenGL 3 renderer creates them lazily, the other renderers create them with the driver.
+    /// @param rSettings is a reference of the settings of the handle (program cache, font cache, font threads, distance field spread and font data policy).
+    /// @return Returns true, when the shader program has been loaded from the program binary cache.
+    /// @note  The context of a handle of this driver must be current.
+    bool prepare(SIMGUISettings const &rSettings);
+
+    /// @brief Applies the settings to the current IMGUI context and to the Irrlicht device.
+    /// @param rSettings is a reference of the settings to apply.
+    void applySettings(SIMGUISettings const &rSettings);
 
     /// @}
 
-    /// @{
+/// @{
     /// @name Font methods
 
     /// @brief Copies the loaded Fonts into GPU memory to use them with the GUI.
-    void compileFonts(void);
+    /// @details Fonts, that have been added since the last call, are appended to the font texture when they fit into its free rows.
+    ///          The whole atlas is built again, when the distance field spread of the settings has changed.
+    /// @param rSettings is a reference of the settings of the handle (font cache, font threads, distance field spread and font data policy).
+    /// @note  The context of a handle of this driver must be current.
+    void compileFonts(SIMGUISettings const &rSettings);
+
+    /// @brief Reserves space in the font atlas for glyphs, that are rasterized when they are drawn for the first time.
+    /// @param rFontConfig    Is the configuration of a font, that has been added to the font atlas.
+    /// @param pGlyphRanges   Is a zero terminated list of glyph ranges, that are rasterized on demand.
+    /// @param NumberOfGlyphs Is the number of glyphs, that fit into the font atlas at the same time.
+    /// @note  The fonts must be compiled afterwards.
+    void addDynamicFont(ImFontConfig const &rFontConfig, ImWchar const *pGlyphRanges, unsigned int NumberOfGlyphs);
+
+    /// @brief Removes the glyph caches of all dynamic fonts. It must be called before the fonts of the atlas are cleared.
+    void deleteDynamicFonts(void);
+
+    /// @brief Copies the glyphs, that have been rasterized since the last call, into the font texture.
+    /// @note  The context of a handle of this driver must be current.
+    void updateDynamicFonts(void);
+
+    /// @brief Is called by a handle, when it starts to build a frame.
+    void beginFrame(void);
+
+    /// @brief Is called by a handle, when its frame has been submitted. When no other handle of the device builds a frame,
+    ///        the frame of the device ends and the dynamic glyphs used so far can be replaced.
+    void endFrame(void);
+
+    /// @brief Counts the bytes, that the fonts keep in CPU memory.
+    /// @param rFontMemory Is a reference to the structure, where the numbers are stored.
+    void getFontMemory(SIMGUIFontMemory &rFontMemory);
 
     /// @}
 
@@ -128,6 +192,15 @@ public:
     /// @param pGUITexture Is a pointer to the GUI texture object.
     virtual void updateFontTexture(IGUITexture *pGUITexture) = 0;
 
+    /// @brief Updates a rectangle of the font texture with the pixels of the font atlas (used for dynamic glyphs).
+    /// @param pGUITexture Is a pointer to the GUI texture object of the fonts.
+    /// @param X           Is the X position of the rectangle.
+    /// @param Y           Is the Y position of the rectangle.
+    /// @param Width       Is the number of Pixels in X direction.
+    /// @param Height      Is the number of Pixels in Y direction.
+    /// @param pPixelData  Is a pointer to the alpha values of the rectangle without any padding between the rows.
+    virtual void updateFontTextureRegion(IGUITexture *pGUITexture, unsigned int X, unsigned int Y, unsigned int Width, unsigned int Height, unsigned char const *pPixelData) = 0;
+
     /**
      * @brief Deletes an texture from graphic memory.
      * @param pGUITexture Is a pointer to the texture to delete. Do not use it afterwards!
@@ -149,17 +222,45 @@ protected:
     /// @brief Setups the keyboard controls to fit to Irrlicht.
     void setupKeyControl(void);
 
-    static unsigned int              mTextureInstances;
+    /// @brief Setups the IMGUI function pointer of the current context.
+    virtual void setupFunctionPointer(void) = 0;
+
+    unsigned int                     mTextureInstances;
 
 private:
-    /// @brief Updated the settings of IMGUI.
-    static void updateSettings(void);
-
-    static irr::IrrlichtDevice *mpDevice;
-    static IIMGUIDriver         *mpInstance;
-    static unsigned int              mInstances;
-    static SIMGUISettings        mSettings;
-    static IGUITexture          *mpFontTexture;
+    /// @brief Builds the font atlas from the added fonts or loads it from the font atlas cache, when the atlas has no pixels.
+    ///        Released TTF data is loaded again, when the atlas must be built.
+    /// @param pFontCacheDirectory is the directory of the font atlas cache. Without cache the atlas is built by the texture upload.
+    /// @param FontDataPolicy      tells, if the TTF data is released after the atlas has been cached.
+    void buildFontAtlas(char const *pFontCacheDirectory, EFontDataPolicy FontDataPolicy);
+
+    /// @brief Sets the distance field spread of the font atlas. When it changes, the pixels of the atlas are dropped and the dynamic glyph cells are resized.
+    /// @param Spread is the spread in pixels (0 means, that the atlas stores the coverage of the glyphs).
+    void setFontSDFSpread(unsigned int Spread);
+
+    /// @brief Packs the fonts, that have been added since the last compilation, into the free rows of the font texture.
+    /// @return Returns false, when the whole atlas must be built again.
+    bool appendFonts(void);
+
+    /// @brief Sets up the glyph caches of all dynamic fonts for the built font atlas.
+    void buildDynamicFonts(void);
+
+    /// @brief Drops the glyphs of all dynamic fonts, thus the font atlas can be built again.
+    void invalidateDynamicFonts(void);
+
+    irr::IrrlichtDevice             *mpDevice;
+    unsigned int                     mInstances;
+    int                              mTakenOverAllocations;
+    IGUITexture                     *mpFontTexture;
+    EIMGUIBackend                    mBackend;
+    bool                             mIsPrepared;
+    ImFontAtlas                      mFontAtlas;
+    CFontDataStore                   mFontDataStore;
+    int                              mNumberOfCompiledConfigs;
+    ImGui_ImplIrrlicht_Data          mRenderData;
+    std::vector<CDynamicGlyphCache *> mDynamicFonts;
+    std::mutex                       mFrameMutex;
+    unsigned int                     mOpenFrames;
 
 };
 
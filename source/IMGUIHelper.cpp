@@ -25,6 +25,16 @@ static void updateScreenSize(irr::IrrlichtDevice *const pDevice) {
 }
 
 /// @brief Updated the IMGUI timer.
+/// @param pFrameTimer Is a pointer to the timer that measures the time step.
+static void updateTimer(CIMGUIFrameTimer *const pFrameTimer) {
+    ImGuiIO &rGUIIO = ImGui::GetIO();
+
+    rGUIIO.DeltaTime = pFrameTimer->update();
+
+    return;
+}
+
+/// @brief Updated the IMGUI timer with the Irrlicht timer.
 /// @param pDevice   Is a pointer to an Irrlicht device.
 /// @param pLastTime Is a pointer to a variable that stores the timer value from the last update.
 static void updateTimer(irr::IrrlichtDevice *const pDevice, float *const pLastTime) {
@@ -94,12 +104,23 @@ static void updateKeyboard(CIMGUIEventStorage *const pEventStorage) {
     return;
 }
 
+void updateIMGUIFrameValues(irr::IrrlichtDevice *const pDevice,  CIMGUIEventStorage *const pEventStorage, CIMGUIFrameTimer *const pFrameTimer) {
+    updateScreenSize(pDevice);
+    updateTimer(pFrameTimer);
+    if(pEventStorage) {
+        updateMouse(pEventStorage);
+        updateKeyboard(pEventStorage);
+        pEventStorage->mFrameNumber++;
+    }
+}
+
 void updateIMGUIFrameValues(irr::IrrlichtDevice *const pDevice,  CIMGUIEventStorage *const pEventStorage, float *const pLastTime) {
     updateScreenSize(pDevice);
     updateTimer(pDevice, pLastTime);
     if(pEventStorage) {
         updateMouse(pEventStorage);
         updateKeyboard(pEventStorage);
+        pEventStorage->mFrameNumber++;
     }
 }
 
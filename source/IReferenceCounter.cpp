@@ -14,39 +14,35 @@
  * @{
  */
 namespace IrrIMGUI {
-IReferenceCounter::IReferenceCounter(void):
-    mReferences(1) {
+IReferenceCounter::IReferenceCounter(void) {
     return;
 }
 
 IReferenceCounter::~IReferenceCounter(void) {
-    if(mReferences != 1) {
+    // the counter is 0 when the object is destroyed by drop() and 1 when it is deleted directly
+    unsigned int const References = TCounter::getReferenceCount();
+
+    if(References > 1) {
         LOG_ERROR("An object with counted references is destroyed, but there are still references in use!\n");
         LOG_ERROR(" * object address: " << std::hex << this << "\n");
-        LOG_ERROR(" * object references in use: " << std::hex << (mReferences - 1) << "\n");
+        LOG_ERROR(" * object references in use: " << std::hex << (References - 1) << "\n");
     }
 
     return;
 }
 
 void IReferenceCounter::grab(void) {
-    mReferences++;
+    TCounter::grab();
     return;
 }
 
 void IReferenceCounter::drop(void) {
-
-    if(mReferences == 1) {
-        delete this;
-    } else {
-        mReferences--;
-    }
-
+    TCounter::drop();
     return;
 }
 
 unsigned int IReferenceCounter::getReferenceCount(void) const {
-    return mReferences;
+    return TCounter::getReferenceCount();
 }
 
 }
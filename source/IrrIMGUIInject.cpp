@@ -12,7 +12,6 @@
 #include "private/IrrIMGUIDebug_priv.h"
 #include "CIMGUIHandle.h"
 #include "private/IrrIMGUIInject_priv.h"
-#include "IrrIMGUI/imgui_irrlicht.h"
 
 namespace IrrIMGUI {
 namespace Private {
@@ -49,9 +48,7 @@ IIMGUIHandle *createIMGUI(irr::IrrlichtDevice *pDevice, CIMGUIEventStorage *pEve
     FASSERT(Inject::pIMGUIFactoryFunction);
     FASSERT(pDevice);
     gl3wInit();
-    IIMGUIHandle *handle = Inject::pIMGUIFactoryFunction(pDevice, pEventStorage, pSettings);
-    ImGui_ImplIrrlicht_Init(pDevice);
-    return handle;
+    return Inject::pIMGUIFactoryFunction(pDevice, pEventStorage, pSettings);
 }
 
 }
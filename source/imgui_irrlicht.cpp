@@ -10,6 +10,12 @@
 #include "IrrIMGUI/imgui_irrlicht.h"
 #include "IrrIMGUI/IrrIMGUI.h"
 #include "IrrIMGUI/IMGUIHelper.h"
+#include "private/IrrIMGUITrace_priv.h"
+#include "private/IrrIMGUIDebug_priv.h"
+#include "private/CGUITextureTable.h"
+#include "private/CProgramBinaryCache.h"
+#include <string>
+#include <vector>
 // SDL,GL3W
 #include <GL/gl3w.h>
 #include <IrrlichtDevice.h>
@@ -17,19 +23,21 @@
 #include <IOSOperator.h>
 
 // Data
-static double       g_Time = 0.0f;
 static bool         g_MousePressed[3] = { false, false, false };
 static float        g_MouseWheel = 0.0f;
-static GLuint       g_FontTexture = 0;
-static int          g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
-static int          g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0, g_AttribLocationClipRect = 0;
-static int          g_AttribLocationPosition = 0, g_AttribLocationUV = 0, g_AttribLocationColor = 0;
-static unsigned int g_VboHandle = 0, g_VaoHandle = 0, g_ElementsHandle = 0;
+static ImGui_ImplIrrlicht_Data g_DefaultData;
+
+// Returns the OpenGL objects that belong to the current context.
+static ImGui_ImplIrrlicht_Data *ImGui_ImplIrrlicht_GetData() {
+    ImGui_ImplIrrlicht_Data *const data = (ImGui_ImplIrrlicht_Data *)ImGui::GetIO().UserData;
+    return data ? data : &g_DefaultData;
+}
 
 // This is the main rendering function that you have to implement and provide to ImGui (via setting up 'RenderDrawListsFn' in the ImGuiIO structure)
 // If text or lines are blurry when integrating ImGui in your engine:
 // - in your Render function, try translating your projection matrix by (0.5f,0.5f) or (0.375f,0.375f)
 void ImGui_ImplIrrlicht_RenderDrawLists(ImDrawData *draw_data) {
+    ImGui_ImplIrrlicht_Data *const data = ImGui_ImplIrrlicht_GetData();
 
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
     ImGuiIO &io = ImGui::GetIO();
@@ -86,36 +94,71 @@ void ImGui_ImplIrrlicht_RenderDrawLists(ImDrawData *draw_data) {
         { 0.0f,                  0.0f,                  -1.0f, 0.0f },
         { -1.0f,                  1.0f,                   0.0f, 1.0f },
     };
-    glUseProgram(g_ShaderHandle);
-    glUniform1i(g_AttribLocationTex, 0);
-    glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
-    glBindVertexArray(g_VaoHandle);
+    glUseProgram(data->ShaderHandle);
+    glUniform1i(data->AttribLocationTex, 0);
+    glUniformMatrix4fv(data->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    glUniform1i(data->AttribLocationDistanceField, 0);
+    glBindVertexArray(data->VaoHandle);
+
+    IrrIMGUI::Private::CGUITextureTable const &texture_table = IrrIMGUI::Private::CGUITextureTable::getInstance();
+
+    // only bind a texture when it differs from the one of the last draw call
+    GLuint bound_texture = 0;
+    bool is_texture_bound = false;
+
+    // the glyphs of a distance field font atlas are drawn by the distance field variant of the fragment shader
+    bool const is_font_distance_field = (io.Fonts->TexGlyphSDFSpread > 0);
+    bool is_distance_field = false;
 
     for(int n = 0; n < draw_data->CmdListsCount; n++) {
         const ImDrawList *cmd_list = draw_data->CmdLists[n];
         const ImDrawIdx *idx_buffer_offset = 0;
+        TRACE_SCOPE_ARG("DrawList", "vertices", cmd_list->VtxBuffer.Size);
 
-        glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
+        glBindBuffer(GL_ARRAY_BUFFER, data->VboHandle);
         glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (GLvoid *)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, data->ElementsHandle);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (GLvoid *)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
 
         for(int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++) {
             const ImDrawCmd *pcmd = &cmd_list->CmdBuffer[cmd_i];
             if(pcmd->UserCallback) {
                 pcmd->UserCallback(cmd_list, pcmd);
+                is_texture_bound = false;
             } else {
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
-                //                glScissor((int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
-                float clipRect[4];
-                clipRect[0] = (int)pcmd->ClipRect.x;
-                clipRect[1] = (int)(fb_height - pcmd->ClipRect.w);
-                clipRect[2] = (int)(pcmd->ClipRect.z - pcmd->ClipRect.x);
-                clipRect[3] = (int)(pcmd->ClipRect.w - pcmd->ClipRect.y);
-                glUniform4f(g_AttribLocationClipRect, clipRect[0], clipRect[1], clipRect[2], clipRect[3]);
-
-                glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
+                // GUI textures use handles of the texture table, other texture IDs are OpenGL texture names
+                ImTextureID texture_id = pcmd->TextureId;
+                bool is_texture_deleted = false;
+                if(IrrIMGUI::Private::CGUITextureTable::isHandle(texture_id)) {
+                    texture_id = texture_table.getGPUTextureID(texture_id);
+                    is_texture_deleted = (texture_id == NULL);
+                }
+
+                if(is_texture_deleted) {
+                    LOG_ERROR("{IrrIMGUI} The texture " << std::hex << pcmd->TextureId << " of a draw command has already been deleted!\n");
+                } else {
+                    GLuint const texture = (GLuint)(intptr_t)texture_id;
+                    if(!is_texture_bound || (texture != bound_texture)) {
+                        glBindTexture(GL_TEXTURE_2D, texture);
+                        bound_texture = texture;
+                        is_texture_bound = true;
+                    }
+                    bool const use_distance_field = is_font_distance_field && (pcmd->TextureId == io.Fonts->TexID);
+                    if(use_distance_field != is_distance_field) {
+                        glUniform1i(data->AttribLocationDistanceField, use_distance_field ? 1 : 0);
+                        is_distance_field = use_distance_field;
+                    }
+                    //                glScissor((int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
+                    float clipRect[4];
+                    clipRect[0] = (int)pcmd->ClipRect.x;
+                    clipRect[1] = (int)(fb_height - pcmd->ClipRect.w);
+                    clipRect[2] = (int)(pcmd->ClipRect.z - pcmd->ClipRect.x);
+                    clipRect[3] = (int)(pcmd->ClipRect.w - pcmd->ClipRect.y);
+                    glUniform4f(data->AttribLocationClipRect, clipRect[0], clipRect[1], clipRect[2], clipRect[3]);
+
+                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
+                }
             }
             idx_buffer_offset += pcmd->ElemCount;
         }
@@ -209,6 +252,7 @@ bool ImGui_ImplIrrlicht_ProcessEvent(irr::SEvent event) {
 }
 
 void ImGui_ImplIrrlicht_CreateFontsTexture() {
+    ImGui_ImplIrrlicht_Data *const data = ImGui_ImplIrrlicht_GetData();
     // Build texture atlas
     ImGuiIO &io = ImGui::GetIO();
     unsigned char *pixels;
@@ -218,89 +262,210 @@ void ImGui_ImplIrrlicht_CreateFontsTexture() {
     // Upload texture to graphics system
     GLint last_texture;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
-    glGenTextures(1, &g_FontTexture);
-    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+    glGenTextures(1, &data->FontTexture);
+    glBindTexture(GL_TEXTURE_2D, data->FontTexture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
     // Store our identifier
-    io.Fonts->TexID = (void *)(intptr_t)g_FontTexture;
+    io.Fonts->TexID = (void *)(intptr_t)data->FontTexture;
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
 }
 
+void ImGui_ImplIrrlicht_UpdateFontsTexture(int x, int y, int width, int height, const unsigned char *alpha_pixels) {
+    ImGui_ImplIrrlicht_Data *const data = ImGui_ImplIrrlicht_GetData();
+    if(!data->FontTexture || (width <= 0) || (height <= 0)) {
+        return;
+    }
+
+    // The texture contains white pixels with the alpha value of the font atlas (see GetTexDataAsRGBA32)
+    ImVector<unsigned int> pixels;
+    pixels.resize(width * height);
+    for(int i = 0; i < width * height; i++) {
+        pixels[i] = IM_COL32(255, 255, 255, alpha_pixels[i]);
+    }
+
+    GLint last_texture;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glBindTexture(GL_TEXTURE_2D, data->FontTexture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.Data);
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+}
+
+// Shader sources of the binding.
+static const GLchar *g_VertexShader =
+    "#version 330\n"
+    "uniform mat4 ProjMtx;\n"
+    "uniform vec4 clipRect;\n"
+    "\n"
+    "in vec2 Position;\n"
+    "in vec2 UV;\n"
+    "in vec4 Color;\n"
+    "out vec2 Frag_UV;\n"
+    "out vec4 Frag_Color;\n"
+    "void main() {\n"
+    "    gl_ClipDistance[0] = clipRect[0];\n"
+    "    gl_ClipDistance[1] = clipRect[1];\n"
+    "    gl_ClipDistance[2] = clipRect[2];\n"
+    "    gl_ClipDistance[3] = clipRect[3];\n"
+    "    Frag_UV = UV;\n"
+    "    Frag_Color = Color;\n"
+    "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
+    "}\n";
+
+// The alpha value of a distance field font atlas is 0.5 on the outline of the glyphs. The edge is smoothed over about one pixel
+// of the screen, thus the glyphs are sharp at every scale.
+static const GLchar *g_FragmentShader =
+    "#version 330\n"
+    "uniform sampler2D Texture;\n"
+    "uniform bool DistanceField;\n"
+    "in vec2 Frag_UV;\n"
+    "in vec4 Frag_Color;\n"
+    "out vec4 Out_Color;\n"
+    "void main()\n"
+    "{\n"
+    "	vec4 texel = texture( Texture, Frag_UV.st);\n"
+    "	if (DistanceField) {\n"
+    "		float width = max(0.7 * fwidth(texel.a), 0.001);\n"
+    "		texel.a = smoothstep(0.5 - width, 0.5 + width, texel.a);\n"
+    "	}\n"
+    "	Out_Color = Frag_Color * texel;\n"
+    "}\n";
+
+// Returns true, when the program binary of the current context can be read and loaded.
+static bool ImGui_ImplIrrlicht_IsProgramBinarySupported() {
+    if(!glGetProgramBinary || !glProgramBinary || !glProgramParameteri) {
+        return false;
+    }
+
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+// Returns the key of the program binary cache. A binary can only be loaded by the same driver in the same version.
+static std::string ImGui_ImplIrrlicht_GetProgramKey() {
+    const char *vendor   = (const char *)glGetString(GL_VENDOR);
+    const char *renderer = (const char *)glGetString(GL_RENDERER);
+    const char *version  = (const char *)glGetString(GL_VERSION);
+
+    std::string key;
+    key += vendor ? vendor : "";
+    key += '\n';
+    key += renderer ? renderer : "";
+    key += '\n';
+    key += version ? version : "";
+    key += '\n';
+    key += g_VertexShader;
+    key += g_FragmentShader;
+    return key;
+}
+
+// Loads the linked program from the cache. Returns false, when there is no binary or when the driver rejects it.
+static bool ImGui_ImplIrrlicht_LoadProgram(ImGui_ImplIrrlicht_Data *data, IrrIMGUI::Private::CProgramBinaryCache const &cache) {
+    unsigned int format = 0;
+    std::vector<char> binary;
+    if(!cache.load(format, binary)) {
+        return false;
+    }
+
+    data->ShaderHandle = glCreateProgram();
+    glProgramBinary(data->ShaderHandle, (GLenum)format, binary.data(), (GLsizei)binary.size());
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(data->ShaderHandle, GL_LINK_STATUS, &status);
+    if(status != GL_TRUE) {
+        LOG_NOTE("{IrrIMGUI} The driver rejected the cached program \"" << cache.getFileName() << "\", it is compiled again.\n");
+        glDeleteProgram(data->ShaderHandle);
+        data->ShaderHandle = 0;
+        return false;
+    }
+
+    return true;
+}
+
+// Compiles and links the program. When a cache is given, the linked program is stored in it.
+static void ImGui_ImplIrrlicht_CompileProgram(ImGui_ImplIrrlicht_Data *data, IrrIMGUI::Private::CProgramBinaryCache const *cache) {
+    data->ShaderHandle = glCreateProgram();
+    data->VertHandle = glCreateShader(GL_VERTEX_SHADER);
+    data->FragHandle = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(data->VertHandle, 1, &g_VertexShader, 0);
+    glShaderSource(data->FragHandle, 1, &g_FragmentShader, 0);
+    glCompileShader(data->VertHandle);
+    glCompileShader(data->FragHandle);
+    glAttachShader(data->ShaderHandle, data->VertHandle);
+    glAttachShader(data->ShaderHandle, data->FragHandle);
+    if(cache) {
+        glProgramParameteri(data->ShaderHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(data->ShaderHandle);
+
+    if(cache) {
+        GLint length = 0;
+        glGetProgramiv(data->ShaderHandle, GL_PROGRAM_BINARY_LENGTH, &length);
+
+        if(length > 0) {
+            std::vector<char> binary(length);
+            GLenum format = 0;
+            glGetProgramBinary(data->ShaderHandle, length, &length, &format, binary.data());
+            cache->store(format, binary.data(), (size_t)length);
+        }
+    }
+}
+
 bool ImGui_ImplIrrlicht_CreateDeviceObjects() {
+    return ImGui_ImplIrrlicht_CreateDeviceObjectsCached(NULL, NULL);
+}
+
+bool ImGui_ImplIrrlicht_CreateDeviceObjectsCached(const char *program_cache_dir, bool *program_from_cache) {
+    ImGui_ImplIrrlicht_Data *const data = ImGui_ImplIrrlicht_GetData();
     // Backup GL state
     GLint last_texture, last_array_buffer, last_vertex_array;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
     glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &last_array_buffer);
     glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &last_vertex_array);
 
-    const GLchar *vertex_shader =
-        "#version 330\n"
-        "uniform mat4 ProjMtx;\n"
-        "uniform vec4 clipRect;\n"
-        "\n"
-        "in vec2 Position;\n"
-        "in vec2 UV;\n"
-        "in vec4 Color;\n"
-        "out vec2 Frag_UV;\n"
-        "out vec4 Frag_Color;\n"
-        "void main() {\n"
-        "    gl_ClipDistance[0] = clipRect[0];\n"
-        "    gl_ClipDistance[1] = clipRect[1];\n"
-        "    gl_ClipDistance[2] = clipRect[2];\n"
-        "    gl_ClipDistance[3] = clipRect[3];\n"
-        "    Frag_UV = UV;\n"
-        "    Frag_Color = Color;\n"
-        "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
-        "}\n";
-
-    const GLchar *fragment_shader =
-        "#version 330\n"
-        "uniform sampler2D Texture;\n"
-        "in vec2 Frag_UV;\n"
-        "in vec4 Frag_Color;\n"
-        "out vec4 Out_Color;\n"
-        "void main()\n"
-        "{\n"
-        "	Out_Color = Frag_Color * texture( Texture, Frag_UV.st);\n"
-        "}\n";
-
-    g_ShaderHandle = glCreateProgram();
-    g_VertHandle = glCreateShader(GL_VERTEX_SHADER);
-    g_FragHandle = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(g_VertHandle, 1, &vertex_shader, 0);
-    glShaderSource(g_FragHandle, 1, &fragment_shader, 0);
-    glCompileShader(g_VertHandle);
-    glCompileShader(g_FragHandle);
-    glAttachShader(g_ShaderHandle, g_VertHandle);
-    glAttachShader(g_ShaderHandle, g_FragHandle);
-    glLinkProgram(g_ShaderHandle);
-
-    g_AttribLocationTex = glGetUniformLocation(g_ShaderHandle, "Texture");
-    g_AttribLocationProjMtx = glGetUniformLocation(g_ShaderHandle, "ProjMtx");
-    g_AttribLocationPosition = glGetAttribLocation(g_ShaderHandle, "Position");
-    g_AttribLocationUV = glGetAttribLocation(g_ShaderHandle, "UV");
-    g_AttribLocationColor = glGetAttribLocation(g_ShaderHandle, "Color");
-    g_AttribLocationClipRect = glGetAttribLocation(g_ShaderHandle, "clipRect");
-    glGenBuffers(1, &g_VboHandle);
-    glGenBuffers(1, &g_ElementsHandle);
-
-    glGenVertexArrays(1, &g_VaoHandle);
-    glBindVertexArray(g_VaoHandle);
-    glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
-    glEnableVertexAttribArray(g_AttribLocationPosition);
-    glEnableVertexAttribArray(g_AttribLocationUV);
-    glEnableVertexAttribArray(g_AttribLocationColor);
+    // Load the linked program from the cache or compile it
+    bool from_cache = false;
+    if(program_cache_dir && ImGui_ImplIrrlicht_IsProgramBinarySupported()) {
+        IrrIMGUI::Private::CProgramBinaryCache const cache(program_cache_dir, ImGui_ImplIrrlicht_GetProgramKey());
+        from_cache = ImGui_ImplIrrlicht_LoadProgram(data, cache);
+        if(!from_cache) {
+            ImGui_ImplIrrlicht_CompileProgram(data, &cache);
+        }
+    } else {
+        ImGui_ImplIrrlicht_CompileProgram(data, NULL);
+    }
+    if(program_from_cache) {
+        *program_from_cache = from_cache;
+    }
+
+    data->AttribLocationTex = glGetUniformLocation(data->ShaderHandle, "Texture");
+    data->AttribLocationProjMtx = glGetUniformLocation(data->ShaderHandle, "ProjMtx");
+    data->AttribLocationDistanceField = glGetUniformLocation(data->ShaderHandle, "DistanceField");
+    data->AttribLocationPosition = glGetAttribLocation(data->ShaderHandle, "Position");
+    data->AttribLocationUV = glGetAttribLocation(data->ShaderHandle, "UV");
+    data->AttribLocationColor = glGetAttribLocation(data->ShaderHandle, "Color");
+    data->AttribLocationClipRect = glGetAttribLocation(data->ShaderHandle, "clipRect");
+    glGenBuffers(1, &data->VboHandle);
+    glGenBuffers(1, &data->ElementsHandle);
+
+    glGenVertexArrays(1, &data->VaoHandle);
+    glBindVertexArray(data->VaoHandle);
+    glBindBuffer(GL_ARRAY_BUFFER, data->VboHandle);
+    glEnableVertexAttribArray(data->AttribLocationPosition);
+    glEnableVertexAttribArray(data->AttribLocationUV);
+    glEnableVertexAttribArray(data->AttribLocationColor);
 
 #define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
-    glVertexAttribPointer(g_AttribLocationPosition, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid *)OFFSETOF(ImDrawVert, pos));
-    glVertexAttribPointer(g_AttribLocationUV, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid *)OFFSETOF(ImDrawVert, uv));
-    glVertexAttribPointer(g_AttribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid *)OFFSETOF(ImDrawVert, col));
+    glVertexAttribPointer(data->AttribLocationPosition, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid *)OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(data->AttribLocationUV, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid *)OFFSETOF(ImDrawVert, uv));
+    glVertexAttribPointer(data->AttribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid *)OFFSETOF(ImDrawVert, col));
 #undef OFFSETOF
 
     ImGui_ImplIrrlicht_CreateFontsTexture();
@@ -314,46 +479,49 @@ bool ImGui_ImplIrrlicht_CreateDeviceObjects() {
 }
 
 void    ImGui_ImplIrrlicht_InvalidateDeviceObjects() {
-    if(g_VaoHandle) {
-        glDeleteVertexArrays(1, &g_VaoHandle);
+    ImGui_ImplIrrlicht_Data *const data = ImGui_ImplIrrlicht_GetData();
+    if(data->VaoHandle) {
+        glDeleteVertexArrays(1, &data->VaoHandle);
     }
-    if(g_VboHandle) {
-        glDeleteBuffers(1, &g_VboHandle);
+    if(data->VboHandle) {
+        glDeleteBuffers(1, &data->VboHandle);
     }
-    if(g_ElementsHandle) {
-        glDeleteBuffers(1, &g_ElementsHandle);
+    if(data->ElementsHandle) {
+        glDeleteBuffers(1, &data->ElementsHandle);
     }
-    g_VaoHandle = g_VboHandle = g_ElementsHandle = 0;
+    data->VaoHandle = data->VboHandle = data->ElementsHandle = 0;
 
-    if(g_ShaderHandle && g_VertHandle) {
-        glDetachShader(g_ShaderHandle, g_VertHandle);
+    if(data->ShaderHandle && data->VertHandle) {
+        glDetachShader(data->ShaderHandle, data->VertHandle);
     }
-    if(g_VertHandle) {
-        glDeleteShader(g_VertHandle);
+    if(data->VertHandle) {
+        glDeleteShader(data->VertHandle);
     }
-    g_VertHandle = 0;
+    data->VertHandle = 0;
 
-    if(g_ShaderHandle && g_FragHandle) {
-        glDetachShader(g_ShaderHandle, g_FragHandle);
+    if(data->ShaderHandle && data->FragHandle) {
+        glDetachShader(data->ShaderHandle, data->FragHandle);
     }
-    if(g_FragHandle) {
-        glDeleteShader(g_FragHandle);
+    if(data->FragHandle) {
+        glDeleteShader(data->FragHandle);
     }
-    g_FragHandle = 0;
+    data->FragHandle = 0;
 
-    if(g_ShaderHandle) {
-        glDeleteProgram(g_ShaderHandle);
+    if(data->ShaderHandle) {
+        glDeleteProgram(data->ShaderHandle);
     }
-    g_ShaderHandle = 0;
+    data->ShaderHandle = 0;
 
-    if(g_FontTexture) {
-        glDeleteTextures(1, &g_FontTexture);
-        ImGui::GetIO().Fonts->TexID = 0;
-        g_FontTexture = 0;
+    if(data->FontTexture) {
+        glDeleteTextures(1, &data->FontTexture);
+        if(ImGui::GetIO().Fonts) {
+            ImGui::GetIO().Fonts->TexID = 0;
+        }
+        data->FontTexture = 0;
     }
 }
 
-bool ImGui_ImplIrrlicht_Init(irr::IrrlichtDevice *dev) {
+bool ImGui_ImplIrrlicht_Init(irr::IrrlichtDevice *) {
 
     ImGuiIO &io = ImGui::GetIO();
     io.RenderDrawListsFn = ImGui_ImplIrrlicht_RenderDrawLists;   // Alternatively you can set this to NULL and call ImGui::GetDrawData() after ImGui::Render() to get the same ImDrawData pointer.
@@ -367,12 +535,14 @@ void ImGui_ImplIrrlicht_Shutdown() {
 }
 
 void ImGui_ImplIrrlicht_NewFrame(irr::IrrlichtDevice *dev) {
-    if(!g_FontTexture) {
+    ImGui_ImplIrrlicht_Data *const data = ImGui_ImplIrrlicht_GetData();
+    ImGuiIO &io = ImGui::GetIO();
+
+    // the OpenGL objects are only needed, when the GUI is drawn by this binding and not by another renderer
+    if(!data->FontTexture && (io.RenderDrawListsFn == ImGui_ImplIrrlicht_RenderDrawLists)) {
         ImGui_ImplIrrlicht_CreateDeviceObjects();
     }
 
-    ImGuiIO &io = ImGui::GetIO();
-
     // Setup display size (every frame to accommodate for window resizing)
     int w, h;
     int display_w, display_h;
@@ -383,11 +553,7 @@ void ImGui_ImplIrrlicht_NewFrame(irr::IrrlichtDevice *dev) {
     io.DisplaySize = ImVec2((float)w, (float)h);
     io.DisplayFramebufferScale = ImVec2(w > 0 ? ((float)display_w / w) : 0, h > 0 ? ((float)display_h / h) : 0);
 
-    // Setup time step
-    int	time = dev->getTimer()->getTime();
-    double current_time = time / 1000.0;
-    io.DeltaTime = g_Time > 0.0 ? (float)(current_time - g_Time) : (float)(1.0f / 60.0f);
-    g_Time = current_time;
+    // The time step is set up per context by IrrIMGUI::updateIMGUIFrameValues(...)
 
     // Start the frame
     ImGui::NewFrame();
@@ -0,0 +1,119 @@
+/**
+ * @file   CAllocationTracker.h
+ * @author Andre Netzeband
+ * @brief  Contains the allocator hooks of the IMGUI contexts, that count the allocations of every GUI frame.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CALLOCATIONTRACKER_H_
+#define IRRIMGUI_CALLOCATIONTRACKER_H_
+
+// library includes
+#include <cstddef>
+
+// module includes
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IrrIMGUI/IncludeIrrlicht.h>
+#include <IrrIMGUI/CIMGUIFrameProfiler.h>
+#include "private/CFrameAllocator.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Counts the memory allocations of an IMGUI context.
+   * @details
+   *   The static functions allocate() and deallocate() are passed as MemAllocFn and MemFreeFn to ImGui::CreateContext().
+   *   Blocks of malloc and of frame allocators can be freed by every context. The counting is done by the tracker, that
+   *   has been made current for the current IMGUI context on the calling thread with makeCurrent().
+   *   Allocations of other contexts are not counted.
+   *
+   *   IMGUI has no reallocation hook, a growing ImVector allocates the new buffer and frees the smaller old buffer
+   *   afterwards. Such a pair is counted as reallocation.
+   *
+   *   When a frame allocator is set, the allocations between startFrame() and endFrame() are served by the frame
+   *   allocator. All other allocations use malloc.
+   */
+  class CAllocationTracker
+  {
+    public:
+      /// @brief Constructor.
+      CAllocationTracker(void);
+
+      /// @brief Destructor.
+      ~CAllocationTracker(void);
+
+      /// @brief The allocation function of the IMGUI contexts.
+      /// @param Size Is the size of the block in bytes.
+      /// @return Returns a pointer to the allocated block.
+      static void *allocate(size_t Size);
+
+      /// @brief The free function of the IMGUI contexts.
+      /// @param pMemory Is a pointer to the block, that has been allocated with allocate(...).
+      static void deallocate(void *pMemory);
+
+      /// @brief Counts all allocations of an IMGUI context on the calling thread with this tracker.
+      /// @param pContext Is a pointer to the IMGUI context, that is current.
+      void makeCurrent(ImGuiContext *pContext);
+
+      /// @brief Stops counting the allocations with this tracker on the calling thread.
+      void resetCurrent(void);
+
+      /// @brief Resets the counters of the current frame.
+      void startFrame(void);
+
+      /// @brief Marks the end of the frame. The following allocations are not served by the frame allocator.
+      void endFrame(void);
+
+      /// @brief Stores the counters of the current frame in a profile.
+      /// @param rProfile Is a reference to the profile.
+      void getFrameStatistics(SIMGUIFrameProfile &rProfile) const;
+
+      /// @brief Sets the profiler, that receives the sampled allocations.
+      /// @param pProfiler Is a pointer to the profiler or nullptr to disable the sampling.
+      /// @param Interval  Every n-th allocation is sampled. 0 disables the sampling.
+      void setSampling(CIMGUIFrameProfiler *pProfiler, unsigned int Interval);
+
+      /// @brief Sets the allocator, that serves the allocations of a frame.
+      /// @param pFrameAllocator Is a pointer to the frame allocator of the context. Its blocks are freed fast, even when it is disabled.
+      /// @param IsEnabled       When this is false, malloc is used for all allocations.
+      void setFrameAllocator(CFrameAllocator *pFrameAllocator, bool IsEnabled);
+
+    private:
+      /// @brief Counts an allocated block.
+      void countAllocation(size_t Size, size_t BlockSize, bool IsSystemAllocation);
+
+      /// @brief Counts a freed block.
+      void countDeallocation(size_t BlockSize);
+
+      unsigned int          mAllocations;
+      unsigned int          mSystemAllocations;
+      unsigned int          mFrees;
+      unsigned int          mReallocations;
+      irr::u64              mAllocatedBytes;
+      irr::u64              mLiveBytes;
+      irr::u64              mPeakBytes;
+      size_t                mLastBlockSize;
+      bool                  mIsLastOperationAllocation;
+      CIMGUIFrameProfiler * mpProfiler;
+      unsigned int          mSamplingInterval;
+      unsigned int          mSamplingCounter;
+      CFrameAllocator     * mpFrameAllocator;
+      bool                  mIsFrameAllocatorEnabled;
+      bool                  mIsInFrame;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CALLOCATIONTRACKER_H_ */
@@ -0,0 +1,131 @@
+/**
+ * @file   CAsyncLogWriter.h
+ * @author Andre Netzeband
+ * @brief  Contains a background thread, that writes the records of the debug channels.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CASYNCLOGWRITER_H_
+#define IRRIMGUI_CASYNCLOGWRITER_H_
+
+// library includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Writes text to stream buffers on a background thread.
+   * @details
+   *   The text is copied into the slots of a bounded lock-free queue, that can be filled by several threads and is
+   *   emptied by the background thread. Every slot has a sequence number, that tells the producers and the consumer
+   *   whether the slot is free or filled. Thus putting text into the queue needs only a single compare-and-swap.
+   *
+   *   Longer texts use several slots. The text of a single call of write(...) is never mixed with text of other threads.
+   *   The queue is a member of the writer, thus no memory is allocated while logging.
+   *
+   *   The background thread sleeps without timeout, when the queue is empty. Only the first text after that wakes it up,
+   *   the following texts are written without waking it up again.
+   */
+  class CAsyncLogWriter
+  {
+    public:
+      /// @return Returns the writer of the process.
+      static CAsyncLogWriter &getInstance(void);
+
+      /// @return Returns true, when the background thread is running. This is a cheap check for the logging threads.
+      static bool isRunning(void) { return IsRunning.load(std::memory_order_acquire); }
+
+      /// @brief Destructor. Stops the background thread.
+      ~CAsyncLogWriter(void);
+
+      /// @brief Copy Constructor does not exist.
+      CAsyncLogWriter(CAsyncLogWriter const &rOther) = delete;
+
+      /// @brief Starts the background thread.
+      void start(void);
+
+      /// @brief Writes all queued text and stops the background thread.
+      void stop(void);
+
+      /// @brief Waits until all text, that has been queued so far, is written.
+      void flush(void);
+
+      /// @brief Puts text into the queue.
+      /// @param pBuffer Is the stream buffer, where the text should be written to.
+      /// @param pText   Is a pointer to the text.
+      /// @param Length  Is the number of characters.
+      /// @return Returns false, when the background thread has been stopped. In this case the text must be written directly.
+      bool write(std::streambuf *pBuffer, char const *pText, size_t Length);
+
+    private:
+      /// @brief A slot of the queue.
+      struct SSlot
+      {
+        std::atomic<size_t> mSequence;
+        std::streambuf     *mpBuffer;
+        size_t              mLength;
+        char                mText[240];
+      };
+
+      /// @brief The number of slots of the queue, must be a power of two.
+      static size_t const NumberOfSlots = 1024;
+
+      /// @brief The highest number of slots, that are used by a single text. Longer texts are split.
+      static size_t const MaxSlotsPerText = 64;
+
+      /// @brief Constructor.
+      CAsyncLogWriter(void);
+
+      /// @brief Reserves consecutive slots of the queue.
+      /// @return Returns the position of the first slot.
+      size_t reserveSlots(size_t Number);
+
+      /// @brief Wakes the background thread up, when it waits for text.
+      void wakeUp(void);
+
+      /// @return Returns true, when the next slot of the consumer is filled.
+      bool hasFilledSlot(void) const;
+
+      /// @brief The function of the background thread.
+      void run(void);
+
+      /// @brief Writes all filled slots.
+      /// @return Returns true, when at least one slot has been written.
+      bool writeSlots(void);
+
+      /// @brief Is true while the background thread is running.
+      static std::atomic<bool> IsRunning;
+
+      std::atomic<size_t>           mEnqueuePosition;
+      std::atomic<size_t>           mWrittenPosition;
+      size_t                        mDequeuePosition;
+      std::atomic<bool>             mIsStopRequested;
+      std::atomic<unsigned int>     mActiveWriters;     ///< The number of threads, that are inside write(...).
+      std::atomic<bool>             mIsWaiting;         ///< Is true, while the background thread waits for text.
+      std::thread                   mThread;
+      std::mutex                    mThreadMutex;       ///< Serializes start(), stop() and flush(), that access the thread object.
+      std::mutex                    mMutex;
+      std::condition_variable       mCondition;
+      SSlot                         mSlots[NumberOfSlots];
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CASYNCLOGWRITER_H_ */
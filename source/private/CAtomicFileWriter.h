@@ -0,0 +1,97 @@
+/**
+ * @file   CAtomicFileWriter.h
+ * @author Andre Netzeband
+ * @brief  Contains a writer, that replaces a file as a whole.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CATOMICFILEWRITER_H_
+#define IRRIMGUI_CATOMICFILEWRITER_H_
+
+// library includes
+#include <fstream>
+#include <string>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Writes a file under a temporary name and moves it over the target file, when it is complete.
+   * @details
+   *   Readers see either the old or the new file, but never an incomplete one. The temporary name contains the process ID
+   *   and a counter, thus several processes and threads can write the same file at the same time. The last one wins.
+   *
+   *   The temporary file replaces the target file with a single rename, on Windows with MoveFileEx and MOVEFILE_REPLACE_EXISTING.
+   *   There is no moment without a target file.
+   */
+  class CAtomicFileWriter
+  {
+    public:
+      /// @brief Constructor. Opens the temporary file.
+      /// @param rFileName Is the name of the target file.
+      CAtomicFileWriter(std::string const &rFileName);
+
+      /// @brief Destructor. Removes the temporary file, when it has not been committed.
+      ~CAtomicFileWriter(void);
+
+      /// @return Returns true, when the temporary file could be opened.
+      bool isOpen(void) const;
+
+      /// @return Returns the stream of the temporary file.
+      std::ofstream &getStream(void) { return mFile; }
+
+      /// @brief Closes the temporary file and moves it over the target file.
+      /// @return Returns false, when the file could not be written or moved. The target file is not changed in this case.
+      bool commit(void);
+
+    private:
+      /// @brief Closes and removes the temporary file.
+      void discard(void);
+
+      std::string   mFileName;
+      std::string   mTemporaryFileName;
+      std::ofstream mFile;
+      bool          mIsFinished;
+  };
+
+  /// @brief Helper functions to read and write binary files.
+  namespace FileHelper
+  {
+
+    /// @brief Reads a value in the byte order of the machine.
+    /// @param rStream Is the stream to read from.
+    /// @param rValue  Is set to the read value.
+    /// @return Returns false, when the value could not be read.
+    template<typename T>
+    inline bool readValue(std::istream &rStream, T &rValue)
+    {
+      rStream.read(reinterpret_cast<char *>(&rValue), sizeof(T));
+      return static_cast<bool>(rStream);
+    }
+
+    /// @brief Writes a value in the byte order of the machine.
+    /// @param rStream Is the stream to write to.
+    /// @param rValue  Is the value to write.
+    template<typename T>
+    inline void writeValue(std::ostream &rStream, T const &rValue)
+    {
+      rStream.write(reinterpret_cast<char const *>(&rValue), sizeof(T));
+      return;
+    }
+
+  }
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CATOMICFILEWRITER_H_ */
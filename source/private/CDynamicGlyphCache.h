@@ -0,0 +1,167 @@
+/**
+ * @file   CDynamicGlyphCache.h
+ * @author Andre Netzeband
+ * @brief  Contains a cache for glyphs, that are rasterized when they are drawn for the first time.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CDYNAMICGLYPHCACHE_H_
+#define IRRIMGUI_CDYNAMICGLYPHCACHE_H_
+
+// library includes
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+struct stbtt_fontinfo;
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Rasterizes the glyphs of large glyph ranges (like the Chinese one) when a text needs them.
+   * @details
+   *   The cache reserves a grid of cells inside the font atlas. IMGUI asks the cache for every glyph, that is not part of
+   *   the built atlas (see IMGUI_FIND_DYNAMIC_GLYPH in imconfig.h). When the glyph is in the dynamic glyph ranges, it is
+   *   rasterized into a free cell. When all cells are used, the least recently used glyph is replaced. Glyphs, that have
+   *   been used in the current frame of the device, are never replaced, since a built draw list of any handle may still
+   *   use them. The frame of the device ends, when every handle of the device has submitted its frame (see nextFrame()).
+   *
+   *   The advance of all dynamic glyphs is known after building the atlas, thus the size of a text is always correct,
+   *   even when its glyphs have not been rasterized yet.
+   *
+   *   All methods are thread safe, since frames of different IMGUI contexts can be built in parallel.
+   */
+  class CDynamicGlyphCache
+  {
+    public:
+      /// @brief A region of the font atlas, that has changed since the last texture update.
+      struct SUpdate
+      {
+        unsigned int               mX;
+        unsigned int               mY;
+        unsigned int               mWidth;
+        unsigned int               mHeight;
+        std::vector<unsigned char> mPixels;
+      };
+
+      /// @brief Constructor. Reserves the cells inside the font atlas, thus it must be called before building the atlas.
+      /// @param rFontAtlas     Is the font atlas of the font.
+      /// @param rFontConfig    Is the configuration of the TTF file, that was used to add the font to the atlas.
+      /// @param pGlyphRanges   Is a zero terminated list of glyph ranges, that are rasterized on demand.
+      /// @param NumberOfGlyphs Is the number of glyphs, that fit into the cache at the same time.
+      CDynamicGlyphCache(ImFontAtlas &rFontAtlas, ImFontConfig const &rFontConfig, ImWchar const *pGlyphRanges, unsigned int NumberOfGlyphs);
+
+      /// @brief Destructor.
+      ~CDynamicGlyphCache(void);
+
+      /// @brief Copy Constructor does not exist.
+      CDynamicGlyphCache(CDynamicGlyphCache const &rOther) = delete;
+
+      /// @brief Assignment Operator does not exist.
+      CDynamicGlyphCache &operator=(CDynamicGlyphCache const &rOther) = delete;
+
+      /// @brief Adapts the size of the cells to the distance field spread of the font atlas (see ImFontAtlas::TexGlyphSDFSpread).
+      ///        It must be called before the atlas is built, when the spread has changed.
+      /// @param rFontAtlas Is the font atlas, that has been passed to the constructor.
+      void updateCells(ImFontAtlas &rFontAtlas);
+
+      /// @brief Sets up the cache for a built atlas. All rasterized glyphs are dropped.
+      /// @param rFontAtlas Is the font atlas, that has been passed to the constructor.
+      void build(ImFontAtlas &rFontAtlas);
+
+      /// @brief Drops all rasterized glyphs, thus the font atlas can be built again.
+      void invalidate(void);
+
+      /// @param Codepoint Is the codepoint of the glyph.
+      /// @return Returns the glyph or nullptr, when the codepoint is not part of the dynamic glyph ranges or when the cache is full.
+      ///         The glyph is pinned, thus the pointer stays valid until the next call of nextFrame().
+      ImFont::Glyph const *findGlyph(ImWchar Codepoint);
+
+      /// @brief Ends the frame of the device. The glyphs used before can be replaced afterwards.
+      /// @note  It must only be called, when no handle of the device has a frame, that is built but not submitted.
+      void nextFrame(void);
+
+      /// @brief Copies the region of the atlas, that has changed since the last call.
+      /// @param rUpdate Is filled with the changed region.
+      /// @return Returns false, when nothing has changed.
+      bool getUpdate(SUpdate &rUpdate);
+
+      /// @return Returns the font of the cache.
+      ImFont *getFont(void) const { return mpFont; }
+
+      /// @return Returns the number of glyphs, that are currently rasterized.
+      unsigned int getNumberOfGlyphs(void);
+
+      /// @return Returns the number of bytes of the pixels and the glyph table of the cache.
+      unsigned int getMemoryBytes(void);
+
+      /// @brief Looks for the cache of a font (see ImFont::DynamicGlyphs). It is called by IMGUI for every glyph, that is not part of the font atlas.
+      /// @param pFont     Is the font.
+      /// @param Codepoint Is the codepoint of the glyph.
+      /// @return Returns the glyph or nullptr.
+      static ImFont::Glyph const *findGlyph(ImFont const *pFont, ImWchar Codepoint);
+
+    private:
+      /// @return Returns true, when the codepoint is part of the dynamic glyph ranges.
+      bool isDynamicGlyph(ImWchar Codepoint) const;
+
+      /// @brief Computes the size of the cells and reserves the rectangle of all cells inside the font atlas.
+      void setupCells(ImFontAtlas &rFontAtlas);
+
+      /// @brief Rasterizes a glyph into a cell.
+      void rasterizeGlyph(unsigned int Cell, ImWchar Codepoint, int GlyphIndex);
+
+      std::mutex                               mMutex;
+      ImFont                                  *mpFont;
+      std::vector<ImWchar>                     mGlyphRanges;
+      stbtt_fontinfo                          *mpFontInfo;
+      float                                    mScale;
+      float                                    mSizePixels;
+      ImVec2                                   mGlyphExtraSpacing;
+      ImVec2                                   mGlyphOffset;
+      bool                                     mIsPixelSnapH;
+      int                                      mRectIndex;
+      unsigned int                             mNumberOfCells;
+      unsigned int                             mGlyphWidth;
+      unsigned int                             mGlyphHeight;
+      unsigned int                             mSpread;
+      unsigned int                             mCellWidth;
+      unsigned int                             mCellHeight;
+      unsigned int                             mColumns;
+      unsigned int                             mRows;
+      bool                                     mIsBuilt;
+      unsigned int                             mAtlasX;
+      unsigned int                             mAtlasY;
+      ImVec2                                   mUVScale;
+      std::vector<unsigned char>               mPixels;
+      std::vector<ImFont::Glyph>               mGlyphs;
+      std::vector<unsigned int>                mGenerations;
+      std::vector<std::list<unsigned int>::iterator> mLRUPositions;
+      std::list<unsigned int>                  mLRU;
+      std::vector<unsigned int>                mFreeCells;
+      std::unordered_map<ImWchar, unsigned int> mCells;
+      unsigned int                             mGeneration;
+      unsigned int                             mDirtyX0;
+      unsigned int                             mDirtyY0;
+      unsigned int                             mDirtyX1;
+      unsigned int                             mDirtyY1;
+      bool                                     mIsFullWarningShown;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CDYNAMICGLYPHCACHE_H_ */
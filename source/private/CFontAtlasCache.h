@@ -0,0 +1,77 @@
+/**
+ * @file   CFontAtlasCache.h
+ * @author Andre Netzeband
+ * @brief  Contains a file cache for baked font atlases.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CFONTATLASCACHE_H_
+#define IRRIMGUI_CFONTATLASCACHE_H_
+
+// library includes
+#include <string>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+  class CFontDataStore;
+
+  /**
+   * @brief Stores the pixels and glyph tables of a built font atlas in a file, thus the glyphs are not rasterized again on the next start.
+   * @details
+   *   The key of an atlas contains a hash of every TTF file together with its size, oversampling, glyph ranges and the other
+   *   settings of the font config, the settings of the atlas (like the distance field spread) and the size of every custom
+   *   rectangle (like the cells of the dynamic glyph cache).
+   *   The file name is a hash of the key, the key itself is stored in the file to detect hash collisions.
+   *
+   *   The glyph tables are stored in their memory layout and the pixels start at an aligned offset at the end of the file,
+   *   thus the file can be read with a single read per table and without any conversion.
+   */
+  class CFontAtlasCache
+  {
+    public:
+      /// @brief Constructor.
+      /// @param pDirectory Is the directory of the cache files.
+      /// @param rFontAtlas Is the font atlas with all added fonts. It does not need to be built.
+      /// @param pFontDataStore Is a pointer to the store of the TTF data, that knows the hash of released data, or nullptr.
+      CFontAtlasCache(char const *pDirectory, ImFontAtlas &rFontAtlas, CFontDataStore const *pFontDataStore = nullptr);
+
+      /// @brief Destructor.
+      ~CFontAtlasCache(void);
+
+      /// @brief Reads the pixels and glyphs from the cache file into the font atlas, as if the atlas was built.
+      /// @param rFontAtlas Is the font atlas that was passed to the constructor.
+      /// @return Returns false, when there is no cache file for the atlas or when the file is damaged. In this case the atlas is not changed.
+      /// @note  The IMGUI context of the atlas must be current, since it contains the mouse cursor positions inside the atlas.
+      bool load(ImFontAtlas &rFontAtlas) const;
+
+      /// @brief Writes the pixels and glyphs of a built font atlas to the cache file.
+      /// @param rFontAtlas Is the font atlas that was passed to the constructor.
+      /// @return Returns false, when the atlas has no pixels or when the file cannot be written.
+      bool store(ImFontAtlas const &rFontAtlas) const;
+
+      /// @return Returns the key of the font atlas.
+      std::string const &getKey(void) const { return mKey; }
+
+      /// @return Returns the name of the cache file.
+      std::string const &getFileName(void) const { return mFileName; }
+
+    private:
+      std::string mKey;
+      std::string mFileName;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CFONTATLASCACHE_H_ */
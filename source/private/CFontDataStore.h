@@ -0,0 +1,122 @@
+/**
+ * @file   CFontDataStore.h
+ * @author Andre Netzeband
+ * @brief  Contains a store, that releases the TTF data of cached fonts and loads it again on demand.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CFONTDATASTORE_H_
+#define IRRIMGUI_CFONTDATASTORE_H_
+
+// library includes
+#include <string>
+#include <vector>
+#include <IrrIMGUI/IncludeIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Remembers where the TTF data of every font config of a font atlas comes from, thus it can be released and loaded again.
+   * @details
+   *   The font atlas needs the TTF data only, when it is built. When the atlas is loaded from the font atlas cache, the data
+   *   is not needed at all. Fonts read from a file are read again and fonts added from compressed data are decompressed again
+   *   from the retained compressed data, when the atlas must be built again.
+   *
+   *   The hash of the released data is kept, thus the key of the font atlas cache can be computed without loading the data.
+   *   Font configs without source (like fonts added from uncompressed memory) keep their TTF data.
+   */
+  class CFontDataStore
+  {
+    public:
+      /// @brief Constructor.
+      CFontDataStore(void);
+
+      /// @brief Destructor.
+      ~CFontDataStore(void);
+
+      /// @brief Remembers the file of the last font config of the atlas.
+      /// @param rFontAtlas Is the font atlas.
+      /// @param pFileName  Is the name of the TTF file.
+      void addFileSource(ImFontAtlas const &rFontAtlas, char const *pFileName);
+
+      /// @brief Remembers the compressed data of the last font config of the atlas.
+      /// @param rFontAtlas         Is the font atlas.
+      /// @param pCompressedTTFData Is a pointer to the compressed data. It is not copied and must stay valid.
+      /// @param CompressedTTFSize  Is the size of the compressed data.
+      void addCompressedSource(ImFontAtlas const &rFontAtlas, void const *pCompressedTTFData, int CompressedTTFSize);
+
+      /// @brief Remembers the base85 encoded compressed data of the last font config of the atlas.
+      /// @param rFontAtlas               Is the font atlas.
+      /// @param pCompressedTTFDataBase85 Is a pointer to the zero terminated data. It is not copied and must stay valid.
+      void addBase85Source(ImFontAtlas const &rFontAtlas, char const *pCompressedTTFDataBase85);
+
+      /// @brief Forgets all sources. It must be called, when the font atlas is cleared.
+      void clear(void);
+
+      /// @brief Releases the TTF data of all font configs, that have a source.
+      /// @param rFontAtlas Is the font atlas.
+      /// @return Returns the number of released bytes.
+      unsigned int release(ImFontAtlas &rFontAtlas);
+
+      /// @brief Loads the released TTF data again, thus the font atlas can be built.
+      /// @param rFontAtlas Is the font atlas.
+      /// @return Returns false, when the data of a font config could not be loaded.
+      bool materialize(ImFontAtlas &rFontAtlas);
+
+      /// @param ConfigIndex Is the index of a font config.
+      /// @return Returns true, when the TTF data of the font config has been released.
+      bool isReleased(int ConfigIndex) const;
+
+      /// @param ConfigIndex Is the index of a released font config.
+      /// @return Returns the hash of the released TTF data, like ImHash() computes it for the data.
+      ImU32 getHash(int ConfigIndex) const;
+
+      /// @return Returns the number of bytes, that have been released and not yet loaded again.
+      unsigned int getReleasedBytes(void) const;
+
+    private:
+      /// @brief The kind of source of the TTF data.
+      enum ESourceType
+      {
+        EST_NONE,
+        EST_FILE,
+        EST_COMPRESSED,
+        EST_BASE85
+      };
+
+      /// @brief The source of the TTF data of a font config.
+      struct SSource
+      {
+        ESourceType mType;
+        std::string mFileName;
+        void const *mpData;
+        int         mSize;
+        bool        mIsReleased;
+        int         mReleasedSize;
+        ImU32       mHash;
+      };
+
+      /// @return Returns the source of the last font config of the atlas.
+      SSource &addSource(ImFontAtlas const &rFontAtlas, ESourceType Type);
+
+      /// @return Returns the TTF data loaded from the source or nullptr.
+      static void *loadData(SSource const &rSource, int &rSize);
+
+      std::vector<SSource> mSources;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CFONTDATASTORE_H_ */
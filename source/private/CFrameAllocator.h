@@ -0,0 +1,158 @@
+/**
+ * @file   CFrameAllocator.h
+ * @author Andre Netzeband
+ * @brief  Contains an allocator with size-class pools and a linear arena for the allocations of a GUI frame.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CFRAMEALLOCATOR_H_
+#define IRRIMGUI_CFRAMEALLOCATOR_H_
+
+// library includes
+#include <cstddef>
+#include <vector>
+#include <atomic>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Serves the IMGUI allocations of a frame without calling malloc and free for every block.
+   * @details
+   *   Small blocks are taken from size-class pools. Freed blocks are put into the free list of their class and are
+   *   reused by the next allocation of the same class, thus growing and shrinking IMGUI vectors do not reach the
+   *   system allocator in a steady state.
+   *
+   *   Larger blocks up to MaxArenaBlockSize are taken from a linear arena. The arena only moves a pointer forward, a chunk of the arena is reset
+   *   as soon as all of its blocks are freed. Transient buffers (temporary vectors, replaced buffers of growing vectors)
+   *   are freed during the same frame and make the chunk reusable for the next frame. Even larger blocks (like the
+   *   vertex buffers of big windows) are long-lived, they are not served by the frame allocator.
+   *
+   *   The pool slabs and arena chunks are only returned to the system when the allocator is destroyed. Every chunk is
+   *   registered globally, thus deallocateForeignBlock() can find the owner of a block, even when another IMGUI context is current.
+   *   The owner may allocate on another thread at the same time, thus a foreign block is only put into the remote free list of
+   *   its owner. The owner gives these blocks back in releaseRemoteBlocks().
+   */
+  class CFrameAllocator
+  {
+    public:
+      /// @brief Constructor.
+      CFrameAllocator(void);
+
+      /// @brief Destructor. Returns all chunks to the system.
+      ~CFrameAllocator(void);
+
+      /// @brief Copy Constructor does not exist.
+      CFrameAllocator(CFrameAllocator const &rOther) = delete;
+
+      /// @brief Allocates a block from a pool or from the arena.
+      /// @param Size                 Is the size of the block in bytes.
+      /// @param rBlockSize           Is a reference where the real size of the block is stored.
+      /// @param rIsSystemAllocation  Is a reference, that is set to true when a new chunk has been allocated from the system.
+      /// @return Returns a pointer to the block or nullptr, when the block is too large or the system has no memory left.
+      void *allocate(size_t Size, size_t &rBlockSize, bool &rIsSystemAllocation);
+
+      /// @brief Frees a block of this allocator. This is fast, since the global registry is not locked.
+      /// @param pMemory    Is a pointer to the block.
+      /// @param rBlockSize Is a reference where the real size of the freed block is stored.
+      /// @return Returns false, when the block does not belong to this allocator. In this case nothing is done.
+      bool deallocate(void *pMemory, size_t &rBlockSize);
+
+      /// @brief Frees a block of any frame allocator with a lookup in the global registry.
+      /// @details The block is put into the remote free list of its owner, it can be reused after the owner called releaseRemoteBlocks().
+      ///          Blocks of memory pages without any chunk are recognized without locking the registry.
+      /// @param pMemory    Is a pointer to the block.
+      /// @param rBlockSize Is a reference where the real size of the freed block is stored.
+      /// @return Returns false, when the block does not belong to a frame allocator. In this case nothing is done.
+      static bool deallocateForeignBlock(void *pMemory, size_t &rBlockSize);
+
+      /// @brief Gives the blocks back to the pools and the arena, that have been freed by other IMGUI contexts.
+      /// @note  Call this function from the thread, that allocates with this allocator.
+      void releaseRemoteBlocks(void);
+
+      /// @return Returns true, when at least one frame allocator owns memory chunks.
+      static bool isUsed(void);
+
+      /// @return Returns the number of bytes, that are allocated from the system for the pools and the arena.
+      size_t getReservedBytes(void) const;
+
+      /// @return Returns the number of blocks, that have not been freed so far.
+      unsigned int getNumberOfBlocks(void) const;
+
+    private:
+      /// @brief A slab of a pool or a chunk of the arena.
+      struct SChunk
+      {
+        char            *mpMemory;
+        size_t           mSize;
+        CFrameAllocator *mpOwner;
+        int              mSizeClass;   ///< The index of the size class or -1 for arena chunks.
+        unsigned int     mBlocks;      ///< The number of allocated blocks inside an arena chunk.
+        size_t           mOffset;      ///< The first free byte of an arena chunk.
+      };
+
+      /// @brief A block in the free list of a pool.
+      struct SFreeBlock
+      {
+        SFreeBlock *mpNext;
+      };
+
+      /// @brief The number of size classes (16, 32, ... 1024 bytes).
+      static unsigned int const NumberOfSizeClasses = 7;
+
+      /// @brief The size of the smallest size class.
+      static size_t const SmallestBlockSize = 16;
+
+      /// @brief The size of a slab, that is split into the blocks of a size class.
+      static size_t const SlabSize = 64 * 1024;
+
+      /// @brief The smallest size of an arena chunk.
+      static size_t const ArenaChunkSize = 256 * 1024;
+
+      /// @brief The largest block, that is taken from the arena.
+      static size_t const MaxArenaBlockSize = 64 * 1024;
+
+      /// @brief The size of the header of an arena block, that stores the size of the block.
+      static size_t const ArenaHeaderSize = 16;
+
+      /// @brief Allocates a block from the pool of a size class.
+      void *allocateFromPool(unsigned int SizeClass, bool &rIsSystemAllocation);
+
+      /// @brief Allocates a block from the arena.
+      void *allocateFromArena(size_t Size, bool &rIsSystemAllocation);
+
+      /// @brief Searches the chunk of this allocator, that contains a block.
+      /// @return Returns a pointer to the chunk or nullptr, when the block does not belong to this allocator.
+      SChunk *findChunk(char const *pBlock) const;
+
+      /// @return Returns the real size of a block.
+      static size_t getBlockSize(SChunk const *pChunk, char const *pBlock);
+
+      /// @brief Gives a block back to the pool or the arena of its chunk.
+      void releaseBlock(SChunk *pChunk, char *pBlock);
+
+      /// @brief Allocates a chunk from the system and registers it.
+      SChunk *createChunk(size_t Size, int SizeClass);
+
+      std::vector<SChunk *> mChunks;          ///< Sorted by the address of the chunks.
+      SFreeBlock           *mpFreeLists[NumberOfSizeClasses];
+      SChunk               *mpArenaChunk;
+      size_t                mReservedBytes;
+      unsigned int          mBlocks;
+      std::atomic<SFreeBlock *> mpRemoteFreeBlocks;  ///< The blocks, that have been freed by other IMGUI contexts.
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CFRAMEALLOCATOR_H_ */
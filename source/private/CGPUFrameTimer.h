@@ -0,0 +1,85 @@
+/**
+ * @file   CGPUFrameTimer.h
+ * @author Andre Netzeband
+ * @brief  Contains a timer that measures the GPU time of the GUI render pass with OpenGL timer queries.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CGPUFRAMETIMER_H_
+#define IRRIMGUI_CGPUFRAMETIMER_H_
+
+// module includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Measures the GPU time of the GUI render pass with GL_TIME_ELAPSED queries.
+   * @details
+   *   The result of a query is available some frames after it has been issued. To not stall the pipeline, the timer
+   *   uses a ring of queries and only reads the results, which are already available.
+   *   All methods must be called on the thread, that owns the OpenGL context.
+   *
+   *   Only one GL_TIME_ELAPSED query can be active at the same time. When the application measures the GUI render pass
+   *   with an own timer query, the frame is not measured, thus the query of the application is not disturbed.
+   *
+   *   The queries belong to the OpenGL context, thus they must be released with release() while the context is current.
+   *   The destructor does not call OpenGL, since the context may already be destroyed.
+   */
+  class CGPUFrameTimer
+  {
+    public:
+      /// @brief Constructor. The queries are created with the first measurement.
+      CGPUFrameTimer(void);
+
+      /// @brief Destructor. Queries, that have not been released, are left to the OpenGL context.
+      ~CGPUFrameTimer(void);
+
+      /// @brief Deletes the queries. The next measurement creates them again.
+      /// @attention The OpenGL context, that has created the queries, must be current.
+      void release(void);
+
+      /// @brief Starts the measurement of a frame.
+      /// @param FrameNumber Is the number of the frame, that is returned together with the result.
+      /// @return Returns false, when all queries are still pending or another timer query is active. In this case the frame is not measured.
+      bool begin(int FrameNumber);
+
+      /// @brief Stops the measurement, that has been started with begin(...).
+      void end(void);
+
+      /// @brief Reads the result of the oldest pending measurement, when it is available.
+      /// @param rFrameNumber Is a reference where the frame number of the measurement is stored.
+      /// @param rNanoseconds Is a reference where the GPU time in nanoseconds is stored.
+      /// @return Returns true, when a result has been read.
+      bool getResult(int &rFrameNumber, irr::u64 &rNanoseconds);
+
+      /// @return Returns true, when the OpenGL context supports timer queries.
+      static bool isSupported(void);
+
+    private:
+      /// @brief The number of measurements, that can be pending at the same time.
+      static unsigned int const NumberOfQueries = 4;
+
+      unsigned int mQueries[NumberOfQueries];
+      int          mFrameNumbers[NumberOfQueries];
+      unsigned int mFirstPendingQuery;
+      unsigned int mPendingQueries;
+      bool         mIsCreated;
+      bool         mIsRunning;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CGPUFRAMETIMER_H_ */
@@ -39,22 +39,39 @@ namespace Private
       unsigned char              *GUIFontID;
   };
 
+  /// @brief A GUI texture. The textures of the drivers are created by CGUITextureTable, that stores their GPU memory.
   class CGUITexture : public IGUITexture
   {
     public:
-      /// @brief Constructor.
+      /// @brief Constructor for a texture, that is not part of the texture table.
       CGUITexture(void);
 
+      /// @brief Constructor.
+      /// @param Handle Is the handle of the texture inside the texture table.
+      explicit CGUITexture(ImTextureID Handle);
+
       /// @brief Destructor.
       virtual ~CGUITexture(void);
 
+      /// @return Returns the handle of the texture table, that is used as Texture ID.
+      ///         A texture, that is not part of the table, returns a pointer to itself.
+      virtual ImTextureID getTextureID(void);
+
+      /// @return Returns the handle of the texture table or nullptr, if the texture is not part of the table.
+      ImTextureID getHandle(void) const { return mHandle; }
+
+      /// @return Returns true, if the texture is part of the texture table and has not been deleted.
+      bool isValid(void) const;
+
+      /// @return Returns the GPU texture ID, that is stored in the texture table.
+      ImTextureID getGPUTextureID(void) const;
+
       bool                mIsUsingOwnMemory;
       TextureSourceType   mSourceType;
       TextureSource       mSource;
-      bool                mIsValid;
-      ImTextureID         mGPUTextureID;
 
-    protected:
+    private:
+      ImTextureID         mHandle;
   };
 
 }
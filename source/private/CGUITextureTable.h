@@ -0,0 +1,187 @@
+/**
+ * @file   CGUITextureTable.h
+ * @author Andre Netzeband
+ * @brief  Contains a table of all GUI textures, that resolves the texture IDs of the draw commands.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CGUITEXTURETABLE_H_
+#define IRRIMGUI_CGUITEXTURETABLE_H_
+
+// library includes
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+// module includes
+#include "IIMGUIDriver.h"
+#include "private/CGUITexture.h"
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief A slot-map of all GUI textures of the process.
+   * @details
+   *   Every GUI texture uses an entry of the table. The texture ID of a GUI texture (see IGUITexture::getTextureID()) is a handle,
+   *   that contains the index of the entry and the generation of the entry. The generation is increased when a texture is deleted,
+   *   thus a handle of a deleted texture is detected, even when the entry is used again by another texture. The highest bit of a handle
+   *   is always set. User space addresses and OpenGL texture names never use this bit on 64 bit platforms, thus they are not mistaken
+   *   for handles. On 32 bit platforms only addresses above 2 GB could be mistaken.
+   *
+   *   The data, that is needed to draw a texture (GPU texture ID, size and format), is stored contiguously in the entries. Thus a
+   *   draw command is resolved with two array lookups. The CGUITexture objects are created inside the table as well. The entries
+   *   are allocated in blocks of BlockSize entries, when all existing entries are used. Blocks are never moved or freed before
+   *   the end of the process.
+   *
+   *   Creating and deleting textures is thread-safe. Resolving a handle does not lock, a texture must not be deleted while it is drawn.
+   */
+  class CGUITextureTable
+  {
+    public:
+      /// @brief The data of a texture, that is needed to draw it.
+      struct SEntry
+      {
+        ImTextureID    mGPUTextureID;   ///< The OpenGL texture name or the Irrlicht ITexture pointer, depending on the driver.
+        unsigned int   mWidth;
+        unsigned int   mHeight;
+        EColorFormat   mColorFormat;
+        unsigned int   mGeneration;
+        unsigned int   mNextFreeIndex;  ///< The index + 1 of the next free entry, 0 for the last one.
+        bool           mIsUsed;
+      };
+
+      /// @brief The number of entries, that are allocated at once.
+      static unsigned int const BlockSize = 1024;
+
+      /// @brief The maximum number of blocks. The index of an entry uses 32 bits of a 64 bit handle, but only 15 bits of a 32 bit handle.
+      static unsigned int const MaxBlocks = (sizeof(uintptr_t) >= 8) ? 1024 : 32;
+
+      /// @brief The maximum number of GUI textures, that can exist at the same time (1048576 on 64 bit and 32768 on 32 bit platforms).
+      static unsigned int const MaxTextures = BlockSize * MaxBlocks;
+
+      /// @return Returns the table of the process.
+      static CGUITextureTable &getInstance(void);
+
+      /// @brief Destructor.
+      ~CGUITextureTable(void);
+
+      /// @brief Copy Constructor does not exist.
+      CGUITextureTable(CGUITextureTable const &rOther) = delete;
+
+      /// @brief Creates a GUI texture in a free entry. When all entries are used, a new block of entries is allocated.
+      /// @return Returns a pointer to the new texture or nullptr, when MaxTextures textures exist already.
+      CGUITexture *createTexture(void);
+
+      /// @brief Deletes a GUI texture and invalidates its handle.
+      /// @param pTexture Is a pointer to the texture, that has been created with createTexture().
+      void deleteTexture(CGUITexture *pTexture);
+
+      /// @param pGUITexture Is a pointer to a GUI texture object.
+      /// @return Returns the GUI texture of the table or nullptr, when the object is not a valid texture of the table.
+      CGUITexture *getTexture(IGUITexture *pGUITexture);
+
+      /// @brief Sets the data of a texture in GPU memory.
+      /// @param pTexture     Is a pointer to the texture.
+      /// @param GPUTextureID Is the OpenGL texture name or the Irrlicht ITexture pointer.
+      /// @param Width        Is the number of Pixels in X direction.
+      /// @param Height       Is the number of Pixels in Y direction.
+      /// @param ColorFormat  Is the format of the GPU memory.
+      void setGPUTexture(CGUITexture *pTexture, ImTextureID GPUTextureID, unsigned int Width, unsigned int Height, EColorFormat ColorFormat);
+
+      /// @param pTexture Is a pointer to the texture.
+      /// @return Returns the entry of a texture of the table.
+      SEntry const &getEntry(CGUITexture const *pTexture) const { return getEntryAt(getIndex(pTexture->getHandle())); }
+
+      /// @param Handle Is the texture ID of a draw command.
+      /// @return Returns true, if the texture ID is a handle. Only handles have the highest bit set.
+      static bool isHandle(ImTextureID const Handle)
+      {
+        return (reinterpret_cast<uintptr_t>(Handle) & HandleTag) != 0;
+      }
+
+      /// @param Handle Is the texture ID of a draw command.
+      /// @return Returns the GPU texture ID of the texture or nullptr, if the texture has been deleted.
+      ImTextureID getGPUTextureID(ImTextureID const Handle) const
+      {
+        unsigned int const Index = getIndex(Handle);
+
+        if (Index < MaxTextures)
+        {
+          SBlock const * const pBlock = getBlock(Index);
+          if (pBlock != nullptr)
+          {
+            SEntry const &rEntry = pBlock->mEntries[Index % BlockSize];
+            if (rEntry.mIsUsed && (getHandle(Index, rEntry.mGeneration) == Handle))
+            {
+              return rEntry.mGPUTextureID;
+            }
+          }
+        }
+
+        return nullptr;
+      }
+
+    private:
+      typedef std::aligned_storage<sizeof(CGUITexture), alignof(CGUITexture)>::type TTextureMemory;
+
+      /// @brief A block of entries.
+      struct SBlock
+      {
+        SEntry         mEntries[BlockSize];
+        TTextureMemory mTextureMemory[BlockSize];   ///< The texture objects are only constructed while the entry is used.
+      };
+
+      /// @brief The bit, that marks a texture ID as handle.
+      static uintptr_t const HandleTag = static_cast<uintptr_t>(1) << (sizeof(uintptr_t) * 8 - 1);
+
+      /// @brief The number of bits of a handle, that contain the index of the entry.
+      static unsigned int const IndexBits = (sizeof(uintptr_t) >= 8) ? 32 : 15;
+
+      /// @brief Constructor. All members are set to zero by the static storage.
+      CGUITextureTable(void) {}
+
+      /// @return Returns the index of an entry inside a handle.
+      static unsigned int getIndex(ImTextureID const Handle)
+      {
+        return static_cast<unsigned int>(reinterpret_cast<uintptr_t>(Handle) & ((static_cast<uintptr_t>(1) << IndexBits) - 1));
+      }
+
+      /// @return Returns the handle of an entry. The lower IndexBits bits contain the index, the bits above contain as much
+      ///         of the generation as fits below the handle tag.
+      static ImTextureID getHandle(unsigned int const Index, unsigned int const Generation)
+      {
+        uintptr_t const GenerationMask = (HandleTag - 1) >> IndexBits;
+        return reinterpret_cast<ImTextureID>(HandleTag | ((static_cast<uintptr_t>(Generation) & GenerationMask) << IndexBits) | Index);
+      }
+
+      /// @return Returns the block of an entry or nullptr, if the block has not been allocated yet.
+      SBlock *getBlock(unsigned int const Index) const { return mpBlocks[Index / BlockSize].load(std::memory_order_acquire); }
+
+      /// @return Returns the entry with an index. Its block must have been allocated.
+      SEntry &getEntryAt(unsigned int const Index) const { return getBlock(Index)->mEntries[Index % BlockSize]; }
+
+      /// @return Returns a pointer to the memory of a texture object.
+      CGUITexture *getTextureMemory(unsigned int const Index) { return reinterpret_cast<CGUITexture *>(&getBlock(Index)->mTextureMemory[Index % BlockSize]); }
+
+      std::mutex           mMutex;
+      unsigned int         mUsedEntries;          ///< The number of entries, that have been used at least once.
+      unsigned int         mFirstFreeIndex;       ///< The index + 1 of the first free entry, 0 when there is no free entry.
+      std::atomic<SBlock*> mpBlocks[MaxBlocks];   ///< The blocks are published with release semantics, since handles are resolved without lock.
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CGUITEXTURETABLE_H_ */
@@ -0,0 +1,86 @@
+/**
+ * @file   CIMGUIBackendRegistry.h
+ * @author Andre Netzeband
+ * @brief  Contains a list of all renderers, that chooses the renderer for an Irrlicht device.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CIMGUIBACKENDREGISTRY_H_
+#define IRRIMGUI_CIMGUIBACKENDREGISTRY_H_
+
+// module includes
+#include <IrrIMGUI/IrrIMGUI.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief The features of the OpenGL context of an Irrlicht device.
+  struct SBackendCapabilities
+  {
+    /// @brief Constructor for a device without OpenGL context.
+    SBackendCapabilities(void):
+      mHasContext(false),
+      mMajorVersion(0),
+      mMinorVersion(0),
+      mHasFixedFunction(false),
+      mIsSoftwareRenderer(false),
+      mIsHeadless(false)
+    {}
+
+    bool mHasContext;          ///< Is true, when the device has an OpenGL context.
+    int  mMajorVersion;
+    int  mMinorVersion;
+    bool mHasFixedFunction;    ///< Is false for core profiles, that do not have the fixed function pipeline anymore.
+    bool mIsSoftwareRenderer;  ///< Is true, when OpenGL is rendered on the CPU (for example by Mesa llvmpipe).
+    bool mIsHeadless;          ///< Is true for the NULL device. It has no context, but an explicitly requested renderer is used anyway.
+  };
+
+  /**
+   * @brief A list of all renderers, that are compiled into the library.
+   * @details
+   *   The renderers are sorted from the fastest to the slowest one. Every renderer has a function that checks,
+   *   whether the OpenGL context of the device supports it. The first supported renderer is chosen, unless
+   *   the user requests another supported renderer with SIMGUISettings::mBackend. The NULL device has no context and chooses
+   *   the null renderer. When a headless application draws into its own OpenGL context, it has to request the renderer.
+   */
+  class CIMGUIBackendRegistry
+  {
+    public:
+      /// @brief An entry of the list.
+      struct SBackend
+      {
+        EIMGUIBackend mBackend;
+        char const *  mpName;
+        bool        (*mpIsSupported)(SBackendCapabilities const &rCapabilities);
+      };
+
+      /// @brief Reads the version, the profile and the renderer of the OpenGL context of a device.
+      /// @param pDevice Is a pointer to the Irrlicht device. Its OpenGL context must be current.
+      /// @return Returns the features of the context.
+      static SBackendCapabilities probeCapabilities(irr::IrrlichtDevice *pDevice);
+
+      /// @brief Chooses a renderer.
+      /// @param rCapabilities Are the features of the OpenGL context.
+      /// @param Requested     Is the renderer, that has been requested by the user, or EIB_AUTOMATIC.
+      /// @return Returns the requested renderer, if it is supported. Otherwise the fastest supported renderer.
+      static SBackend const &selectBackend(SBackendCapabilities const &rCapabilities, EIMGUIBackend Requested);
+
+      /// @param Backend Is a renderer.
+      /// @return Returns the entry of a renderer or nullptr, when it is not compiled into the library.
+      static SBackend const *getBackend(EIMGUIBackend Backend);
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CIMGUIBACKENDREGISTRY_H_ */
@@ -0,0 +1,74 @@
+/**
+ * @file   CProgramBinaryCache.h
+ * @author Andre Netzeband
+ * @brief  Contains a file cache for linked OpenGL shader programs.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CPROGRAMBINARYCACHE_H_
+#define IRRIMGUI_CPROGRAMBINARYCACHE_H_
+
+// library includes
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief Stores the binary of a linked shader program (see glGetProgramBinary) in a file.
+   * @details
+   *   A program binary can only be loaded by the same driver in the same version, thus the key of a program contains
+   *   the vendor, the renderer and the version of the OpenGL context together with the shader sources. The file name is
+   *   a hash of the key, the key itself is stored in the file to detect hash collisions.
+   *
+   *   The driver can still reject a binary (for example after a driver update with the same version string),
+   *   thus a loaded binary must always be checked with the link status.
+   */
+  class CProgramBinaryCache
+  {
+    public:
+      /// @brief Constructor.
+      /// @param pDirectory Is the directory of the cache files.
+      /// @param rKey       Is the key of the program.
+      CProgramBinaryCache(char const *pDirectory, std::string const &rKey);
+
+      /// @brief Destructor.
+      ~CProgramBinaryCache(void);
+
+      /// @brief Reads the program binary from the cache file.
+      /// @param rFormat Is set to the binary format of the program.
+      /// @param rBinary Is filled with the program binary.
+      /// @return Returns false, when there is no cache file for the key or when the file is damaged.
+      bool load(unsigned int &rFormat, std::vector<char> &rBinary) const;
+
+      /// @brief Writes a program binary to the cache file.
+      /// @param Format  Is the binary format of the program.
+      /// @param pBinary Is a pointer to the program binary.
+      /// @param Size    Is the number of bytes of the binary.
+      /// @return Returns false, when the file cannot be written.
+      bool store(unsigned int Format, void const *pBinary, size_t Size) const;
+
+      /// @return Returns the name of the cache file.
+      std::string const &getFileName(void) const { return mFileName; }
+
+    private:
+      std::string mKey;
+      std::string mFileName;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CPROGRAMBINARYCACHE_H_ */
@@ -0,0 +1,104 @@
+/**
+ * @file   CTraceWriter.h
+ * @author Andre Netzeband
+ * @brief  Contains a writer, that streams trace events into a Chrome trace file.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CTRACEWRITER_H_
+#define IRRIMGUI_CTRACEWRITER_H_
+
+// library includes
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// module includes
+#include <IrrIMGUI/IncludeIrrlicht.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /// @brief A single event of the trace.
+  struct STraceEvent
+  {
+    char const * mpName;
+    char const * mpArgumentName;
+    long long    mArgumentValue;
+    irr::u64     mStartNanoseconds;
+    irr::u64     mEndNanoseconds;
+    unsigned int mThreadID;
+  };
+
+  /**
+   * @brief Collects trace events and writes them with a background thread into a Chrome "trace_event" JSON file.
+   * @details
+   *   The threads, that add events, only append them to a list. The background thread takes the whole list periodically
+   *   and formats the events, thus the file operations never block the GUI frame.
+   */
+  class CTraceWriter
+  {
+    public:
+      /// @brief Constructor.
+      CTraceWriter(void);
+
+      /// @brief Destructor. Stops a running trace.
+      ~CTraceWriter(void);
+
+      /// @brief Opens the file and starts the background thread.
+      /// @param pFileName Is the name of the file.
+      /// @return Returns false, when the writer is already running or when the file cannot be opened.
+      bool start(char const * pFileName);
+
+      /// @brief Writes all remaining events, closes the file and stops the background thread.
+      void stop(void);
+
+      /// @brief Adds an event. When the writer is not running, the event is ignored.
+      /// @param rEvent Is a reference to the event.
+      void addEvent(STraceEvent const &rEvent);
+
+    private:
+      /// @brief The main loop of the background thread.
+      void writerLoop(void);
+
+      /// @brief Writes events into the file.
+      /// @param rEvents Is a reference to the events to write.
+      void writeEvents(std::vector<STraceEvent> const &rEvents);
+
+      /// @brief Writes a string as JSON string into the file.
+      /// @param pString Is the string to write.
+      void writeString(char const * pString);
+
+      /// @brief Writes a time in nanoseconds as microseconds into the file.
+      /// @param Nanoseconds Is the time to write.
+      void writeMicroseconds(irr::u64 Nanoseconds);
+
+      std::mutex               mControlMutex;
+      std::mutex               mMutex;
+      std::condition_variable  mCondition;
+      std::vector<STraceEvent> mPendingEvents;
+      std::vector<STraceEvent> mWrittenEvents;
+      std::ofstream            mFile;
+      std::thread              mThread;
+      irr::u64                 mStartNanoseconds;
+      bool                     mIsRunning;
+      bool                     mIsStopRequested;
+      bool                     mIsFirstEvent;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_CTRACEWRITER_H_ */
@@ -0,0 +1,108 @@
+/**
+ * @file   CWorkStealingPool.h
+ * @author Andre Netzeband
+ * @brief  Contains a thread pool that distributes tasks by work-stealing.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_CWORKSTEALINGPOOL_H_
+#define IRRIMGUI_CWORKSTEALINGPOOL_H_
+
+// library includes
+#include <functional>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <exception>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+namespace IrrIMGUI
+{
+namespace Private
+{
+
+  /**
+   * @brief A pool of worker threads, that executes a list of tasks and returns when all of them are done.
+   * @details
+   *   Every thread (including the calling one) owns a task queue. The tasks are distributed round-robin over the queues.
+   *   A thread takes the tasks from the back of its own queue and steals from the front of the other queues, when its own queue is empty.
+   *   Thus a few long tasks on one queue do not delay the tasks in the other queues.
+   */
+  class CWorkStealingPool
+  {
+    public:
+      /// @brief The type of a single task.
+      typedef std::function<void(void)> Task;
+
+      /// @{
+      /// @name Constructor and Destructor
+
+      /// @brief Constructor.
+      /// @param NumberOfThreads Is the number of threads that execute tasks (including the calling thread). Pass 0 to use one thread per CPU core.
+      CWorkStealingPool(unsigned int NumberOfThreads);
+
+      /// @brief Destructor. Stops and joins all worker threads.
+      ~CWorkStealingPool(void);
+
+      /// @}
+
+      /// @{
+      /// @name Task execution
+
+      /// @brief Executes all tasks and returns when all of them are done. The calling thread takes part in the execution.
+      /// @param rTasks Is a reference to the list of tasks.
+      /// @note  When tasks throw an exception, all other tasks are still executed. Afterwards the first exception is rethrown.
+      void run(std::vector<Task> const &rTasks);
+
+      /// @return Returns the number of threads that execute tasks (including the calling thread).
+      unsigned int getNumberOfThreads(void) const;
+
+      /// @}
+
+    private:
+      /// @brief The task queue of a single thread.
+      struct SQueue
+      {
+        std::mutex               mMutex;
+        std::deque<Task const *> mTasks;
+      };
+
+      /// @brief The main function of a worker thread.
+      /// @param QueueIndex Is the index of the own queue.
+      void workerLoop(unsigned int QueueIndex);
+
+      /// @brief Executes tasks until all queues are empty.
+      /// @param QueueIndex Is the index of the own queue.
+      void executeTasks(unsigned int QueueIndex);
+
+      /// @brief Takes a task from the own queue or steals one from another queue.
+      /// @param QueueIndex Is the index of the own queue.
+      /// @return Returns a pointer to the task or nullptr, when all queues are empty.
+      Task const * getTask(unsigned int QueueIndex);
+
+      std::vector<std::unique_ptr<SQueue>> mQueues;
+      std::vector<std::thread>             mThreads;
+      std::mutex                           mMutex;
+      std::condition_variable              mStartCondition;
+      std::condition_variable              mFinishCondition;
+      unsigned int                         mGeneration;
+      bool                                 mIsStopped;
+      std::atomic<unsigned int>            mOpenTasks;
+      std::exception_ptr                   mException;
+  };
+
+}
+}
+
+/**
+ * @}
+ */
+
+#endif  // IRRIMGUI_CWORKSTEALINGPOOL_H_
@@ -68,6 +68,8 @@
 /// @name Debug and Error logging to console
 
 /// @brief Prints an note to std::out. It is only active for debug level 2.
+/// @details The records of all LOG macros are formatted with a stream of the calling thread and are written as a whole.
+///          Below the debug level, the macro is empty and the stream expression is not evaluated at all.
 /// @param string Is the stream to print.
 #define LOG_NOTE(string)
 
@@ -125,20 +127,23 @@
 #define ASSERT(expr)
 #endif // _DEBUG
 
+/// formats the record with the stream of the calling thread and writes it as a whole to the channel
+#define LOG_RECORD(Channel, string) { if ((Channel).isRecordAllowed()) { IrrIMGUI::Debug::CRecordStream &rLogRecord = IrrIMGUI::Debug::CRecordStream::start(Channel); rLogRecord << string; rLogRecord.finish(); } }
+
 #if IS_DEBUG_LEVEL(DEBUG_LEVEL_NOTE)
-#define LOG_NOTE(string)    { (IrrIMGUI::Debug::NoteOutput)    << string << std::flush; }
+#define LOG_NOTE(string)    LOG_RECORD(IrrIMGUI::Debug::NoteOutput,    string)
 #else  // DEBUG_LEVEL_NOTE
 #define LOG_NOTE(string)
 #endif // DEBUG_LEVEL_NOTE
 
 #if IS_DEBUG_LEVEL(DEBUG_LEVEL_WARNING)
-#define LOG_WARNING(string) { (IrrIMGUI::Debug::WarningOutput) << string << std::flush; }
+#define LOG_WARNING(string) LOG_RECORD(IrrIMGUI::Debug::WarningOutput, string)
 #else  // DEBUG_LEVEL_WARNING
 #define LOG_WARNING(string)
 #endif // DEBUG_LEVEL_WARNING
 
 #if IS_DEBUG_LEVEL(DEBUG_LEVEL_ERROR)
-#define LOG_ERROR(string)   { (IrrIMGUI::Debug::ErrorOutput)   << string << std::flush; }
+#define LOG_ERROR(string)   LOG_RECORD(IrrIMGUI::Debug::ErrorOutput,   string)
 #else  // DEBUG_LEVEL_ERROR
 #define LOG_ERROR(string)
 #endif // DEBUG_LEVEL_ERROR
@@ -0,0 +1,61 @@
+/**
+ * @file   IrrIMGUIDrawData_priv.h
+ * @author Andre Netzeband
+ * @brief  Contains the constants of the draw data capture format.
+ * @addtogroup IrrIMGUIPrivate
+ */
+
+#ifndef IRRIMGUI_SOURCE_IRRIMGUIDRAWDATA_PRIV_H_
+#define IRRIMGUI_SOURCE_IRRIMGUIDRAWDATA_PRIV_H_
+
+// library includes
+#include <cstdint>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+namespace IrrIMGUI {
+namespace Private {
+
+/**
+ * @brief Contains the constants of the draw data capture format.
+ * @details
+ *   All values are stored in the byte order of the capturing machine.
+ *
+ *   File header:  Magic (4 chars), Version (u32), sizeof(ImDrawVert) (u32), sizeof(ImDrawIdx) (u32)
+ *   Frame:        FrameMarker (u32), NumberOfLists (u32), DisplayWidth (f32), DisplayHeight (f32), FontTexture (u64), Lists
+ *   List:         ListRepeat (u8) or ListData (u8), NumberOfVertices (u32), NumberOfIndices (u32), NumberOfCommands (u32),
+ *                 Vertices (raw), Indices (raw), Commands
+ *   Command:      ElementCount (u32), ClipRect (4 x f32), Texture (u64)
+ */
+namespace DrawData {
+
+/// @brief The magic characters at the beginning of every capture file.
+static char const Magic[4] = {'I', 'M', 'D', 'D'};
+
+/// @brief The version of the capture format.
+static uint32_t const Version = 1;
+
+/// @brief The marker at the beginning of every frame.
+static uint32_t const FrameMarker = 0x454D5246;
+
+/// @brief The draw list is equal to the draw list at the same position in the previous frame.
+static uint8_t const ListRepeat = 0;
+
+/// @brief The draw list data follows.
+static uint8_t const ListData = 1;
+
+/// @brief The number of bytes of a stored draw command: element count, clipping rectangle and texture.
+static uint32_t const CommandSize = sizeof(uint32_t) + 4 * sizeof(float) + sizeof(uint64_t);
+
+}
+}
+}
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_IRRIMGUIDRAWDATA_PRIV_H_ */
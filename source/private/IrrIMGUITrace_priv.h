@@ -0,0 +1,36 @@
+/**
+ * @file   IrrIMGUITrace_priv.h
+ * @author Andre Netzeband
+ * @brief  Contains macros to add trace markers to the GUI frame path.
+ * @addtogroup IrrIMGUITrace
+ */
+
+#ifndef IRRIMGUI_SOURCE_IRRIMGUITRACE_PRIV_H_
+#define IRRIMGUI_SOURCE_IRRIMGUITRACE_PRIV_H_
+
+// module includes
+#include <IrrIMGUI/IrrIMGUITrace.h>
+
+/**
+ * @addtogroup IrrIMGUIPrivate
+ * @{
+ */
+
+#define _TRACE_CONCAT(a, b) a##b
+#define TRACE_CONCAT(a, b) _TRACE_CONCAT(a, b)
+
+/// @brief Records the rest of the current scope as trace event.
+/// @param name Is the name of the event (a static string).
+#define TRACE_SCOPE(name) IrrIMGUI::Trace::CTraceScope TRACE_CONCAT(TraceScope, __LINE__)(name)
+
+/// @brief Records the rest of the current scope as trace event with an argument.
+/// @param name     Is the name of the event (a static string).
+/// @param argument Is the name of the argument (a static string).
+/// @param value    Is the integer value of the argument.
+#define TRACE_SCOPE_ARG(name, argument, value) IrrIMGUI::Trace::CTraceScope TRACE_CONCAT(TraceScope, __LINE__)(name, argument, static_cast<long long>(value))
+
+/**
+ * @}
+ */
+
+#endif /* IRRIMGUI_SOURCE_IRRIMGUITRACE_PRIV_H_ */
@@ -0,0 +1,172 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestBackendRegistry.cpp
+ * @brief Contains unit tests for the choice of the renderer.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CIMGUIBackendRegistry.h>
+#include <CGUITexture.h>
+#include <sstream>
+#include <string>
+
+using namespace IrrIMGUI;
+using namespace IrrIMGUI::Private;
+
+TEST_GROUP(TestBackendRegistry)
+{
+  std::streambuf * mpStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpStreamBuffer = Debug::WarningOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::WarningOutput.rdbuf(mpStreamBuffer);
+  }
+
+  /// @return Returns the features of an OpenGL context.
+  static SBackendCapabilities getCapabilities(int const MajorVersion, int const MinorVersion, bool const HasFixedFunction)
+  {
+    SBackendCapabilities Capabilities;
+    Capabilities.mHasContext       = true;
+    Capabilities.mMajorVersion     = MajorVersion;
+    Capabilities.mMinorVersion     = MinorVersion;
+    Capabilities.mHasFixedFunction = HasFixedFunction;
+    return Capabilities;
+  }
+};
+
+TEST(TestBackendRegistry, checkAutomaticChoice)
+{
+  // the shader is the fastest renderer and needs OpenGL 3.3
+  CHECK_EQUAL(EIB_OPENGL3, CIMGUIBackendRegistry::selectBackend(getCapabilities(4, 5, false), EIB_AUTOMATIC).mBackend);
+  CHECK_EQUAL(EIB_OPENGL3, CIMGUIBackendRegistry::selectBackend(getCapabilities(3, 3, true),  EIB_AUTOMATIC).mBackend);
+
+#ifdef _IRRIMGUI_NATIVE_OPENGL_
+  CHECK_EQUAL(EIB_OPENGL2, CIMGUIBackendRegistry::selectBackend(getCapabilities(2, 1, true),  EIB_AUTOMATIC).mBackend);
+#else
+  CHECK_EQUAL(EIB_NULL,    CIMGUIBackendRegistry::selectBackend(getCapabilities(2, 1, true),  EIB_AUTOMATIC).mBackend);
+#endif // _IRRIMGUI_NATIVE_OPENGL_
+
+  // a core profile below OpenGL 3.3 has neither the fixed function pipeline nor the shader version
+  CHECK_EQUAL(EIB_NULL,    CIMGUIBackendRegistry::selectBackend(getCapabilities(3, 2, false), EIB_AUTOMATIC).mBackend);
+
+  // without OpenGL context only the null renderer is possible
+  CHECK_EQUAL(EIB_NULL,    CIMGUIBackendRegistry::selectBackend(SBackendCapabilities(), EIB_AUTOMATIC).mBackend);
+
+  return;
+}
+
+TEST(TestBackendRegistry, checkRequestedBackend)
+{
+  std::stringstream WarningOutput;
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  CHECK_EQUAL(EIB_NULL,    CIMGUIBackendRegistry::selectBackend(getCapabilities(4, 5, true), EIB_NULL).mBackend);
+  CHECK_EQUAL(std::string(""), WarningOutput.str());
+
+  // an unsupported renderer is replaced by the fastest supported one
+  CHECK_EQUAL(EIB_OPENGL3, CIMGUIBackendRegistry::selectBackend(getCapabilities(4, 5, false), EIB_OPENGL2).mBackend);
+  CHECK_EQUAL(false, WarningOutput.str().empty());
+
+  WarningOutput.str("");
+  CHECK_EQUAL(EIB_NULL,    CIMGUIBackendRegistry::selectBackend(SBackendCapabilities(), EIB_OPENGL3).mBackend);
+  CHECK_EQUAL(false, WarningOutput.str().empty());
+
+  return;
+}
+
+TEST(TestBackendRegistry, checkNullBackend)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGuiIO &rIMGUI = ImGui::GetIO();
+
+  CHECK_EQUAL(true, rIMGUI.RenderDrawListsFn != nullptr);
+  CHECK_EQUAL(true, rIMGUI.Fonts->TexID != nullptr);
+
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(4, 4));
+  IGUITexture * const pTexture = pGUI->createTexture(pImage);
+  CGUITexture * const pRealTexture = dynamic_cast<CGUITexture *>(pTexture);
+
+  CHECK(pRealTexture != nullptr);
+  CHECK_EQUAL(true,       pRealTexture->isValid());
+  CHECK_EQUAL(ETST_IMAGE, pRealTexture->mSourceType);
+  POINTERS_EQUAL(pImage,  pRealTexture->mSource.ImageID);
+
+  // the GUI is calculated, but not drawn
+  pGUI->startGUI();
+  ImGui::Begin("NullWindow");
+  ImGui::Image(pTexture->getTextureID(), ImVec2(4.0f, 4.0f));
+  ImGui::End();
+  pGUI->drawAll();
+
+  pGUI->deleteTexture(pTexture);
+  pImage->drop();
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestBackendRegistry, checkNullDeviceIsHeadless)
+{
+  std::stringstream WarningOutput;
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  // the NULL device has no OpenGL context, thus the null renderer is chosen automatically
+  SBackendCapabilities const Capabilities = CIMGUIBackendRegistry::probeCapabilities(pDevice);
+  CHECK_EQUAL(false,    Capabilities.mHasContext);
+  CHECK_EQUAL(true,     Capabilities.mIsHeadless);
+  CHECK_EQUAL(EIB_NULL, CIMGUIBackendRegistry::selectBackend(Capabilities, EIB_AUTOMATIC).mBackend);
+
+  // a requested renderer is used, since the application provides the context
+  CHECK_EQUAL(EIB_OPENGL3, CIMGUIBackendRegistry::selectBackend(Capabilities, EIB_OPENGL3).mBackend);
+  CHECK_EQUAL(std::string(""), WarningOutput.str());
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  CHECK_EQUAL(std::string(""), WarningOutput.str());
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
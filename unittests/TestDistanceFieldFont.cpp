@@ -0,0 +1,218 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestDistanceFieldFont.cpp
+ * @brief Contains unit tests for font atlases, that store the glyphs as signed distance field.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CFontAtlasCache.h>
+#include <IMGUI/imgui_internal.h>
+#include <sstream>
+#include <string>
+
+using namespace IrrIMGUI;
+using namespace IrrIMGUI::Private;
+
+TEST_GROUP(TestDistanceFieldFont)
+{
+  std::streambuf *  mpNoteStreamBuffer;
+  std::stringstream mNoteOutput;
+
+  TEST_SETUP()
+  {
+    mpNoteStreamBuffer = Debug::NoteOutput.rdbuf();
+    Debug::NoteOutput.rdbuf(mNoteOutput.rdbuf());
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::NoteOutput.rdbuf(mpNoteStreamBuffer);
+  }
+
+  /// @return Returns the size of a glyph quad in pixels.
+  static ImVec2 getQuadSize(ImFont::Glyph const &rGlyph)
+  {
+    return ImVec2(rGlyph.X1 - rGlyph.X0, rGlyph.Y1 - rGlyph.Y0);
+  }
+};
+
+TEST(TestDistanceFieldFont, checkDistanceFieldGlyphs)
+{
+  int const Spread = 4;
+
+  // without oversampling the glyphs of both atlases have the same pixel raster
+  ImFontConfig FontConfig;
+  FontConfig.OversampleH = 1;
+  FontConfig.OversampleV = 1;
+
+  unsigned char * pCoveragePixels = nullptr;
+  int CoverageWidth = 0;
+  int CoverageHeight = 0;
+  ImFontAtlas CoverageAtlas;
+  ImFont * const pCoverageFont = CoverageAtlas.AddFontFromFileTTF("../../media/Karla-Regular.ttf", 32.0f, &FontConfig);
+  CoverageAtlas.GetTexDataAsAlpha8(&pCoveragePixels, &CoverageWidth, &CoverageHeight);
+
+  unsigned char * pPixels = nullptr;
+  int Width = 0;
+  int Height = 0;
+  ImFontAtlas Atlas;
+  Atlas.TexGlyphSDFSpread = Spread;
+  ImFont * const pFont = Atlas.AddFontFromFileTTF("../../media/Karla-Regular.ttf", 32.0f, &FontConfig);
+  Atlas.GetTexDataAsAlpha8(&pPixels, &Width, &Height);
+
+  for(ImWchar const Codepoint : { 'A', 'g', '#', '@', 'i' })
+  {
+    ImFont::Glyph const * const pCoverageGlyph = pCoverageFont->FindGlyph(Codepoint);
+    ImFont::Glyph const * const pGlyph         = pFont->FindGlyph(Codepoint);
+    CHECK_EQUAL(Codepoint, pGlyph->Codepoint);
+
+    // the quad contains the distance field around the glyph
+    CHECK_EQUAL(pCoverageGlyph->X0 - Spread, pGlyph->X0);
+    CHECK_EQUAL(pCoverageGlyph->Y0 - Spread, pGlyph->Y0);
+    CHECK_EQUAL(pCoverageGlyph->X1 + Spread, pGlyph->X1);
+    CHECK_EQUAL(pCoverageGlyph->Y1 + Spread, pGlyph->Y1);
+    CHECK_EQUAL(pCoverageGlyph->XAdvance,    pGlyph->XAdvance);
+
+    int const CoverageX0  = static_cast<int>(pCoverageGlyph->U0 * CoverageWidth + 0.5f);
+    int const CoverageY0  = static_cast<int>(pCoverageGlyph->V0 * CoverageHeight + 0.5f);
+    int const X0          = static_cast<int>(pGlyph->U0 * Width + 0.5f);
+    int const Y0          = static_cast<int>(pGlyph->V0 * Height + 0.5f);
+    int const QuadWidth   = static_cast<int>((pGlyph->U1 - pGlyph->U0) * Width + 0.5f);
+    int const QuadHeight  = static_cast<int>((pGlyph->V1 - pGlyph->V0) * Height + 0.5f);
+    int const GlyphWidth  = QuadWidth  - 2 * Spread;
+    int const GlyphHeight = QuadHeight - 2 * Spread;
+    CHECK(GlyphWidth > 0);
+    CHECK(GlyphHeight > 0);
+
+    // covered pixels are inside of the outline and empty pixels are outside
+    for(int Y = 0; Y < GlyphHeight; Y++)
+    {
+      for(int X = 0; X < GlyphWidth; X++)
+      {
+        unsigned char const Coverage = pCoveragePixels[(CoverageY0 + Y) * CoverageWidth + CoverageX0 + X];
+        unsigned char const Distance = pPixels[(Y0 + Spread + Y) * Width + X0 + Spread + X];
+        if(Coverage == 255)
+        {
+          CHECK(Distance > 128);
+        }
+        else if(Coverage == 0)
+        {
+          CHECK(Distance < 128);
+        }
+      }
+    }
+
+    // the corners of the quad are farther away from the outline than the spread
+    CHECK_EQUAL(0, pPixels[Y0 * Width + X0]);
+    CHECK_EQUAL(0, pPixels[(Y0 + QuadHeight - 1) * Width + X0 + QuadWidth - 1]);
+  }
+
+  CoverageAtlas.Clear();
+  Atlas.Clear();
+
+  return;
+}
+
+TEST(TestDistanceFieldFont, checkDistanceFieldSetting)
+{
+  // the null renderer has no shader renderer, that would build the whole atlas again when it is prepared
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImFontAtlas * const pFontAtlas = ImGui::GetIO().Fonts;
+
+  ImFont * const pFont = pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 32.0f);
+  pGUI->compileFonts();
+  CHECK_EQUAL(0, pFontAtlas->TexGlyphSDFSpread);
+  ImVec2 const CoverageSize = getQuadSize(*pFont->FindGlyph('A'));
+  std::string const CoverageKey = CFontAtlasCache(".", *pFontAtlas).getKey();
+
+  // the spread is applied, when the fonts are compiled
+  Settings.mFontSDFSpread = 6;
+  pGUI->setSettings(Settings);
+  CHECK_EQUAL(0, pFontAtlas->TexGlyphSDFSpread);
+
+  pGUI->compileFonts();
+  CHECK_EQUAL(6, pFontAtlas->TexGlyphSDFSpread);
+  CHECK(getQuadSize(*pFont->FindGlyph('A')).x >= CoverageSize.x + 2 * 6 - 1);
+  CHECK(getQuadSize(*pFont->FindGlyph('A')).y == CoverageSize.y + 2 * 6);
+  CHECK(CFontAtlasCache(".", *pFontAtlas).getKey() != CoverageKey);
+
+  // fonts added afterwards are appended as distance field
+  ImFont * const pAppendedFont = pGUI->addFontFromFileTTF("../../media/Karla-Regular.ttf", 32.0f);
+  pGUI->compileFonts();
+  CHECK(pAppendedFont->FindGlyph('A')->X0 < 0.0f);
+
+  Settings.mFontSDFSpread = 0;
+  pGUI->setSettings(Settings);
+  pGUI->compileFonts();
+  CHECK_EQUAL(0, pFontAtlas->TexGlyphSDFSpread);
+  CHECK_EQUAL(CoverageSize.y, getQuadSize(*pFont->FindGlyph('A')).y);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestDistanceFieldFont, checkDynamicDistanceFieldGlyphs)
+{
+  static ImWchar const CyrillicGlyphRanges[] = { 0x0400, 0x04FF, 0 };
+
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+  ImFont * const pFont = pGUI->addDynamicFontFromFileTTF("../../media/DroidSans.ttf", 32.0f, CyrillicGlyphRanges, 16);
+  pGUI->compileFonts();
+  ImVec2 const CoverageSize = getQuadSize(*pFont->FindGlyph(0x0416));
+
+  // the cells of the dynamic glyphs grow with the spread
+  Settings.mFontSDFSpread = 4;
+  pGUI->setSettings(Settings);
+  pGUI->compileFonts();
+
+  ImFont::Glyph const * const pGlyph = pFont->FindGlyph(0x0416);
+  CHECK_EQUAL(0x0416, pGlyph->Codepoint);
+  CHECK_EQUAL(CoverageSize.x + 2 * 4, getQuadSize(*pGlyph).x);
+  CHECK_EQUAL(CoverageSize.y + 2 * 4, getQuadSize(*pGlyph).y);
+  CHECK(pGlyph->U1 <= 1.0f);
+  CHECK(pGlyph->V1 <= 1.0f);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
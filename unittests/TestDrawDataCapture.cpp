@@ -0,0 +1,320 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestDrawDataCapture.cpp
+ * @brief Contains unit tests for the capture and replay of draw data.
+ */
+
+// library includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IrrIMGUI/CIMGUIDrawDataWriter.h>
+#include <IrrIMGUI/CIMGUIDrawDataReader.h>
+
+using namespace IrrIMGUI;
+
+/// @brief The file, where the draw data of the tests is captured to.
+static char const * const CaptureFileName = "TestDrawDataCapture.imdd";
+
+/// @brief Fills a draw list with a single rectangle.
+static void fillList(ImDrawList &rList, float const Position, ImTextureID const Texture)
+{
+  rList.VtxBuffer.clear();
+  rList.IdxBuffer.clear();
+  rList.CmdBuffer.clear();
+
+  for (int i = 0; i < 4; i++)
+  {
+    ImDrawVert Vertex;
+    Vertex.pos = ImVec2(Position + static_cast<float>(i), Position);
+    Vertex.uv  = ImVec2(0.0f, 1.0f);
+    Vertex.col = 0xFF00FF00;
+    rList.VtxBuffer.push_back(Vertex);
+  }
+
+  ImDrawIdx const Indices[] = {0, 1, 2, 0, 2, 3};
+  for (ImDrawIdx const Index : Indices)
+  {
+    rList.IdxBuffer.push_back(Index);
+  }
+
+  ImDrawCmd Command;
+  Command.ElemCount = 6;
+  Command.ClipRect  = ImVec4(0.0f, 0.0f, 100.0f, 200.0f);
+  Command.TextureId = Texture;
+  rList.CmdBuffer.push_back(Command);
+
+  return;
+}
+
+/// @brief Captures a frame with a single rectangle and overwrites the bytes at an offset of the frame.
+template<typename T>
+static void writeCorruptFile(size_t const FrameOffset, T const Value)
+{
+  ImDrawList List;
+  ImDrawList * pList = &List;
+  fillList(List, 10.0f, nullptr);
+
+  ImDrawData DrawData;
+  DrawData.Valid         = true;
+  DrawData.CmdLists      = &pList;
+  DrawData.CmdListsCount = 1;
+
+  {
+    CIMGUIDrawDataWriter Writer;
+    Writer.open(CaptureFileName);
+    Writer.writeFrame(&DrawData, ImVec2(640.0f, 480.0f), nullptr);
+  }
+
+  // the file header consists of magic, version, vertex size and index size
+  size_t const FileHeaderSize = 4 * sizeof(uint32_t);
+
+  std::fstream File(CaptureFileName, std::ios::in | std::ios::out | std::ios::binary);
+  File.seekp(static_cast<std::streamoff>(FileHeaderSize + FrameOffset));
+  File.write(reinterpret_cast<char const *>(&Value), sizeof(T));
+
+  return;
+}
+
+TEST_GROUP(TestDrawDataCapture)
+{
+  std::streambuf * mpStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpStreamBuffer = Debug::ErrorOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::ErrorOutput.rdbuf(mpStreamBuffer);
+    std::remove(CaptureFileName);
+  }
+};
+
+TEST(TestDrawDataCapture, checkWriteAndReplayFrames)
+{
+  ImTextureID const FontTexture  = reinterpret_cast<ImTextureID>(0x100);
+  ImTextureID const ImageTexture = reinterpret_cast<ImTextureID>(0x200);
+
+  ImDrawList Lists[2];
+  ImDrawList * ListPointers[2] = {&Lists[0], &Lists[1]};
+  fillList(Lists[0], 10.0f, FontTexture);
+  fillList(Lists[1], 20.0f, ImageTexture);
+
+  ImDrawData DrawData;
+  DrawData.Valid         = true;
+  DrawData.CmdLists      = ListPointers;
+  DrawData.CmdListsCount = 2;
+
+  {
+    CIMGUIDrawDataWriter Writer;
+    CHECK(Writer.open(CaptureFileName));
+
+    CHECK(Writer.writeFrame(&DrawData, ImVec2(640.0f, 480.0f), FontTexture));
+    irr::u64 const FirstFrameBytes = Writer.getNumberOfBytes();
+
+    // unchanged draw lists are only stored as marker
+    CHECK(Writer.writeFrame(&DrawData, ImVec2(640.0f, 480.0f), FontTexture));
+    CHECK((Writer.getNumberOfBytes() - FirstFrameBytes) < 32);
+
+    fillList(Lists[1], 30.0f, ImageTexture);
+    CHECK(Writer.writeFrame(&DrawData, ImVec2(800.0f, 600.0f), FontTexture));
+    CHECK_EQUAL(3, Writer.getNumberOfFrames());
+  }
+
+  ImTextureID const ReplayFontTexture  = reinterpret_cast<ImTextureID>(0x300);
+  ImTextureID const ReplayImageTexture = reinterpret_cast<ImTextureID>(0x400);
+
+  CIMGUIDrawDataReader Reader;
+  CHECK(Reader.open(CaptureFileName));
+  Reader.setTextures(ReplayFontTexture, ReplayImageTexture);
+
+  for (int Frame = 0; Frame < 3; Frame++)
+  {
+    ImDrawData * const pDrawData = Reader.readFrame();
+    CHECK(pDrawData != nullptr);
+    CHECK(pDrawData->Valid);
+    CHECK_EQUAL(2,  pDrawData->CmdListsCount);
+    CHECK_EQUAL(8,  pDrawData->TotalVtxCount);
+    CHECK_EQUAL(12, pDrawData->TotalIdxCount);
+
+    ImDrawList const * const pFirstList  = pDrawData->CmdLists[0];
+    ImDrawList const * const pSecondList = pDrawData->CmdLists[1];
+    CHECK_EQUAL(10.0f, pFirstList->VtxBuffer[0].pos.x);
+    CHECK_EQUAL(13.0f, pFirstList->VtxBuffer[3].pos.x);
+    CHECK_EQUAL(0xFF00FF00, pFirstList->VtxBuffer[3].col);
+    CHECK_EQUAL(2, pFirstList->IdxBuffer[4]);
+    CHECK_EQUAL(6, pFirstList->CmdBuffer[0].ElemCount);
+    CHECK_EQUAL(200.0f, pFirstList->CmdBuffer[0].ClipRect.w);
+    CHECK(pFirstList->CmdBuffer[0].TextureId  == ReplayFontTexture);
+    CHECK(pSecondList->CmdBuffer[0].TextureId == ReplayImageTexture);
+    CHECK_EQUAL((Frame < 2) ? 20.0f : 30.0f, pSecondList->VtxBuffer[0].pos.x);
+  }
+
+  CHECK_EQUAL(800.0f, Reader.getDisplaySize().x);
+  CHECK_EQUAL(3, Reader.getNumberOfFrames());
+  CHECK(Reader.readFrame() == nullptr);
+
+  // after rewinding, the replay starts again
+  CHECK(Reader.rewind());
+  CHECK(Reader.readFrame() != nullptr);
+  CHECK_EQUAL(640.0f, Reader.getDisplaySize().x);
+  CHECK_EQUAL(1, Reader.getNumberOfFrames());
+
+  return;
+}
+
+TEST(TestDrawDataCapture, checkHandleCapturesFrames)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  CIMGUIDrawDataWriter Writer;
+  CHECK(Writer.open(CaptureFileName));
+
+  SIMGUISettings Settings;
+  Settings.mpDrawDataWriter = &Writer;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  for (int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Text("Frame %d", Frame);
+    pGUI->drawAll();
+  }
+
+  CHECK_EQUAL(3, Writer.getNumberOfFrames());
+  Writer.close();
+
+  {
+    CIMGUIDrawDataReader Reader;
+    CHECK(Reader.open(CaptureFileName));
+    Reader.setTextures(ImGui::GetIO().Fonts->TexID, nullptr);
+
+    while (ImDrawData * const pDrawData = Reader.readFrame())
+    {
+      CHECK(pDrawData->CmdListsCount > 0);
+      CHECK(pDrawData->CmdLists[0]->CmdBuffer[0].TextureId == ImGui::GetIO().Fonts->TexID);
+    }
+    CHECK_EQUAL(3, Reader.getNumberOfFrames());
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestDrawDataCapture, checkInvalidFilesAreRejected)
+{
+  std::stringstream ErrorString;
+  Debug::ErrorOutput.rdbuf(ErrorString.rdbuf());
+
+  CIMGUIDrawDataReader Reader;
+  CHECK_EQUAL(false, Reader.open("NotExistingFile.imdd"));
+  CHECK_EQUAL(false, Reader.isOpen());
+  CHECK(Reader.readFrame() == nullptr);
+
+  {
+    std::ofstream File(CaptureFileName);
+    File << "This is not a capture file.";
+  }
+
+  CHECK_EQUAL(false, Reader.open(CaptureFileName));
+  CHECK(ErrorString.str().find("is not a draw data capture file") != std::string::npos);
+
+  CIMGUIDrawDataWriter Writer;
+  CHECK_EQUAL(false, Writer.writeFrame(nullptr, ImVec2(0.0f, 0.0f), nullptr));
+
+  return;
+}
+
+TEST(TestDrawDataCapture, checkCorruptCountsAndRangesAreRejected)
+{
+  std::stringstream ErrorString;
+  Debug::ErrorOutput.rdbuf(ErrorString.rdbuf());
+
+  // frame: marker, number of lists, width, height, font texture
+  size_t const NumberOfListsOffset = sizeof(uint32_t);
+  size_t const ListOffset          = 4 * sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint8_t);
+  // list: number of vertices, indices and commands followed by the vertices, indices and commands
+  size_t const NumberOfVerticesOffset = ListOffset;
+  size_t const NumberOfIndicesOffset  = ListOffset + sizeof(uint32_t);
+  size_t const IndexOffset            = ListOffset + 3 * sizeof(uint32_t) + 4 * sizeof(ImDrawVert);
+  size_t const ElemCountOffset        = IndexOffset + 6 * sizeof(ImDrawIdx);
+
+  struct SCorruption
+  {
+    size_t       mOffset;
+    uint32_t     mValue;
+    bool         mIsIndex;
+  };
+
+  SCorruption const Corruptions[] =
+  {
+    {NumberOfListsOffset,    0xFFFFFFFF, false}, // more lists than bytes in the file
+    {NumberOfVerticesOffset, 0x80000000, false}, // negative as int
+    {NumberOfIndicesOffset,  1000,       false}, // more indices than bytes in the file
+    {ElemCountOffset,        7,          false}, // command uses more indices than stored
+    {IndexOffset,            4,          true},  // index behind the last vertex
+  };
+
+  for (SCorruption const & rCorruption : Corruptions)
+  {
+    if (rCorruption.mIsIndex)
+    {
+      writeCorruptFile(rCorruption.mOffset, static_cast<ImDrawIdx>(rCorruption.mValue));
+    }
+    else
+    {
+      writeCorruptFile(rCorruption.mOffset, rCorruption.mValue);
+    }
+
+    ErrorString.str("");
+    CIMGUIDrawDataReader Reader;
+    CHECK(Reader.open(CaptureFileName));
+    CHECK(Reader.readFrame() == nullptr);
+    CHECK(ErrorString.str().find("The draw data capture file is corrupt") != std::string::npos);
+    CHECK_EQUAL(0, Reader.getNumberOfFrames());
+  }
+
+  // the unchanged file can be replayed
+  writeCorruptFile(IndexOffset, static_cast<ImDrawIdx>(0));
+  CIMGUIDrawDataReader Reader;
+  CHECK(Reader.open(CaptureFileName));
+  ImDrawData * const pDrawData = Reader.readFrame();
+  CHECK(pDrawData != nullptr);
+  CHECK_EQUAL(1, pDrawData->CmdListsCount);
+  CHECK_EQUAL(4, pDrawData->TotalVtxCount);
+
+  return;
+}
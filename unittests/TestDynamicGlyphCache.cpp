@@ -0,0 +1,185 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestDynamicGlyphCache.cpp
+ * @brief Contains unit tests for the glyphs, that are rasterized when they are drawn for the first time.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <sstream>
+#include <string>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(TestDynamicGlyphCache)
+{
+  std::streambuf * mpWarningStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpWarningStreamBuffer = Debug::WarningOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::WarningOutput.rdbuf(mpWarningStreamBuffer);
+  }
+};
+
+/// @brief The Cyrillic glyphs are rasterized on demand.
+static ImWchar const CyrillicGlyphRanges[] =
+{
+  0x0400, 0x04FF,
+  0,
+};
+
+TEST(TestDynamicGlyphCache, checkGlyphsOnDemand)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  ImFont * const pFont = pGUI->addDynamicFontFromFileTTF("../../media/DroidSans.ttf", 16.0f, CyrillicGlyphRanges, 64);
+  CHECK(pFont != nullptr);
+  pGUI->compileFonts();
+
+  // the advance is known before the glyph is rasterized
+  float const Advance = pFont->GetCharAdvance(0x0416);
+  CHECK(Advance > 0.0f);
+
+  ImFont::Glyph const * const pGlyph = pFont->FindGlyph(0x0416);
+  CHECK(pGlyph != nullptr);
+  CHECK(pGlyph != pFont->FallbackGlyph);
+  CHECK_EQUAL(0x0416, pGlyph->Codepoint);
+  CHECK_EQUAL(Advance, pGlyph->XAdvance);
+  CHECK(pGlyph->X1 > pGlyph->X0);
+  CHECK(pGlyph->Y1 > pGlyph->Y0);
+  CHECK(pGlyph->U1 > pGlyph->U0);
+  CHECK(pGlyph->V1 > pGlyph->V0);
+
+  // only fonts with dynamic glyphs ask the cache for missing glyphs
+  CHECK(pFont->DynamicGlyphs != nullptr);
+  CHECK(ImGui::GetIO().Fonts->Fonts[0]->DynamicGlyphs == nullptr);
+
+  // glyphs outside of the dynamic glyph ranges still use the atlas
+  ImFont::Glyph const * const pAtlasGlyph = pFont->FindGlyph('A');
+  CHECK(pAtlasGlyph != nullptr);
+  CHECK_EQUAL('A', pAtlasGlyph->Codepoint);
+  CHECK(pFont->FindGlyph(0x3042) == pFont->FallbackGlyph);
+
+  for(int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::PushFont(pFont);
+    ImGui::Text("%s", "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82");
+    ImGui::PopFont();
+    pGUI->drawAll();
+  }
+
+  CHECK(pFont->FindGlyph(0x041F) != pFont->FallbackGlyph);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestDynamicGlyphCache, checkLeastRecentlyUsedReplacement)
+{
+  std::stringstream WarningOutput;
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  ImFont * const pFont = pGUI->addDynamicFontFromFileTTF("../../media/DroidSans.ttf", 16.0f, CyrillicGlyphRanges, 2);
+  pGUI->compileFonts();
+
+  // glyphs of the current frame are never replaced
+  pGUI->startGUI();
+  ImFont::Glyph const FirstGlyph = *pFont->FindGlyph(0x0410);
+  CHECK_EQUAL(0x0410, FirstGlyph.Codepoint);
+  CHECK_EQUAL(0x0411, pFont->FindGlyph(0x0411)->Codepoint);
+  CHECK(pFont->FindGlyph(0x0412) == pFont->FallbackGlyph);
+  CHECK_EQUAL(false, WarningOutput.str().empty());
+  pGUI->drawAll();
+
+  // in the next frame the least recently used glyph is replaced
+  pGUI->startGUI();
+  CHECK_EQUAL(0x0411, pFont->FindGlyph(0x0411)->Codepoint);
+  ImFont::Glyph const * const pThirdGlyph = pFont->FindGlyph(0x0412);
+  CHECK_EQUAL(0x0412, pThirdGlyph->Codepoint);
+  CHECK_EQUAL(FirstGlyph.U0, pThirdGlyph->U0);
+  CHECK_EQUAL(FirstGlyph.V0, pThirdGlyph->V0);
+  pGUI->drawAll();
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestDynamicGlyphCache, checkGlyphsOfUnsubmittedFramesArePinned)
+{
+  std::stringstream WarningOutput;
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUIA = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUIB = createIMGUI(pDevice);
+
+  ImFont * const pFont = pGUIA->addDynamicFontFromFileTTF("../../media/DroidSans.ttf", 16.0f, CyrillicGlyphRanges, 2);
+  pGUIA->compileFonts();
+
+  // handle B has built a frame with both cells, but has not submitted it yet
+  pGUIB->startGUI();
+  CHECK_EQUAL(0x0410, pFont->FindGlyph(0x0410)->Codepoint);
+  CHECK_EQUAL(0x0411, pFont->FindGlyph(0x0411)->Codepoint);
+  pGUIB->finishGUI();
+
+  // the submitted frames of handle A must not release the glyphs of handle B
+  for(int Frame = 0; Frame < 2; Frame++)
+  {
+    pGUIA->startGUI();
+    CHECK(pFont->FindGlyph(0x0412) == pFont->FallbackGlyph);
+    pGUIA->drawAll();
+  }
+
+  // when all handles have submitted their frames, the glyphs can be replaced
+  pGUIB->drawAll();
+  pGUIA->startGUI();
+  CHECK_EQUAL(0x0412, pFont->FindGlyph(0x0412)->Codepoint);
+  pGUIA->drawAll();
+
+  pGUIB->drop();
+  pGUIA->drop();
+  pDevice->drop();
+
+  return;
+}
@@ -0,0 +1,253 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestEventRecording.cpp
+ * @brief Contains unit tests for the recording and replay of input events.
+ */
+
+// library includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IrrIMGUI/CIMGUIEventRecorder.h>
+#include <IrrIMGUI/CIMGUIEventPlayer.h>
+
+using namespace IrrIMGUI;
+
+/// @brief The file, where the input of the tests is recorded to.
+static char const * const RecordingFileName = "TestEventRecording.input";
+
+/// @return Returns a mouse event.
+static irr::SEvent createMouseEvent(irr::EMOUSE_INPUT_EVENT const Event, int const X, int const Y)
+{
+  irr::SEvent MouseEvent;
+  MouseEvent.EventType               = irr::EET_MOUSE_INPUT_EVENT;
+  MouseEvent.MouseInput.Event        = Event;
+  MouseEvent.MouseInput.X            = X;
+  MouseEvent.MouseInput.Y            = Y;
+  MouseEvent.MouseInput.Wheel        = 0.0f;
+  MouseEvent.MouseInput.Shift        = false;
+  MouseEvent.MouseInput.Control      = false;
+  MouseEvent.MouseInput.ButtonStates = 0;
+  return MouseEvent;
+}
+
+/// @return Returns a key event.
+static irr::SEvent createKeyEvent(irr::EKEY_CODE const Key, wchar_t const Char, bool const IsPressedDown)
+{
+  irr::SEvent KeyEvent;
+  KeyEvent.EventType            = irr::EET_KEY_INPUT_EVENT;
+  KeyEvent.KeyInput.Key         = Key;
+  KeyEvent.KeyInput.Char        = Char;
+  KeyEvent.KeyInput.PressedDown = IsPressedDown;
+  KeyEvent.KeyInput.Shift       = false;
+  KeyEvent.KeyInput.Control     = false;
+  return KeyEvent;
+}
+
+/// @brief Builds a GUI frame with a window and a button.
+static void buildFrame(IIMGUIHandle * const pGUI)
+{
+  pGUI->startGUI();
+  ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+  ImGui::Begin("Window");
+  ImGui::Button("Button", ImVec2(100.0f, 100.0f));
+  ImGui::End();
+  pGUI->drawAll();
+  return;
+}
+
+/// @brief Replays the recording into a new handle with a fixed-step clock.
+/// @return Returns the sum of all vertex colors of every frame.
+static std::vector<unsigned int> replayRecording(irr::IrrlichtDevice * const pDevice)
+{
+  std::vector<unsigned int> Colors;
+
+  CIMGUIFixedStepClock Clock(16000000);
+  SIMGUISettings Settings;
+  Settings.mpFrameClock = &Clock;
+
+  CIMGUIEventReceiver EventReceiver;
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, &EventReceiver, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  CIMGUIEventPlayer Player;
+  CHECK(Player.open(RecordingFileName));
+
+  while (Player.getFrameNumber() < Player.getNumberOfFrames())
+  {
+    Player.playFrame(EventReceiver);
+    buildFrame(pGUI);
+
+    // the colors show the hovered and pressed state of the button
+    ImDrawData const * const pDrawData = ImGui::GetDrawData();
+    unsigned int ColorSum = 0;
+    for (int List = 0; List < pDrawData->CmdListsCount; List++)
+    {
+      for (int Vertex = 0; Vertex < pDrawData->CmdLists[List]->VtxBuffer.Size; Vertex++)
+      {
+        ColorSum += pDrawData->CmdLists[List]->VtxBuffer[Vertex].col;
+      }
+    }
+    Colors.push_back(ColorSum);
+  }
+
+  pGUI->drop();
+  return Colors;
+}
+
+TEST_GROUP(TestEventRecording)
+{
+  std::streambuf * mpStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpStreamBuffer = Debug::ErrorOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::ErrorOutput.rdbuf(mpStreamBuffer);
+    std::remove(RecordingFileName);
+  }
+};
+
+TEST(TestEventRecording, checkRecordAndPlayEvents)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  {
+    CIMGUIEventReceiver EventReceiver;
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice, &EventReceiver);
+    ImGui::GetIO().IniFilename = nullptr;
+
+    // frames before the recording do not count
+    buildFrame(pGUI);
+
+    CIMGUIEventRecorder Recorder;
+    CHECK(Recorder.open(RecordingFileName));
+    EventReceiver.setRecorder(&Recorder);
+    CHECK(EventReceiver.getRecorder() == &Recorder);
+
+    EventReceiver.OnEvent(createMouseEvent(irr::EMIE_MOUSE_MOVED, 10, 20));
+    buildFrame(pGUI);
+    buildFrame(pGUI);
+    EventReceiver.OnEvent(createKeyEvent(irr::KEY_KEY_A, L'a', true));
+    EventReceiver.OnEvent(createMouseEvent(irr::EMIE_LMOUSE_PRESSED_DOWN, 10, 20));
+    buildFrame(pGUI);
+
+    CHECK_EQUAL(3, Recorder.getNumberOfEvents());
+    EventReceiver.setRecorder(nullptr);
+
+    pGUI->drop();
+  }
+
+  CIMGUIEventPlayer Player;
+  CHECK(Player.open(RecordingFileName));
+  CHECK_EQUAL(3, Player.getNumberOfEvents());
+  CHECK_EQUAL(3, Player.getNumberOfFrames());
+
+  CIMGUIEventReceiver EventReceiver;
+
+  CHECK_EQUAL(1, Player.playFrame(EventReceiver));
+  CHECK_EQUAL(10, EventReceiver.mMousePositionX);
+  CHECK_EQUAL(20, EventReceiver.mMousePositionY);
+
+  CHECK_EQUAL(0, Player.playFrame(EventReceiver));
+  CHECK_EQUAL(false, Player.isFinished());
+
+  CHECK_EQUAL(2, Player.playFrame(EventReceiver));
+  CHECK_EQUAL(true, EventReceiver.mKeyAPressed);
+  CHECK_EQUAL(true, EventReceiver.mIsLeftMouseButtonPressed);
+  CHECK_EQUAL('a', EventReceiver.mCharFifo.getChar());
+  CHECK_EQUAL(true, Player.isFinished());
+  CHECK_EQUAL(3, Player.getFrameNumber());
+
+  Player.rewind();
+  CHECK_EQUAL(false, Player.isFinished());
+  CHECK_EQUAL(0, Player.getFrameNumber());
+
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestEventRecording, checkReplayIsDeterministic)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  {
+    std::ofstream File(RecordingFileName);
+    File << "IrrIMGUI-Input 1\n";
+    File << "0 0 M " << irr::EMIE_MOUSE_MOVED          << " 50 50 0 0 0 0\n";
+    File << "2 0 M " << irr::EMIE_LMOUSE_PRESSED_DOWN  << " 50 50 0 0 0 1\n";
+    File << "4 0 M " << irr::EMIE_LMOUSE_LEFT_UP       << " 50 50 0 0 0 0\n";
+    File << "6 0 M " << irr::EMIE_MOUSE_MOVED          << " 500 500 0 0 0 0\n";
+  }
+
+  std::vector<unsigned int> const FirstReplay  = replayRecording(pDevice);
+  std::vector<unsigned int> const SecondReplay = replayRecording(pDevice);
+
+  CHECK_EQUAL(7, FirstReplay.size());
+  CHECK(FirstReplay == SecondReplay);
+
+  // the button is pressed in frame 2 and not hovered anymore in frame 6
+  CHECK(FirstReplay[1] != FirstReplay[2]);
+  CHECK(FirstReplay[5] != FirstReplay[6]);
+
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestEventRecording, checkInvalidFilesAreRejected)
+{
+  std::stringstream ErrorString;
+  Debug::ErrorOutput.rdbuf(ErrorString.rdbuf());
+
+  CIMGUIEventPlayer Player;
+  CHECK_EQUAL(false, Player.open("NotExistingFile.input"));
+  CHECK_EQUAL(true, Player.isFinished());
+
+  {
+    std::ofstream File(RecordingFileName);
+    File << "IrrIMGUI-Input 1\n";
+    File << "0 0 X 1 2 3\n";
+  }
+
+  CHECK_EQUAL(false, Player.open(RecordingFileName));
+  CHECK(ErrorString.str().find("is corrupt in line 2") != std::string::npos);
+  CHECK_EQUAL(0, Player.getNumberOfEvents());
+
+  CIMGUIEventRecorder Recorder;
+  CHECK_EQUAL(false, Recorder.recordEvent(createMouseEvent(irr::EMIE_MOUSE_MOVED, 0, 0), 0));
+
+  return;
+}
@@ -0,0 +1,305 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestFontAtlasBuild.cpp
+ * @brief Contains unit tests for building the font atlas with several threads and for appending fonts to a built atlas.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CFontAtlasCache.h>
+#include <IMGUI/imgui_internal.h>
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace IrrIMGUI;
+using namespace IrrIMGUI::Private;
+
+TEST_GROUP(TestFontAtlasBuild)
+{
+  std::streambuf * mpNoteStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpNoteStreamBuffer = Debug::NoteOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::NoteOutput.rdbuf(mpNoteStreamBuffer);
+  }
+
+  /// @brief The pixels and glyphs of a built font atlas.
+  struct SAtlas
+  {
+    int                        mWidth;
+    int                        mHeight;
+    std::vector<unsigned char> mPixels;
+    std::vector<ImFont::Glyph> mGlyphs;
+  };
+
+  /// @brief Builds an atlas with several fonts and glyph ranges, that are split into many render blocks.
+  static SAtlas buildAtlas(unsigned int NumberOfFontThreads)
+  {
+    // the drivers free the pixels after the upload, thus they are taken from the font cache file written by compileFonts()
+    SIMGUISettings Settings;
+    Settings.mNumberOfFontThreads = NumberOfFontThreads;
+    Settings.mpFontCacheDirectory = ".";
+
+    irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+    ImFontConfig OversampledConfig;
+    OversampledConfig.OversampleH = 3;
+    OversampledConfig.OversampleV = 2;
+
+    std::vector<ImFont *> Fonts;
+    Fonts.push_back(pGUI->addFontFromFileTTF("../../media/DroidSans.ttf",       18.0f, nullptr, pGUI->getGlyphRangesCyrillic()));
+    Fonts.push_back(pGUI->addFontFromFileTTF("../../media/Cousine-Regular.ttf", 14.0f, &OversampledConfig));
+    Fonts.push_back(pGUI->addFontFromFileTTF("../../media/Karla-Regular.ttf",   24.0f));
+
+    ImFontAtlas * const pFontAtlas = ImGui::GetIO().Fonts;
+    CFontAtlasCache const FontCache(".", *pFontAtlas);
+    std::remove(FontCache.getFileName().c_str());
+
+    pGUI->compileFonts();
+
+    SAtlas Atlas;
+    for(ImFont * const pFont : Fonts)
+    {
+      Atlas.mGlyphs.insert(Atlas.mGlyphs.end(), pFont->Glyphs.begin(), pFont->Glyphs.end());
+    }
+
+    CHECK(FontCache.load(*pFontAtlas));
+    Atlas.mWidth  = pFontAtlas->TexWidth;
+    Atlas.mHeight = pFontAtlas->TexHeight;
+    Atlas.mPixels.assign(pFontAtlas->TexPixelsAlpha8, pFontAtlas->TexPixelsAlpha8 + Atlas.mWidth * Atlas.mHeight);
+    std::remove(FontCache.getFileName().c_str());
+
+    pGUI->drop();
+    pDevice->drop();
+
+    return Atlas;
+  }
+
+  /// @brief Checks that two glyph tables are equal.
+  static void checkGlyphs(std::vector<ImFont::Glyph> const &rExpectedGlyphs, ImVector<ImFont::Glyph> const &rGlyphs)
+  {
+    CHECK_EQUAL(rExpectedGlyphs.size(), static_cast<size_t>(rGlyphs.Size));
+
+    for(size_t i = 0; i < rExpectedGlyphs.size(); i++)
+    {
+      CHECK_EQUAL(rExpectedGlyphs[i].Codepoint, rGlyphs[static_cast<int>(i)].Codepoint);
+      CHECK_EQUAL(rExpectedGlyphs[i].U0,        rGlyphs[static_cast<int>(i)].U0);
+      CHECK_EQUAL(rExpectedGlyphs[i].V0,        rGlyphs[static_cast<int>(i)].V0);
+      CHECK_EQUAL(rExpectedGlyphs[i].U1,        rGlyphs[static_cast<int>(i)].U1);
+      CHECK_EQUAL(rExpectedGlyphs[i].V1,        rGlyphs[static_cast<int>(i)].V1);
+    }
+
+    return;
+  }
+};
+
+TEST(TestFontAtlasBuild, checkParallelBuildIsDeterministic)
+{
+  SAtlas const SerialAtlas   = buildAtlas(1);
+  SAtlas const ParallelAtlas = buildAtlas(4);
+
+  CHECK(SerialAtlas.mGlyphs.size() > 0);
+  CHECK_EQUAL(SerialAtlas.mWidth,  ParallelAtlas.mWidth);
+  CHECK_EQUAL(SerialAtlas.mHeight, ParallelAtlas.mHeight);
+  CHECK_EQUAL(SerialAtlas.mGlyphs.size(), ParallelAtlas.mGlyphs.size());
+  for(size_t i = 0; i < SerialAtlas.mGlyphs.size(); i++)
+  {
+    ImFont::Glyph const &rSerialGlyph   = SerialAtlas.mGlyphs[i];
+    ImFont::Glyph const &rParallelGlyph = ParallelAtlas.mGlyphs[i];
+    CHECK_EQUAL(rSerialGlyph.Codepoint, rParallelGlyph.Codepoint);
+    CHECK_EQUAL(rSerialGlyph.XAdvance,  rParallelGlyph.XAdvance);
+    CHECK_EQUAL(rSerialGlyph.X0,        rParallelGlyph.X0);
+    CHECK_EQUAL(rSerialGlyph.Y0,        rParallelGlyph.Y0);
+    CHECK_EQUAL(rSerialGlyph.X1,        rParallelGlyph.X1);
+    CHECK_EQUAL(rSerialGlyph.Y1,        rParallelGlyph.Y1);
+    CHECK_EQUAL(rSerialGlyph.U0,        rParallelGlyph.U0);
+    CHECK_EQUAL(rSerialGlyph.V0,        rParallelGlyph.V0);
+    CHECK_EQUAL(rSerialGlyph.U1,        rParallelGlyph.U1);
+    CHECK_EQUAL(rSerialGlyph.V1,        rParallelGlyph.V1);
+  }
+  MEMCMP_EQUAL(SerialAtlas.mPixels.data(), ParallelAtlas.mPixels.data(), SerialAtlas.mPixels.size());
+
+  return;
+}
+
+TEST(TestFontAtlasBuild, checkAppendedFonts)
+{
+  std::stringstream NoteOutput;
+  Debug::NoteOutput.rdbuf(NoteOutput.rdbuf());
+
+  // the null renderer has no shader renderer, that would build the whole atlas again when it is prepared
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImFontAtlas * const pFontAtlas = ImGui::GetIO().Fonts;
+
+  ImFont * const pFont = pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 20.0f);
+  pGUI->addFontFromFileTTF("../../media/ProggyTiny.ttf", 10.0f);
+  pGUI->compileFonts();
+
+  std::vector<ImFont::Glyph> const Glyphs(pFont->Glyphs.begin(), pFont->Glyphs.end());
+  int const Width  = pFontAtlas->TexWidth;
+  int const Height = pFontAtlas->TexHeight;
+
+  float UsedV = 0.0f;
+  for(ImFont * const pBuiltFont : pFontAtlas->Fonts)
+  {
+    for(ImFont::Glyph const &rGlyph : pBuiltFont->Glyphs)
+    {
+      UsedV = std::max(UsedV, rGlyph.V1);
+    }
+  }
+
+  // a new font is packed below the glyphs of the compiled fonts
+  NoteOutput.str("");
+  ImFont * const pAppendedFont = pGUI->addFontFromFileTTF("../../media/Karla-Regular.ttf", 13.0f);
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("Appended 1 fonts") != std::string::npos);
+
+  CHECK_EQUAL(Width,  pFontAtlas->TexWidth);
+  CHECK_EQUAL(Height, pFontAtlas->TexHeight);
+  checkGlyphs(Glyphs, pFont->Glyphs);
+
+  CHECK(pAppendedFont->Glyphs.Size > 0);
+  for(ImFont::Glyph const &rGlyph : pAppendedFont->Glyphs)
+  {
+    CHECK(rGlyph.V0 >= UsedV);
+    CHECK(rGlyph.V1 <= 1.0f);
+  }
+  CHECK_EQUAL('A', pAppendedFont->FindGlyph('A')->Codepoint);
+
+  // new ranges can be merged into a compiled font
+  static ImWchar const CyrillicRanges[] = { 0x0410, 0x044F, 0 };
+  ImFontConfig MergeConfig;
+  MergeConfig.MergeMode = true;
+  MergeConfig.DstFont   = pFont;
+
+  NoteOutput.str("");
+  pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 20.0f, &MergeConfig, CyrillicRanges);
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("Appended 1 fonts") != std::string::npos);
+
+  CHECK_EQUAL(0x0410, pFont->FindGlyph(0x0410)->Codepoint);
+  CHECK_EQUAL(Glyphs[0].Codepoint, pFont->Glyphs[0].Codepoint);
+  CHECK_EQUAL(Glyphs[0].V0,        pFont->Glyphs[0].V0);
+  CHECK_EQUAL(Glyphs.back().V1,    pFont->FindGlyph(Glyphs.back().Codepoint)->V1);
+
+  // a font, that does not fit into the free rows, builds the whole atlas again
+  NoteOutput.str("");
+  pGUI->addFontFromFileTTF("../../media/Cousine-Regular.ttf", 64.0f, nullptr, pGUI->getGlyphRangesCyrillic());
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("built again") != std::string::npos);
+  CHECK_EQUAL(0x0410, pFont->FindGlyph(0x0410)->Codepoint);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestFontAtlasBuild, checkAppendedGlyphPixels)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  unsigned char * pPixels = nullptr;
+  int Width  = 0;
+  int Height = 0;
+
+  ImFontAtlas Atlas;
+  Atlas.AddFontFromFileTTF("../../media/DroidSans.ttf", 20.0f);
+  Atlas.GetTexDataAsAlpha8(&pPixels, &Width, &Height);
+
+  int UsedHeight = 0;
+  for(ImFont::Glyph const &rGlyph : Atlas.Fonts[0]->Glyphs)
+  {
+    UsedHeight = std::max(UsedHeight, static_cast<int>(rGlyph.V1 * Height + 0.5f));
+  }
+
+  unsigned char * pRows = nullptr;
+  int Y    = 0;
+  int Rows = 0;
+  ImFont * const pAppendedFont = Atlas.AddFontFromFileTTF("../../media/Karla-Regular.ttf", 13.0f);
+  CHECK(ImFontAtlasBuildAppendWithStbTruetype(&Atlas, 1, &pRows, &Y, &Rows));
+  CHECK_EQUAL(Width,  Atlas.TexWidth);
+  CHECK_EQUAL(Height, Atlas.TexHeight);
+  CHECK(Y + Rows <= Height);
+
+  // the appended rows do not touch the existing glyphs
+  CHECK(Y >= UsedHeight + Atlas.TexGlyphPadding);
+
+  // the appended glyphs look like the glyphs of an atlas, that only contains the font
+  int ReferenceWidth  = 0;
+  int ReferenceHeight = 0;
+  ImFontAtlas ReferenceAtlas;
+  ImFont * const pReferenceFont = ReferenceAtlas.AddFontFromFileTTF("../../media/Karla-Regular.ttf", 13.0f);
+  ReferenceAtlas.GetTexDataAsAlpha8(&pPixels, &ReferenceWidth, &ReferenceHeight);
+
+  for(ImWchar const Codepoint : { 'A', 'g', '#', '@' })
+  {
+    ImFont::Glyph const * const pGlyph          = pAppendedFont->FindGlyph(Codepoint);
+    ImFont::Glyph const * const pReferenceGlyph = pReferenceFont->FindGlyph(Codepoint);
+    CHECK_EQUAL(Codepoint, pGlyph->Codepoint);
+
+    int const X0          = static_cast<int>(pGlyph->U0 * Width + 0.5f);
+    int const Y0          = static_cast<int>(pGlyph->V0 * Height + 0.5f) - Y;
+    int const ReferenceX0 = static_cast<int>(pReferenceGlyph->U0 * ReferenceWidth + 0.5f);
+    int const ReferenceY0 = static_cast<int>(pReferenceGlyph->V0 * ReferenceHeight + 0.5f);
+    int const GlyphWidth  = static_cast<int>((pReferenceGlyph->U1 - pReferenceGlyph->U0) * ReferenceWidth + 0.5f);
+    int const GlyphHeight = static_cast<int>((pReferenceGlyph->V1 - pReferenceGlyph->V0) * ReferenceHeight + 0.5f);
+    CHECK(Y0 >= 0);
+    CHECK(Y0 + GlyphHeight <= Rows);
+
+    for(int Row = 0; Row < GlyphHeight; Row++)
+    {
+      MEMCMP_EQUAL(&pPixels[(ReferenceY0 + Row) * ReferenceWidth + ReferenceX0], &pRows[(Y0 + Row) * Width + X0], GlyphWidth);
+    }
+  }
+
+  ImGui::MemFree(pRows);
+  ReferenceAtlas.Clear();
+  Atlas.Clear();
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
@@ -0,0 +1,257 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestFontAtlasCache.cpp
+ * @brief Contains unit tests for the file cache of built font atlases.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CFontAtlasCache.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace IrrIMGUI;
+using namespace IrrIMGUI::Private;
+
+TEST_GROUP(TestFontAtlasCache)
+{
+  std::streambuf * mpNoteStreamBuffer;
+  std::streambuf * mpWarningStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpNoteStreamBuffer    = Debug::NoteOutput.rdbuf();
+    mpWarningStreamBuffer = Debug::WarningOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::NoteOutput.rdbuf(mpNoteStreamBuffer);
+    Debug::WarningOutput.rdbuf(mpWarningStreamBuffer);
+  }
+
+  /// @return Returns the name of the cache file for the current font atlas.
+  static std::string getFileName(void)
+  {
+    return CFontAtlasCache(".", *ImGui::GetIO().Fonts).getFileName();
+  }
+};
+
+TEST(TestFontAtlasCache, checkColdAndWarmStart)
+{
+  SIMGUISettings Settings;
+  Settings.mpFontCacheDirectory = ".";
+
+  // the first start builds the atlas and stores it
+  irr::IrrlichtDevice * pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+  ImFont * pFont = pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 16.0f);
+  std::string const FileName = getFileName();
+  std::remove(FileName.c_str());
+
+  pGUI->compileFonts();
+
+  std::vector<ImFont::Glyph> const Glyphs(pFont->Glyphs.begin(), pFont->Glyphs.end());
+  float const  Ascent        = pFont->Ascent;
+  int const    Surface       = pFont->MetricsTotalSurface;
+  int const    Width         = ImGui::GetIO().Fonts->TexWidth;
+  int const    Height        = ImGui::GetIO().Fonts->TexHeight;
+  ImVec2 const UvWhitePixel  = ImGui::GetIO().Fonts->TexUvWhitePixel;
+  CHECK(Glyphs.size() > 0);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  // the second start loads the same atlas from the file
+  std::stringstream NoteOutput;
+  Debug::NoteOutput.rdbuf(NoteOutput.rdbuf());
+
+  pDevice = irr::createDevice(irr::video::EDT_NULL);
+  pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+  pFont = pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 16.0f);
+  STRCMP_EQUAL(FileName.c_str(), getFileName().c_str());
+
+  NoteOutput.str("");
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("Loaded the font atlas") != std::string::npos);
+
+  CHECK_EQUAL(Glyphs.size(), static_cast<size_t>(pFont->Glyphs.size()));
+  MEMCMP_EQUAL(Glyphs.data(), pFont->Glyphs.Data, Glyphs.size() * sizeof(ImFont::Glyph));
+  CHECK_EQUAL(Ascent,         pFont->Ascent);
+  CHECK_EQUAL(Surface,        pFont->MetricsTotalSurface);
+  CHECK_EQUAL(Width,          ImGui::GetIO().Fonts->TexWidth);
+  CHECK_EQUAL(Height,         ImGui::GetIO().Fonts->TexHeight);
+  CHECK_EQUAL(UvWhitePixel.x, ImGui::GetIO().Fonts->TexUvWhitePixel.x);
+  CHECK_EQUAL(UvWhitePixel.y, ImGui::GetIO().Fonts->TexUvWhitePixel.y);
+  CHECK(pFont->FindGlyph('A') != nullptr);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  std::remove(FileName.c_str());
+
+  return;
+}
+
+TEST(TestFontAtlasCache, checkChangedFonts)
+{
+  std::stringstream WarningOutput;
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  SIMGUISettings Settings;
+  Settings.mpFontCacheDirectory = ".";
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+
+  pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 16.0f);
+  std::string const FileName = getFileName();
+
+  // another size needs another file
+  ImGui::GetIO().Fonts->ConfigData.back().SizePixels = 17.0f;
+  std::string const OtherFileName = getFileName();
+  ImGui::GetIO().Fonts->ConfigData.back().SizePixels = 16.0f;
+  CHECK_EQUAL(false, FileName == OtherFileName);
+
+  // a damaged file is replaced
+  FILE * const pFile = std::fopen(FileName.c_str(), "wb");
+  CHECK(pFile != nullptr);
+  std::fputs("no font atlas", pFile);
+  std::fclose(pFile);
+
+  pGUI->compileFonts();
+  CHECK_EQUAL(false, WarningOutput.str().empty());
+  CHECK(ImGui::GetIO().Fonts->Fonts.back()->FindGlyph('A') != nullptr);
+
+  WarningOutput.str("");
+  CHECK_EQUAL(true, CFontAtlasCache(".", *ImGui::GetIO().Fonts).load(*ImGui::GetIO().Fonts));
+  CHECK_EQUAL(std::string(""), WarningOutput.str());
+
+  pGUI->drop();
+  pDevice->drop();
+
+  std::remove(FileName.c_str());
+
+  return;
+}
+
+TEST(TestFontAtlasCache, checkReleasedFontData)
+{
+  std::stringstream NoteOutput;
+  Debug::NoteOutput.rdbuf(NoteOutput.rdbuf());
+
+  SIMGUISettings Settings;
+  Settings.mpFontCacheDirectory = ".";
+  Settings.mFontDataPolicy      = EFDP_RELEASE_CACHED;
+  Settings.mIsProfilerEnabled   = true;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+  ImFontAtlas * const pFontAtlas = ImGui::GetIO().Fonts;
+
+  ImFont * const pFont = pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 16.0f);
+  int const FontDataSize = pFontAtlas->ConfigData.back().FontDataSize;
+  std::string const FileName = getFileName();
+  std::remove(FileName.c_str());
+
+  // the default font of the handle keeps its data
+  irr::u64 DefaultFontDataSize = 0;
+  for (int i = 0; i < pFontAtlas->ConfigData.Size - 1; i++)
+  {
+    DefaultFontDataSize += static_cast<irr::u64>(pFontAtlas->ConfigData[i].FontDataSize);
+  }
+
+  // the TTF data is released, when the atlas has been stored
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("Released") != std::string::npos);
+  POINTERS_EQUAL(nullptr, pFontAtlas->ConfigData.back().FontData);
+  CHECK_EQUAL(FontDataSize, pFontAtlas->ConfigData.back().FontDataSize);
+  CHECK(pFont->FindGlyph('A') != nullptr);
+
+  pGUI->startGUI();
+  ImGui::Text("Released");
+  pGUI->drawAll();
+
+  SIMGUIFontMemory const ReleasedMemory = pGUI->getProfiler()->getFontMemory();
+  CHECK_EQUAL(DefaultFontDataSize, ReleasedMemory.mTTFBytes);
+  CHECK_EQUAL(static_cast<irr::u64>(FontDataSize), ReleasedMemory.mReleasedTTFBytes);
+  CHECK(ReleasedMemory.mGlyphBytes > 0);
+  CHECK(ReleasedMemory.getTotalBytes() > 0);
+
+  // another atlas is built with the TTF data loaded again
+  Settings.mFontSDFSpread = 2;
+  pGUI->setSettings(Settings);
+  NoteOutput.str("");
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("Loaded the font atlas") == std::string::npos);
+  CHECK(NoteOutput.str().find("Released") != std::string::npos);
+  POINTERS_EQUAL(nullptr, pFontAtlas->ConfigData.back().FontData);
+  CHECK(pFont->FindGlyph('A') != nullptr);
+
+  // the key of the released data is the same, thus the first atlas is loaded without the TTF data
+  Settings.mFontSDFSpread = 0;
+  pGUI->setSettings(Settings);
+  NoteOutput.str("");
+  pGUI->compileFonts();
+  CHECK(NoteOutput.str().find("Loaded the font atlas") != std::string::npos);
+  POINTERS_EQUAL(nullptr, pFontAtlas->ConfigData.back().FontData);
+
+  // the default policy keeps the data, when it has been loaded again
+  Settings.mFontDataPolicy = EFDP_KEEP;
+  Settings.mFontSDFSpread  = 3;
+  pGUI->setSettings(Settings);
+  pGUI->compileFonts();
+  CHECK(pFontAtlas->ConfigData.back().FontData != nullptr);
+  CHECK_EQUAL(FontDataSize, pFontAtlas->ConfigData.back().FontDataSize);
+
+  std::string const KeptFileName = getFileName();
+  pFontAtlas->TexGlyphSDFSpread = 2;
+  std::string const SDFFileName = getFileName();
+  pFontAtlas->TexGlyphSDFSpread = 3;
+
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(DefaultFontDataSize + FontDataSize, pGUI->getProfiler()->getFontMemory().mTTFBytes);
+  CHECK_EQUAL(0, pGUI->getProfiler()->getFontMemory().mReleasedTTFBytes);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  std::remove(FileName.c_str());
+  std::remove(SDFFileName.c_str());
+  std::remove(KeptFileName.c_str());
+
+  return;
+}
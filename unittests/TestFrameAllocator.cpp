@@ -0,0 +1,141 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestFrameAllocator.cpp
+ * @brief Contains unit tests for the size-class pools and the arena of the frame allocator.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <CFrameAllocator.h>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace IrrIMGUI::Private;
+
+TEST_GROUP(TestFrameAllocator)
+{
+};
+
+TEST(TestFrameAllocator, checkOrdinaryBlocksAreNotForeignBlocks)
+{
+  CFrameAllocator Allocator;
+  size_t BlockSize = 0;
+  bool IsSystemAllocation = false;
+
+  void * const pFrameBlock = Allocator.allocate(100, BlockSize, IsSystemAllocation);
+  CHECK(pFrameBlock != nullptr);
+  CHECK(IsSystemAllocation);
+  CHECK(CFrameAllocator::isUsed());
+
+  void * const pMallocBlock = malloc(100);
+  CHECK_EQUAL(false, CFrameAllocator::deallocateForeignBlock(pMallocBlock, BlockSize));
+  CHECK_EQUAL(false, Allocator.deallocate(pMallocBlock, BlockSize));
+  free(pMallocBlock);
+
+  CHECK(Allocator.deallocate(pFrameBlock, BlockSize));
+  CHECK_EQUAL(128, BlockSize);
+  CHECK_EQUAL(0, Allocator.getNumberOfBlocks());
+
+  return;
+}
+
+TEST(TestFrameAllocator, checkForeignBlocksAreReleasedByTheOwner)
+{
+  CFrameAllocator Allocator;
+  size_t BlockSize = 0;
+  bool IsSystemAllocation = false;
+
+  void * const pPoolBlock  = Allocator.allocate(16,   BlockSize, IsSystemAllocation);
+  void * const pArenaBlock = Allocator.allocate(5000, BlockSize, IsSystemAllocation);
+  CHECK_EQUAL(2, Allocator.getNumberOfBlocks());
+
+  CHECK(CFrameAllocator::deallocateForeignBlock(pPoolBlock, BlockSize));
+  CHECK_EQUAL(16, BlockSize);
+  CHECK(CFrameAllocator::deallocateForeignBlock(pArenaBlock, BlockSize));
+  CHECK_EQUAL(5008, BlockSize);
+
+  // the owner does not see the blocks before it releases them
+  CHECK_EQUAL(2, Allocator.getNumberOfBlocks());
+  Allocator.releaseRemoteBlocks();
+  CHECK_EQUAL(0, Allocator.getNumberOfBlocks());
+
+  // the arena chunk is empty again, thus it is reused
+  CHECK(Allocator.allocate(5000, BlockSize, IsSystemAllocation) == pArenaBlock);
+  CHECK_EQUAL(false, IsSystemAllocation);
+  CHECK(Allocator.deallocate(pArenaBlock, BlockSize));
+
+  return;
+}
+
+TEST(TestFrameAllocator, checkForeignBlocksWhileTheOwnerAllocates)
+{
+  int const NumberOfBlocks = 20000;
+
+  CFrameAllocator Allocator;
+  size_t BlockSize = 0;
+  bool IsSystemAllocation = false;
+
+  std::vector<void *> ForeignBlocks;
+  for (int i = 0; i < NumberOfBlocks; i++)
+  {
+    ForeignBlocks.push_back(Allocator.allocate(static_cast<size_t>(16 + (i % 64) * 32), BlockSize, IsSystemAllocation));
+  }
+
+  // another thread frees the blocks, while the owner allocates and frees its own blocks
+  std::atomic<bool> IsFreeing(true);
+  std::thread ForeignThread([&ForeignBlocks, &IsFreeing]
+  {
+    size_t ForeignBlockSize = 0;
+    for (void * const pBlock : ForeignBlocks)
+    {
+      CHECK(CFrameAllocator::deallocateForeignBlock(pBlock, ForeignBlockSize));
+    }
+    IsFreeing = false;
+  });
+
+  while (IsFreeing)
+  {
+    std::vector<void *> OwnBlocks;
+    for (int i = 0; i < 64; i++)
+    {
+      OwnBlocks.push_back(Allocator.allocate(static_cast<size_t>(16 + i * 32), BlockSize, IsSystemAllocation));
+    }
+    for (void * const pBlock : OwnBlocks)
+    {
+      CHECK(Allocator.deallocate(pBlock, BlockSize));
+    }
+    Allocator.releaseRemoteBlocks();
+  }
+  ForeignThread.join();
+
+  Allocator.releaseRemoteBlocks();
+  CHECK_EQUAL(0, Allocator.getNumberOfBlocks());
+
+  return;
+}
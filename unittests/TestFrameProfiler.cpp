@@ -0,0 +1,362 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestFrameProfiler.cpp
+ * @brief Contains unit tests for the GUI frame profiler.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/CIMGUIFrameProfiler.h>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(TestFrameProfiler)
+{
+};
+
+static SIMGUIFrameProfile createProfile(int const FrameNumber, irr::u64 const Nanoseconds)
+{
+  SIMGUIFrameProfile Profile;
+  Profile.mFrameNumber         = FrameNumber;
+  Profile.mStartGUINanoseconds = Nanoseconds;
+  Profile.mWidgetNanoseconds   = Nanoseconds;
+  Profile.mRenderNanoseconds   = Nanoseconds;
+  Profile.mSubmitNanoseconds   = Nanoseconds;
+  Profile.mVertices            = static_cast<unsigned int>(Nanoseconds);
+  return Profile;
+}
+
+TEST(TestFrameProfiler, checkRingBuffer)
+{
+  CIMGUIFrameProfiler Profiler(3);
+  CHECK_EQUAL(3, Profiler.getHistorySize());
+  CHECK_EQUAL(0, Profiler.getNumberOfFrames());
+
+  Profiler.addFrame(createProfile(1, 10));
+  Profiler.addFrame(createProfile(2, 20));
+  CHECK_EQUAL(2, Profiler.getNumberOfFrames());
+  CHECK_EQUAL(2, Profiler.getFrame(0).mFrameNumber);
+  CHECK_EQUAL(1, Profiler.getFrame(1).mFrameNumber);
+
+  // the oldest frame is removed, when the buffer is full
+  Profiler.addFrame(createProfile(3, 30));
+  Profiler.addFrame(createProfile(4, 40));
+  CHECK_EQUAL(3, Profiler.getNumberOfFrames());
+  CHECK_EQUAL(4, Profiler.getFrame(0).mFrameNumber);
+  CHECK_EQUAL(2, Profiler.getFrame(2).mFrameNumber);
+  CHECK(160 == Profiler.getFrame(0).getCPUNanoseconds());
+
+  Profiler.clear();
+  CHECK_EQUAL(0, Profiler.getNumberOfFrames());
+
+  Profiler.addFrame(createProfile(5, 50));
+  Profiler.setHistorySize(5);
+  CHECK_EQUAL(5, Profiler.getHistorySize());
+  CHECK_EQUAL(0, Profiler.getNumberOfFrames());
+
+  return;
+}
+
+TEST(TestFrameProfiler, checkAverageAndGPUTime)
+{
+  CIMGUIFrameProfiler Profiler(4);
+
+  CHECK_EQUAL(false, Profiler.getAverage().mIsGPUTimeValid);
+
+  Profiler.addFrame(createProfile(1, 10));
+  Profiler.addFrame(createProfile(2, 30));
+  Profiler.addFrame(createProfile(3, 50));
+
+  // GPU times arrive later and only for some frames
+  Profiler.setGPUTime(1, 100);
+  Profiler.setGPUTime(2, 300);
+  Profiler.setGPUTime(42, 1000);
+
+  CHECK(Profiler.getFrame(2).mIsGPUTimeValid);
+  CHECK(100 == Profiler.getFrame(2).mGPUNanoseconds);
+  CHECK_EQUAL(false, Profiler.getFrame(0).mIsGPUTimeValid);
+
+  SIMGUIFrameProfile const Average = Profiler.getAverage();
+  CHECK_EQUAL(3, Average.mFrameNumber);
+  CHECK(30 == Average.mWidgetNanoseconds);
+  CHECK_EQUAL(30, Average.mVertices);
+  CHECK(Average.mIsGPUTimeValid);
+  CHECK(200 == Average.mGPUNanoseconds);
+
+  return;
+}
+
+static void dummyCallback(ImDrawList const *, ImDrawCmd const *)
+{
+  return;
+}
+
+TEST(TestFrameProfiler, checkCountDrawData)
+{
+  ImDrawList List;
+  ImDrawCmd  Command;
+  Command.TextureId = reinterpret_cast<ImTextureID>(1);
+  List.CmdBuffer.push_back(Command);
+  List.CmdBuffer.push_back(Command);
+  ImDrawCmd  CallbackCommand;
+  CallbackCommand.UserCallback = dummyCallback;
+  List.CmdBuffer.push_back(CallbackCommand);
+  List.CmdBuffer.push_back(Command);
+  List.VtxBuffer.resize(8);
+  List.IdxBuffer.resize(12);
+
+  ImDrawList * pLists[] = {&List};
+  ImDrawData DrawData;
+  DrawData.Valid         = true;
+  DrawData.CmdLists      = pLists;
+  DrawData.CmdListsCount = 1;
+  DrawData.TotalVtxCount = 8;
+  DrawData.TotalIdxCount = 12;
+
+  SIMGUIFrameProfile Profile;
+  CIMGUIFrameProfiler::countDrawData(&DrawData, Profile);
+
+  CHECK_EQUAL(1,  Profile.mDrawLists);
+  CHECK_EQUAL(8,  Profile.mVertices);
+  CHECK_EQUAL(12, Profile.mIndices);
+  CHECK_EQUAL(3,  Profile.mDrawCalls);
+  // the callback can change the texture, thus it must be bound again
+  CHECK_EQUAL(2,  Profile.mTextureBinds);
+  CHECK_EQUAL(8 * sizeof(ImDrawVert) + 12 * sizeof(ImDrawIdx), Profile.mBufferBytes);
+
+  List.ClearFreeMemory();
+
+  return;
+}
+
+TEST(TestFrameProfiler, checkHandleRecordsFrames)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  SIMGUISettings Settings;
+  Settings.mIsProfilerEnabled        = true;
+  Settings.mIsProfilerOverlayEnabled = true;
+  Settings.mProfilerHistorySize      = 2;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  CIMGUIFrameProfiler * const pProfiler = pGUI->getProfiler();
+  CHECK_EQUAL(2, pProfiler->getHistorySize());
+
+  for (int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Text("Frame %d", Frame);
+    pGUI->drawAll();
+  }
+
+  CHECK_EQUAL(2, pProfiler->getNumberOfFrames());
+  SIMGUIFrameProfile const &rFrame = pProfiler->getFrame(0);
+  CHECK_EQUAL(ImGui::GetFrameCount(), rFrame.mFrameNumber);
+  CHECK(rFrame.getCPUNanoseconds() > 0);
+  CHECK(rFrame.mDrawCalls > 0);
+  CHECK(rFrame.mVertices > 0);
+  CHECK(rFrame.mBufferBytes > 0);
+  // there is no OpenGL context with the NULL driver
+  CHECK_EQUAL(false, rFrame.mIsGPUTimeValid);
+
+  // disabling the profiler stops recording
+  Settings.mIsProfilerEnabled = false;
+  pGUI->setSettings(Settings);
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(0, pProfiler->getNumberOfFrames());
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestFrameProfiler, checkHandlePreparesRenderer)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  CIMGUIFrameProfiler * const pProfiler = pGUI->getProfiler();
+  CHECK_EQUAL(false, pProfiler->getStartup().mIsPrepared);
+
+  pGUI->prepare();
+  SIMGUIStartupProfile const Startup = pProfiler->getStartup();
+  CHECK_EQUAL(true,  Startup.mIsPrepared);
+  // the NULL driver does not use the program cache
+  CHECK_EQUAL(false, Startup.mIsProgramFromCache);
+
+  // the renderer is only prepared once
+  pGUI->prepare();
+  pGUI->startGUI();
+  pGUI->drawAll();
+  CHECK_EQUAL(Startup.mPrepareNanoseconds, pProfiler->getStartup().mPrepareNanoseconds);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestFrameProfiler, checkAllocationSamples)
+{
+  CIMGUIFrameProfiler Profiler;
+  CHECK_EQUAL(0, Profiler.getAllocationSamples().size());
+
+  Profiler.addAllocationSample("First", 10);
+  Profiler.addAllocationSample("Second", 20);
+  Profiler.addAllocationSample("Second", 30);
+
+  std::vector<SIMGUIAllocationSample> const Samples = Profiler.getAllocationSamples();
+  CHECK_EQUAL(2, Samples.size());
+  CHECK(Samples[0].mLocation == "Second");
+  CHECK_EQUAL(2, Samples[0].mSamples);
+  CHECK(50 == Samples[0].mBytes);
+  CHECK(Samples[1].mLocation == "First");
+  CHECK_EQUAL(1, Samples[1].mSamples);
+
+  Profiler.clearAllocationSamples();
+  CHECK_EQUAL(0, Profiler.getAllocationSamples().size());
+
+  return;
+}
+
+TEST(TestFrameProfiler, checkHandleTracksAllocations)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  SIMGUISettings Settings;
+  Settings.mIsProfilerEnabled          = true;
+  Settings.mProfilerHistorySize        = 1;
+  Settings.mAllocationSamplingInterval = 1;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  CIMGUIFrameProfiler * const pProfiler = pGUI->getProfiler();
+  unsigned int FirstAllocations = 0;
+
+  for (int Frame = 0; Frame < 5; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Begin("Allocating Window");
+    ImGui::Text("Frame %d", Frame);
+    ImGui::End();
+    pGUI->drawAll();
+
+    if (Frame == 0)
+    {
+      FirstAllocations = pProfiler->getFrame(0).mAllocations;
+    }
+  }
+
+  // the first frame creates the window, later frames reuse its buffers
+  SIMGUIFrameProfile const &rFrame = pProfiler->getFrame(0);
+  CHECK(FirstAllocations > 0);
+  CHECK(rFrame.mAllocations < FirstAllocations);
+  CHECK(rFrame.mLiveBytes > 0);
+  CHECK(rFrame.mPeakBytes >= rFrame.mLiveBytes);
+
+  bool IsWindowSampled = false;
+  std::vector<SIMGUIAllocationSample> const Samples = pProfiler->getAllocationSamples();
+  for (size_t i = 0; i < Samples.size(); i++)
+  {
+    IsWindowSampled = IsWindowSampled || (Samples[i].mLocation == "Allocating Window");
+  }
+  CHECK(IsWindowSampled);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+/// @brief Builds a frame with a temporary text buffer, that allocates in every frame.
+static SIMGUIFrameProfile buildTemporaryBufferFrame(IIMGUIHandle * const pGUI)
+{
+  pGUI->startGUI();
+  {
+    ImGuiTextBuffer Buffer;
+    for (int Line = 0; Line < 100; Line++)
+    {
+      Buffer.append("Line %d\n", Line);
+    }
+    ImGui::TextUnformatted(Buffer.begin(), Buffer.end());
+  }
+  pGUI->drawAll();
+
+  return pGUI->getProfiler()->getFrame(0);
+}
+
+TEST(TestFrameProfiler, checkFrameAllocator)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  SIMGUISettings Settings;
+  Settings.mIsProfilerEnabled   = true;
+  Settings.mProfilerHistorySize = 1;
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  for (int Frame = 0; Frame < 3; Frame++)
+  {
+    buildTemporaryBufferFrame(pGUI);
+  }
+
+  // without frame allocator every allocation reaches malloc
+  SIMGUIFrameProfile const MallocFrame = buildTemporaryBufferFrame(pGUI);
+  CHECK(MallocFrame.mAllocations > 0);
+  CHECK_EQUAL(MallocFrame.mAllocations, MallocFrame.mSystemAllocations);
+  CHECK(MallocFrame.mReallocations > 0);
+
+  Settings.mIsFrameAllocatorEnabled = true;
+  pGUI->setSettings(Settings);
+
+  SIMGUIFrameProfile const FirstFrame = buildTemporaryBufferFrame(pGUI);
+  CHECK(FirstFrame.mSystemAllocations > 0);
+
+  // afterwards the pools and the arena are reused
+  SIMGUIFrameProfile const PoolFrame = buildTemporaryBufferFrame(pGUI);
+  CHECK_EQUAL(MallocFrame.mAllocations, PoolFrame.mAllocations);
+  CHECK_EQUAL(0, PoolFrame.mSystemAllocations);
+
+  // blocks of the frame allocator can still be freed, when it is disabled again
+  Settings.mIsFrameAllocatorEnabled = false;
+  pGUI->setSettings(Settings);
+  buildTemporaryBufferFrame(pGUI);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
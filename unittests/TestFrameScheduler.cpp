@@ -0,0 +1,235 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestFrameScheduler.cpp
+ * @brief Contains unit tests for the frame scheduler.
+ */
+
+// library includes
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IIMGUIFrameScheduler.h>
+
+using namespace IrrIMGUI;
+
+/// @brief Counts the calls of the render function.
+static std::atomic<int> RenderCalls(0);
+
+static void countRenderCalls(ImDrawData * pDrawData)
+{
+  CHECK_NOT_EQUAL(nullptr, pDrawData);
+  RenderCalls++;
+  return;
+}
+
+TEST_GROUP(TestFrameScheduler)
+{
+  TEST_SETUP()
+  {
+    RenderCalls = 0;
+  }
+
+  TEST_TEARDOWN()
+  {
+  }
+};
+
+TEST(TestFrameScheduler, checkNumberOfThreads)
+{
+  IIMGUIFrameScheduler * const pScheduler = createIMGUIFrameScheduler(3);
+  CHECK_EQUAL(3, pScheduler->getNumberOfThreads());
+  pScheduler->drop();
+
+  IIMGUIFrameScheduler * const pDefaultScheduler = createIMGUIFrameScheduler();
+  CHECK(pDefaultScheduler->getNumberOfThreads() >= 1);
+  pDefaultScheduler->drop();
+
+  return;
+}
+
+TEST(TestFrameScheduler, checkAddAndRemoveGUI)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI1 = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI2 = createIMGUI(pDevice);
+
+  IIMGUIFrameScheduler * const pScheduler = createIMGUIFrameScheduler(2);
+  CHECK_EQUAL(0, pScheduler->getNumberOfGUIs());
+
+  pScheduler->addGUI(pGUI1, nullptr);
+  pScheduler->addGUI(pGUI2, nullptr);
+  CHECK_EQUAL(2, pScheduler->getNumberOfGUIs());
+  CHECK_EQUAL(2, pGUI1->getReferenceCount());
+  CHECK_EQUAL(2, pGUI2->getReferenceCount());
+
+  pScheduler->removeGUI(pGUI1);
+  CHECK_EQUAL(1, pScheduler->getNumberOfGUIs());
+  CHECK_EQUAL(1, pGUI1->getReferenceCount());
+
+  // the scheduler drops the remaining handles at destruction
+  pScheduler->drop();
+  CHECK_EQUAL(1, pGUI2->getReferenceCount());
+
+  pGUI2->drop();
+  pGUI1->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestFrameScheduler, checkFramesAreBuiltInOwnContexts)
+{
+  int const NumberOfGUIs   = 8;
+  int const NumberOfFrames = 10;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIFrameScheduler * const pScheduler = createIMGUIFrameScheduler(4);
+
+  std::vector<IIMGUIHandle *> GUIs;
+  std::vector<ImGuiContext *> Contexts;
+  std::vector<int>            Calls(NumberOfGUIs, 0);
+  std::vector<int>            WrongContexts(NumberOfGUIs, 0);
+
+  for (int i = 0; i < NumberOfGUIs; i++)
+  {
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+    ImGui::GetIO().IniFilename       = nullptr;
+    ImGui::GetIO().RenderDrawListsFn = countRenderCalls;
+    GUIs.push_back(pGUI);
+    Contexts.push_back(ImGui::GetCurrentContext());
+  }
+
+  for (int i = 0; i < NumberOfGUIs; i++)
+  {
+    pScheduler->addGUI(GUIs[i], [i, &Calls, &WrongContexts, &Contexts](IIMGUIHandle * pGUI)
+    {
+      Calls[i]++;
+      if (ImGui::GetCurrentContext() != Contexts[i])
+      {
+        WrongContexts[i]++;
+      }
+
+      ImGui::Begin("Panel");
+      for (int Line = 0; Line < 50; Line++)
+      {
+        ImGui::Text("Panel %d, Line %d", i, Line);
+      }
+      ImGui::End();
+    });
+  }
+
+  for (int Frame = 0; Frame < NumberOfFrames; Frame++)
+  {
+    pScheduler->buildFrames();
+
+    // the draw data is ready, but nothing has been submitted
+    CHECK_EQUAL(0, RenderCalls);
+    for (int i = 0; i < NumberOfGUIs; i++)
+    {
+      GUIs[i]->makeCurrent();
+      CHECK_NOT_EQUAL(nullptr, ImGui::GetDrawData());
+      CHECK(ImGui::GetDrawData()->TotalVtxCount > 0);
+    }
+
+    pScheduler->drawAll();
+    CHECK_EQUAL(NumberOfGUIs, RenderCalls);
+    RenderCalls = 0;
+  }
+
+  for (int i = 0; i < NumberOfGUIs; i++)
+  {
+    CHECK_EQUAL(NumberOfFrames, Calls[i]);
+    CHECK_EQUAL(0, WrongContexts[i]);
+  }
+
+  pScheduler->drop();
+  for (IIMGUIHandle * pGUI : GUIs)
+  {
+    pGUI->drop();
+  }
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestFrameScheduler, checkExceptionsOfGUIFunctions)
+{
+  int const NumberOfGUIs = 4;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIFrameScheduler * const pScheduler = createIMGUIFrameScheduler(2);
+
+  std::vector<IIMGUIHandle *> GUIs;
+  std::vector<int>            Calls(NumberOfGUIs, 0);
+  bool                        IsThrowing = true;
+
+  for (int i = 0; i < NumberOfGUIs; i++)
+  {
+    IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+    ImGui::GetIO().IniFilename       = nullptr;
+    ImGui::GetIO().RenderDrawListsFn = countRenderCalls;
+    GUIs.push_back(pGUI);
+
+    pScheduler->addGUI(pGUI, [i, &Calls, &IsThrowing](IIMGUIHandle * pGUI)
+    {
+      Calls[i]++;
+      if (IsThrowing && (i == 1))
+      {
+        throw std::runtime_error("GUI function failed");
+      }
+      ImGui::Text("Panel %d", i);
+    });
+  }
+
+  // the other frames are built, before the exception is passed to the caller
+  CHECK_THROWS(std::runtime_error, pScheduler->buildFrames());
+  for (int i = 0; i < NumberOfGUIs; i++)
+  {
+    CHECK_EQUAL(1, Calls[i]);
+  }
+
+  // the worker threads are still alive
+  IsThrowing = false;
+  pScheduler->buildFrames();
+  pScheduler->drawAll();
+  CHECK_EQUAL(NumberOfGUIs, RenderCalls);
+  for (int i = 0; i < NumberOfGUIs; i++)
+  {
+    CHECK_EQUAL(2, Calls[i]);
+  }
+
+  pScheduler->drop();
+  for (IIMGUIHandle * pGUI : GUIs)
+  {
+    pGUI->drop();
+  }
+  pDevice->drop();
+
+  return;
+}
@@ -0,0 +1,128 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestFrameTimer.cpp
+ * @brief Contains unit tests for the GUI frame timer.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/CIMGUIFrameTimer.h>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(TestFrameTimer)
+{
+};
+
+TEST(TestFrameTimer, checkFixedStep)
+{
+  float DeltaTime;
+  CIMGUIFixedStepClock Clock(16000000);
+  CIMGUIFrameTimer Timer(&Clock);
+
+  DeltaTime = Timer.update();
+  CHECK_EQUAL_TOLERANCE(0.016f, 0.000001f, DeltaTime);
+  CHECK(16000000 == Timer.getRawDeltaNanoseconds());
+  DeltaTime = Timer.update();
+  CHECK_EQUAL_TOLERANCE(0.016f, 0.000001f, DeltaTime);
+  CHECK_EQUAL_TOLERANCE(0.016f, 0.000001f, Timer.getDeltaTime());
+
+  return;
+}
+
+TEST(TestFrameTimer, checkMinimumTimeStep)
+{
+  CIMGUIFixedStepClock Clock(0);
+  CIMGUIFrameTimer Timer(&Clock);
+
+  // a clock that does not advance must never lead to a time step of 0
+  CHECK(Timer.update() > 0.0f);
+  CHECK(1 == Timer.getRawDeltaNanoseconds());
+
+  return;
+}
+
+TEST(TestFrameTimer, checkSmoothing)
+{
+  float DeltaTime;
+  CIMGUIFixedStepClock Clock(0);
+  CIMGUIFrameTimer Timer(&Clock);
+  Timer.setSmoothing(0.5f);
+  CHECK_EQUAL(0.5f, Timer.getSmoothing());
+
+  // the first time step is not smoothed
+  Clock.advance(10000000);
+  DeltaTime = Timer.update();
+  CHECK_EQUAL_TOLERANCE(0.010f, 0.000001f, DeltaTime);
+
+  Clock.advance(30000000);
+  DeltaTime = Timer.update();
+  CHECK_EQUAL_TOLERANCE(0.020f, 0.000001f, DeltaTime);
+  CHECK(30000000 == Timer.getRawDeltaNanoseconds());
+
+  Clock.advance(20000000);
+  DeltaTime = Timer.update();
+  CHECK_EQUAL_TOLERANCE(0.020f, 0.000001f, DeltaTime);
+
+  return;
+}
+
+TEST(TestFrameTimer, checkChangeClock)
+{
+  float DeltaTime;
+  CIMGUIFixedStepClock FirstClock(0);
+  CIMGUIFixedStepClock SecondClock(0);
+  CIMGUIFrameTimer Timer(&FirstClock);
+  Timer.setSmoothing(0.9f);
+
+  FirstClock.advance(10000000);
+  Timer.update();
+
+  // changing the clock restarts the measurement and the smoothing
+  SecondClock.setNanoseconds(1000000000);
+  Timer.setClock(&SecondClock);
+  SecondClock.advance(40000000);
+  DeltaTime = Timer.update();
+  CHECK_EQUAL_TOLERANCE(0.040f, 0.000001f, DeltaTime);
+
+  return;
+}
+
+TEST(TestFrameTimer, checkSystemClock)
+{
+  CIMGUIFrameTimer Timer;
+
+  irr::u64 const FirstTime  = CIMGUIFrameTimer::getSystemNanoseconds();
+  irr::u64 const SecondTime = CIMGUIFrameTimer::getSystemNanoseconds();
+  CHECK(SecondTime >= FirstTime);
+
+  float const DeltaTime = Timer.update();
+  CHECK(DeltaTime > 0.0f);
+  CHECK(DeltaTime < 1.0f);
+
+  return;
+}
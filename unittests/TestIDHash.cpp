@@ -0,0 +1,134 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestIDHash.cpp
+ * @brief Contains unit tests for the hash of the IMGUI IDs.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IncludeIMGUI.h>
+#include <IMGUI/imgui_internal.h>
+#include <string>
+#include <vector>
+
+TEST_GROUP(TestIDHash)
+{
+  /// @return Returns the CRC32 like the byte-wise table lookup of IMGUI computes it, including the handling of "###".
+  static ImU32 computeReferenceHash(void const * const pData, int DataSize, ImU32 const Seed)
+  {
+    ImU32 Table[256];
+    for(ImU32 i = 0; i < 256; i++)
+    {
+      ImU32 CRC = i;
+      for(int j = 0; j < 8; j++)
+      {
+        CRC = (CRC >> 1) ^ ((CRC & 1) ? 0xEDB88320 : 0);
+      }
+      Table[i] = CRC;
+    }
+
+    ImU32 const InvertedSeed = ~Seed;
+    ImU32 CRC = InvertedSeed;
+    unsigned char const * pCurrent = static_cast<unsigned char const *>(pData);
+    if(DataSize > 0)
+    {
+      while(DataSize--)
+      {
+        CRC = (CRC >> 8) ^ Table[(CRC & 0xFF) ^ *pCurrent++];
+      }
+    }
+    else
+    {
+      while(unsigned char const Char = *pCurrent++)
+      {
+        if((Char == '#') && (pCurrent[0] == '#') && (pCurrent[1] == '#'))
+        {
+          CRC = InvertedSeed;
+        }
+        CRC = (CRC >> 8) ^ Table[(CRC & 0xFF) ^ Char];
+      }
+    }
+    return ~CRC;
+  }
+};
+
+TEST(TestIDHash, checkKnownCRC32)
+{
+  // the check value of the standard CRC32
+  CHECK_EQUAL(0xCBF43926, ImHash("123456789", 0, 0));
+  CHECK_EQUAL(0xCBF43926, ImHash("123456789", 9, 0));
+  CHECK_EQUAL(0u, ImHash("", 0, 0));
+
+  return;
+}
+
+TEST(TestIDHash, checkLabelsAreCompatible)
+{
+  char const * const Labels[] =
+  {
+    "", "a", "OK", "Cancel", "##value", "Position X", "Transform / Position X", "Save###SaveButton", "###", "####", "#####",
+    "a#b##c###d", "Label##", "Label###", "Label##########id", "#", "##", "Properties 3", "Render##Settings###Render",
+    "A long label with a lot of text, that is longer than a few words of 8 bytes###AndAnID",
+  };
+  ImU32 const Seeds[] = { 0, 0x12345678, 0xFFFFFFFF };
+
+  for(ImU32 const Seed : Seeds)
+  {
+    for(char const * const pLabel : Labels)
+    {
+      CHECK_EQUAL(computeReferenceHash(pLabel, 0, Seed), ImHash(pLabel, 0, Seed));
+    }
+  }
+
+  return;
+}
+
+TEST(TestIDHash, checkBuffersAreCompatible)
+{
+  // every size and alignment of the words of 8 bytes
+  std::vector<unsigned char> Data(300);
+  for(size_t i = 0; i < Data.size(); i++)
+  {
+    Data[i] = static_cast<unsigned char>(i * 131 + 7);
+  }
+
+  for(int Offset = 0; Offset < 8; Offset++)
+  {
+    for(int Size = 1; Size < 260; Size++)
+    {
+      CHECK_EQUAL(computeReferenceHash(&Data[Offset], Size, 0x9E3779B9), ImHash(&Data[Offset], Size, 0x9E3779B9));
+    }
+  }
+
+  // the "###" of a buffer with known size is hashed as well
+  std::string const Label = "Label###ID";
+  CHECK_EQUAL(computeReferenceHash(Label.c_str(), static_cast<int>(Label.size()), 0), ImHash(Label.c_str(), static_cast<int>(Label.size()), 0));
+  CHECK(ImHash(Label.c_str(), static_cast<int>(Label.size()), 0) != ImHash(Label.c_str(), 0, 0));
+  CHECK_EQUAL(ImHash("###ID", 0, 0), ImHash(Label.c_str(), 0, 0));
+
+  return;
+}
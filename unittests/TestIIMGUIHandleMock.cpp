@@ -94,6 +94,78 @@ TEST(IIMGUIHandleMock, checkStartGUIAndDrawAll)
   return;
 }
 
+TEST(IIMGUIHandleMock, checkMakeCurrent)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  mock().expectOneCall("IIMGUIHandleMock::makeCurrent");
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  pGUI->makeCurrent();
+
+  pGUI->drop();
+
+  pDevice->drop();
+
+  return;
+}
+
+TEST(IIMGUIHandleMock, checkPrepare)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  mock().expectOneCall("IIMGUIHandleMock::prepare");
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  pGUI->prepare();
+
+  pGUI->drop();
+
+  pDevice->drop();
+
+  return;
+}
+
+TEST(IIMGUIHandleMock, checkFinishGUI)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  mock().expectOneCall("IIMGUIHandleMock::finishGUI");
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  pGUI->finishGUI();
+
+  pGUI->drop();
+
+  pDevice->drop();
+
+  return;
+}
+
+TEST(IIMGUIHandleMock, checkGetProfiler)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  mock().expectOneCall("IIMGUIHandleMock::getProfiler");
+  mock().ignoreOtherCalls();
+
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+
+  CHECK(pGUI->getProfiler() != nullptr);
+
+  pGUI->drop();
+
+  pDevice->drop();
+
+  return;
+}
+
 TEST(IIMGUIHandleMock, checkSetAndGetSettings)
 {
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
@@ -159,6 +231,16 @@ TEST(IIMGUIHandleMock, checkFontFunctions)
           .withConstPointerParameter("pFontConfig", &FontConfig)
           .withConstPointerParameter("pGlyphRanges", GlyphRanges);
 
+  ImWchar const DynamicGlyphRanges[] = {20, 30};
+  unsigned int const NumberOfCachedGlyphs = 64;
+  mock().expectOneCall("IIMGUIHandleMock::addDynamicFontFromFileTTF")
+          .withParameter("pFileName", TTFFileName)
+          .withParameter("FontSizeInPixel", FontSizeInPixel)
+          .withConstPointerParameter("pDynamicGlyphRanges", DynamicGlyphRanges)
+          .withParameter("NumberOfCachedGlyphs", NumberOfCachedGlyphs)
+          .withConstPointerParameter("pFontConfig", &FontConfig)
+          .withConstPointerParameter("pGlyphRanges", GlyphRanges);
+
   mock().ignoreOtherCalls();
 
   IIMGUIHandle * const pGUI = createIMGUI(pDevice);
@@ -169,6 +251,7 @@ TEST(IIMGUIHandleMock, checkFontFunctions)
   ImFont * const pFont4 = pGUI->addFontFromMemoryTTF(pTTFData, TTFSize, FontSizeInPixel, &FontConfig, GlyphRanges);
   ImFont * const pFont5 = pGUI->addFontFromMemoryCompressedTTF(pCompressedTTFData, CompressedTTFSize, FontSizeInPixel, &FontConfig, GlyphRanges);
   ImFont * const pFont6 = pGUI->addFontFromMemoryCompressedBase85TTF(pCompressedTTFDataBase85, FontSizeInPixel, &FontConfig, GlyphRanges);
+  ImFont * const pFont7 = pGUI->addDynamicFontFromFileTTF(TTFFileName, FontSizeInPixel, DynamicGlyphRanges, NumberOfCachedGlyphs, &FontConfig, GlyphRanges);
 
   pGUI->drop();
   pDevice->drop();
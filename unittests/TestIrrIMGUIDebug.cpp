@@ -33,6 +33,9 @@
 #include <IrrIMGUIDebug_priv.h>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <cstdio>
+#include <thread>
 
 using namespace IrrIMGUI;
 
@@ -161,3 +164,154 @@ TEST(TestIrrIMGUIDebug, checkAssertionMacro)
 
   CHECK_EQUAL(true, WasExceptionTriggered);
 }
+
+TEST(TestIrrIMGUIDebug, checkRecordIsWrittenWithPrefix)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+
+  LOG_RECORD(TestChannel, "Hello " << 42 << "\nWorld\n");
+
+  CHECK_EQUAL(std::string("[Test] Hello 42\n[Test] World\n"), OutputStream.str());
+}
+
+TEST(TestIrrIMGUIDebug, checkRecordStartsWithDefaultFormat)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+
+  LOG_RECORD(TestChannel, std::hex << 255 << "\n");
+  LOG_RECORD(TestChannel, 255 << "\n");
+
+  CHECK_EQUAL(std::string("[Test] ff\n[Test] 255\n"), OutputStream.str());
+}
+
+TEST(TestIrrIMGUIDebug, checkLongRecord)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+
+  std::string const LongText(5000, 'x');
+  LOG_RECORD(TestChannel, LongText << "\n");
+
+  CHECK_EQUAL(std::string("[Test] ") + LongText + "\n", OutputStream.str());
+}
+
+/// @brief Writes a record while the record of the caller is formatted.
+static int writeInnerRecord(Debug::CChannel * const pChannel)
+{
+  LOG_RECORD(*pChannel, "Inner " << 1 << "\n");
+  return 7;
+}
+
+TEST(TestIrrIMGUIDebug, checkNestedRecord)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+
+  LOG_RECORD(TestChannel, "Outer " << writeInnerRecord(&TestChannel) << " end\n");
+  LOG_RECORD(TestChannel, "Next\n");
+
+  CHECK_EQUAL(std::string("[Test] Inner 1\n[Test] Outer 7 end\n[Test] Next\n"), OutputStream.str());
+}
+
+static void writeTestRecords(Debug::CChannel * const pChannel, int const Thread)
+{
+  for (int i = 0; i < 200; i++)
+  {
+    LOG_RECORD(*pChannel, "Thread " << Thread << " record " << i << "\n");
+  }
+  return;
+}
+
+TEST(TestIrrIMGUIDebug, checkAsyncLogging)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+
+  Debug::startAsyncLogging();
+  CHECK_EQUAL(true, Debug::isAsyncLoggingEnabled());
+
+  std::thread Thread1(writeTestRecords, &TestChannel, 1);
+  std::thread Thread2(writeTestRecords, &TestChannel, 2);
+  writeTestRecords(&TestChannel, 0);
+  Thread1.join();
+  Thread2.join();
+
+  Debug::flushAsyncLogging();
+  Debug::stopAsyncLogging();
+  CHECK_EQUAL(false, Debug::isAsyncLoggingEnabled());
+
+  // all records are complete lines with prefix and the records of a thread keep their order
+  int NextRecord[3] = {0, 0, 0};
+  std::string Line;
+  int Lines = 0;
+  while (std::getline(OutputStream, Line))
+  {
+    int Thread = -1;
+    int Record = -1;
+    CHECK_EQUAL(2, std::sscanf(Line.c_str(), "[Test] Thread %d record %d", &Thread, &Record));
+    CHECK(Thread >= 0 && Thread < 3);
+    CHECK_EQUAL(NextRecord[Thread], Record);
+    NextRecord[Thread]++;
+    Lines++;
+  }
+
+  CHECK_EQUAL(600, Lines);
+}
+
+TEST(TestIrrIMGUIDebug, checkConcurrentStopOfAsyncLogging)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+
+  for (int Round = 0; Round < 20; Round++)
+  {
+    Debug::startAsyncLogging();
+    LOG_RECORD(TestChannel, "Round " << Round << "\n");
+
+    std::thread FlushThread(Debug::flushAsyncLogging);
+    std::thread StopThread(Debug::stopAsyncLogging);
+    Debug::stopAsyncLogging();
+    FlushThread.join();
+    StopThread.join();
+
+    CHECK_EQUAL(false, Debug::isAsyncLoggingEnabled());
+  }
+
+  // every record has been written before the writer stopped
+  std::string Line;
+  int Lines = 0;
+  while (std::getline(OutputStream, Line))
+  {
+    Lines++;
+  }
+
+  CHECK_EQUAL(20, Lines);
+}
+
+TEST(TestIrrIMGUIDebug, checkRateLimit)
+{
+  std::stringstream OutputStream;
+  Debug::CChannel TestChannel(OutputStream, "[Test] ");
+  TestChannel.setRateLimit(3);
+
+  for (int i = 0; i < 10; i++)
+  {
+    LOG_RECORD(TestChannel, "Record " << i << "\n");
+  }
+
+  // when a new second starts during the loop, more records are allowed
+  std::string Line;
+  unsigned int Lines = 0;
+  while (std::getline(OutputStream, Line))
+  {
+    Lines++;
+  }
+
+  CHECK(Lines >= 3);
+  CHECK_EQUAL(10U, Lines + TestChannel.getNumberOfSuppressedRecords());
+
+  TestChannel.setRateLimit(0);
+  CHECK_EQUAL(true, TestChannel.isRecordAllowed());
+}
@@ -31,6 +31,9 @@
 // library includes
 #include <typeinfo>
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
 #define STB_DEFINE
 #include "stb_compress_only.h"
 #include <IrrIMGUI/UnitTest/UnitTest.h>
@@ -40,13 +43,18 @@
 #include <IrrIMGUI/IrrIMGUIConstants.h>
 #include <IrrIMGUIDebug_priv.h>
 #include <CGUITexture.h>
+#include <CGUITextureTable.h>
 
 using namespace IrrIMGUI;
 
 TEST_GROUP(TestIMGUIHandle)
 {
+  /// @brief The NULL device chooses the null renderer, but the tests draw against OpenGL.
+  SIMGUISettings mSettings;
+
   TEST_SETUP()
   {
+    mSettings.mBackend = EIB_OPENGL3;
   }
 
   TEST_TEARDOWN()
@@ -60,7 +68,7 @@ TEST(TestIMGUIHandle, checkIfHandleGrabsAndDropsIrrlicht)
 
   irr::s32 const IrrDeviceRefCount = pDevice->getReferenceCount();
 
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
 
   CHECK(pDevice->getReferenceCount() > IrrDeviceRefCount);
 
@@ -75,22 +83,11 @@ TEST(TestIMGUIHandle, checkIfHandleGrabsAndDropsIrrlicht)
 
 TEST(TestIMGUIHandle, checkIfHandleSetupsIMGUIMouse)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
-  for (int i = 0; i < Const::NumberOfMouseButtons; i++)
-  {
-    rIMGUI.MouseClicked[i]          = true;
-    rIMGUI.MouseDoubleClicked[i]    = true;
-    rIMGUI.MouseDown[i]             = true;
-    rIMGUI.MouseClickedTime[i]      = 42.0f;
-    rIMGUI.MouseDownDurationPrev[i] = 52.0f;
-    rIMGUI.MouseDownDuration[i]     = 62.0f;
-  }
-
-  rIMGUI.MouseWheel = 2.0f;
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  // the handle uses its own context, which is current after creation
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   for (int i = 0; i < Const::NumberOfMouseButtons; i++)
   {
@@ -112,33 +109,31 @@ TEST(TestIMGUIHandle, checkIfHandleSetupsIMGUIMouse)
 
 TEST(TestIMGUIHandle, checkIfHandleSetupsFonts)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
-  rIMGUI.Fonts->Clear();
-  rIMGUI.Fonts->TexID = nullptr;
+  ImFontAtlas * const pDefaultFonts = ImGui::GetIO().Fonts;
 
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
 
-  CHECK_NOT_EQUAL(nullptr, rIMGUI.Fonts->TexID);
-  CHECK_EQUAL(1,           rIMGUI.Fonts->Fonts.size());
+  ImGuiIO &rIMGUI = ImGui::GetIO();
+
+  CHECK_NOT_EQUAL(pDefaultFonts, rIMGUI.Fonts);
+  CHECK_NOT_EQUAL(nullptr,       rIMGUI.Fonts->TexID);
+  CHECK_EQUAL(1,                 rIMGUI.Fonts->Fonts.size());
 
   pGUI->drop();
   pDevice->drop();
 
-  CHECK_EQUAL(0,    rIMGUI.Fonts->Fonts.size());
+  CHECK_EQUAL(pDefaultFonts, ImGui::GetIO().Fonts);
 
   return;
 }
 
 TEST(TestIMGUIHandle, checkIfHandleSetupsFunctionPointer)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
-  rIMGUI.RenderDrawListsFn = nullptr;
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   CHECK_NOT_EQUAL(nullptr, rIMGUI.RenderDrawListsFn);
 
@@ -151,21 +146,22 @@ TEST(TestIMGUIHandle, checkIfHandleSetupsFunctionPointer)
 TEST(TestIMGUIHandle, checkFrameUpdate)
 {
   float CurrentGUITime;
-  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
 
-  pDevice->getTimer()->setTime(0);
+  // every frame takes exactly 16ms
+  CIMGUIFixedStepClock Clock(16000000);
+  SIMGUISettings Settings = mSettings;
+  Settings.mpFrameClock = &Clock;
 
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGuiIO &rIMGUI = ImGui::GetIO();
   float const InitialGUITime = ImGui::GetTime();
 
   rIMGUI.DeltaTime = 0.0f;
   rIMGUI.DisplaySize = ImVec2(0.0f, 0.0f);
   int const LastFrame = ImGui::GetFrameCount();
 
-  pDevice->getTimer()->setTime(16);
-
   pGUI->startGUI();
 
   CHECK_NOT_EQUAL(0.0f,    rIMGUI.DisplaySize.x);
@@ -176,8 +172,6 @@ TEST(TestIMGUIHandle, checkFrameUpdate)
 
   pGUI->drawAll();
 
-  pDevice->getTimer()->setTime(32);
-
   pGUI->startGUI();
 
   CHECK_NOT_EQUAL(0.0f,    rIMGUI.DisplaySize.x);
@@ -206,10 +200,10 @@ void checkDrawCommand(ImDrawList const * const pParentList, ImDrawCmd const * co
 
 TEST(TestIMGUIHandle, checkDrawCallback)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   pGUI->startGUI();
 
@@ -279,10 +273,10 @@ void encodeBase85(irr::u8 * const pOutputData, irr::u8 * const pInputData, size_
 
 TEST(TestIMGUIHandle, checkFontMethods)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   CHECK_EQUAL(1, rIMGUI.Fonts->Fonts.size());
 
@@ -357,10 +351,10 @@ TEST(TestIMGUIHandle, checkFontMethods)
 
 TEST(TestIMGUIHandle, checkGlyphMethods)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   CHECK_EQUAL(rIMGUI.Fonts->GetGlyphRangesChinese(),  pGUI->getGlyphRangesChinese());
   CHECK_EQUAL(rIMGUI.Fonts->GetGlyphRangesCyrillic(), pGUI->getGlyphRangesCyrillic());
@@ -373,10 +367,10 @@ TEST(TestIMGUIHandle, checkGlyphMethods)
 
 TEST(TestIMGUIHandle, checkImageTextureCreation)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   irr::video::IImage * const pImage1 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(100, 100));
   irr::video::IImage * const pImage2 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(200, 200));
@@ -387,25 +381,25 @@ TEST(TestIMGUIHandle, checkImageTextureCreation)
 
   Private::CGUITexture * const pRealGUITexture = dynamic_cast<IrrIMGUI::Private::CGUITexture*>(pGUITexture);
 
-  CHECK_EQUAL(true,                pRealGUITexture->mIsValid);
+  CHECK_EQUAL(true,                pRealGUITexture->isValid());
   CHECK_EQUAL(Private::ETST_IMAGE, pRealGUITexture->mSourceType);
   CHECK_EQUAL(pImage1,             pRealGUITexture->mSource.ImageID);
-  CHECK_NOT_EQUAL(NULL,            pRealGUITexture->mGPUTextureID);
+  CHECK_NOT_EQUAL(NULL,            pRealGUITexture->getGPUTextureID());
 
   pGUI->updateTexture(pGUITexture, pImage2);
 
-  CHECK_EQUAL(true,                pRealGUITexture->mIsValid);
+  CHECK_EQUAL(true,                pRealGUITexture->isValid());
   CHECK_EQUAL(Private::ETST_IMAGE, pRealGUITexture->mSourceType);
   CHECK_EQUAL(pImage2,             pRealGUITexture->mSource.ImageID);
-  CHECK_NOT_EQUAL(NULL,            pRealGUITexture->mGPUTextureID);
+  CHECK_NOT_EQUAL(NULL,            pRealGUITexture->getGPUTextureID());
 
   irr::video::ITexture * const pIrrTexture = pDevice->getVideoDriver()->addTexture("test1", pImage1);
   pGUI->updateTexture(pGUITexture, pIrrTexture);
 
-  CHECK_EQUAL(true,                  pRealGUITexture->mIsValid);
+  CHECK_EQUAL(true,                  pRealGUITexture->isValid());
   CHECK_EQUAL(Private::ETST_TEXTURE, pRealGUITexture->mSourceType);
   CHECK_EQUAL(pIrrTexture,           pRealGUITexture->mSource.TextureID);
-  CHECK_NOT_EQUAL(NULL,              pRealGUITexture->mGPUTextureID);
+  CHECK_NOT_EQUAL(NULL,              pRealGUITexture->getGPUTextureID());
 
   pGUI->deleteTexture(pGUITexture);
 
@@ -417,10 +411,10 @@ TEST(TestIMGUIHandle, checkImageTextureCreation)
 
 TEST(TestIMGUIHandle, checkTextureTextureCreation)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
-  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
 
   irr::video::IImage * const pImage1 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(100, 100));
   irr::video::IImage * const pImage2 = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(200, 200));
@@ -435,24 +429,24 @@ TEST(TestIMGUIHandle, checkTextureTextureCreation)
 
   Private::CGUITexture * const pRealGUITexture = dynamic_cast<IrrIMGUI::Private::CGUITexture*>(pGUITexture);
 
-  CHECK_EQUAL(true,                  pRealGUITexture->mIsValid);
+  CHECK_EQUAL(true,                  pRealGUITexture->isValid());
   CHECK_EQUAL(Private::ETST_TEXTURE, pRealGUITexture->mSourceType);
   CHECK_EQUAL(pIrrTexture1,          pRealGUITexture->mSource.TextureID);
-  CHECK_NOT_EQUAL(NULL,              pRealGUITexture->mGPUTextureID);
+  CHECK_NOT_EQUAL(NULL,              pRealGUITexture->getGPUTextureID());
 
   pGUI->updateTexture(pGUITexture, pIrrTexture2);
 
-  CHECK_EQUAL(true,                  pRealGUITexture->mIsValid);
+  CHECK_EQUAL(true,                  pRealGUITexture->isValid());
   CHECK_EQUAL(Private::ETST_TEXTURE, pRealGUITexture->mSourceType);
   CHECK_EQUAL(pIrrTexture2,          pRealGUITexture->mSource.TextureID);
-  CHECK_NOT_EQUAL(NULL,              pRealGUITexture->mGPUTextureID);
+  CHECK_NOT_EQUAL(NULL,              pRealGUITexture->getGPUTextureID());
 
   pGUI->updateTexture(pGUITexture, pImage1);
 
-  CHECK_EQUAL(true,                pRealGUITexture->mIsValid);
+  CHECK_EQUAL(true,                pRealGUITexture->isValid());
   CHECK_EQUAL(Private::ETST_IMAGE, pRealGUITexture->mSourceType);
   CHECK_EQUAL(pImage1,             pRealGUITexture->mSource.ImageID);
-  CHECK_NOT_EQUAL(NULL,            pRealGUITexture->mGPUTextureID);
+  CHECK_NOT_EQUAL(NULL,            pRealGUITexture->getGPUTextureID());
 
   pGUI->deleteTexture(pGUITexture);
 
@@ -461,3 +455,242 @@ TEST(TestIMGUIHandle, checkTextureTextureCreation)
   pGUI->drop();
   pDevice->drop();
 }
+
+TEST(TestIMGUIHandle, checkDeletedTextureHandle)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(100, 100));
+
+  IGUITexture * const pGUITexture1 = pGUI->createTexture(pImage);
+  ImTextureID const TextureID1 = *pGUITexture1;
+  pGUI->deleteTexture(pGUITexture1);
+
+  // the new texture uses the same entry of the texture table, but the handle is different
+  IGUITexture * const pGUITexture2 = pGUI->createTexture(pImage);
+  ImTextureID const TextureID2 = *pGUITexture2;
+  CHECK_NOT_EQUAL(TextureID1, TextureID2);
+
+  std::stringstream ErrorString;
+  std::streambuf * const pErrorBuffer = Debug::ErrorOutput.rdbuf();
+  Debug::ErrorOutput.rdbuf(ErrorString.rdbuf());
+
+  // a draw command with the deleted texture is not drawn
+  pGUI->startGUI();
+  ImGui::Begin("DeletedTexture");
+  ImGui::Image(TextureID1, ImVec2(10.0f, 10.0f));
+  ImGui::End();
+  pGUI->drawAll();
+
+  CHECK(ErrorString.str().find("has already been deleted") != std::string::npos);
+
+  // a draw command with the new texture is drawn
+  ErrorString.str("");
+  pGUI->startGUI();
+  ImGui::Begin("DeletedTexture");
+  ImGui::Image(TextureID2, ImVec2(10.0f, 10.0f));
+  ImGui::End();
+  pGUI->drawAll();
+
+  STRCMP_EQUAL("", ErrorString.str().c_str());
+
+  Debug::ErrorOutput.rdbuf(pErrorBuffer);
+
+  pGUI->deleteTexture(pGUITexture2);
+
+  pImage->drop();
+  pGUI->drop();
+  pDevice->drop();
+}
+
+TEST(TestIMGUIHandle, checkRawTextureIDsAndManyTextures)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &mSettings);
+
+  irr::video::IImage * const pImage = pDevice->getVideoDriver()->createImage(irr::video::ECF_A8R8G8B8, irr::core::dimension2du(4, 4));
+
+  // OpenGL texture names and pointers are never mistaken for handles of the texture table
+  CHECK_EQUAL(false, Private::CGUITextureTable::isHandle(reinterpret_cast<ImTextureID>(static_cast<uintptr_t>(0x10001))));
+  CHECK_EQUAL(false, Private::CGUITextureTable::isHandle(reinterpret_cast<ImTextureID>(static_cast<uintptr_t>(0xFFFFFFFF))));
+  CHECK_EQUAL(false, Private::CGUITextureTable::isHandle(pImage));
+
+  std::stringstream ErrorString;
+  std::streambuf * const pErrorBuffer = Debug::ErrorOutput.rdbuf();
+  Debug::ErrorOutput.rdbuf(ErrorString.rdbuf());
+
+  pGUI->startGUI();
+  ImGui::Begin("RawTexture");
+  ImGui::Image(reinterpret_cast<ImTextureID>(static_cast<uintptr_t>(0x10001)), ImVec2(10.0f, 10.0f));
+  ImGui::End();
+  pGUI->drawAll();
+
+  STRCMP_EQUAL("", ErrorString.str().c_str());
+
+  // the table grows, when all entries are used
+  std::vector<IGUITexture *> Textures;
+  for (unsigned int i = 0; i < 3 * Private::CGUITextureTable::BlockSize; i++)
+  {
+    IGUITexture * const pGUITexture = pGUI->createTexture(pImage);
+    CHECK(pGUITexture != nullptr);
+    Textures.push_back(pGUITexture);
+  }
+
+  CHECK(Private::CGUITextureTable::getInstance().getTexture(Textures.back()) != nullptr);
+  STRCMP_EQUAL("", ErrorString.str().c_str());
+
+  for (IGUITexture * const pGUITexture : Textures)
+  {
+    pGUI->deleteTexture(pGUITexture);
+  }
+
+  Debug::ErrorOutput.rdbuf(pErrorBuffer);
+
+  pImage->drop();
+  pGUI->drop();
+  pDevice->drop();
+}
+
+TEST(TestIMGUIHandle, checkIndependentContexts)
+{
+  ImGuiContext * const pDefaultContext = ImGui::GetCurrentContext();
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  IIMGUIHandle * const pGUI1 = createIMGUI(pDevice, nullptr, &mSettings);
+  ImGuiContext * const pContext1 = ImGui::GetCurrentContext();
+  ImFontAtlas  * const pFonts1   = ImGui::GetIO().Fonts;
+
+  IIMGUIHandle * const pGUI2 = createIMGUI(pDevice, nullptr, &mSettings);
+  ImGuiContext * const pContext2 = ImGui::GetCurrentContext();
+  ImFontAtlas  * const pFonts2   = ImGui::GetIO().Fonts;
+
+  CHECK_NOT_EQUAL(pDefaultContext, pContext1);
+  CHECK_NOT_EQUAL(pDefaultContext, pContext2);
+  CHECK_NOT_EQUAL(pContext1,       pContext2);
+
+  // both handles use the same device, thus they share the font atlas
+  CHECK_EQUAL(pFonts1, pFonts2);
+
+  // settings are applied per context
+  SIMGUISettings Settings;
+  Settings.mIsGUIMouseCursorEnabled = true;
+  pGUI1->setSettings(Settings);
+
+  Settings.mIsGUIMouseCursorEnabled = false;
+  pGUI2->setSettings(Settings);
+
+  pGUI1->makeCurrent();
+  CHECK_EQUAL(pContext1, ImGui::GetCurrentContext());
+  CHECK_EQUAL(true,      ImGui::GetIO().MouseDrawCursor);
+
+  pGUI2->makeCurrent();
+  CHECK_EQUAL(pContext2, ImGui::GetCurrentContext());
+  CHECK_EQUAL(false,     ImGui::GetIO().MouseDrawCursor);
+
+  // the font atlas must survive, as long as a handle of this device exists
+  pGUI1->drop();
+  pGUI2->makeCurrent();
+  CHECK_EQUAL(1, ImGui::GetIO().Fonts->Fonts.size());
+
+  pGUI2->drop();
+  CHECK_EQUAL(pDefaultContext, ImGui::GetCurrentContext());
+
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkContextsOfDifferentDevices)
+{
+  irr::IrrlichtDevice * const pDevice1 = irr::createDevice(irr::video::EDT_NULL);
+  irr::IrrlichtDevice * const pDevice2 = irr::createDevice(irr::video::EDT_NULL);
+
+  irr::s32 const IrrDevice1RefCount = pDevice1->getReferenceCount();
+  irr::s32 const IrrDevice2RefCount = pDevice2->getReferenceCount();
+
+  IIMGUIHandle * const pGUI1 = createIMGUI(pDevice1, nullptr, &mSettings);
+  ImFontAtlas  * const pFonts1 = ImGui::GetIO().Fonts;
+
+  IIMGUIHandle * const pGUI2 = createIMGUI(pDevice2, nullptr, &mSettings);
+  ImFontAtlas  * const pFonts2 = ImGui::GetIO().Fonts;
+
+  CHECK_NOT_EQUAL(pFonts1, pFonts2);
+  CHECK(pDevice1->getReferenceCount() > IrrDevice1RefCount);
+  CHECK(pDevice2->getReferenceCount() > IrrDevice2RefCount);
+
+  pGUI1->drop();
+
+  CHECK_EQUAL(IrrDevice1RefCount, pDevice1->getReferenceCount());
+  CHECK(pDevice2->getReferenceCount() > IrrDevice2RefCount);
+
+  pGUI2->drop();
+
+  CHECK_EQUAL(IrrDevice2RefCount, pDevice2->getReferenceCount());
+
+  pDevice1->drop();
+  pDevice2->drop();
+
+  return;
+}
+
+/// @brief Builds some GUI frames for a handle without submitting them to the graphic card.
+static void buildTestFrames(IIMGUIHandle * const pGUI, ImGuiContext ** const ppUsedContext, int * const pVertexCount)
+{
+  pGUI->makeCurrent();
+
+  ImGuiIO &rIMGUI = ImGui::GetIO();
+  rIMGUI.RenderDrawListsFn = nullptr;
+  rIMGUI.IniFilename       = nullptr;
+  rIMGUI.DisplaySize       = ImVec2(640.0f, 480.0f);
+  rIMGUI.DeltaTime         = 1.0f / 60.0f;
+
+  for (int Frame = 0; Frame < 100; Frame++)
+  {
+    ImGui::NewFrame();
+    ImGui::Begin("ThreadTest");
+    ImGui::Text("Frame %d", Frame);
+    ImGui::End();
+    ImGui::Render();
+  }
+
+  *ppUsedContext = ImGui::GetCurrentContext();
+  *pVertexCount  = ImGui::GetDrawData()->TotalVtxCount;
+
+  return;
+}
+
+TEST(TestIMGUIHandle, checkContextsOnDifferentThreads)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+
+  IIMGUIHandle * const pGUI1 = createIMGUI(pDevice, nullptr, &mSettings);
+  ImGuiContext * const pContext1 = ImGui::GetCurrentContext();
+  IIMGUIHandle * const pGUI2 = createIMGUI(pDevice, nullptr, &mSettings);
+  ImGuiContext * const pContext2 = ImGui::GetCurrentContext();
+
+  ImGuiContext * pUsedContext1 = nullptr;
+  ImGuiContext * pUsedContext2 = nullptr;
+  int VertexCount1 = 0;
+  int VertexCount2 = 0;
+
+  std::thread Thread1(buildTestFrames, pGUI1, &pUsedContext1, &VertexCount1);
+  std::thread Thread2(buildTestFrames, pGUI2, &pUsedContext2, &VertexCount2);
+  Thread1.join();
+  Thread2.join();
+
+  CHECK_EQUAL(pContext1, pUsedContext1);
+  CHECK_EQUAL(pContext2, pUsedContext2);
+  CHECK(VertexCount1 > 0);
+  CHECK(VertexCount2 > 0);
+
+  // the threads must not change the current context of this thread
+  CHECK_EQUAL(pContext2, ImGui::GetCurrentContext());
+
+  pGUI1->drop();
+  pGUI2->drop();
+  pDevice->drop();
+
+  return;
+}
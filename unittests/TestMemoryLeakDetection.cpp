@@ -33,8 +33,17 @@
 #include <IrrIMGUI/IrrIMGUIDebug.h>
 #include <sstream>
 #include <iostream>
+#include <cstdint>
 #include <string>
 
+#ifdef __GLIBC__
+#include <malloc.h>
+#include <unistd.h>
+
+/// @brief Allocates memory directly in the GNU C library, thus the memory instrumentation does not count the block.
+extern "C" void *__libc_malloc(size_t Size);
+#endif // __GLIBC__
+
 using namespace IrrIMGUI;
 
 #ifdef _ENABLE_MEMORY_LEAK_DETECTION_
@@ -228,3 +237,108 @@ TEST(TestMemoryLeakDetection, checkIfResetEnablesNewDetectionByDestructor)
 }
 
 #endif // _ENABLE_MEMORY_LEAK_DETECTION_
+
+TEST_GROUP(TestMemoryInstrumentation)
+{
+};
+
+TEST(TestMemoryInstrumentation, checkPeakBytesAndNumberOfAllocations)
+{
+  IrrIMGUI::Tools::CBasicMemoryLeakDetection MemoryLeakDetection;
+
+  char * const pBuffer = new char[4096];
+  int * const pVariable = new int;
+  delete pVariable;
+  delete[] pBuffer;
+
+  if (IrrIMGUI::Tools::CBasicMemoryLeakDetection::isInstrumented())
+  {
+    CHECK(MemoryLeakDetection.getPeakBytes() >= 4096 + sizeof(int));
+    CHECK(MemoryLeakDetection.getNumberOfAllocations() >= 2);
+
+    // the peak is measured again after a reset
+    MemoryLeakDetection.resetMemoryState();
+    CHECK(MemoryLeakDetection.getPeakBytes() < 4096);
+    CHECK_EQUAL(0, MemoryLeakDetection.getNumberOfAllocations());
+  }
+  else
+  {
+    CHECK_EQUAL(0, MemoryLeakDetection.getPeakBytes());
+    CHECK_EQUAL(0, MemoryLeakDetection.getNumberOfAllocations());
+  }
+
+  CHECK_EQUAL(0, MemoryLeakDetection.compareMemoryState());
+}
+
+TEST(TestMemoryInstrumentation, checkPeakBytesOfSeveralObjects)
+{
+  IrrIMGUI::Tools::CBasicMemoryLeakDetection LeakDetection;
+  IrrIMGUI::Tools::CBasicMemoryLeakDetection Benchmark;
+
+  char * const pBuffer = new char[4096];
+  delete[] pBuffer;
+
+  // a reset of one object does not reset the peak of the other one
+  Benchmark.resetMemoryState();
+
+  if (IrrIMGUI::Tools::CBasicMemoryLeakDetection::isInstrumented())
+  {
+    CHECK(LeakDetection.getPeakBytes() >= 4096);
+    CHECK(Benchmark.getPeakBytes() < 4096);
+  }
+
+  CHECK_EQUAL(0, Benchmark.compareMemoryState());
+  CHECK_EQUAL(0, LeakDetection.compareMemoryState());
+}
+
+#ifdef __GLIBC__
+
+TEST(TestMemoryInstrumentation, checkFreeOfBlocksThatHaveNotBeenCounted)
+{
+  size_t const BlockSize = 1 << 30;
+  void * const pBlock = __libc_malloc(BlockSize);
+  if ((pBlock == nullptr) || !IrrIMGUI::Tools::CBasicMemoryLeakDetection::isInstrumented())
+  {
+    free(pBlock);
+    return;
+  }
+
+  IrrIMGUI::Tools::CBasicMemoryLeakDetection MemoryLeakDetection;
+
+  // the allocated bytes of the process are less than the block size, but the counter must not wrap around
+  free(pBlock);
+  char * const pBuffer = new char[4096];
+  delete[] pBuffer;
+
+  CHECK(MemoryLeakDetection.getPeakBytes() < BlockSize);
+  CHECK(MemoryLeakDetection.compareMemoryState() <= -static_cast<int>(BlockSize));
+}
+
+TEST(TestMemoryInstrumentation, checkPageAndArrayAllocations)
+{
+  IrrIMGUI::Tools::CBasicMemoryLeakDetection MemoryLeakDetection;
+
+  // every block, that is freed with free(), has been counted by its allocation
+  void * const pPages = pvalloc(100);
+  CHECK(pPages != nullptr);
+  CHECK_EQUAL(0u, reinterpret_cast<uintptr_t>(pPages) % static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)));
+
+  int * pArray = static_cast<int *>(reallocarray(nullptr, 1000, sizeof(int)));
+  CHECK(pArray != nullptr);
+  pArray = static_cast<int *>(reallocarray(pArray, 2000, sizeof(int)));
+  CHECK(pArray != nullptr);
+  CHECK(reallocarray(pArray, static_cast<size_t>(-1) / 2, sizeof(int)) == nullptr);
+
+  if (IrrIMGUI::Tools::CBasicMemoryLeakDetection::isInstrumented())
+  {
+    CHECK(MemoryLeakDetection.getPeakBytes() >= 2000 * sizeof(int) + 100);
+    CHECK(MemoryLeakDetection.compareMemoryState() > 0);
+  }
+
+  free(pArray);
+  free(pPages);
+
+  CHECK_EQUAL(0, MemoryLeakDetection.compareMemoryState());
+}
+
+#endif // __GLIBC__
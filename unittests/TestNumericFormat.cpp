@@ -0,0 +1,180 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestNumericFormat.cpp
+ * @brief Contains unit tests for the fast formatting of widget values.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IMGUI/imgui_internal.h>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(TestNumericFormat)
+{
+  std::streambuf *  mpNoteStreamBuffer;
+  std::stringstream mNoteOutput;
+  irr::IrrlichtDevice * mpDevice;
+  IIMGUIHandle *        mpGUI;
+
+  TEST_SETUP()
+  {
+    mpNoteStreamBuffer = Debug::NoteOutput.rdbuf();
+    Debug::NoteOutput.rdbuf(mNoteOutput.rdbuf());
+
+    SIMGUISettings Settings;
+    Settings.mBackend = EIB_NULL;
+    mpDevice = irr::createDevice(irr::video::EDT_NULL);
+    mpGUI = createIMGUI(mpDevice, nullptr, &Settings);
+    ImGui::GetIO().IniFilename = nullptr;
+  }
+
+  TEST_TEARDOWN()
+  {
+    mpGUI->drop();
+    mpDevice->drop();
+    Debug::NoteOutput.rdbuf(mpNoteStreamBuffer);
+  }
+
+  /// @brief Checks, that the float is formatted like vsnprintf() does it.
+  static void checkFloat(char const * const pFormat, float const Value)
+  {
+    char Expected[64];
+    char Actual[64];
+    std::snprintf(Expected, sizeof(Expected), pFormat, Value);
+    int const Length = ImFormatFloat(Actual, sizeof(Actual), pFormat, Value);
+    STRCMP_EQUAL(Expected, Actual);
+    CHECK_EQUAL(static_cast<int>(std::strlen(Expected)), Length);
+    return;
+  }
+
+  /// @brief Checks, that the integer is formatted like vsnprintf() does it.
+  static void checkInt(char const * const pFormat, int const Value)
+  {
+    char Expected[64];
+    char Actual[64];
+    std::snprintf(Expected, sizeof(Expected), pFormat, Value);
+    int const Length = ImFormatInt(Actual, sizeof(Actual), pFormat, Value);
+    STRCMP_EQUAL(Expected, Actual);
+    CHECK_EQUAL(static_cast<int>(std::strlen(Expected)), Length);
+    return;
+  }
+};
+
+TEST(TestNumericFormat, checkFloatFormats)
+{
+  // supported formats, formats with text around the value and formats, that are passed to vsnprintf()
+  char const * const Formats[] =
+  {
+    "%f", "%.0f", "%.1f", "%.3f", "%.9f", "%.f", "%.2f m/s", "%.0f%%", "X: %.3f",
+    "%g", "%.0g", "%.1g", "%.3g", "%.9g", "%.6g deg",
+    "%8.3f", "%+.2f", "%e", "%.10f", "%.12g"
+  };
+
+  // rounding ties, negative zero, carries into the next digit, values with another exponent for %g and values too large for the fast path
+  float const Values[] =
+  {
+    0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 1.5f, 2.5f, -2.5f, 0.125f, 0.375f, 0.05f, -0.004f, 3.14159265f, 9.9999996f, 99999.95f,
+    999999.5f, 1234567.0f, 0.0001f, 0.00009999f, 1e-45f, 1e9f, 4294967040.0f, 4294967296.0f, 123456789.0f, -1e30f,
+    std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()
+  };
+
+  for(char const * const pFormat : Formats)
+  {
+    for(float const Value : Values)
+    {
+      checkFloat(pFormat, Value);
+    }
+
+    for(int i = -2000; i <= 2000; i++)
+    {
+      checkFloat(pFormat, static_cast<float>(i) * 0.0125f);
+      checkFloat(pFormat, static_cast<float>(i) * 7.1f);
+    }
+  }
+
+  return;
+}
+
+TEST(TestNumericFormat, checkIntFormats)
+{
+  char const * const Formats[] = { "%d", "%i", "Value: %d units", "%%%d%%", "%5d", "%.3d", "%x" };
+  int const Values[] = { 0, 1, -1, 9, 10, -10, 4711, INT_MAX, INT_MIN };
+
+  for(char const * const pFormat : Formats)
+  {
+    for(int const Value : Values)
+    {
+      checkInt(pFormat, Value);
+    }
+  }
+
+  return;
+}
+
+TEST(TestNumericFormat, checkReusedFormatBuffer)
+{
+  // the same buffer with another format must not use the format parsed before
+  char Format[16];
+  for(int Precision = 0; Precision < 10; Precision++)
+  {
+    std::snprintf(Format, sizeof(Format), "%%.%df", Precision);
+    checkFloat(Format, 3.14159265f);
+  }
+
+  std::snprintf(Format, sizeof(Format), "%%.3f");
+  checkFloat(Format, 2.0f);
+  std::snprintf(Format, sizeof(Format), "%%.3g");
+  checkFloat(Format, 2.0f);
+  std::snprintf(Format, sizeof(Format), "%%d");
+  checkInt(Format, 2);
+
+  return;
+}
+
+TEST(TestNumericFormat, checkTruncation)
+{
+  char Text[6];
+  CHECK_EQUAL(5, ImFormatFloat(Text, sizeof(Text), "%.3f mm", 12.5f));
+  STRCMP_EQUAL("12.50", Text);
+
+  CHECK_EQUAL(5, ImFormatInt(Text, sizeof(Text), "Value %d", 42));
+  STRCMP_EQUAL("Value", Text);
+
+  CHECK_EQUAL(0, ImFormatFloat(Text, 1, "%.3f", 12.5f));
+  STRCMP_EQUAL("", Text);
+
+  return;
+}
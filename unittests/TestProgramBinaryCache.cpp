@@ -0,0 +1,168 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestProgramBinaryCache.cpp
+ * @brief Contains unit tests for the file cache of linked shader programs.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <CProgramBinaryCache.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace IrrIMGUI;
+using namespace IrrIMGUI::Private;
+
+TEST_GROUP(TestProgramBinaryCache)
+{
+  std::streambuf * mpStreamBuffer;
+
+  TEST_SETUP()
+  {
+    mpStreamBuffer = Debug::WarningOutput.rdbuf();
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::WarningOutput.rdbuf(mpStreamBuffer);
+  }
+};
+
+TEST(TestProgramBinaryCache, checkStoreAndLoad)
+{
+  CProgramBinaryCache Cache(".", "Vendor|Renderer|4.5|Shader");
+  std::remove(Cache.getFileName().c_str());
+
+  unsigned int Format = 0;
+  std::vector<char> Binary;
+  CHECK_EQUAL(false, Cache.load(Format, Binary));
+
+  char const StoredBinary[] = "linked program";
+  CHECK_EQUAL(true, Cache.store(0x1234, StoredBinary, sizeof(StoredBinary)));
+
+  CHECK_EQUAL(true, Cache.load(Format, Binary));
+  CHECK_EQUAL(0x1234u, Format);
+  CHECK_EQUAL(sizeof(StoredBinary), Binary.size());
+  STRCMP_EQUAL(StoredBinary, Binary.data());
+
+  std::remove(Cache.getFileName().c_str());
+
+  return;
+}
+
+TEST(TestProgramBinaryCache, checkOtherKey)
+{
+  CProgramBinaryCache Cache(".", "Vendor|Renderer|4.5|Shader");
+  CProgramBinaryCache OtherCache("./", "Vendor|Renderer|4.6|Shader");
+
+  // a new driver version uses another file
+  CHECK_EQUAL(false, Cache.getFileName() == OtherCache.getFileName());
+
+  char const StoredBinary[] = "linked program";
+  CHECK_EQUAL(true, Cache.store(0x1234, StoredBinary, sizeof(StoredBinary)));
+
+  unsigned int Format = 0;
+  std::vector<char> Binary;
+  CHECK_EQUAL(false, OtherCache.load(Format, Binary));
+
+  std::remove(Cache.getFileName().c_str());
+
+  return;
+}
+
+TEST(TestProgramBinaryCache, checkDamagedFile)
+{
+  std::stringstream WarningOutput;
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  CProgramBinaryCache Cache(".", "Vendor|Renderer|4.5|Shader");
+
+  FILE * const pFile = std::fopen(Cache.getFileName().c_str(), "wb");
+  CHECK(pFile != nullptr);
+  std::fputs("no program", pFile);
+  std::fclose(pFile);
+
+  unsigned int Format = 0;
+  std::vector<char> Binary;
+  CHECK_EQUAL(false, Cache.load(Format, Binary));
+  CHECK_EQUAL(false, WarningOutput.str().empty());
+
+  std::remove(Cache.getFileName().c_str());
+
+  return;
+}
+
+TEST(TestProgramBinaryCache, checkConcurrentStore)
+{
+  CProgramBinaryCache Cache(".", "Vendor|Renderer|4.5|Shader");
+  std::remove(Cache.getFileName().c_str());
+
+  char const FirstBinary[]  = "first linked program";
+  char const SecondBinary[] = "second linked program";
+  CHECK_EQUAL(true, Cache.store(0x1234, FirstBinary, sizeof(FirstBinary)));
+
+  // two processes may write the same file, every store uses its own temporary file and replaces the file as a whole
+  bool IsStored[2] = { true, true };
+  std::thread Threads[2];
+  for (int i = 0; i < 2; i++)
+  {
+    Threads[i] = std::thread([&Cache, &IsStored, &FirstBinary, &SecondBinary, i]()
+    {
+      for (int Round = 0; Round < 50; Round++)
+      {
+        bool const IsFirst = ((Round + i) % 2) == 0;
+        IsStored[i] = Cache.store(0x1234, IsFirst ? FirstBinary : SecondBinary, IsFirst ? sizeof(FirstBinary) : sizeof(SecondBinary)) && IsStored[i];
+      }
+    });
+  }
+
+  unsigned int Format = 0;
+  std::vector<char> Binary;
+  for (int Round = 0; Round < 50; Round++)
+  {
+    // the file is always complete
+    CHECK_EQUAL(true, Cache.load(Format, Binary));
+    CHECK(std::string(Binary.data()) == FirstBinary || std::string(Binary.data()) == SecondBinary);
+  }
+
+  for (std::thread &rThread : Threads)
+  {
+    rThread.join();
+  }
+
+  CHECK_EQUAL(true, IsStored[0]);
+  CHECK_EQUAL(true, IsStored[1]);
+  CHECK_EQUAL(true, Cache.load(Format, Binary));
+
+  std::remove(Cache.getFileName().c_str());
+
+  return;
+}
@@ -34,6 +34,8 @@
 #include <sstream>
 #include <IrrIMGUI/IrrIMGUIDebug.h>
 #include <IrrIMGUI/IReferenceCounter.h>
+#include <IrrIMGUI/CIntrusiveReferenceCounter.h>
+#include <thread>
 
 using namespace IrrIMGUI;
 
@@ -144,3 +146,72 @@ TEST(ReferenceCounter, checkErrorWhenCounterIsWrongAtDeletion)
 
   return;
 }
+
+/// @brief An object with the inline reference counter, that reports its destruction.
+class CInlineCounted : public CIntrusiveReferenceCounter<CInlineCounted>
+{
+  public:
+    CInlineCounted(bool * const pIsDestroyed):
+      mpIsDestroyed(pIsDestroyed)
+    {
+      *mpIsDestroyed = false;
+    }
+
+    ~CInlineCounted(void)
+    {
+      *mpIsDestroyed = true;
+    }
+
+  private:
+    bool * const mpIsDestroyed;
+};
+
+TEST(ReferenceCounter, checkInlineCounter)
+{
+  bool IsDestroyed = false;
+  CInlineCounted * const pTestCounter = new CInlineCounted(&IsDestroyed);
+
+  CHECK_EQUAL(1, pTestCounter->getReferenceCount());
+
+  pTestCounter->grab();
+  pTestCounter->grab();
+  CHECK_EQUAL(3, pTestCounter->getReferenceCount());
+
+  CHECK_EQUAL(false, pTestCounter->drop());
+  CHECK_EQUAL(false, pTestCounter->drop());
+  CHECK_EQUAL(1, pTestCounter->getReferenceCount());
+  CHECK_EQUAL(false, IsDestroyed);
+
+  CHECK_EQUAL(true, pTestCounter->drop());
+  CHECK_EQUAL(true, IsDestroyed);
+
+  return;
+}
+
+static void grabAndDrop(IReferenceCounter * const pTestCounter)
+{
+  for (int i = 0; i < 10000; i++)
+  {
+    pTestCounter->grab();
+    pTestCounter->drop();
+  }
+  return;
+}
+
+TEST(ReferenceCounter, checkCounterFromSeveralThreads)
+{
+  IReferenceCounter * const pTestCounter = new IReferenceCounter;
+
+  std::thread Thread1(grabAndDrop, pTestCounter);
+  std::thread Thread2(grabAndDrop, pTestCounter);
+  std::thread Thread3(grabAndDrop, pTestCounter);
+  grabAndDrop(pTestCounter);
+  Thread1.join();
+  Thread2.join();
+  Thread3.join();
+
+  CHECK_EQUAL(1, pTestCounter->getReferenceCount());
+  pTestCounter->drop();
+
+  return;
+}
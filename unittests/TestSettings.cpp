@@ -55,8 +55,6 @@ TEST_GROUP(TestIMGUISettings)
 
 TEST(TestIMGUISettings, checkIfMouseCursorEnableIsApplied)
 {
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
   SIMGUISettings Settings;
 
@@ -64,6 +62,7 @@ TEST(TestIMGUISettings, checkIfMouseCursorEnableIsApplied)
     Settings.mIsGUIMouseCursorEnabled = false;
 
     IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+    ImGuiIO &rIMGUI = ImGui::GetIO();
 
     CHECK_EQUAL(false, rIMGUI.MouseDrawCursor);
     CHECK_EQUAL(true,  pDevice->getCursorControl()->isVisible());
@@ -90,6 +89,7 @@ TEST(TestIMGUISettings, checkIfMouseCursorEnableIsApplied)
     Settings.mIsGUIMouseCursorEnabled = true;
 
     IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+    ImGuiIO &rIMGUI = ImGui::GetIO();
 
     CHECK_EQUAL(true,  rIMGUI.MouseDrawCursor);
     CHECK_EQUAL(false, pDevice->getCursorControl()->isVisible());
@@ -122,8 +122,6 @@ TEST(TestIMGUISettings, checkIfMemoryTrackingSettingsAreApplied)
   std::stringstream ErrorString;
   Debug::ErrorOutput.rdbuf(ErrorString.rdbuf());
 
-  ImGuiIO &rIMGUI = ImGui::GetIO();
-
   irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
   SIMGUISettings Settings;
 
@@ -133,13 +131,16 @@ TEST(TestIMGUISettings, checkIfMemoryTrackingSettingsAreApplied)
 
     IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
 
-    // allocate IMGUI memory for 100 integer values.
-    ImVector<int> Values;
-    Values.resize(100);
+    // allocate IMGUI memory for 100 integer values inside the context of the handle.
+    void (* const pFreeFunction)(void *) = ImGui::GetIO().MemFreeFn;
+    void * const pValues = ImGui::MemAlloc(100 * sizeof(int));
 
     // This will shutdown IMGUI, thus with enabled tracking an Error is thrown.
     pGUI->drop();
 
+    // the context of the handle does not exist anymore, thus free the memory directly
+    pFreeFunction(pValues);
+
     CHECK_NOT_EQUAL(std::string::npos, ErrorString.str().find("{IrrIMGUI} There are 1 allocated memory blocks that have not been deallocated so far!"));
   }
 
@@ -149,13 +150,16 @@ TEST(TestIMGUISettings, checkIfMemoryTrackingSettingsAreApplied)
 
     IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
 
-    // allocate IMGUI memory for 100 integer values.
-    ImVector<int> Values;
-    Values.resize(100);
+    // allocate IMGUI memory for 100 integer values inside the context of the handle.
+    void (* const pFreeFunction)(void *) = ImGui::GetIO().MemFreeFn;
+    void * const pValues = ImGui::MemAlloc(100 * sizeof(int));
 
     // This will shutdown IMGUI, thus with enabled tracking an Error is thrown.
     pGUI->drop();
 
+    // the context of the handle does not exist anymore, thus free the memory directly
+    pFreeFunction(pValues);
+
     CHECK(std::string::npos == ErrorString.str().find("{IrrIMGUI} There are 1 allocated memory blocks that have not been deallocated so far!"));
   }
 
@@ -169,13 +173,16 @@ TEST(TestIMGUISettings, checkIfMemoryTrackingSettingsAreApplied)
 
     pGUI->setSettings(Settings);
 
-    // allocate IMGUI memory for 100 integer values.
-    ImVector<int> Values;
-    Values.resize(100);
+    // allocate IMGUI memory for 100 integer values inside the context of the handle.
+    void (* const pFreeFunction)(void *) = ImGui::GetIO().MemFreeFn;
+    void * const pValues = ImGui::MemAlloc(100 * sizeof(int));
 
     // This will shutdown IMGUI, thus with enabled tracking an Error is thrown.
     pGUI->drop();
 
+    // the context of the handle does not exist anymore, thus free the memory directly
+    pFreeFunction(pValues);
+
     CHECK(std::string::npos == ErrorString.str().find("{IrrIMGUI} There are 1 allocated memory blocks that have not been deallocated so far!"));
   }
 
@@ -189,13 +196,16 @@ TEST(TestIMGUISettings, checkIfMemoryTrackingSettingsAreApplied)
 
     pGUI->setSettings(Settings);
 
-    // allocate IMGUI memory for 100 integer values.
-    ImVector<int> Values;
-    Values.resize(100);
+    // allocate IMGUI memory for 100 integer values inside the context of the handle.
+    void (* const pFreeFunction)(void *) = ImGui::GetIO().MemFreeFn;
+    void * const pValues = ImGui::MemAlloc(100 * sizeof(int));
 
     // This will shutdown IMGUI, thus with enabled tracking an Error is thrown.
     pGUI->drop();
 
+    // the context of the handle does not exist anymore, thus free the memory directly
+    pFreeFunction(pValues);
+
     CHECK(std::string::npos != ErrorString.str().find("{IrrIMGUI} There are 1 allocated memory blocks that have not been deallocated so far!"));
   }
 
@@ -0,0 +1,380 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestTextLayoutCache.cpp
+ * @brief Contains unit tests for the cache of text sizes and glyph quads.
+ */
+
+// library includes
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IIMGUIHandle.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUIDebug.h>
+#include <IMGUI/imgui_internal.h>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+using namespace IrrIMGUI;
+
+TEST_GROUP(TestTextLayoutCache)
+{
+  std::streambuf *  mpNoteStreamBuffer;
+  std::stringstream mNoteOutput;
+
+  TEST_SETUP()
+  {
+    mpNoteStreamBuffer = Debug::NoteOutput.rdbuf();
+    Debug::NoteOutput.rdbuf(mNoteOutput.rdbuf());
+  }
+
+  TEST_TEARDOWN()
+  {
+    Debug::NoteOutput.rdbuf(mpNoteStreamBuffer);
+  }
+
+  /// @brief Draws static labels, a changing value, a wrapped text, a moving window and a window, that clips its last lines.
+  static void drawLabels(int const Frame)
+  {
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiSetCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(300.0f, 400.0f), ImGuiSetCond_Always);
+    ImGui::Begin("Labels");
+    ImGui::Text("Static label");
+    ImGui::Text("%s", "Formatted label");
+    ImGui::Text("Value %d", 42);
+    ImGui::Text("Frame %d", Frame);
+    ImGui::TextWrapped("A long text, that is wrapped into several lines, since it does not fit into the window.");
+    ImGui::Button("Button");
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f + 7.5f * static_cast<float>(Frame), 420.0f), ImGuiSetCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(300.0f, 100.0f), ImGuiSetCond_Always);
+    ImGui::Begin("Moving");
+    ImGui::Text("A label, that moves with its window");
+    ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 0.5f + 0.1f * static_cast<float>(Frame % 3)), "A label, that changes its color");
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(320.0f, 10.0f), ImGuiSetCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(100.0f, 80.0f), ImGuiSetCond_Always);
+    ImGui::Begin("Clipped");
+    for(int i = 0; i < 10; i++)
+    {
+      ImGui::Text("Clipped line %d", i);
+    }
+    ImGui::End();
+
+    return;
+  }
+
+  /// @return Returns the vertices of all draw lists of the last frame.
+  static std::vector<ImDrawVert> getVertices(void)
+  {
+    std::vector<ImDrawVert> Vertices;
+    ImDrawData const * const pDrawData = ImGui::GetDrawData();
+    for(int i = 0; i < pDrawData->CmdListsCount; i++)
+    {
+      ImVector<ImDrawVert> const &rBuffer = pDrawData->CmdLists[i]->VtxBuffer;
+      Vertices.insert(Vertices.end(), rBuffer.begin(), rBuffer.end());
+    }
+    return Vertices;
+  }
+
+  /// @brief Checks, that both vertex lists describe the same triangles. Cached positions may differ in their last bits.
+  static void checkEqualVertices(std::vector<ImDrawVert> const &rExpected, std::vector<ImDrawVert> const &rActual)
+  {
+    CHECK_EQUAL(rExpected.size(), rActual.size());
+    for(size_t i = 0; i < rExpected.size(); i++)
+    {
+      CHECK(std::fabs(rExpected[i].pos.x - rActual[i].pos.x) < 0.001f);
+      CHECK(std::fabs(rExpected[i].pos.y - rActual[i].pos.y) < 0.001f);
+      CHECK(rExpected[i].uv.x == rActual[i].uv.x);
+      CHECK(rExpected[i].uv.y == rActual[i].uv.y);
+      CHECK_EQUAL(rExpected[i].col, rActual[i].col);
+    }
+    return;
+  }
+};
+
+TEST(TestTextLayoutCache, checkCachedTextsAreEqual)
+{
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGuiIO const &rGUIIO = ImGui::GetIO();
+
+  // the first frames place the windows
+  for(int Frame = 0; Frame < 5; Frame++)
+  {
+    pGUI->startGUI();
+    drawLabels(Frame);
+    pGUI->drawAll();
+  }
+
+  std::vector<std::vector<ImDrawVert>> ExpectedVertices;
+  for(int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    drawLabels(Frame);
+    pGUI->drawAll();
+    ExpectedVertices.push_back(getVertices());
+    CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutHits);
+    CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutMisses);
+  }
+
+  Settings.mTextLayoutCacheSize = 100;
+  pGUI->setSettings(Settings);
+  for(int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    drawLabels(Frame);
+    pGUI->drawAll();
+
+    checkEqualVertices(ExpectedVertices[Frame], getVertices());
+    if(Frame == 0)
+    {
+      CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutHits);
+    }
+    else
+    {
+      // only the frame number and the clipped lines are laid out again
+      CHECK(rGUIIO.MetricsTextLayoutHits > rGUIIO.MetricsTextLayoutMisses);
+    }
+    CHECK(rGUIIO.MetricsTextLayoutEntries > 0);
+    CHECK(rGUIIO.MetricsTextLayoutEntries <= 100);
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestTextLayoutCache, checkCacheSize)
+{
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+  Settings.mTextLayoutCacheSize = 3;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGuiIO const &rGUIIO = ImGui::GetIO();
+
+  for(int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    for(int i = 0; i < 10; i++)
+    {
+      ImGui::Text("Label %d", i);
+    }
+    pGUI->drawAll();
+  }
+
+  // texts without free entry are not cached
+  CHECK_EQUAL(3, rGUIIO.MetricsTextLayoutEntries);
+  CHECK(rGUIIO.MetricsTextLayoutHits > 0);
+  CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutMisses);
+
+  // texts, that are not drawn anymore, give their entries to other texts
+  for(int Frame = 0; Frame < 2; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Text("Other label");
+    pGUI->drawAll();
+  }
+  CHECK(rGUIIO.MetricsTextLayoutEntries <= 3);
+  CHECK(rGUIIO.MetricsTextLayoutHits > 0);
+
+  Settings.mTextLayoutCacheSize = 0;
+  pGUI->setSettings(Settings);
+  pGUI->startGUI();
+  ImGui::Text("Other label");
+  pGUI->drawAll();
+  CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutEntries);
+  CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutHits);
+  CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutMisses);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestTextLayoutCache, checkCompiledFontsInvalidateCache)
+{
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+  Settings.mTextLayoutCacheSize = 100;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGuiIO const &rGUIIO = ImGui::GetIO();
+
+  for(int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Text("Static label");
+    pGUI->drawAll();
+  }
+  CHECK(rGUIIO.MetricsTextLayoutHits > 0);
+  CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutMisses);
+
+  // the glyphs of a compiled atlas may have other texture coordinates
+  unsigned int const LayoutGeneration = ImGui::GetFont()->LayoutGeneration;
+  pGUI->addFontFromFileTTF("../../media/DroidSans.ttf", 16.0f);
+  pGUI->compileFonts();
+  CHECK(ImGui::GetIO().Fonts->Fonts[0]->LayoutGeneration != LayoutGeneration);
+
+  pGUI->startGUI();
+  ImGui::Text("Static label");
+  pGUI->drawAll();
+  CHECK_EQUAL(0, rGUIIO.MetricsTextLayoutHits);
+  CHECK(rGUIIO.MetricsTextLayoutMisses > 0);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestTextLayoutCache, checkMovingTextsKeepTheirQuads)
+{
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+  ImGuiIO const &rGUIIO = ImGui::GetIO();
+
+  auto const drawMovingLabel = [](float const X, float const Y)
+  {
+    ImGui::SetNextWindowPos(ImVec2(X, Y), ImGuiSetCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(300.0f, 100.0f), ImGuiSetCond_Always);
+    ImGui::Begin("Moving");
+    ImGui::SetWindowFontScale(1.37f);
+    ImGui::Text("A label, that moves with its window");
+    ImGui::End();
+  };
+
+  for(int Frame = 0; Frame < 3; Frame++)
+  {
+    pGUI->startGUI();
+    drawMovingLabel(10.0f, 10.0f);
+    pGUI->drawAll();
+  }
+  std::vector<ImDrawVert> const ExpectedVertices = getVertices();
+
+  // the scaled glyphs have fractional positions, thus moving the cached quads themselves would accumulate rounding errors
+  Settings.mTextLayoutCacheSize = 100;
+  pGUI->setSettings(Settings);
+  for(int Frame = 0; Frame < 2000; Frame++)
+  {
+    float const Position = 10.0f + static_cast<float>(Frame * 37 % 250);
+    pGUI->startGUI();
+    drawMovingLabel(Position, Position);
+    pGUI->drawAll();
+  }
+  CHECK(rGUIIO.MetricsTextLayoutHits > 0);
+
+  // the quads have been stored at the first position, thus they are drawn there without any rounding error
+  pGUI->startGUI();
+  drawMovingLabel(10.0f, 10.0f);
+  pGUI->drawAll();
+  CHECK(rGUIIO.MetricsTextLayoutHits > 0);
+  std::vector<ImDrawVert> const Vertices = getVertices();
+  checkEqualVertices(ExpectedVertices, Vertices);
+  for(size_t i = 0; i < ExpectedVertices.size(); i++)
+  {
+    CHECK(ExpectedVertices[i].pos.x == Vertices[i].pos.x);
+    CHECK(ExpectedVertices[i].pos.y == Vertices[i].pos.y);
+  }
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
+
+TEST(TestTextLayoutCache, checkFallbackGlyphsAreNotCached)
+{
+  static ImWchar const CyrillicGlyphRanges[] = { 0x0400, 0x04FF, 0 };
+
+  std::stringstream WarningOutput;
+  std::streambuf * const pWarningBuffer = Debug::WarningOutput.rdbuf();
+  Debug::WarningOutput.rdbuf(WarningOutput.rdbuf());
+
+  SIMGUISettings Settings;
+  Settings.mBackend = EIB_NULL;
+  Settings.mTextLayoutCacheSize = 100;
+
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice, nullptr, &Settings);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  ImFont * const pFont = pGUI->addDynamicFontFromFileTTF("../../media/DroidSans.ttf", 16.0f, CyrillicGlyphRanges, 2);
+  pGUI->compileFonts();
+
+  // the first text uses both cells of the glyph cache, thus the glyph of the second text falls back
+  pGUI->startGUI();
+  ImGui::PushFont(pFont);
+  ImGui::Text("%s", "\xD0\x90\xD0\x91");
+  ImGui::Text("%s", "\xD0\x94");
+  ImGui::PopFont();
+  pGUI->drawAll();
+  CHECK_EQUAL(false, WarningOutput.str().empty());
+
+  // in the next frames the glyph gets a cell and is drawn instead of the fallback glyph
+  for(int Frame = 0; Frame < 2; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::PushFont(pFont);
+    ImGui::Text("%s", "\xD0\x94");
+    ImGui::PopFont();
+    pGUI->drawAll();
+  }
+
+  ImFont::Glyph const * const pGlyph = pFont->FindGlyph(0x0414);
+  CHECK(pGlyph != pFont->FallbackGlyph);
+
+  bool IsGlyphDrawn = false;
+  for(ImDrawVert const &rVertex : getVertices())
+  {
+    IsGlyphDrawn = IsGlyphDrawn || ((rVertex.uv.x == pGlyph->U0) && (rVertex.uv.y == pGlyph->V0));
+  }
+  CHECK(IsGlyphDrawn);
+
+  Debug::WarningOutput.rdbuf(pWarningBuffer);
+
+  pGUI->drop();
+  pDevice->drop();
+
+  return;
+}
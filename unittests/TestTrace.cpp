@@ -0,0 +1,135 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Andr Netzeband
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/**
+ * @file TestTrace.cpp
+ * @brief Contains unit tests for the Chrome trace export.
+ */
+
+// library includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <IrrIMGUI/UnitTest/UnitTest.h>
+#include <IrrIMGUI/IrrIMGUI.h>
+#include <IrrIMGUI/IrrIMGUITrace.h>
+
+using namespace IrrIMGUI;
+
+/// @brief The file, where the traces of the tests are written to.
+static char const * const TraceFileName = "TestTrace.json";
+
+/// @return Returns the content of the trace file.
+static std::string readTraceFile(void)
+{
+  std::ifstream File(TraceFileName);
+  std::stringstream Content;
+  Content << File.rdbuf();
+  return Content.str();
+}
+
+TEST_GROUP(TestTrace)
+{
+  TEST_TEARDOWN()
+  {
+    Trace::stopTracing();
+    std::remove(TraceFileName);
+  }
+};
+
+TEST(TestTrace, checkStartAndStop)
+{
+  CHECK_EQUAL(false, Trace::isTracing());
+
+  CHECK(Trace::startTracing(TraceFileName));
+  CHECK(Trace::isTracing());
+
+  // only one trace can run at the same time
+  CHECK_EQUAL(false, Trace::startTracing(TraceFileName));
+
+  Trace::stopTracing();
+  CHECK_EQUAL(false, Trace::isTracing());
+
+  std::string const Content = readTraceFile();
+  CHECK_EQUAL(0, Content.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+  CHECK(Content.find("]}") != std::string::npos);
+
+  return;
+}
+
+TEST(TestTrace, checkEventsAreOnlyRecordedWhileTracing)
+{
+  {
+    Trace::CTraceScope Scope("BeforeTrace");
+  }
+
+  CHECK(Trace::startTracing(TraceFileName));
+  {
+    Trace::CTraceScope Scope("Inside\"Trace", "value", 42);
+  }
+  Trace::stopTracing();
+
+  {
+    Trace::CTraceScope Scope("AfterTrace");
+  }
+
+  std::string const Content = readTraceFile();
+  CHECK(Content.find("BeforeTrace") == std::string::npos);
+  CHECK(Content.find("AfterTrace")  == std::string::npos);
+  CHECK(Content.find("{\"name\":\"Inside\\\"Trace\",\"cat\":\"IrrIMGUI\",\"ph\":\"X\"") != std::string::npos);
+  CHECK(Content.find("\"args\":{\"value\":42}") != std::string::npos);
+
+  return;
+}
+
+TEST(TestTrace, checkGUIFramePathIsTraced)
+{
+  irr::IrrlichtDevice * const pDevice = irr::createDevice(irr::video::EDT_NULL);
+  IIMGUIHandle * const pGUI = createIMGUI(pDevice);
+  ImGui::GetIO().IniFilename = nullptr;
+
+  CHECK(Trace::startTracing(TraceFileName));
+
+  for (int Frame = 0; Frame < 2; Frame++)
+  {
+    pGUI->startGUI();
+    ImGui::Text("Frame %d", Frame);
+    pGUI->drawAll();
+  }
+
+  Trace::stopTracing();
+
+  pGUI->drop();
+  pDevice->drop();
+
+  std::string const Content = readTraceFile();
+  CHECK(Content.find("\"name\":\"startGUI\"") != std::string::npos);
+  CHECK(Content.find("\"name\":\"NewFrame\"") != std::string::npos);
+  CHECK(Content.find("\"name\":\"Render\"")   != std::string::npos);
+  CHECK(Content.find("\"name\":\"Submit\"")   != std::string::npos);
+
+  return;
+}